@@ -179,6 +179,34 @@ typedef struct __attribute__ ((__packed__)) {
     Display_5641AS_GPIO_def_t K4;	//!< Type Definition of the GPIO peripheral port to which the K4 terminal of the 5641AS 7-segment Display device is connected to.
 } Display_5641AS_peripherals_def_t;
 
+/**@brief	Gets the equivalent of a certain number to its equivalent ASCII Numeric Characters, so that it can be
+ *          shown via the @ref set_5641as_display_output function.
+ *
+ * @details	This function is only able to get the equivalent ASCII Numeric Characters for any number greater than -10
+ *          and lower than 100, with one decimal digit at the most. Any further decimal digits are truncated.
+ *
+ * @details The number to convert is given in centi-units (e.g., 2537 stands for 25.37) so that no Floating-Point
+ *          arithmetic is required.
+ * @details The \p dst param is expected to have a length of 3 bytes. In the first byte of the \p dst param, the value
+ *          of the tens digit from the \p src param is going to be stored, if there is any. The value of the ones digit
+ *          from the \p src param is going to be stored in the second byte of the \p dst param. Finally, the value of
+ *          the tenths digit (i.e., the decimal digit) of the \p src param is going to be stored in the third byte of
+ *          the \p dst param.
+ *
+ * @param src     Number to convert, in centi-units.
+ * @param[out] dst  Pointer to the array into which the equivalent ASCII Numeric Characters will be stored.
+ *
+ * @retval  Display_5641AS_EC_OK    If the given number to convert is greater than -10 and lower than 100 and if its
+ *                                  conversion was successfully made and retrieved.
+ * @retval  Display_5641AS_EC_ERR   If this function did not attempted to get or convert the requested number due to
+ *                                  either being equal or lower than -10, or equal or greater than 100.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	March 26, 2024
+ * @date	LAST UPDATE: October 16, 2026.
+ */
+Display_5641AS_Status convert_number_to_5641as_ASCII(int32_t src, uint16_t *dst);
+
 /**@brief	Gets the ASCII characters that are expected to be currently shown at the 5641AS 7-segment Display Device.
  *
  * @param[out] display_output   Pointer towards where ASCII characters expected to be currently shown at the 5641AS
@@ -233,6 +233,28 @@ void start_etx_ota();
  */
 void stop_etx_ota();
 
+/**@brief	Sends some desired data back to the host as a single ETX OTA Data Type Packet (e.g., the reply to an ETX OTA
+ *          Custom Data that requested some information from our MCU/MPU).
+ *
+ * @details The sent Packet follows the General Data Format of the ETX OTA Packets, where its 32-bit CRC is calculated
+ *          with respect to the given data only. Unlike the ETX OTA Transactions, the host is not expected to respond
+ *          to this Packet.
+ *
+ * @note    This function should only be called while there is no on-going ETX OTA Transaction (e.g., from the
+ *          @ref etx_ota_status_resp_handler function or after it).
+ *
+ * @param[in] data  Pointer to the data that wants to be sent.
+ * @param size      Length in bytes of the \p data param, which must be from 1 up to 64 bytes.
+ *
+ * @retval  ETX_OTA_EC_OK
+ * @retval  ETX_OTA_EC_NR   If the Hardware Protocol could not send the Packet within @ref ETX_CUSTOM_HAL_TIMEOUT .
+ * @retval  ETX_OTA_EC_ERR  If the \p size param is out of range or if the Hardware Protocol has failed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+ETX_OTA_Status send_etx_ota_custom_data_reply(uint8_t *data, uint16_t size);
+
 /**@brief	Callback function before an ETX OTA Transaction with the host machine is about to give place.
  *
  * @details	This main purpose for providing this function is so that the implementer can use it to override it from
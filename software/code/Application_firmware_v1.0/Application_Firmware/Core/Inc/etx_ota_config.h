@@ -75,7 +75,7 @@
 #endif
 
 #ifndef ETX_APP_FLASH_PAGES_SIZE
-#define ETX_APP_FLASH_PAGES_SIZE 			(88U)   			/**< @brief Designated Flash Memory pages for the Application Firmware of our MCU/MPU. */
+#define ETX_APP_FLASH_PAGES_SIZE 			(62U)   			/**< @brief Designated Flash Memory pages for the Application Firmware of our MCU/MPU. @note The 26 Flash Memory pages that follow them (i.e., from 0x08017800 up to 0x0801DFFF) are used by the Telemetry Archive and the Temperature Sensors Calibration modules of the Application Firmware, so they must not be erased whenever a new Application Firmware Image is installed. */
 #endif
 
 /* NOTE: The UART configurations such as its Baud rate, the Data-bits, the Parity, the Stop-bit and whether the Flow
@@ -86,7 +86,7 @@
 #endif
 
 #ifndef ETX_CUSTOM_HAL_TIMEOUT
-#define ETX_CUSTOM_HAL_TIMEOUT				(9000U)				/**< @brief Designated time in milliseconds for the HAL Timeout to be requested during each FLASH and UART request where the ETX OTA protocol is to be used on. @note For more details see @ref FLASH_WaitForLastOperation and @ref HAL_UART_Receive . */
+#define ETX_CUSTOM_HAL_TIMEOUT				(1000U)				/**< @brief Designated time in milliseconds for the HAL Timeout to be requested during each FLASH and UART request where the ETX OTA protocol is to be used on. @note For more details see @ref FLASH_WaitForLastOperation and @ref HAL_UART_Receive . @note Since the ETX OTA Transactions are handled inside the UART Interrupt, where the Independent Watchdog is not reloaded, this value must be shorter than the shortest actual timeout of that Watchdog (see @ref WATCHDOG_TIMEOUT ), so that a host that stops sending in the middle of a Transaction makes it fail instead of resetting our MCU/MPU. */
 #endif
 
 /** @} */ //default_etx_ota_settings
@@ -0,0 +1,173 @@
+/**@file
+ * @brief	Fault Manager Header file.
+ *
+ * @defgroup fault_manager Fault Manager module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a central
+ *          manager of the faults of the MTKATR001 System with the purpose of being used by the application.
+ *
+ * @details The way that the @ref fault_manager works is that the application defines each fault that it wants to be
+ *          managed via a @ref fault_def_t (i.e., its Exception Code, whether it is latched or not, how many times it
+ *          may recover before being latched and which capabilities of the application are lost while it is active)
+ *          and then periodically reports whether the condition of each fault is present or not via the
+ *          @ref set_fault_condition function. A fault becomes active as soon as its condition is reported to be
+ *          present and:
+ *          <ul>
+ *              <li>If the fault is latched, then it stays active until our MCU/MPU is reset.</li>
+ *              <li>If the fault is not latched, then it is cleared once its condition has been reported to be absent
+ *                  during @ref fault_def_t::clear_time milliseconds. However, if it becomes active again more than
+ *                  @ref fault_def_t::max_retries times, then it is latched anyway. This retry counter is restarted
+ *                  once the fault has stayed cleared during @ref FAULT_MANAGER_RETRY_RESET_TIME milliseconds.</li>
+ *          </ul>
+ * @details The application can then know its current degraded mode via the @ref get_fault_manager_lost_capabilities
+ *          function, which gives the bitwise OR of the capabilities lost by all the active faults, so that it only
+ *          turns Off what is actually affected. In addition, each time that a fault is raised, cleared or latched, an
+ *          event is recorded into a ring buffer of @ref FAULT_MANAGER_HISTORY_SIZE entries whose oldest entries are
+ *          overwritten once it is full.
+ *
+ * @note    The functions of this module must only be called from a single context (e.g., from the tasks of the
+ *          @ref task_scheduler ). Interrupts that detect a fault should only force their actuators into a safe state
+ *          and leave the fault to be reported from that context.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef FAULT_MANAGER_H_
+#define FAULT_MANAGER_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define FAULT_MANAGER_MAX_FAULTS            (16)        /**< @brief Maximum number of faults that can be managed by the @ref fault_manager . */
+#define FAULT_MANAGER_HISTORY_SIZE          (16)        /**< @brief Number of events that the history of the @ref fault_manager can hold. @note This value must be a power of two and lower than 256. */
+#define FAULT_MANAGER_RETRY_RESET_TIME      (3600000)   /**< @brief Time in milliseconds during which a non-latched fault must stay cleared so that its retry counter is restarted. */
+
+/**@brief	Fault Manager Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref fault_manager to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    FAULT_MANAGER_EC_OK         = 0U,   //!< Fault Manager Process was successful.
+    FAULT_MANAGER_EC_ERR        = 4U,   //!< Fault Manager Process has failed.
+    FAULT_MANAGER_EC_NO_DATA    = 6U    //!< Fault Manager Process could not get the requested history entry because it has not been recorded.
+} Fault_Manager_Status;
+
+/**@brief	Types of the events that are recorded into the history of the @ref fault_manager .
+ */
+typedef enum
+{
+    FAULT_EVENT_RAISED      = 0U,   //!< The fault has become active.
+    FAULT_EVENT_CLEARED     = 1U,   //!< The non-latched fault has been cleared.
+    FAULT_EVENT_LATCHED     = 2U    //!< The non-latched fault has exceeded its retries and has been latched.
+} Fault_Event_Type;
+
+/**@brief	Fault definition parameters structure.
+ */
+typedef struct
+{
+    uint8_t code;                       //!< Exception Code of the fault. @note This value must be different than zero and unique among the faults given to the @ref fault_manager .
+    uint8_t is_latched;                 //!< Flag that indicates whether the fault stays active until our MCU/MPU is reset (i.e., 1) or whether it can be cleared (i.e., 0).
+    uint8_t max_retries;                //!< Number of times that a non-latched fault may become active again, after having been cleared, before it is latched.
+    uint32_t clear_time;                //!< Time in milliseconds during which the condition of a non-latched fault must be reported to be absent before the fault is cleared.
+    uint32_t lost_capabilities;         //!< Bitmask, defined by the application, of the capabilities that are lost while the fault is active.
+} fault_def_t;
+
+/**@brief	Fault history entry structure.
+ */
+typedef struct
+{
+    uint32_t tick;                      //!< Tick, in milliseconds, at which the event was recorded.
+    uint8_t code;                       //!< Exception Code of the fault of the event.
+    Fault_Event_Type event;             //!< Type of the event.
+} fault_history_entry_t;
+
+/**@brief   Reports whether the condition of a fault of the @ref fault_manager is currently present or not, and raises,
+ *          clears or latches that fault accordingly.
+ *
+ * @param code          Exception Code of the fault.
+ * @param is_present    1 if the condition of the fault is currently present or 0 otherwise.
+ * @param tick          Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @retval  FAULT_MANAGER_EC_OK
+ * @retval  FAULT_MANAGER_EC_ERR    If the \p code param does not stand for any of the managed faults.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Fault_Manager_Status set_fault_condition(uint8_t code, uint8_t is_present, uint32_t tick);
+
+/**@brief   Gets whether a fault of the @ref fault_manager is currently active or not.
+ *
+ * @param code  Exception Code of the fault.
+ *
+ * @retval  1   If the fault is currently active.
+ * @retval  0   If the fault is not currently active or if the \p code param does not stand for any of the managed
+ *              faults.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint8_t is_fault_active(uint8_t code);
+
+/**@brief   Gets the capabilities that are currently lost due to the active faults of the @ref fault_manager .
+ *
+ * @return  The bitwise OR of the @ref fault_def_t::lost_capabilities of all the currently active faults.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_fault_manager_lost_capabilities(void);
+
+/**@brief   Gets the most recently raised fault of the @ref fault_manager that is still active.
+ *
+ * @return  The Exception Code of that fault, or zero if there are currently no active faults.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint8_t get_latest_active_fault(void);
+
+/**@brief   Gets the number of events that have been recorded into the history of the @ref fault_manager since it was
+ *          initialized, including the ones that have already been overwritten.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_fault_history_total_events(void);
+
+/**@brief   Gets an event from the history of the @ref fault_manager .
+ *
+ * @param index         Index of the desired event, where zero stands for the most recent one.
+ * @param[out] entry    Pointer to the structure into which the event will be written.
+ *
+ * @retval  FAULT_MANAGER_EC_OK
+ * @retval  FAULT_MANAGER_EC_NO_DATA    If the \p index param is greater than or equal to the number of events that
+ *                                      the history currently holds, in which case the \p entry param is left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Fault_Manager_Status get_fault_history_entry(uint8_t index, fault_history_entry_t *entry);
+
+/**@brief   Initializes the @ref fault_manager with the desired faults, all of them cleared, and with an empty history.
+ *
+ * @param[in] faults        Pointer to the array of definitions of the faults, which must remain valid while the
+ *                          @ref fault_manager is in use.
+ * @param total_faults      Number of faults in the \p faults param, which must be between 1 and
+ *                          @ref FAULT_MANAGER_MAX_FAULTS .
+ *
+ * @retval  FAULT_MANAGER_EC_OK
+ * @retval  FAULT_MANAGER_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Fault_Manager_Status init_fault_manager(const fault_def_t *faults, uint8_t total_faults);
+
+#endif /* FAULT_MANAGER_H_ */
+
+/** @} */
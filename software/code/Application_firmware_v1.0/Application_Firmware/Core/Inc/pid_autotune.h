@@ -0,0 +1,173 @@
+/**@file
+ * @brief	Relay-Feedback PID Auto-Tuner Header file.
+ *
+ * @defgroup pid_autotune Relay-Feedback PID Auto-Tuner module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as an
+ *          Åström–Hägglund Relay-Feedback Auto-Tuner for the gains of a @ref pid_controller with the purpose of being
+ *          used by the application.
+ *
+ * @details The way that the @ref pid_autotune works is that, once started via the @ref start_pid_autotune function,
+ *          the implementer has to call the @ref run_pid_autotune function periodically, instead of the
+ *          @ref run_pid_controller function, and apply its output to the actuators. That output is a relay of amplitude
+ *          \f$d\f$ with hysteresis around the setpoint (i.e., \f$+d\f$ until the measurement rises above the setpoint
+ *          plus the hysteresis and \f$-d\f$ until it falls below the setpoint minus the hysteresis), which makes the
+ *          controlled variable oscillate in a limit cycle at the Ultimate Period \f$P_u\f$ of the process.
+ * @details The first oscillation cycle is discarded, since it contains the initial transient, and the peak-to-peak
+ *          amplitude and the period of the following @ref pid_autotune_config_t::cycles cycles are averaged. From the
+ *          resulting amplitude \f$a\f$ of the measurement, the Ultimate Gain is calculated as
+ *          \f$K_u = \frac{4 d}{\pi a}\f$ and the PID gains are then calculated with the classic Ziegler–Nichols rules
+ *          (i.e., \f$K_p = 0.6 K_u\f$ , \f$K_i = \frac{2 K_p}{P_u}\f$ and \f$K_d = \frac{K_p P_u}{8}\f$ ), which can be
+ *          retrieved via the @ref get_pid_autotune_result function.
+ *
+ * @note    All the calculations are made in Fixed-Point arithmetic and the resulting gains are given in the same Q16
+ *          Fixed-Point format and units that are used by the @ref pid_controller .
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef PID_AUTOTUNE_H_
+#define PID_AUTOTUNE_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "pid_controller.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Fixed-Point PID Controller.
+
+#define PID_AUTOTUNE_MAX_CYCLES         (8)         /**< @brief Maximum number of oscillation cycles that the @ref pid_autotune can average. */
+
+/**@brief	Relay-Feedback PID Auto-Tuner Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref pid_autotune to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    PID_AUTOTUNE_EC_OK      = 0U,    //!< Relay-Feedback PID Auto-Tuner Process was successful.
+    PID_AUTOTUNE_EC_ERR     = 4U     //!< Relay-Feedback PID Auto-Tuner Process has failed.
+} PID_Autotune_Status;
+
+/**@brief	Relay-Feedback PID Auto-Tuner States.
+ */
+typedef enum
+{
+    PID_AUTOTUNE_IDLE       = 0U,    //!< The Auto-Tuner has not been started or it has been stopped.
+    PID_AUTOTUNE_RUNNING    = 1U,    //!< The Auto-Tuner is applying the relay and measuring the oscillation cycles.
+    PID_AUTOTUNE_DONE       = 2U,    //!< The Auto-Tuner has finished successfully and its result is available.
+    PID_AUTOTUNE_FAILED     = 3U     //!< The Auto-Tuner has timed out or the measured oscillation was not valid.
+} PID_Autotune_State;
+
+/**@brief	Relay-Feedback PID Auto-Tuner Configuration parameters structure.
+ */
+typedef struct
+{
+    int32_t setpoint;                   //!< Value around which the controlled variable will be made to oscillate.
+    int32_t relay_amplitude;            //!< Amplitude \f$d\f$ of the relay, in output units. @note This value must be greater than zero.
+    int32_t hysteresis;                 //!< Hysteresis of the relay, in measurement units, which must be greater than the noise of the measurement. @note This value must not be negative.
+    uint8_t cycles;                     //!< Number of oscillation cycles that are averaged after the first one. @note This value must be between 1 and @ref PID_AUTOTUNE_MAX_CYCLES .
+    uint32_t timeout;                   //!< Time in milliseconds after which the Auto-Tuner fails if it has not finished yet.
+} pid_autotune_config_t;
+
+/**@brief	Relay-Feedback PID Auto-Tuner Result structure.
+ */
+typedef struct
+{
+    int32_t ku;                         //!< Ultimate Gain in Q16 Fixed-Point format, in output units per measurement unit.
+    uint32_t pu;                        //!< Ultimate Period in milliseconds.
+    int32_t kp;                         //!< Proportional gain (see @ref pid_controller_config_t::kp ).
+    int32_t ki;                         //!< Integral gain (see @ref pid_controller_config_t::ki ).
+    int32_t kd;                         //!< Derivative gain (see @ref pid_controller_config_t::kd ).
+} pid_autotune_result_t;
+
+/**@brief	Relay-Feedback PID Auto-Tuner Instance structure.
+ *
+ * @details This holds the state of one Auto-Tuner, which is populated by the functions of the @ref pid_autotune .
+ */
+typedef struct
+{
+    pid_autotune_config_t config;       //!< Configuration with which the Auto-Tuner was started.
+    PID_Autotune_State state;           //!< Current state of the Auto-Tuner.
+    int32_t output;                     //!< Current output of the relay.
+    uint32_t start_tick;                //!< Tick, in milliseconds, at which the Auto-Tuner was started.
+    uint32_t cycle_start_tick;          //!< Tick, in milliseconds, at which the current oscillation cycle started.
+    int32_t cycle_max;                  //!< Highest measurement of the current oscillation cycle.
+    int32_t cycle_min;                  //!< Lowest measurement of the current oscillation cycle.
+    uint8_t positive_switches;          //!< Number of times that the relay has switched into its positive output, where each oscillation cycle goes from one of those switches to the next one.
+    uint32_t periods_sum;               //!< Sum of the periods, in milliseconds, of the averaged oscillation cycles.
+    int32_t peak_to_peak_sum;           //!< Sum of the peak-to-peak amplitudes of the averaged oscillation cycles.
+    pid_autotune_result_t result;       //!< Result of the Auto-Tuner, which is only valid in the @ref PID_AUTOTUNE_DONE state.
+} pid_autotune_t;
+
+/**@brief   Executes one period of an Auto-Tuner of the @ref pid_autotune .
+ *
+ * @details Once the required oscillation cycles have been measured, the Auto-Tuner moves into the
+ *          @ref PID_AUTOTUNE_DONE state. However, if the timeout of the Auto-Tuner expires first or if the measured
+ *          oscillation was not valid, then it moves into the @ref PID_AUTOTUNE_FAILED state. In both cases, the output
+ *          returned from then on is zero.
+ *
+ * @param[in,out] autotune  Pointer to the Auto-Tuner, previously started via @ref start_pid_autotune , that wants to
+ *                          be executed.
+ * @param measurement       Current value of the controlled variable.
+ * @param tick              Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @return  The output of the relay that is to be applied to the actuators, which is either plus or minus the
+ *          @ref pid_autotune_config_t::relay_amplitude while the Auto-Tuner is running, or zero otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+int32_t run_pid_autotune(pid_autotune_t *autotune, int32_t measurement, uint32_t tick);
+
+/**@brief   Gets the current state of an Auto-Tuner of the @ref pid_autotune .
+ *
+ * @param[in] autotune  Pointer to the Auto-Tuner whose state wants to be obtained.
+ *
+ * @return  The current @ref PID_Autotune_State of the \p autotune param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+PID_Autotune_State get_pid_autotune_state(const pid_autotune_t *autotune);
+
+/**@brief   Gets the result of an Auto-Tuner of the @ref pid_autotune that has finished successfully.
+ *
+ * @param[in] autotune  Pointer to the Auto-Tuner whose result wants to be obtained.
+ * @param[out] result   Pointer to the structure into which the result will be written.
+ *
+ * @retval  PID_AUTOTUNE_EC_OK  If the \p autotune param is in the @ref PID_AUTOTUNE_DONE state.
+ * @retval  PID_AUTOTUNE_EC_ERR Otherwise, in which case the \p result param is left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+PID_Autotune_Status get_pid_autotune_result(const pid_autotune_t *autotune, pid_autotune_result_t *result);
+
+/**@brief   Stops an Auto-Tuner of the @ref pid_autotune , which moves it into the @ref PID_AUTOTUNE_IDLE state.
+ *
+ * @param[in,out] autotune  Pointer to the Auto-Tuner that wants to be stopped.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void stop_pid_autotune(pid_autotune_t *autotune);
+
+/**@brief   Starts an Auto-Tuner of the @ref pid_autotune with a desired configuration.
+ *
+ * @param[out] autotune Pointer to the Auto-Tuner that wants to be started.
+ * @param[in] config    Pointer to the desired configuration for the \p autotune param.
+ * @param measurement   Current value of the controlled variable, which defines the initial direction of the relay.
+ * @param tick          Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @retval  PID_AUTOTUNE_EC_OK  If the Auto-Tuner was successfully started.
+ * @retval  PID_AUTOTUNE_EC_ERR If the \p config param has any invalid value, in which case the \p autotune param is
+ *                              left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+PID_Autotune_Status start_pid_autotune(pid_autotune_t *autotune, const pid_autotune_config_t *config, int32_t measurement, uint32_t tick);
+
+#endif /* PID_AUTOTUNE_H_ */
+
+/** @} */
@@ -0,0 +1,163 @@
+/**@file
+ * @brief	Fixed-Point PID Controller Header file.
+ *
+ * @defgroup pid_controller Fixed-Point PID Controller module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a discrete
+ *          PID Controller in Fixed-Point arithmetic with the purpose of being used by the application.
+ *
+ * @details The way that the @ref pid_controller works is that the implementer first initializes a
+ *          @ref pid_controller_t structure via the @ref init_pid_controller function with the desired gains, with the
+ *          period at which the controller will be executed and with the limits of its output. From then on, the
+ *          implementer only has to call the @ref run_pid_controller function once each period with the current
+ *          setpoint and measurement to get the output that is to be applied to the actuators.
+ * @details The gains are given in Q16 Fixed-Point format and in output units per measurement unit, so that, for
+ *          example, if the measurement is given in centi-degrees Celsius and the output is desired in centi-percent of
+ *          Duty Cycle, then a Proportional gain of 65536 stands for 1 percent of Duty Cycle per degree Celsius. In
+ *          addition, the Integral gain is given per second and the Derivative gain is given in seconds. The products of
+ *          the Integral and Derivative gains with the period of the controller are calculated only once each time that
+ *          the gains are set, so that each execution of the controller costs only a few multiplications.
+ * @details The following techniques are used to make the controller behave well in practice:<br>
+ *          <ul>
+ *              <li>The Derivative term is calculated from the measurement instead of from the error, so that a change
+ *                  in the setpoint does not cause a kick in the output.</li>
+ *              <li>The Integral term is clamped to the output limits and it is not accumulated while the output is
+ *                  saturated and the error would drive it further into saturation (i.e., conditional integration),
+ *                  so that the controller does not wind up.</li>
+ *              <li>The output is clamped to the output limits.</li>
+ *          </ul>
+ *
+ * @note    Each controlled variable must use its own @ref pid_controller_t structure.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef PID_CONTROLLER_H_
+#define PID_CONTROLLER_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define PID_CONTROLLER_Q16_SHIFT        (16)       /**< @brief Number of fractional bits of the Q16 Fixed-Point gains of the @ref pid_controller . */
+
+/**@brief	Fixed-Point PID Controller Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref pid_controller to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    PID_CONTROLLER_EC_OK      = 0U,    //!< Fixed-Point PID Controller Process was successful.
+    PID_CONTROLLER_EC_ERR     = 4U     //!< Fixed-Point PID Controller Process has failed.
+} PID_Controller_Status;
+
+/**@brief	Fixed-Point PID Controller Configuration parameters structure.
+ */
+typedef struct
+{
+    int32_t kp;                         //!< Proportional gain in Q16 Fixed-Point format, in output units per measurement unit. @note This value must not be negative.
+    int32_t ki;                         //!< Integral gain in Q16 Fixed-Point format, in output units per measurement unit and per second. @note This value must not be negative.
+    int32_t kd;                         //!< Derivative gain in Q16 Fixed-Point format, in output units per measurement unit and multiplied by seconds. @note This value must not be negative.
+    uint32_t sample_period;             //!< Period, in milliseconds, at which the @ref run_pid_controller function will be called.
+    int32_t output_min;                 //!< Lowest value that the output of the controller may have.
+    int32_t output_max;                 //!< Highest value that the output of the controller may have.
+} pid_controller_config_t;
+
+/**@brief	Fixed-Point PID Controller Instance structure.
+ *
+ * @details This holds the state of one controller, which is populated by the functions of the @ref pid_controller .
+ */
+typedef struct
+{
+    int32_t kp;                         //!< Proportional gain in Q16 Fixed-Point format.
+    int64_t ki_times_period;            //!< Integral gain multiplied by the period of the controller in seconds, in Q16 Fixed-Point format.
+    int64_t kd_over_period;             //!< Derivative gain divided by the period of the controller in seconds, in Q16 Fixed-Point format.
+    uint32_t sample_period;             //!< Period, in milliseconds, at which the @ref run_pid_controller function is called.
+    int32_t output_min;                 //!< Lowest value that the output of the controller may have.
+    int32_t output_max;                 //!< Highest value that the output of the controller may have.
+    int64_t integral;                   //!< Integral term, in output units and in Q16 Fixed-Point format.
+    int32_t previous_measurement;       //!< Measurement given in the previous execution of the controller.
+    int32_t output;                     //!< Latest output of the controller.
+    uint8_t is_primed;                  //!< Flag that indicates whether the controller has already been executed at least once since its last reset (1) or not (0).
+} pid_controller_t;
+
+/**@brief   Executes one period of a controller of the @ref pid_controller .
+ *
+ * @param[in,out] pid   Pointer to the controller, previously initialized via @ref init_pid_controller , that wants to
+ *                      be executed.
+ * @param setpoint      Desired value for the controlled variable.
+ * @param measurement   Current value of the controlled variable, in the same units as the \p setpoint param.
+ *
+ * @return  The output of the controller, which is always between the output limits of the \p pid param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+int32_t run_pid_controller(pid_controller_t *pid, int32_t setpoint, int32_t measurement);
+
+/**@brief   Clears the Integral and Derivative terms of a controller of the @ref pid_controller , so that it starts
+ *          again from scratch the next time that it is executed.
+ *
+ * @param[in,out] pid   Pointer to the controller that wants to be reset.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void reset_pid_controller(pid_controller_t *pid);
+
+/**@brief   Changes the output limits of a controller of the @ref pid_controller .
+ *
+ * @details The Integral term of the controller is clamped to the new output limits, if needed.
+ *
+ * @param[in,out] pid   Pointer to the controller whose output limits want to be changed.
+ * @param output_min    Lowest value that the output of the controller may have.
+ * @param output_max    Highest value that the output of the controller may have.
+ *
+ * @retval  PID_CONTROLLER_EC_OK    If the output limits were successfully changed.
+ * @retval  PID_CONTROLLER_EC_ERR   If the \p output_min param is greater than the \p output_max param, in which case
+ *                                  the controller is left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+PID_Controller_Status set_pid_controller_output_limits(pid_controller_t *pid, int32_t output_min, int32_t output_max);
+
+/**@brief   Changes the gains of a controller of the @ref pid_controller .
+ *
+ * @details The Integral term accumulated so far is kept, so that the output does not jump because of the change.
+ *
+ * @param[in,out] pid   Pointer to the controller whose gains want to be changed.
+ * @param kp            Proportional gain (see @ref pid_controller_config_t::kp ).
+ * @param ki            Integral gain (see @ref pid_controller_config_t::ki ).
+ * @param kd            Derivative gain (see @ref pid_controller_config_t::kd ).
+ *
+ * @retval  PID_CONTROLLER_EC_OK    If the gains were successfully changed.
+ * @retval  PID_CONTROLLER_EC_ERR   If any of the given gains is negative, in which case the controller is left
+ *                                  unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+PID_Controller_Status set_pid_controller_gains(pid_controller_t *pid, int32_t kp, int32_t ki, int32_t kd);
+
+/**@brief   Initializes a controller of the @ref pid_controller with a desired configuration.
+ *
+ * @param[out] pid      Pointer to the controller that wants to be initialized.
+ * @param[in] config    Pointer to the desired configuration for the \p pid param.
+ *
+ * @retval  PID_CONTROLLER_EC_OK    If the controller was successfully initialized.
+ * @retval  PID_CONTROLLER_EC_ERR   If any of the gains of the \p config param is negative, if its
+ *                                  @ref pid_controller_config_t::sample_period field is zero or if its
+ *                                  @ref pid_controller_config_t::output_min field is greater than its
+ *                                  @ref pid_controller_config_t::output_max field.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+PID_Controller_Status init_pid_controller(pid_controller_t *pid, const pid_controller_config_t *config);
+
+#endif /* PID_CONTROLLER_H_ */
+
+/** @} */
@@ -0,0 +1,161 @@
+/**@file
+ * @brief	Predictive Preheat Scheduler Header file.
+ *
+ * @defgroup preheat_scheduler Predictive Preheat Scheduler module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a
+ *          predictive scheduler of the heating of a buffer (e.g., the Hot Water) that a heating loop (e.g., the one of
+ *          the Internal Ambient Temperature) needs to be ready before it can throw heat, with the purpose of being used
+ *          by the application.
+ *
+ * @details The way that the @ref preheat_scheduler works is that the implementer calls the
+ *          @ref run_preheat_scheduler function periodically (e.g., at the rate of the controller of the heating loop)
+ *          with the current temperatures of the buffer and of the heated process and with whether the heater of the
+ *          buffer and the air of the heated process were On since the previous call. From those, this module learns
+ *          two rates, each as an exponential moving average of the change of a temperature over whole windows of
+ *          @ref preheat_scheduler_config_t::window milliseconds:
+ *          <ul>
+ *              <li>The heating rate of the buffer, from the windows during which its heater was On all the time.</li>
+ *              <li>The heat-loss rate of the heated process, from the windows during which no air was thrown into it at
+ *                  all.</li>
+ *          </ul>
+ *          With these, the @ref run_preheat_scheduler function predicts how long it will take for the heated process
+ *          to fall to the temperature at which its loop will need heat, and how long it will take for the buffer to
+ *          reach the temperature at which it is ready, and it requests the buffer to be heated only once the latter,
+ *          plus @ref preheat_scheduler_config_t::lead_margin , is no shorter than the former. This makes the buffer be
+ *          ready right when the heating loop needs it, instead of keeping it hot all the time or only starting to heat
+ *          it once it is already needed.
+ *
+ * @note    Until both rates have been learned from @ref preheat_scheduler_config_t::min_samples windows each, the
+ *          @ref run_preheat_scheduler function only requests the buffer to be heated once the heated process already
+ *          needs it (i.e., on demand), so that a freshly started scheduler (e.g., after every reset, since the rates
+ *          are not persisted) does not keep the heater of the buffer On meanwhile. The windows during which the
+ *          buffer is heated on demand and the ones between them are the ones from which both rates are learned.
+ * @note    The temperatures may be given in any unit (e.g., centi-degrees Celsius), and the learned rates are then
+ *          given in that same unit per minute.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef PREHEAT_SCHEDULER_H_
+#define PREHEAT_SCHEDULER_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define PREHEAT_SCHEDULER_MAX_FILTER_SHIFT  (8)     /**< @brief Largest value that the @ref preheat_scheduler_config_t::filter_shift may have. */
+
+/**@brief	Predictive Preheat Scheduler Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref preheat_scheduler to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    PREHEAT_SCHEDULER_EC_OK         = 0U,   //!< Predictive Preheat Scheduler Process was successful.
+    PREHEAT_SCHEDULER_EC_ERR        = 4U,   //!< Predictive Preheat Scheduler Process has failed.
+    PREHEAT_SCHEDULER_EC_NO_DATA    = 6U    //!< Predictive Preheat Scheduler Process has concluded with no data to process (i.e., its rates have not been learned yet).
+} Preheat_Scheduler_Status;
+
+/**@brief	Predictive Preheat Scheduler Configuration parameters structure.
+ */
+typedef struct
+{
+    uint32_t window;                    //!< Time in milliseconds over which each change of temperature is measured, which should be long enough for the heater of the buffer to go through several of its On and Off cycles. @note This value must be greater than zero.
+    uint8_t filter_shift;               //!< Number of bits by which the change of each learned rate is divided with each new window (e.g., 3 makes it remember about the latest 8 windows). @note This value must not be greater than @ref PREHEAT_SCHEDULER_MAX_FILTER_SHIFT .
+    uint8_t min_samples;                //!< Number of windows from which each rate has to be learned before it is used to predict.
+    uint32_t lead_margin;               //!< Extra time in milliseconds by which the buffer is requested to be ready before the heated process is predicted to need it, which covers the errors of the prediction.
+} preheat_scheduler_config_t;
+
+/**@brief	Predictive Preheat Scheduler Inputs structure.
+ */
+typedef struct
+{
+    int32_t buffer_temperature;         //!< Current temperature of the buffer (e.g., the Hot Water Temperature).
+    int32_t buffer_ready_temperature;   //!< Temperature from which the buffer is ready to be used by the heating loop.
+    int32_t process_temperature;        //!< Current temperature of the heated process (e.g., the Internal Ambient Temperature).
+    int32_t process_heat_temperature;   //!< Temperature of the heated process below which its heating loop needs the buffer (e.g., its setpoint).
+    uint8_t is_heater_on;               //!< 1 if the heater of the buffer has been On since the previous call of the @ref run_preheat_scheduler function or 0 otherwise.
+    uint8_t is_air_on;                  //!< 1 if any air has been thrown into the heated process since the previous call of the @ref run_preheat_scheduler function or 0 otherwise.
+} preheat_scheduler_inputs_t;
+
+/**@brief	Predictive Preheat Scheduler Rates structure.
+ */
+typedef struct
+{
+    int32_t heating_rate;               //!< Learned rate at which the buffer warms up while its heater is On, in temperature units per minute.
+    int32_t heat_loss_rate;             //!< Learned rate at which the heated process cools down while no air is thrown into it, in temperature units per minute, where negative values stand for a process that warms up by itself.
+    uint8_t heating_samples;            //!< Number of windows, up to @ref preheat_scheduler_config_t::min_samples , from which the heating rate has been learned.
+    uint8_t heat_loss_samples;          //!< Number of windows, up to @ref preheat_scheduler_config_t::min_samples , from which the heat-loss rate has been learned.
+} preheat_scheduler_rates_t;
+
+/**@brief	Predictive Preheat Scheduler Instance structure.
+ *
+ * @details This holds the state of one Scheduler, which is populated by the functions of the @ref preheat_scheduler .
+ */
+typedef struct
+{
+    preheat_scheduler_config_t config;  //!< Configuration with which the Scheduler was initialized.
+    preheat_scheduler_rates_t rates;    //!< Rates that have been learned so far.
+    uint32_t window_start_tick;         //!< Tick, in milliseconds, at which the current window started.
+    int32_t window_start_buffer;        //!< Temperature of the buffer at the start of the current window.
+    int32_t window_start_process;       //!< Temperature of the heated process at the start of the current window.
+    uint8_t is_heater_always_on;        //!< Flag that indicates whether the heater of the buffer has been On during all the current window or not. @details 0 = Not always<br>1 = Always
+    uint8_t is_air_always_off;          //!< Flag that indicates whether no air has been thrown into the heated process during all the current window or not. @details 0 = Not always<br>1 = Always
+    uint8_t is_window_started;          //!< Flag that indicates whether the current window has been started or not. @details 0 = Not started<br>1 = Started
+} preheat_scheduler_t;
+
+/**@brief   Executes one period of a Scheduler of the @ref preheat_scheduler , which learns its rates from the given
+ *          inputs and predicts whether the buffer has to be heated from now on.
+ *
+ * @note    If this function is not called for two windows or longer (e.g., while the heating loop is disabled), then
+ *          the window in course is discarded instead of being learned.
+ *
+ * @param[in,out] scheduler Pointer to the Scheduler, previously initialized via @ref init_preheat_scheduler , that
+ *                          wants to be executed.
+ * @param[in] inputs        Pointer to the current inputs of the \p scheduler param.
+ * @param tick              Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @return  1 if the buffer has to be heated from now on or 0 if its heater can be kept Off. The buffer always has to be
+ *          heated while the heated process is at or below the temperature at which it needs the buffer.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint8_t run_preheat_scheduler(preheat_scheduler_t *scheduler, const preheat_scheduler_inputs_t *inputs, uint32_t tick);
+
+/**@brief   Gets the rates that have been learned so far by a Scheduler of the @ref preheat_scheduler .
+ *
+ * @param[in] scheduler Pointer to the Scheduler whose rates want to be obtained.
+ * @param[out] rates    Pointer to the structure into which the rates will be written.
+ *
+ * @retval  PREHEAT_SCHEDULER_EC_OK
+ * @retval  PREHEAT_SCHEDULER_EC_NO_DATA    If any of the rates has been learned from fewer than
+ *                                          @ref preheat_scheduler_config_t::min_samples windows, in which case the
+ *                                          \p rates param is still written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Preheat_Scheduler_Status get_preheat_scheduler_rates(const preheat_scheduler_t *scheduler, preheat_scheduler_rates_t *rates);
+
+/**@brief   Initializes a Scheduler of the @ref preheat_scheduler with a desired configuration and with no rates
+ *          learned.
+ *
+ * @param[out] scheduler    Pointer to the Scheduler that wants to be initialized.
+ * @param[in] config        Pointer to the desired configuration for the \p scheduler param.
+ *
+ * @retval  PREHEAT_SCHEDULER_EC_OK
+ * @retval  PREHEAT_SCHEDULER_EC_ERR    If the \p config param has any invalid value, in which case the \p scheduler
+ *                                      param is left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Preheat_Scheduler_Status init_preheat_scheduler(preheat_scheduler_t *scheduler, const preheat_scheduler_config_t *config);
+
+#endif /* PREHEAT_SCHEDULER_H_ */
+
+/** @} */
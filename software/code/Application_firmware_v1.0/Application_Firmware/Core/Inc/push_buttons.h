@@ -0,0 +1,159 @@
+/**@file
+ * @brief	Debounced Push Buttons Header file.
+ *
+ * @defgroup push_buttons Debounced Push Buttons module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as an
+ *          interrupt-driven debouncer for the Push Buttons of the MTKATR001 System with the purpose of being used by
+ *          the application.
+ *
+ * @details The way that the @ref push_buttons works is that each edge of a Push Button whose GPIO Pin has been
+ *          configured as an EXTI line is reported to this module via the @ref push_buttons_exti_handler function,
+ *          which only marks that Push Button as pending. Then, the @ref run_push_buttons_debouncer function, which is
+ *          expected to be called once each millisecond from a Timer Interrupt (e.g., the SysTick), waits for the Push
+ *          Button to stay quiet during the configured debounce time before sampling it. Any Push Button whose GPIO Pin
+ *          could not be configured as an EXTI line (e.g., because another GPIO Port already uses that line) is
+ *          sampled by that same function each millisecond instead and then debounced in the same way.
+ * @details Each debounced change of a Push Button is turned into either a @ref PUSH_BUTTON_EVENT_PRESS or a
+ *          @ref PUSH_BUTTON_EVENT_RELEASE event and, if a Push Button is held during the configured long-press time, a
+ *          single @ref PUSH_BUTTON_EVENT_LONG_PRESS event is generated as well. Those events are written into a
+ *          single-producer/single-consumer ring buffer, which is lock-free since only the debouncer writes its head
+ *          and only the application, via the @ref get_push_button_event function, writes its tail.
+ *
+ * @note    The @ref get_push_button_event function must only be called from a single context (e.g., from one task of
+ *          the @ref task_scheduler ).
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef PUSH_BUTTONS_H_
+#define PUSH_BUTTONS_H_
+
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define PUSH_BUTTONS_MAX_BUTTONS            (8)     /**< @brief Maximum number of Push Buttons that can be managed by the @ref push_buttons . */
+#define PUSH_BUTTONS_EVENT_QUEUE_SIZE       (16)    /**< @brief Number of events that the ring buffer of the @ref push_buttons can hold. @note This value must be a power of two and lower than 256. */
+
+/**@brief	Debounced Push Buttons Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref push_buttons to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    PUSH_BUTTONS_EC_OK      = 0U,    //!< Debounced Push Buttons Process was successful.
+    PUSH_BUTTONS_EC_ERR     = 4U,    //!< Debounced Push Buttons Process has failed.
+    PUSH_BUTTONS_EC_NO_DATA = 6U     //!< Debounced Push Buttons Process could not get an event because there are currently no pending events.
+} Push_Buttons_Status;
+
+/**@brief	Types of the events that are generated by the @ref push_buttons .
+ */
+typedef enum
+{
+    PUSH_BUTTON_EVENT_PRESS         = 0U,   //!< The Push Button has been pressed.
+    PUSH_BUTTON_EVENT_RELEASE       = 1U,   //!< The Push Button has been released.
+    PUSH_BUTTON_EVENT_LONG_PRESS    = 2U    //!< The Push Button has been held during the long-press time.
+} Push_Button_Event_Type;
+
+/**@brief	Push Button definition parameters structure.
+ */
+typedef struct
+{
+    GPIO_TypeDef *GPIO_Port;            //!< Type Definition of the GPIO peripheral port to which the Push Button is connected to.
+    uint16_t GPIO_Pin;                  //!< Pin number of the GPIO peripheral to which the Push Button is connected to.
+    GPIO_PinState pressed_state;        //!< State that the GPIO Pin has while the Push Button is pressed.
+    uint8_t is_exti;                    //!< Flag that indicates whether the GPIO Pin has been configured as an EXTI line (i.e., 1) or whether it has to be sampled by the debouncer instead (i.e., 0).
+} push_button_def_t;
+
+/**@brief	Debounced Push Button event structure.
+ */
+typedef struct
+{
+    uint8_t button;                     //!< Index, in the array given to the @ref init_push_buttons_module function, of the Push Button that generated the event.
+    Push_Button_Event_Type type;        //!< Type of the event.
+} push_button_event_t;
+
+/**@brief   Marks as pending every EXTI Push Button of the @ref push_buttons that is connected to a certain GPIO Pin.
+ *
+ * @note    This function is expected to be called from the @ref HAL_GPIO_EXTI_Callback function.
+ *
+ * @param GPIO_Pin  GPIO Pin whose EXTI line has been triggered.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void push_buttons_exti_handler(uint16_t GPIO_Pin);
+
+/**@brief   Executes one millisecond of the debouncer of the @ref push_buttons , which generates the events of the Push
+ *          Buttons.
+ *
+ * @note    This function is expected to be called once each millisecond from a Timer Interrupt (e.g., the SysTick).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void run_push_buttons_debouncer(void);
+
+/**@brief   Gets the oldest pending event of the @ref push_buttons and removes it from its ring buffer.
+ *
+ * @param[out] event    Pointer to the structure into which the event will be written.
+ *
+ * @retval  PUSH_BUTTONS_EC_OK
+ * @retval  PUSH_BUTTONS_EC_NO_DATA If there are currently no pending events, in which case the \p event param is left
+ *                                  unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Push_Buttons_Status get_push_button_event(push_button_event_t *event);
+
+/**@brief   Gets the debounced state of a Push Button of the @ref push_buttons .
+ *
+ * @param button    Index, in the array given to the @ref init_push_buttons_module function, of the desired Push Button.
+ *
+ * @retval  1   If the Push Button is currently pressed.
+ * @retval  0   If the Push Button is currently released or if the \p button param is not valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint8_t is_push_button_pressed(uint8_t button);
+
+/**@brief   Gets the number of events that the @ref push_buttons has discarded because its ring buffer was full.
+ *
+ * @return  The number of discarded events since the @ref push_buttons was initialized.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_push_buttons_dropped_events(void);
+
+/**@brief   Initializes the @ref push_buttons with the desired Push Buttons, all of them assumed to be released.
+ *
+ * @note    This function must be called before enabling the EXTI Interrupts of the Push Buttons and before the
+ *          @ref run_push_buttons_debouncer function starts being called.
+ *
+ * @param[in] buttons       Pointer to the array of definitions of the Push Buttons, which must remain valid while the
+ *                          @ref push_buttons is in use.
+ * @param total_buttons     Number of Push Buttons in the \p buttons param, which must be between 1 and
+ *                          @ref PUSH_BUTTONS_MAX_BUTTONS .
+ * @param debounce_time     Time in milliseconds during which a Push Button must stay quiet before it is sampled.
+ *                          This value must be between 1 and 255.
+ * @param long_press_time   Time in milliseconds during which a Push Button must be held so that a
+ *                          @ref PUSH_BUTTON_EVENT_LONG_PRESS event is generated. This value must be greater than zero.
+ *
+ * @retval  PUSH_BUTTONS_EC_OK
+ * @retval  PUSH_BUTTONS_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Push_Buttons_Status init_push_buttons_module(const push_button_def_t *buttons, uint8_t total_buttons, uint16_t debounce_time, uint16_t long_press_time);
+
+#endif /* PUSH_BUTTONS_H_ */
+
+/** @} */
@@ -0,0 +1,140 @@
+/**@file
+ * @brief	Temperature Sensors Calibration Header file.
+ *
+ * @defgroup sensor_calibration Temperature Sensors Calibration module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as the
+ *          per-channel calibration of the Temperature Sensors of the MTKATR001 System, persisted in our MCU/MPU's Flash
+ *          Memory, with the purpose of being used by the application.
+ *
+ * @details The way that the @ref sensor_calibration works is that each channel of the @ref temp_sensors has its own
+ *          calibration table of up to @ref SENSOR_CALIBRATION_MAX_POINTS breakpoints, where each breakpoint maps a
+ *          Temperature measured with the ideal LM35 formula into the actual Temperature that a reference thermometer
+ *          gave at that moment, both in centi-degrees Celsius. The @ref apply_sensor_calibration function then
+ *          interpolates linearly between the two breakpoints that surround the measured Temperature, or extrapolates
+ *          with the first or last segment of the table outside of them, so that a failed sensor can still be detected
+ *          by its out-of-range readings. Since the slope of each segment is calculated in Q16 Fixed-Point whenever a
+ *          table is loaded or changed, each calibrated reading only costs a short search of its segment, one
+ *          multiplication and one shift. In addition:
+ *          <ul>
+ *              <li>A table with a single breakpoint applies a constant offset.</li>
+ *              <li>A table with no breakpoints leaves the measured Temperature unchanged, which is the case of every
+ *                  channel until a table is set for it.</li>
+ *          </ul>
+ * @details All the tables are persisted together as one record, with its sequence number and 32-bit CRC, in one of
+ *          the two Flash Memory pages designated to this module right before the ones of the
+ *          @ref firmware_update_config . Each new record is written into the page that does not hold the current one,
+ *          so that the latest valid record is never erased before the new one has been completely written, even if
+ *          our MCU/MPU is reset in the middle of it.
+ *
+ * @note    Erasing a Flash Memory page stalls our MCU/MPU while it is being made (i.e., up to about 40 milliseconds)
+ *          and, therefore, the @ref set_sensor_calibration function should be called only when a calibration table
+ *          actually changes.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef SENSOR_CALIBRATION_H_
+#define SENSOR_CALIBRATION_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "etx_ota_config.h" // Custom Library used for configuring the ETX OTA protocol.
+#include "temperature_sensors.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the ADC acquisition layer of the LM35 Temperature Sensors.
+
+#define SENSOR_CALIBRATION_START_PAGE       (118U)      /**< @brief Designated Flash Memory start page for the @ref sensor_calibration . @details This stands for the address 0x0801'D800, which is right after the pages of the @ref telemetry_archive and right before the ones of the @ref firmware_update_config . */
+#define SENSOR_CALIBRATION_TOTAL_PAGES      (2U)        /**< @brief Number of Flash Memory pages designated to the @ref sensor_calibration , each of which can hold one record of all the calibration tables. */
+#define SENSOR_CALIBRATION_MAX_POINTS       (8U)        /**< @brief Maximum number of breakpoints of each calibration table of the @ref sensor_calibration . */
+
+/**@brief	Temperature Sensors Calibration Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref sensor_calibration to indicate the
+ *          resulting status of having executed the process contained in each of those functions. For example, to
+ *          indicate that the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    SENSOR_CALIBRATION_EC_OK        = 0U,   //!< Temperature Sensors Calibration Process was successful. @note The code of this module contemplates that this value will match the one given for \c HAL_OK from @ref HAL_StatusTypeDef .
+    SENSOR_CALIBRATION_EC_NR        = 2U,   //!< Temperature Sensors Calibration Process has concluded with no response from HAL when requesting it to erase or to write the Flash Memory.
+    SENSOR_CALIBRATION_EC_ERR       = 4U,   //!< Temperature Sensors Calibration Process has failed.
+    SENSOR_CALIBRATION_EC_NO_DATA   = 6U    //!< Temperature Sensors Calibration Process found no valid record in the designated Flash Memory pages, so no channel is calibrated.
+} Sensor_Calibration_Status;
+
+/**@brief	Calibration breakpoint structure.
+ */
+typedef struct
+{
+    uint16_t measured;                  //!< Temperature, in centi-degrees Celsius, that is given by the ideal LM35 formula at this breakpoint.
+    int16_t actual;                     //!< Actual Temperature, in centi-degrees Celsius, that stands for the \c measured one.
+} sensor_calibration_point_t;
+
+/**@brief	Calibration table structure.
+ */
+typedef struct
+{
+    uint8_t total_points;                                               //!< Number of valid breakpoints in the \c points field, from 0 up to @ref SENSOR_CALIBRATION_MAX_POINTS .
+    uint8_t reserved[3];                                                //!< Padding that keeps the \c points field aligned, which is kept at zero.
+    sensor_calibration_point_t points[SENSOR_CALIBRATION_MAX_POINTS];   //!< Breakpoints of the table, whose \c measured fields must be strictly increasing.
+} sensor_calibration_table_t;
+
+/**@brief   Calibrates a Temperature of a desired Temperature Sensor with its calibration table.
+ *
+ * @param channel       Temperature Sensor whose Temperature was measured.
+ * @param measured      Temperature, in centi-degrees Celsius, that was given by the ideal LM35 formula.
+ *
+ * @return  The calibrated Temperature in centi-degrees Celsius.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+int32_t apply_sensor_calibration(Temp_Sensor_Channel channel, int32_t measured);
+
+/**@brief   Gets the current calibration table of a desired Temperature Sensor.
+ *
+ * @param channel       Temperature Sensor whose calibration table is desired.
+ * @param[out] table    Pointer to the structure into which a copy of that calibration table will be written.
+ *
+ * @retval  SENSOR_CALIBRATION_EC_OK
+ * @retval  SENSOR_CALIBRATION_EC_ERR   If the \p channel param is not valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Calibration_Status get_sensor_calibration(Temp_Sensor_Channel channel, sensor_calibration_table_t *table);
+
+/**@brief   Sets and persists the calibration table of a desired Temperature Sensor.
+ *
+ * @note    The @ref init_sensor_calibration_module function has to be called first before using this function.
+ *
+ * @param channel       Temperature Sensor whose calibration table wants to be set.
+ * @param[in] table     Pointer to the new calibration table, which may have no breakpoints to remove the calibration
+ *                      of that Temperature Sensor.
+ *
+ * @details The new calibration table is applied only once it has been persisted. Therefore, if this function does not
+ *          return @ref SENSOR_CALIBRATION_EC_OK , then the previous calibration table is kept.
+ *
+ * @retval  SENSOR_CALIBRATION_EC_OK
+ * @retval  SENSOR_CALIBRATION_EC_NR
+ * @retval  SENSOR_CALIBRATION_EC_ERR   If any of the given params is invalid or if the Flash Memory could not be
+ *                                      written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Calibration_Status set_sensor_calibration(Temp_Sensor_Channel channel, const sensor_calibration_table_t *table);
+
+/**@brief   Initializes the @ref sensor_calibration by loading the most recent valid record of calibration tables that
+ *          has been persisted into its Flash Memory pages.
+ *
+ * @retval  SENSOR_CALIBRATION_EC_OK
+ * @retval  SENSOR_CALIBRATION_EC_NO_DATA   If there is no valid record, in which case no channel is calibrated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Calibration_Status init_sensor_calibration_module(void);
+
+#endif /* SENSOR_CALIBRATION_H_ */
+
+/** @} */
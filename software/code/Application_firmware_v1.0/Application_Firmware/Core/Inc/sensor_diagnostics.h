@@ -0,0 +1,159 @@
+/**@file
+ * @brief	Sensor Plausibility Diagnostics Header file.
+ *
+ * @defgroup sensor_diagnostics Sensor Plausibility Diagnostics module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as the
+ *          plausibility diagnostics of a sensor, which classify each of its readings as valid, suspect or failed, with
+ *          the purpose of being used by the application.
+ *
+ * @details The way that the @ref sensor_diagnostics works is that the implementer has to give each new reading of a
+ *          sensor to the @ref run_sensor_diagnostics function, which checks it as follows:
+ *          <ul>
+ *              <li><b>Range check:</b> The reading is outside the range that the sensor can physically output (e.g.,
+ *                  a short-circuited or an open ADC Channel).</li>
+ *              <li><b>Stuck check:</b> The reading has not changed at all during
+ *                  @ref sensor_diagnostics_config_t::stuck_time milliseconds, which a live sensor with at least one
+ *                  LSB of noise does not do (e.g., an ADC Channel that is tied to a rail).</li>
+ *              <li><b>Rate check:</b> The reading has changed faster than
+ *                  @ref sensor_diagnostics_config_t::max_rate with respect to the previous one, which the physical
+ *                  variable cannot do (e.g., a loose connection).</li>
+ *              <li><b>Cross check:</b> The implementer has found the reading to be inconsistent with the readings of
+ *                  other sensors, which is given via the \c is_inconsistent param of the @ref run_sensor_diagnostics
+ *                  function since only the application knows how its sensors relate to each other.</li>
+ *          </ul>
+ * @details A failed Range or Stuck check makes the sensor @ref SENSOR_FAILED right away. A failed Rate or Cross check
+ *          makes it @ref SENSOR_SUSPECT instead, which it stays until all its checks have passed during
+ *          @ref sensor_diagnostics_config_t::settle_time milliseconds, and it becomes @ref SENSOR_FAILED if it keeps
+ *          being suspect during @ref sensor_diagnostics_config_t::fail_time milliseconds. A failed sensor whose checks
+ *          pass again goes back through the @ref SENSOR_SUSPECT state before becoming @ref SENSOR_VALID again. The
+ *          application is then expected to only trust the readings of a @ref SENSOR_VALID sensor.
+ *
+ * @note    This module does not depend on any hardware, so each of its instances can be used for any sensor whose
+ *          readings are given as integers (e.g., centi-degrees Celsius).
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef SENSOR_DIAGNOSTICS_H_
+#define SENSOR_DIAGNOSTICS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define SENSOR_DIAGNOSTICS_RANGE_CHECK      (1U << 0)   /**< @brief Bit of the checks that have failed (see @ref get_sensor_diagnostics_failed_checks ) that stands for the Range check. */
+#define SENSOR_DIAGNOSTICS_STUCK_CHECK      (1U << 1)   /**< @brief Bit of the checks that have failed that stands for the Stuck check. */
+#define SENSOR_DIAGNOSTICS_RATE_CHECK       (1U << 2)   /**< @brief Bit of the checks that have failed that stands for the Rate check. */
+#define SENSOR_DIAGNOSTICS_CROSS_CHECK      (1U << 3)   /**< @brief Bit of the checks that have failed that stands for the Cross check. */
+
+/**@brief	Sensor Plausibility Diagnostics Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref sensor_diagnostics to indicate the
+ *          resulting status of having executed the process contained in each of those functions. For example, to
+ *          indicate that the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    SENSOR_DIAGNOSTICS_EC_OK    = 0U,   //!< Sensor Plausibility Diagnostics Process was successful.
+    SENSOR_DIAGNOSTICS_EC_ERR   = 4U    //!< Sensor Plausibility Diagnostics Process has failed.
+} Sensor_Diagnostics_Status;
+
+/**@brief	Validity of a sensor, as diagnosed by the @ref sensor_diagnostics .
+ */
+typedef enum
+{
+    SENSOR_VALID                = 0U,   //!< All the checks of the sensor have passed, so its readings can be trusted.
+    SENSOR_SUSPECT              = 1U,   //!< The Rate or Cross check of the sensor has recently failed, or the sensor is recovering from having failed, so its readings should not be trusted for now.
+    SENSOR_FAILED               = 2U    //!< The Range or Stuck check of the sensor is currently failing, or it has been suspect for too long.
+} Sensor_Validity;
+
+/**@brief	Sensor Plausibility Diagnostics Configuration parameters structure.
+ */
+typedef struct
+{
+    int32_t min_value;                  //!< Lowest reading that the sensor can physically output.
+    int32_t max_value;                  //!< Highest reading that the sensor can physically output. @note This value must be greater than \c min_value .
+    uint32_t max_rate;                  //!< Fastest change, in reading units per second, that the physical variable can make. @note Zero disables the Rate check.
+    uint32_t stuck_time;                //!< Time in milliseconds after which a reading that has not changed at all fails the Stuck check. @note Zero disables the Stuck check.
+    uint32_t settle_time;               //!< Time in milliseconds during which all the checks of a suspect or failed sensor must pass before it is valid again.
+    uint32_t fail_time;                 //!< Time in milliseconds after which a sensor that keeps being suspect is considered failed. @note This value must be greater than \c settle_time .
+} sensor_diagnostics_config_t;
+
+/**@brief	Sensor Plausibility Diagnostics Instance structure.
+ *
+ * @details This holds the configuration and the state of the diagnostics of one sensor, which is populated by the
+ *          functions of the @ref sensor_diagnostics .
+ */
+typedef struct
+{
+    sensor_diagnostics_config_t config; //!< Configuration of the diagnostics.
+    Sensor_Validity validity;           //!< Current validity of the sensor.
+    uint8_t failed_checks;              //!< Bitmask of the checks that failed with the latest reading (e.g., @ref SENSOR_DIAGNOSTICS_RANGE_CHECK ).
+    uint8_t has_previous_reading;       //!< Flag that indicates whether \c previous_reading holds a reading or not. @details 0 = No reading yet<br>1 = It holds a reading
+    int32_t previous_reading;           //!< Previous reading of the sensor.
+    uint32_t previous_tick;             //!< Tick, in milliseconds, at which the previous reading was given.
+    uint32_t unchanged_since_tick;      //!< Tick, in milliseconds, since which the readings have not changed at all.
+    uint32_t suspect_since_tick;        //!< Tick, in milliseconds, at which the sensor stopped being valid.
+    uint32_t last_failed_check_tick;    //!< Tick, in milliseconds, at which any check lastly failed.
+} sensor_diagnostics_t;
+
+/**@brief   Checks a new reading of a sensor of the @ref sensor_diagnostics and updates the validity of that sensor.
+ *
+ * @param[in,out] diagnostics   Pointer to the diagnostics, previously initialized via @ref init_sensor_diagnostics ,
+ *                              of the sensor.
+ * @param reading               New reading of the sensor.
+ * @param is_inconsistent       Whether the implementer has found the \p reading param to be inconsistent with the
+ *                              readings of other sensors or not (i.e., the Cross check). @details 0 = Consistent<br>1 =
+ *                              Inconsistent
+ * @param tick                  Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @return  The updated validity of the sensor.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Validity run_sensor_diagnostics(sensor_diagnostics_t *diagnostics, int32_t reading, uint8_t is_inconsistent, uint32_t tick);
+
+/**@brief   Gets the current validity of a sensor of the @ref sensor_diagnostics .
+ *
+ * @param[in] diagnostics   Pointer to the diagnostics of the sensor.
+ *
+ * @return  The validity of the sensor as of its latest reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Validity get_sensor_diagnostics_validity(const sensor_diagnostics_t *diagnostics);
+
+/**@brief   Gets the checks that failed with the latest reading of a sensor of the @ref sensor_diagnostics .
+ *
+ * @param[in] diagnostics   Pointer to the diagnostics of the sensor.
+ *
+ * @return  A bitmask of @ref SENSOR_DIAGNOSTICS_RANGE_CHECK , @ref SENSOR_DIAGNOSTICS_STUCK_CHECK ,
+ *          @ref SENSOR_DIAGNOSTICS_RATE_CHECK and @ref SENSOR_DIAGNOSTICS_CROSS_CHECK .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint8_t get_sensor_diagnostics_failed_checks(const sensor_diagnostics_t *diagnostics);
+
+/**@brief   Initializes the diagnostics of a sensor of the @ref sensor_diagnostics with a desired configuration.
+ *
+ * @details The sensor is considered valid until its first reading is checked.
+ *
+ * @param[out] diagnostics  Pointer to the diagnostics that want to be initialized.
+ * @param[in] config        Pointer to the desired configuration for the \p diagnostics param.
+ *
+ * @retval  SENSOR_DIAGNOSTICS_EC_OK
+ * @retval  SENSOR_DIAGNOSTICS_EC_ERR   If the \p config param has any invalid value, in which case the \p diagnostics
+ *                                      param is left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Diagnostics_Status init_sensor_diagnostics(sensor_diagnostics_t *diagnostics, const sensor_diagnostics_config_t *config);
+
+#endif /* SENSOR_DIAGNOSTICS_H_ */
+
+/** @} */
@@ -0,0 +1,101 @@
+/**@file
+ * @brief	Median plus IIR Sensor Filter Header file.
+ *
+ * @defgroup sensor_filter Median plus IIR Sensor Filter module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a two-stage
+ *          digital filter for the samples of a sensor with the purpose of being used by the application.
+ *
+ * @details The way that the @ref sensor_filter works is that each sample given to the @ref run_sensor_filter function
+ *          first goes through a Median filter of a short window, which rejects isolated spikes, and then through a
+ *          first-order IIR Low-Pass filter, which attenuates the remaining noise above its cut-off frequency. Both
+ *          stages are made in Fixed-Point arithmetic and their execution time per sample is constant, so that the
+ *          @ref run_sensor_filter function can be safely called from an Interrupt.
+ * @details The first-order IIR Low-Pass filter has the form
+ *          \f$y[n] = y[n-1] + \alpha \cdot (x[n] - y[n-1])\f$, where the \f$\alpha\f$ coefficient is calculated in
+ *          the @ref init_sensor_filter function from the desired cut-off frequency \f$f_c\f$ and from the sample
+ *          rate \f$f_s\f$ as \f$\alpha = \frac{2 \pi f_c}{2 \pi f_c + f_s}\f$ (i.e., as a discretized RC filter).
+ *
+ * @note    Each sensor must use its own @ref sensor_filter_t structure, which can be configured independently.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef SENSOR_FILTER_H_
+#define SENSOR_FILTER_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define SENSOR_FILTER_MAX_MEDIAN_WINDOW     (5)        /**< @brief Maximum number of samples that the Median filter of the @ref sensor_filter can use. */
+
+/**@brief	Median plus IIR Sensor Filter Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref sensor_filter to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    SENSOR_FILTER_EC_OK      = 0U,    //!< Median plus IIR Sensor Filter Process was successful.
+    SENSOR_FILTER_EC_ERR     = 4U     //!< Median plus IIR Sensor Filter Process has failed.
+} Sensor_Filter_Status;
+
+/**@brief	Median plus IIR Sensor Filter Configuration parameters structure.
+ */
+typedef struct
+{
+    uint8_t median_window;              //!< Number of samples used by the Median filter. @note This value must be odd and equal or lower than @ref SENSOR_FILTER_MAX_MEDIAN_WINDOW , where a value of 1 disables the Median filter.
+    uint32_t cutoff_frequency;          //!< Cut-off frequency, in millihertz, of the IIR Low-Pass filter. @note A value of 0 disables the IIR Low-Pass filter.
+    uint32_t sample_rate;               //!< Rate, in Hertz, at which the samples will be given to the @ref run_sensor_filter function.
+} sensor_filter_config_t;
+
+/**@brief	Median plus IIR Sensor Filter Instance structure.
+ *
+ * @details This holds the state of one filter, which is populated by the functions of the @ref sensor_filter .
+ */
+typedef struct
+{
+    uint16_t window[SENSOR_FILTER_MAX_MEDIAN_WINDOW];   //!< Latest samples given to the Median filter.
+    uint8_t window_size;                                //!< Number of samples used by the Median filter.
+    uint8_t window_index;                               //!< Index of @ref sensor_filter_t::window into which the next sample will be written.
+    uint8_t is_primed;                                  //!< Flag that indicates whether the filter has already received its first sample (1) or not (0).
+    uint16_t alpha;                                     //!< Coefficient of the IIR Low-Pass filter in Q15 Fixed-Point format.
+    int32_t output;                                     //!< Latest output of the IIR Low-Pass filter in Q8 Fixed-Point format.
+} sensor_filter_t;
+
+/**@brief   Passes a new sample through a filter of the @ref sensor_filter and gets the resulting filtered sample.
+ *
+ * @details The very first sample given to a filter initializes the whole state of that filter with that sample, so
+ *          that the output does not start from zero.
+ *
+ * @param[in,out] filter    Pointer to the filter, previously initialized via @ref init_sensor_filter , that wants to
+ *                          be used.
+ * @param sample            New sample.
+ *
+ * @return  The filtered sample, which is in the same units as the \p sample param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint16_t run_sensor_filter(sensor_filter_t *filter, uint16_t sample);
+
+/**@brief   Initializes a filter of the @ref sensor_filter with a desired configuration.
+ *
+ * @param[out] filter   Pointer to the filter that wants to be initialized.
+ * @param[in] config    Pointer to the desired configuration for the \p filter param.
+ *
+ * @retval  SENSOR_FILTER_EC_OK     If the filter was successfully initialized.
+ * @retval  SENSOR_FILTER_EC_ERR    If the @ref sensor_filter_config_t::median_window field of the \p config param is
+ *                                  either even, zero or greater than @ref SENSOR_FILTER_MAX_MEDIAN_WINDOW , or if its
+ *                                  @ref sensor_filter_config_t::sample_rate field is zero.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Sensor_Filter_Status init_sensor_filter(sensor_filter_t *filter, const sensor_filter_config_t *config);
+
+#endif /* SENSOR_FILTER_H_ */
+
+/** @} */
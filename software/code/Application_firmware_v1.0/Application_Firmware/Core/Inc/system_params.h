@@ -0,0 +1,152 @@
+/**@file
+ * @brief	MTKATR001 System Parameters Storage Header file.
+ *
+ * @defgroup system_params MTKATR001 System Parameters Storage module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as the
+ *          persistent storage of the MTKATR001 System Parameters in our MCU/MPU's Flash Memory with the purpose of being
+ *          used by the application.
+ *
+ * @details The strategy followed by this module is the same one that is followed by the @ref firmware_update_config
+ *          (i.e., a modified method of
+ *          <a href=http://ww1.microchip.com/downloads/en/appnotes/01095c.pdf>MICROCHIP's Emulating Data EEPROM</a>),
+ *          but in the last 4kB of the Flash Memory of our MCU/MPU, which are right after the ones of the
+ *          @ref firmware_update_config . Those 4kB are split into two System Parameters Pages of
+ *          @ref SYSTEM_PARAMS_PAGE_SIZE bytes each. Each time that new data is written, it is appended as a new Data
+ *          Block, together with its 32-bit CRC, right after the most recently written one, and whenever one System
+ *          Parameters Page is full and the other one has already started to be written, the full one is erased. This
+ *          way, the Flash Memory is only erased once each @ref SYSTEM_PARAMS_BLOCKS_PER_PAGE writes, which preserves
+ *          its lifetime.
+ *
+ * @note    Erasing a System Parameters Page stalls our MCU/MPU while it is being made (i.e., up to about 40
+ *          milliseconds per Flash Memory Page) and, therefore, the @ref write_system_params function should be called
+ *          only when the MTKATR001 System Parameters actually change.
+ *
+ * @note    The code from this module contemplates/expects the Flash Memory pages designated to it to have been fully
+ *          erased for the very first time that it is used in our MCU/MPU.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef SYSTEM_PARAMS_H_
+#define SYSTEM_PARAMS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "etx_ota_config.h" // Custom Library used for configuring the ETX OTA protocol.
+
+#define SYSTEM_PARAMS_START_PAGE            (124U)      /**< @brief Designated Flash Memory start page for the @ref system_params . @details This stands for the address 0x0801'F000, which is right after the 4kB used by the @ref firmware_update_config . */
+#define SYSTEM_PARAMS_PAGE_SIZE             (2048U)     /**< @brief Designated size for a page of the @ref system_params , rather than being an actual Flash Memory page size of our MCU/MPU. */
+#define SYSTEM_PARAMS_BLOCK_SIZE            (64U)       /**< @brief Size in bytes of each Data Block written by the @ref system_params . @note @ref SYSTEM_PARAMS_PAGE_SIZE must be divisible by this value. */
+#define SYSTEM_PARAMS_BLOCKS_PER_PAGE       (SYSTEM_PARAMS_PAGE_SIZE/SYSTEM_PARAMS_BLOCK_SIZE)  /**< @brief Number of Data Blocks that fit in one page of the @ref system_params . */
+#define SYSTEM_PARAMS_RESERVED_WORDS        (7U)        /**< @brief Number of 32-bit words of the @ref system_params_data_t structure that are reserved for future possible uses. */
+#define SYSTEM_PARAMS_32BIT_ERASED_VALUE    (0xFFFFFFFF)    /**< @brief Value that a 32-bit field of the @ref system_params_data_t structure has when it has never been written. */
+
+/**@brief	MTKATR001 System Parameters Storage Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref system_params to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    SYSTEM_PARAMS_EC_OK         = 0U,   //!< MTKATR001 System Parameters Storage Process was successful. @note The code of this module contemplates that this value will match the one given for \c HAL_OK from @ref HAL_StatusTypeDef .
+    SYSTEM_PARAMS_EC_NR         = 2U,   //!< MTKATR001 System Parameters Storage Process has concluded with no response from HAL when requesting it to erase or to write the Flash Memory.
+    SYSTEM_PARAMS_EC_ERR        = 4U,   //!< MTKATR001 System Parameters Storage Process has failed.
+    SYSTEM_PARAMS_EC_CRPT       = 5U,   //!< MTKATR001 System Parameters Storage Flash Memory pages were identified to be corrupted and could not be restored.
+    SYSTEM_PARAMS_EC_NO_DATA    = 6U    //!< MTKATR001 System Parameters Storage Read Process could not be made because there is currently no existing data in the designated Flash Memory pages.
+} System_Params_Status;
+
+/**@brief	MTKATR001 System Parameters data structure. This contains all the fields of the data that will be managed by
+ *          the @ref system_params .
+ *
+ * @note    The size of this structure plus 8 bytes (i.e., the CRC and the flags of each Data Block) must be equal to
+ *          @ref SYSTEM_PARAMS_BLOCK_SIZE . New fields should be taken from the reserved ones, which are kept at
+ *          @ref SYSTEM_PARAMS_32BIT_ERASED_VALUE , so that the Data Blocks that were written by previous versions of
+ *          the Application Firmware can still be read.
+ */
+typedef struct __attribute__ ((__packed__))
+{
+    int32_t pid_kp;                                     //!< Proportional gain of the Internal Ambient Temperature PID Controller (see @ref pid_controller_config_t::kp ).
+    int32_t pid_ki;                                     //!< Integral gain of the Internal Ambient Temperature PID Controller (see @ref pid_controller_config_t::ki ).
+    int32_t pid_kd;                                     //!< Derivative gain of the Internal Ambient Temperature PID Controller (see @ref pid_controller_config_t::kd ).
+    int32_t autotune_ku;                                //!< Ultimate Gain that was measured by the latest successful Internal Ambient Temperature PID Auto-Tuning (see @ref pid_autotune_result_t::ku ).
+    uint32_t autotune_pu;                               //!< Ultimate Period, in milliseconds, that was measured by the latest successful Internal Ambient Temperature PID Auto-Tuning (see @ref pid_autotune_result_t::pu ).
+    int8_t desired_internal_ambient_temperature;        //!< Desired Internal Ambient Temperature in degrees Celsius.
+    uint8_t desired_hot_fan_duty_cycle;                 //!< Desired Hot Fan Duty Cycle in percentage. @note A value greater than 100 means that the regulation setpoints of this structure have never been written (e.g., 0xFF in the Data Blocks written by previous versions of the Application Firmware).
+    uint8_t desired_cold_fan_duty_cycle;                //!< Desired Cold Fan Duty Cycle in percentage.
+    uint8_t desired_hot_water_temperature;              //!< Desired Hot Water Temperature in degrees Celsius.
+    uint8_t desired_hot_water_min_temperature;          //!< Desired Hot Water Minimum Temperature in degrees Celsius.
+    uint8_t desired_cold_water_max_temperature;         //!< Desired Cold Water Maximum Temperature in degrees Celsius.
+    uint16_t reserved_setpoints;                        //!< 16-bits reserved for future possible regulation setpoints, which are kept at 0xFFFF.
+    uint32_t reserved[SYSTEM_PARAMS_RESERVED_WORDS];    //!< 32-bit words reserved for future possible uses for the @ref system_params .
+} system_params_data_t;
+
+/**@brief   Gets the latest MTKATR001 System Parameters that have been written into the @ref system_params .
+ *
+ * @note    The @ref init_system_params_module function has to be called first before using this function.
+ *
+ * @param[out] p_data   Pointer to the structure into which a copy of the latest data will be written. If there is
+ *                      currently no data in the @ref system_params , then all the bytes of this structure will be set
+ *                      to 0xFF.
+ *
+ * @retval  SYSTEM_PARAMS_EC_OK
+ * @retval  SYSTEM_PARAMS_EC_NO_DATA
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+System_Params_Status read_system_params(system_params_data_t *p_data);
+
+/**@brief   Writes the desired MTKATR001 System Parameters into the @ref system_params .
+ *
+ * @details The new Data Block is written right after the most recently written one and, after that, the System
+ *          Parameters Page that has been left full of data, if any, is erased. However, if the given data is identical
+ *          to the one of the most recently written Data Block, then nothing is written, so that the application can
+ *          call this function whenever its parameters might have changed without wearing out the Flash Memory.
+ *
+ * @details The Data Blocks that are not fully erased (e.g., the ones that were left partially written because our
+ *          MCU/MPU was reset in the middle of a write) are skipped, since they cannot be programmed again until their
+ *          page is erased. If the writes reach the start of a page that is not fully erased, then that page is erased
+ *          first.
+ *
+ * @note    The @ref init_system_params_module function has to be called first before using this function.
+ *
+ * @param[in] p_data    Pointer to the data that wants to be written.
+ *
+ * @retval  SYSTEM_PARAMS_EC_OK
+ * @retval  SYSTEM_PARAMS_EC_NR
+ * @retval  SYSTEM_PARAMS_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+System_Params_Status write_system_params(const system_params_data_t *p_data);
+
+/**@brief   Initializes the @ref system_params by looking for its most recently written Data Block.
+ *
+ * @details Since the Data Blocks of each System Parameters Page are always written from its start and one after the
+ *          other, the most recently written Data Block is found with a binary search over the written Data Blocks of
+ *          each page instead of by reading all of them. After this, the @ref read_system_params function gets the
+ *          latest data in constant time.
+ *
+ * @details If the most recently written Data Block was only partially written or does not match its 32-bit CRC, then
+ *          the previous ones are looked at, going into the other System Parameters Page if needed, until a valid one
+ *          is found. Only if none of them is valid, both System Parameters Pages are erased, so that the
+ *          @ref system_params is left without data instead of with corrupted data. In addition, if one System Parameters Page is full and the other one has already started to be written, then
+ *          the full one is erased.
+ *
+ * @retval  SYSTEM_PARAMS_EC_OK
+ * @retval  SYSTEM_PARAMS_EC_NR
+ * @retval  SYSTEM_PARAMS_EC_ERR
+ * @retval  SYSTEM_PARAMS_EC_CRPT
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+System_Params_Status init_system_params_module(void);
+
+#endif /* SYSTEM_PARAMS_H_ */
+
+/** @} */
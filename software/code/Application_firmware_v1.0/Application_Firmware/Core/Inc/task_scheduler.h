@@ -0,0 +1,149 @@
+/**@file
+ * @brief	Cooperative Task Scheduler Header file.
+ *
+ * @defgroup task_scheduler Cooperative Task Scheduler module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a
+ *          tick-driven cooperative Task Scheduler with the purpose of being used by the application to run several
+ *          periodic tasks without having to pace them via blocking delays.
+ *
+ * @details The way that the @ref task_scheduler works is that the implementer first declares an array of
+ *          @ref task_scheduler_task_t structures, where each of them defines the callback function of a task, the
+ *          period in milliseconds at which that task is desired to be released and the deadline in milliseconds,
+ *          relative to each release, within which that task is expected to have finished its execution. That array is
+ *          then given to this module via the @ref init_task_scheduler_module function and, from then on, the
+ *          implementer only has to call the @ref run_task_scheduler function over and over inside the main program's
+ *          infinite loop.
+ * @details Each time that the @ref run_task_scheduler function is called, it will execute the first task, with respect
+ *          to the order in which the tasks were given in the array mentioned before, whose release time has been
+ *          reached. This means that the order of the tasks in that array also defines their priority, where the first
+ *          task has the highest priority.
+ * @details Since this is a cooperative Task Scheduler, the tasks will never be preempted by this module and,
+ *          therefore, each task should return as soon as possible (i.e., the tasks must never contain blocking delays
+ *          or loops whose duration is not bounded) so that all the other tasks can meet their own deadlines.
+ *
+ * @note    The time base of this module is the HAL Tick (see @ref HAL_GetTick ), which is expected to be incremented
+ *          each 1 millisecond by the SysTick Interrupt.
+ *
+ * @details <b><u>Code Example for running two periodic tasks via the @ref task_scheduler :</u></b>
+ *
+ * @code
+  #include "task_scheduler.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Cooperative Task Scheduler.
+
+  static void fast_task(void);
+  static void slow_task(void);
+
+  task_scheduler_task_t tasks[2] = {
+      {.callback = fast_task, .period = 50, .deadline = 20},
+      {.callback = slow_task, .period = 1000, .deadline = 100}
+  };
+
+  int main(void)
+  {
+      // Initialize the HAL, the clocks and the peripherals here.
+
+      if (init_task_scheduler_module(tasks, 2) != TASK_SCHEDULER_EC_OK)
+      {
+          // Handle the error here.
+      }
+      while (1)
+      {
+          run_task_scheduler();
+      }
+  }
+ * @endcode
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef TASK_SCHEDULER_H_
+#define TASK_SCHEDULER_H_
+
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define TASK_SCHEDULER_MAX_TASKS      (8)        /**< @brief Total maximum tasks that can be given to the @ref task_scheduler . */
+
+/**@brief	Cooperative Task Scheduler Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref task_scheduler to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    TASK_SCHEDULER_EC_OK      = 0U,    //!< Cooperative Task Scheduler Process was successful.
+    TASK_SCHEDULER_EC_IDLE    = 1U,    //!< Cooperative Task Scheduler did not execute any task because none of them had reached its release time.
+    TASK_SCHEDULER_EC_ERR     = 4U     //!< Cooperative Task Scheduler Process has failed.
+} Task_Scheduler_Status;
+
+/**@brief	Function pointer type of the callback functions that hold the body of each task of the @ref task_scheduler .
+ */
+typedef void (*task_scheduler_callback_t)(void);
+
+/**@brief	Task Definition parameters structure of the @ref task_scheduler .
+ *
+ * @details This contains both the fields that the implementer has to populate to define a task (i.e.,
+ *          @ref task_scheduler_task_t::callback , @ref task_scheduler_task_t::period and
+ *          @ref task_scheduler_task_t::deadline ) and the fields that the @ref task_scheduler will use to keep track
+ *          of the releases and of the execution statistics of that task.
+ */
+typedef struct
+{
+    task_scheduler_callback_t callback;     //!< Pointer to the function that holds the body of the task.
+    uint32_t period;                        //!< Time in milliseconds between two consecutive releases of the task.
+    uint32_t deadline;                      //!< Time in milliseconds, relative to each release, within which the task is expected to have finished its execution. @note This value should be greater than zero and equal or lower than @ref task_scheduler_task_t::period .
+    uint32_t next_release_tick;             //!< HAL Tick at which the task will be released next. @note This field is populated by the @ref task_scheduler .
+    uint32_t max_execution_time;            //!< Longest execution time in milliseconds that the task has had so far. @note This field is populated by the @ref task_scheduler .
+    uint32_t deadline_misses;               //!< Number of times that the task has finished its execution after its deadline. @note This field is populated by the @ref task_scheduler .
+    uint32_t skipped_releases;              //!< Number of releases of the task that were skipped because the task was delayed by more than one whole period. @note This field is populated by the @ref task_scheduler .
+} task_scheduler_task_t;
+
+/**@brief   Executes the highest priority task of the @ref task_scheduler whose release time has been reached, if there
+ *          is any.
+ *
+ * @details After executing a task, its next release time will be advanced by exactly one period with respect to its
+ *          previous release time so that the releases do not drift in time. However, if the task was delayed by more
+ *          than one whole period, then all the releases that have already passed will be skipped, so that the task is
+ *          next released at the following multiple of its period, and counted via the
+ *          @ref task_scheduler_task_t::skipped_releases field of that task. In addition, if the task finishes its
+ *          execution after its deadline, then this will be counted via the @ref task_scheduler_task_t::deadline_misses
+ *          field of that task.
+ *
+ * @note    This function is expected to be called over and over inside the infinite loop of the main program.
+ *
+ * @retval  TASK_SCHEDULER_EC_OK    If a task was executed.
+ * @retval  TASK_SCHEDULER_EC_IDLE  If none of the tasks had reached its release time.
+ * @retval  TASK_SCHEDULER_EC_ERR   If the @ref task_scheduler has not been initialized.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Task_Scheduler_Status run_task_scheduler(void);
+
+/**@brief   Initializes the @ref task_scheduler in order to be able to use its provided functions.
+ *
+ * @details All the given tasks will be released for the first time right after this function is called and their
+ *          execution statistics will be reset to zero.
+ *
+ * @param[in,out] tasks Pointer to the array of tasks that the @ref task_scheduler will manage, where the order of the
+ *                      tasks in that array defines their priority (the first task has the highest priority). Note that
+ *                      this array must remain valid during the whole lifetime of the program.
+ * @param tasks_size    Number of tasks contained in the \p tasks param.
+ *
+ * @retval  TASK_SCHEDULER_EC_OK    If the @ref task_scheduler was successfully initialized.
+ * @retval  TASK_SCHEDULER_EC_ERR   If the \p tasks param is \c NULL , if the \p tasks_size param is zero or greater
+ *                                  than @ref TASK_SCHEDULER_MAX_TASKS or if any of the given tasks has a \c NULL
+ *                                  callback, a zero period or a deadline that is either zero or greater than its
+ *                                  period.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Task_Scheduler_Status init_task_scheduler_module(task_scheduler_task_t *tasks, uint8_t tasks_size);
+
+#endif /* TASK_SCHEDULER_H_ */
+
+/** @} */
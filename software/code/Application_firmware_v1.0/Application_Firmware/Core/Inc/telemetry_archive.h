@@ -0,0 +1,142 @@
+/**@file
+ * @brief	Telemetry Archive Header file.
+ *
+ * @defgroup telemetry_archive Telemetry Archive module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as an
+ *          append-only archive of the records of the @ref telemetry_log , persisted in our MCU/MPU's Flash Memory so
+ *          that they survive any reset, with the purpose of being used by the application.
+ *
+ * @details The way that the @ref telemetry_archive works is that it takes the Flash Memory pages designated to it,
+ *          right before the ones of the @ref sensor_calibration , as a ring of pages that are filled one after the
+ *          other. Each page starts with a header that holds its page sequence number (i.e., one more than the one of
+ *          the page that was filled before it) protected by a 32-bit CRC, followed by up to
+ *          @ref TELEMETRY_ARCHIVE_RECORDS_PER_PAGE slots that each hold one @ref telemetry_record_t together with its
+ *          own 32-bit CRC. Records are only ever appended into the erased slots of the latest page, and the next page
+ *          of the ring, which holds the oldest records, is only erased once the latest page is full. Therefore, each
+ *          page is erased once per turn of the ring, which spreads the wear evenly over all of them.
+ * @details Since the page sequence numbers increase along the ring, starting from the oldest page, the
+ *          @ref init_telemetry_archive_module function finds the latest page with a binary search over the page
+ *          headers, where an erased or corrupted header counts as the lowest sequence number, and then finds its first
+ *          erased slot with another binary search. Mounting the archive thus reads
+ *          O(log(@ref TELEMETRY_ARCHIVE_TOTAL_PAGES)) headers and O(log(@ref TELEMETRY_ARCHIVE_RECORDS_PER_PAGE))
+ *          slots instead of scanning the whole archive. A record or page whose CRC does not match (e.g., due to a
+ *          reset in the middle of writing it) is simply skipped when reading the archive.
+ * @details The records are taken from the @ref telemetry_log by the @ref feed_telemetry_archive function in batches
+ *          of @ref TELEMETRY_ARCHIVE_BATCH_RECORDS , so that the Flash Memory is unlocked and programmed only once per
+ *          batch. Each record in the archive has a sequence number (i.e., the number of slots that precede it since
+ *          the archive was first written), so that the application can read it in bulk via the
+ *          @ref read_telemetry_archive_records function in the same way as with the @ref telemetry_log . In the
+ *          MTKATR001 System, the host pages through these records via the MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Command of
+ *          the ETX OTA Protocol.
+ *
+ * @note    Erasing a Flash Memory page stalls our MCU/MPU while it is being made (i.e., up to about 40 milliseconds),
+ *          which happens once every @ref TELEMETRY_ARCHIVE_RECORDS_PER_PAGE archived records.
+ * @note    Each Flash Memory page of our MCU/MPU endures about 10'000 erase cycles. Since each page of this module is
+ *          erased once every @ref TELEMETRY_ARCHIVE_TOTAL_PAGES times @ref TELEMETRY_ARCHIVE_RECORDS_PER_PAGE archived
+ *          records, the rate at which records are written into the @ref telemetry_log determines the lifetime of the
+ *          archive (e.g., about 3 years of continuous operation with one record every 10 seconds).
+ * @note    The functions of this module must only be called from a single context (e.g., the tasks of the
+ *          @ref task_scheduler ).
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef TELEMETRY_ARCHIVE_H_
+#define TELEMETRY_ARCHIVE_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "etx_ota_config.h" // Custom Library used for configuring the ETX OTA protocol.
+#include "sensor_calibration.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the per-channel calibration of the Temperature Sensors.
+#include "telemetry_log.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a RAM ring buffer of snapshots of the process variables of the MTKATR001 System.
+
+#define TELEMETRY_ARCHIVE_TOTAL_PAGES       (24U)       /**< @brief Number of Flash Memory pages designated to the @ref telemetry_archive . */
+#define TELEMETRY_ARCHIVE_START_PAGE        (SENSOR_CALIBRATION_START_PAGE - TELEMETRY_ARCHIVE_TOTAL_PAGES)     /**< @brief Designated Flash Memory start page for the @ref telemetry_archive . @details This stands for the address 0x0801'7800, which is right after the @ref ETX_APP_FLASH_PAGES_SIZE pages of the Application Firmware and right before the ones of the @ref sensor_calibration . */
+#define TELEMETRY_ARCHIVE_RECORDS_PER_PAGE  (42U)       /**< @brief Number of record slots in each Flash Memory page of the @ref telemetry_archive , which is as many as fit after the page header. */
+#define TELEMETRY_ARCHIVE_BATCH_RECORDS     (8U)        /**< @brief Number of records of the @ref telemetry_log that the @ref feed_telemetry_archive function waits for before writing them together into the @ref telemetry_archive . @note This value must be lower than @ref TELEMETRY_LOG_CAPACITY . */
+
+#if (TELEMETRY_ARCHIVE_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR) != (ETX_APP_FLASH_ADDR + ETX_APP_FLASH_PAGES_SIZE*FLASH_PAGE_SIZE_IN_BYTES)
+#error "The Telemetry Archive must start right after the Flash Memory pages of the Application Firmware."
+#endif
+
+/**@brief	Telemetry Archive Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref telemetry_archive to indicate the
+ *          resulting status of having executed the process contained in each of those functions. For example, to
+ *          indicate that the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    TELEMETRY_ARCHIVE_EC_OK         = 0U,   //!< Telemetry Archive Process was successful. @note The code of this module contemplates that this value will match the one given for \c HAL_OK from @ref HAL_StatusTypeDef .
+    TELEMETRY_ARCHIVE_EC_NR         = 2U,   //!< Telemetry Archive Process has concluded with no response from HAL when requesting it to erase or to write the Flash Memory.
+    TELEMETRY_ARCHIVE_EC_ERR        = 4U,   //!< Telemetry Archive Process has failed.
+    TELEMETRY_ARCHIVE_EC_NO_DATA    = 6U    //!< Telemetry Archive Process has concluded with no data to process.
+} Telemetry_Archive_Status;
+
+/**@brief   Writes into the @ref telemetry_archive the records of the @ref telemetry_log that have not been archived
+ *          yet, in whole batches of @ref TELEMETRY_ARCHIVE_BATCH_RECORDS records.
+ *
+ * @details If the @ref telemetry_log has overwritten some records before they could be archived, then the archiving
+ *          continues from its oldest record. If the Flash Memory could not be written, then the records that were not
+ *          archived are retried the next time that this function is called.
+ *
+ * @note    The @ref init_telemetry_archive_module function has to be called first before using this function.
+ *
+ * @retval  TELEMETRY_ARCHIVE_EC_OK
+ * @retval  TELEMETRY_ARCHIVE_EC_NR
+ * @retval  TELEMETRY_ARCHIVE_EC_ERR
+ * @retval  TELEMETRY_ARCHIVE_EC_NO_DATA    If a whole batch of records is not available yet, in which case nothing is
+ *                                          written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Telemetry_Archive_Status feed_telemetry_archive(void);
+
+/**@brief   Gets the sequence number that the next record written into the @ref telemetry_archive will have.
+ *
+ * @return  The sequence number of the next record.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_telemetry_archive_next_sequence(void);
+
+/**@brief   Reads in bulk consecutive records of the @ref telemetry_archive .
+ *
+ * @details If the requested first record has already been erased, then the reading starts from the oldest record that
+ *          is still held instead. The records whose CRC does not match are skipped.
+ *
+ * @param[in,out] sequence  Pointer to the sequence number of the first record that wants to be read, which is updated
+ *                          into the sequence number that follows the last record that was examined, so that it can be
+ *                          given as is to the next call of this function.
+ * @param[out] records      Pointer to the array into which the records will be copied, in chronological order.
+ * @param max_records       Maximum number of records that can be copied into the \p records param.
+ *
+ * @return  The number of records that were copied, which is zero if there are no records from the \p sequence param
+ *          onwards.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint16_t read_telemetry_archive_records(uint32_t *sequence, telemetry_record_t *records, uint16_t max_records);
+
+/**@brief   Initializes the @ref telemetry_archive by finding the latest of its Flash Memory pages and the first erased
+ *          slot of that page, so that the new records are appended after the ones that have been persisted.
+ *
+ * @note    The @ref init_telemetry_log function has to be called first before using this function, since the records
+ *          of the @ref telemetry_log are archived from the moment that this function is called.
+ *
+ * @retval  TELEMETRY_ARCHIVE_EC_OK
+ * @retval  TELEMETRY_ARCHIVE_EC_NO_DATA    If no page of the @ref telemetry_archive has been written yet.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Telemetry_Archive_Status init_telemetry_archive_module(void);
+
+#endif /* TELEMETRY_ARCHIVE_H_ */
+
+/** @} */
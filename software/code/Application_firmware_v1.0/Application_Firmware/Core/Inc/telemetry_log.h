@@ -0,0 +1,115 @@
+/**@file
+ * @brief	Telemetry Log Header file.
+ *
+ * @defgroup telemetry_log Telemetry Log module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a RAM ring
+ *          buffer of timestamped snapshots of the process variables of the MTKATR001 System, with the purpose of being
+ *          used by the application.
+ *
+ * @details The way that the @ref telemetry_log works is that the application periodically gives a snapshot of its
+ *          Temperatures, setpoints, actuators and faults to the @ref write_telemetry_record function, which copies it
+ *          into the next slot of a ring buffer of @ref TELEMETRY_LOG_CAPACITY records, overwriting the oldest one once
+ *          that ring buffer is full. Each record is given a sequence number (i.e., the number of records that were
+ *          written before it since this module was initialized), so that the application can read any number of
+ *          consecutive records in bulk via the @ref read_telemetry_records function, starting from the sequence number
+ *          that follows the last record that it read, and know whether some records were overwritten before it could
+ *          read them. In the MTKATR001 System, the host pages through these records via the
+ *          MTKATR001_CMD_GET_TELEMETRY_LOG Command of the ETX OTA Protocol.
+ * @details The records are packed so that the whole ring buffer fits in a small part of the RAM of our MCU/MPU, and
+ *          this module neither blocks nor locks anything. There must be a single writer, which may interrupt the
+ *          readers but not be interrupted by them, while the readers simply copy the requested records again whenever
+ *          the writer has overwritten any of them in the middle of the copy.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef TELEMETRY_LOG_H_
+#define TELEMETRY_LOG_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define TELEMETRY_LOG_CAPACITY              (128)       /**< @brief Number of records that the ring buffer of the @ref telemetry_log can hold. @note This value must be a power of two. */
+#define TELEMETRY_HEATER_ON                 (1U << 0)   /**< @brief Bit of @ref telemetry_record_t::actuators that stands for the Water Heating Resistor being On. */
+#define TELEMETRY_HOT_WATER_PUMP_ON         (1U << 1)   /**< @brief Bit of @ref telemetry_record_t::actuators that stands for the Hot Water Pump being On. */
+#define TELEMETRY_COLD_WATER_PUMP_ON        (1U << 2)   /**< @brief Bit of @ref telemetry_record_t::actuators that stands for the Cold Water Pump being On. */
+#define TELEMETRY_IIATR_LED_ON              (1U << 3)   /**< @brief Bit of @ref telemetry_record_t::actuators that stands for the IIATR LED being On. */
+#define TELEMETRY_AUTOTUNE_RUNNING          (1U << 4)   /**< @brief Bit of @ref telemetry_record_t::actuators that stands for the Auto-Tuning of the Internal Ambient Temperature PID Controller being on-going. */
+
+#if (TELEMETRY_LOG_CAPACITY & (TELEMETRY_LOG_CAPACITY - 1)) != 0
+#error "TELEMETRY_LOG_CAPACITY must be a power of two."
+#endif
+
+/**@brief	Telemetry record structure.
+ *
+ * @details This holds one snapshot of the process variables of the MTKATR001 System, which is packed so that it takes
+ *          20 bytes.
+ */
+typedef struct __attribute__((packed))
+{
+    uint32_t timestamp;                         //!< HAL Tick at which the snapshot was taken.
+    int16_t cold_water_temperature;             //!< Cold Water Temperature in centi-degrees Celsius.
+    int16_t hot_water_temperature;              //!< Hot Water Temperature in centi-degrees Celsius.
+    int16_t internal_ambient_temperature;       //!< Internal Ambient Temperature in centi-degrees Celsius.
+    int8_t desired_internal_ambient_temperature;    //!< Desired Internal Ambient Temperature in degrees Celsius.
+    uint8_t desired_hot_water_temperature;      //!< Desired Hot Water Temperature in degrees Celsius.
+    uint16_t cold_fan_compare;                  //!< Compare value of the PWM of the Cold Fan.
+    uint16_t hot_fan_compare;                   //!< Compare value of the PWM of the Hot Fan.
+    uint8_t actuators;                          //!< Bitmask of the actuators that are On (e.g., @ref TELEMETRY_HEATER_ON ).
+    uint8_t sensors_validity;                   //!< Validity of each Temperature Sensor, in two bits per sensor ordered from the least significant ones as in @ref Temp_Sensor_Channel .
+    uint16_t active_faults;                     //!< Bitmask of the active faults, where bit N stands for the fault with index N in the array of faults given to the @ref fault_manager .
+} telemetry_record_t;
+
+/**@brief   Writes a snapshot into the next slot of the ring buffer of the @ref telemetry_log , overwriting the oldest
+ *          record if that ring buffer is full.
+ *
+ * @note    This function must only be called from a single context (e.g., a single task of the @ref task_scheduler ).
+ *
+ * @param[in] record    Pointer to the snapshot that wants to be written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void write_telemetry_record(const telemetry_record_t *record);
+
+/**@brief   Gets the total number of records that have been written into the @ref telemetry_log since it was
+ *          initialized, which is also the sequence number that the next record will have.
+ *
+ * @return  The total number of written records.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_telemetry_log_total_records(void);
+
+/**@brief   Reads in bulk consecutive records of the @ref telemetry_log .
+ *
+ * @details If the requested first record has already been overwritten, then the reading starts from the oldest record
+ *          that is still held instead, so that the caller can know how many records it missed from the updated
+ *          \p sequence param.
+ *
+ * @param[in,out] sequence  Pointer to the sequence number of the first record that wants to be read, which is updated
+ *                          into the sequence number of the first record that was actually read.
+ * @param[out] records      Pointer to the array into which the records will be copied, in chronological order.
+ * @param max_records       Maximum number of records that can be copied into the \p records param.
+ *
+ * @return  The number of records that were copied, which is zero if there are no records from the \p sequence param
+ *          onwards.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint16_t read_telemetry_records(uint32_t *sequence, telemetry_record_t *records, uint16_t max_records);
+
+/**@brief   Initializes the @ref telemetry_log with an empty ring buffer.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void init_telemetry_log(void);
+
+#endif /* TELEMETRY_LOG_H_ */
+
+/** @} */
@@ -0,0 +1,153 @@
+/**@file
+ * @brief	Telemetry Stream Header file.
+ *
+ * @defgroup telemetry_stream Telemetry Stream module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a periodic
+ *          binary stream of the live Temperatures and actuators of the MTKATR001 System, sent over the same UART as the
+ *          @ref app_side_etx_ota (e.g., towards the HM-10 BT Device), with the purpose of being used by the
+ *          application.
+ *
+ * @details The way that the @ref telemetry_stream works is that the application gives it a fresh
+ *          @ref telemetry_stream_sample_t each time that it calls the @ref run_telemetry_stream function, from which
+ *          this module takes one sample every configured period. Those samples are batched, up to
+ *          @ref TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME of them, into a frame that follows the General Data Format of
+ *          the ETX OTA Packets (i.e., SOF, Packet Type, Data Length, Data, 32-bit CRC and EOF) but with the
+ *          @ref TELEMETRY_STREAM_PACKET_TYPE Packet Type, so that the host can tell them apart from the ETX OTA
+ *          Packets. The Data field of each frame has the following little-endian fields:
+ *          <ol>
+ *              <li>Frame sequence number: 1 byte, which is incremented with each frame so that the host can detect a
+ *                  lost or dropped frame.</li>
+ *              <li>Number of samples: 1 byte.</li>
+ *              <li>Sample period in milliseconds: 2 bytes.</li>
+ *              <li>HAL Tick of the first sample: 4 bytes.</li>
+ *              <li>First sample: the Cold Water, Hot Water and Internal Ambient Temperatures, each in centi-degrees
+ *                  Celsius as a 16-bit signed integer, and then the actuators byte, for a total of 7 bytes.</li>
+ *              <li>Each of the other samples: the change of each of those three Temperatures with respect to the
+ *                  previous sample, each as an 8-bit signed integer, and then the actuators byte, for a total of 4
+ *                  bytes.</li>
+ *          </ol>
+ *          The samples of a frame are one sample period apart from each other. Whenever a change does not fit in 8
+ *          bits or a sample period is missed, the current frame is closed and the next sample starts a new frame, so
+ *          that every frame can be decoded on its own. A full frame takes 40 bytes, which the HM-10 BT Device sends as
+ *          two BLE packets of 20 bytes.
+ * @details Each frame is sent in non-blocking mode via the UART Interrupts, so the @ref run_telemetry_stream function
+ *          never waits for the UART. If the previous frame is still being sent, then the new one waits for the next
+ *          call of that function, replacing any older frame that was still waiting.
+ *
+ * @note    Since the @ref app_side_etx_ota sends its Packets in blocking mode over the same UART, the implementer has
+ *          to call the @ref pause_telemetry_stream function right before an ETX OTA Transaction (e.g., from the
+ *          @ref etx_ota_pre_transaction_handler function) and the @ref resume_telemetry_stream function after it.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef TELEMETRY_STREAM_H_
+#define TELEMETRY_STREAM_H_
+
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define TELEMETRY_STREAM_PACKET_TYPE            (0x10U)     /**< @brief Packet Type of the frames of the @ref telemetry_stream , which is different from the ones of the ETX OTA Packets. */
+#define TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME  (5U)        /**< @brief Maximum number of samples in each frame of the @ref telemetry_stream . */
+#define TELEMETRY_STREAM_MIN_PERIOD             (100U)      /**< @brief Shortest sample period, in milliseconds, that the @ref telemetry_stream accepts. */
+#define TELEMETRY_STREAM_DEFAULT_PERIOD         (500U)      /**< @brief Sample period, in milliseconds, with which the @ref telemetry_stream is expected to be initialized. */
+
+/**@brief	Telemetry Stream Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref telemetry_stream to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    TELEMETRY_STREAM_EC_OK      = 0U,   //!< Telemetry Stream Process was successful.
+    TELEMETRY_STREAM_EC_ERR     = 4U    //!< Telemetry Stream Process has failed.
+} Telemetry_Stream_Status;
+
+/**@brief	Telemetry Stream sample structure.
+ */
+typedef struct
+{
+    int16_t cold_water_temperature;             //!< Cold Water Temperature in centi-degrees Celsius.
+    int16_t hot_water_temperature;              //!< Hot Water Temperature in centi-degrees Celsius.
+    int16_t internal_ambient_temperature;       //!< Internal Ambient Temperature in centi-degrees Celsius.
+    uint8_t actuators;                          //!< Bitmask of the actuators that are On, with the same bits as @ref telemetry_record_t::actuators .
+} telemetry_stream_sample_t;
+
+/**@brief   Takes a sample for the @ref telemetry_stream if its sample period has elapsed, and sends the frame that is
+ *          waiting to be sent, if any, as soon as the UART is free.
+ *
+ * @note    This function should be called at least once every @ref TELEMETRY_STREAM_MIN_PERIOD milliseconds and only
+ *          from a single context (e.g., a single task of the @ref task_scheduler ).
+ *
+ * @param[in] sample    Pointer to the current sample of the MTKATR001 System.
+ * @param tick          Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void run_telemetry_stream(const telemetry_stream_sample_t *sample, uint32_t tick);
+
+/**@brief   Sets the sample period of the @ref telemetry_stream , which discards the samples of the current frame.
+ *
+ * @param period    Desired sample period in milliseconds, from @ref TELEMETRY_STREAM_MIN_PERIOD onwards, or zero to
+ *                  stop streaming.
+ *
+ * @retval  TELEMETRY_STREAM_EC_OK
+ * @retval  TELEMETRY_STREAM_EC_ERR     If the \p period param is out of range, in which case nothing is changed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Telemetry_Stream_Status set_telemetry_stream_period(uint16_t period);
+
+/**@brief   Gets the sample period of the @ref telemetry_stream .
+ *
+ * @return  The sample period in milliseconds, or zero if streaming is stopped.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint16_t get_telemetry_stream_period(void);
+
+/**@brief   Pauses the @ref telemetry_stream so that the UART is left free, aborting the frame that is being sent and
+ *          discarding the ones that were waiting, if any.
+ *
+ * @note    This function can be called from an Interrupt context.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void pause_telemetry_stream(void);
+
+/**@brief   Resumes the @ref telemetry_stream after having been paused via the @ref pause_telemetry_stream function,
+ *          where the next sample starts a new frame.
+ *
+ * @note    This function can be called from an Interrupt context.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void resume_telemetry_stream(void);
+
+/**@brief   Initializes the @ref telemetry_stream in order to be able to use its provided functions.
+ *
+ * @param[in] huart     Pointer to the UART Handle Structure of the UART through which the frames will be sent, whose
+ *                      Interrupts must be enabled.
+ * @param period        Desired sample period in milliseconds, from @ref TELEMETRY_STREAM_MIN_PERIOD onwards, or zero
+ *                      to not stream until a period is set via the @ref set_telemetry_stream_period function.
+ *
+ * @retval  TELEMETRY_STREAM_EC_OK
+ * @retval  TELEMETRY_STREAM_EC_ERR     If any of the given params is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Telemetry_Stream_Status init_telemetry_stream(UART_HandleTypeDef *huart, uint16_t period);
+
+#endif /* TELEMETRY_STREAM_H_ */
+
+/** @} */
@@ -0,0 +1,249 @@
+/**@file
+ * @brief	Temperature Sensors ADC Acquisition Header file.
+ *
+ * @defgroup temp_sensors Temperature Sensors ADC Acquisition module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as the ADC
+ *          acquisition layer of the LM35 Temperature Sensors of the MTKATR001 System with the purpose of being used by
+ *          the application.
+ *
+ * @details The way that the @ref temp_sensors works is that the ADC given to it via the @ref init_temp_sensors_module
+ *          function must have already been configured in Scan Mode, with Continuous Mode disabled, with the Cold Water,
+ *          Hot Water and Internal Ambient Temperature Sensors channels in its Ranks 1, 2 and 3 respectively (i.e., in
+ *          the same order as in @ref Temp_Sensor_Channel ), with the internal VREFINT channel in its Rank 4, with a
+ *          Timer event as its External Trigger and with a DMA Channel linked to it in Circular Mode and with Half-Word
+ *          data alignments. That initialization function will then arm the ADC and start the given Trigger Timer so
+ *          that each Trigger Timer event converts one Scan of all those channels into an internal Circular DMA buffer.
+ *          Since the conversions are started by the hardware, the Scans are taken at a fixed rate of
+ *          @ref TEMP_SENSORS_SCAN_RATE without any jitter from the software.
+ * @details That Circular DMA buffer holds two consecutive blocks of @ref TEMP_SENSORS_OVERSAMPLING_RATIO Scans each.
+ *          Each time that the DMA finishes writing one of those blocks, its Half-Transfer or Transfer-Complete
+ *          Interrupt ratiometrically compensates each conversion of each Scan with the VREFINT conversion of that
+ *          same Scan, accumulates all the Scans of that block for each channel and shifts the result to the right by
+ *          @ref TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS bits (i.e., Oversampling and Decimation), which yields one
+ *          sample of @ref TEMP_SENSORS_ADC_RESOLUTION_BITS bits per channel at a fixed rate of
+ *          @ref TEMP_SENSORS_SAMPLE_RATE , while the DMA keeps writing the other block. That decimated sample then
+ *          goes through the @ref sensor_filter of its channel (i.e., a short Median filter followed by a first-order
+ *          IIR Low-Pass filter, each of them configured per channel via the @ref init_temp_sensors_module function)
+ *          and the result is published together with the HAL Tick at which it was completed and with its sequence
+ *          number. Since the
+ *          CPU is only interrupted once per decimated sample, this costs almost nothing and adds no latency other
+ *          than the duration of the block itself.
+ * @details Since the ADC converts with respect to its own supply voltage (VDDA), any drift or ripple of that supply
+ *          would otherwise be read as a Temperature change of the LM35 sensors, whose output voltage does not depend
+ *          on it. Therefore, each conversion is multiplied by @ref TEMP_SENSORS_VREFINT_NOMINAL_VALUE and divided by
+ *          the VREFINT conversion of its own Scan, so that the published values always stand for a supply of exactly
+ *          @ref TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS millivolts, whatever the actual one is. The supply voltage that
+ *          was measured this way is also published in each decimated sample. In addition, the ADC runs its
+ *          self-calibration right before its conversions are started and then each time that the
+ *          @ref calibrate_temp_sensors_adc function is called, so that its offset is kept calibrated as the Temperature
+ *          of our MCU/MPU changes.
+ * @details This way, the application can get the latest decimated sample of any of the Temperature Sensors at any
+ *          moment via the @ref get_temp_sensor_adc_value function or get the latest decimated samples of all of them,
+ *          together with their timestamp, via the @ref get_temp_sensors_sample function, where neither of them blocks,
+ *          polls or locks anything.
+ *
+ * @note    The VREFINT of the STM32F1 series has no factory calibration value and it may be up to about 3% away from
+ *          its typical @ref TEMP_SENSORS_VREFINT_MILLIVOLTS , so the VREFINT compensation removes the supply drift and
+ *          ripple but not that constant gain error, which is left to the @ref sensor_calibration .
+ *
+ * @note    Oversampling and Decimation only increases the effective resolution if the Temperature Sensors signals
+ *          carry at least about one ADC LSB of noise, which is the case for the LM35 sensors of the MTKATR001 System.
+ *
+ * @note    If the @ref HAL_ADC_ConvHalfCpltCallback , the @ref HAL_ADC_ConvCpltCallback or the
+ *          @ref HAL_ADC_ErrorCallback functions provided by the STMicroelectronic's Library are used in the main
+ *          program or by another library, then this module will not be able to publish the decimated samples or to
+ *          report ADC or DMA errors via the @ref get_temp_sensors_status function respectively, unless the code used in
+ *          those functions that lies inside this module is added into that other main program or external library.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef TEMPERATURE_SENSORS_H_
+#define TEMPERATURE_SENSORS_H_
+
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "sensor_filter.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Median plus IIR Sensor Filter.
+
+#define TEMP_SENSORS_TOTAL_CHANNELS      (3)        /**< @brief Total number of Temperature Sensors channels that are converted by the ADC used by the @ref temp_sensors . */
+#define TEMP_SENSORS_ADC_TOTAL_CHANNELS  (TEMP_SENSORS_TOTAL_CHANNELS + 1)  /**< @brief Total number of channels in each Scan of the ADC used by the @ref temp_sensors , which are the Temperature Sensors channels followed by the VREFINT channel. */
+#define TEMP_SENSORS_VREFINT_MILLIVOLTS  (1200)     /**< @brief Typical voltage, in millivolts, of the internal VREFINT of our MCU/MPU. */
+#define TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS    (3300)  /**< @brief Nominal ADC supply voltage (VDDA), in millivolts, to which the conversions of the Temperature Sensors are compensated. */
+#define TEMP_SENSORS_VREFINT_NOMINAL_VALUE      ((TEMP_SENSORS_VREFINT_MILLIVOLTS*4095U + TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS/2) / TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS)    /**< @brief Raw 12-bit ADC value of the VREFINT channel when the ADC supply voltage equals the @ref TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS . */
+#define TEMP_SENSORS_MIN_VDDA_MILLIVOLTS (2400)     /**< @brief Lowest ADC supply voltage, in millivolts, at which the ADC of the STM32F1 series is specified to work. @details A VREFINT conversion that stands for a lower supply voltage is considered invalid, in which case the conversions of its Scan are used without compensation. */
+#define TEMP_SENSORS_MAX_VDDA_MILLIVOLTS (3600)     /**< @brief Highest ADC supply voltage, in millivolts, at which our MCU/MPU is specified to work. @details A VREFINT conversion that stands for a higher supply voltage is considered invalid, in which case the conversions of its Scan are used without compensation. */
+#define TEMP_SENSORS_SAMPLE_RATE         (100)      /**< @brief Rate in Hertz at which the @ref temp_sensors publishes a decimated sample of each Temperature Sensor. */
+#define TEMP_SENSORS_SAMPLE_PERIOD       (1000/TEMP_SENSORS_SAMPLE_RATE)    /**< @brief Time in milliseconds between two consecutive decimated samples of the Temperature Sensors. */
+#define TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS    (2)     /**< @brief Number of bits of resolution that are added to the 12-bit ADC via Oversampling and Decimation. @details Each extra bit requires four times more Scans per decimated sample (e.g., 2 extra bits require 16x oversampling and 3 extra bits require 64x oversampling). @note This value must be between 0 and 4. */
+#define TEMP_SENSORS_OVERSAMPLING_RATIO  (1 << (2*TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS))     /**< @brief Number of Scans that are accumulated into each decimated sample. */
+#define TEMP_SENSORS_SCAN_RATE           (TEMP_SENSORS_SAMPLE_RATE*TEMP_SENSORS_OVERSAMPLING_RATIO)  /**< @brief Rate in Hertz at which the Trigger Timer given to the @ref temp_sensors is expected to start each Scan of the Temperature Sensors. */
+#define TEMP_SENSORS_MAX_SCAN_RATE       (2500)     /**< @brief Maximum value that @ref TEMP_SENSORS_SCAN_RATE may have. @details Each Scan of the @ref TEMP_SENSORS_ADC_TOTAL_CHANNELS channels takes approximately 336 microseconds with the ADC clock (1 MHz) and sampling times (71.5 cycles) of the MTKATR001 System. Therefore, for example, 64x oversampling requires a @ref TEMP_SENSORS_SAMPLE_RATE of 39 Hz or lower. */
+#define TEMP_SENSORS_ADC_RESOLUTION_BITS (12 + TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS)    /**< @brief Effective resolution in bits of the decimated samples of the @ref temp_sensors . */
+#define TEMP_SENSORS_ADC_MAX_VALUE       (4095U << TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS) /**< @brief Decimated sample value that stands for the ADC reference voltage. */
+#define TEMP_SENSORS_LM35_CENTI_CELSIUS_PER_MILLIVOLT   (10)    /**< @brief Constant of the LM35 Temperature Sensor with which the Temperature in centi-degrees Celsius can be obtained whenever multiplying this Constant with the Voltage, in millivolts, read from the LM35 Sensor Output Pin. */
+
+#if (TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS < 0) || (TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS > 4)
+#error "TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS must be between 0 and 4 so that the decimated samples fit in 16 bits."
+#endif
+#if (TEMP_SENSORS_SCAN_RATE > TEMP_SENSORS_MAX_SCAN_RATE)
+#error "TEMP_SENSORS_SAMPLE_RATE is too high for the configured TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS."
+#endif
+
+/**@brief	Temperature Sensors ADC Acquisition Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref temp_sensors to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    TEMP_SENSORS_EC_OK      = 0U,    //!< Temperature Sensors ADC Acquisition Process was successful.
+    TEMP_SENSORS_EC_ERR     = 4U     //!< Temperature Sensors ADC Acquisition Process has failed.
+} Temp_Sensors_Status;
+
+/**@brief	Temperature Sensors channels definitions.
+ *
+ * @details These definitions indicate the index of each Temperature Sensor inside the Circular DMA buffer of the
+ *          @ref temp_sensors , which also matches the Rank of each Temperature Sensor channel in the Scan Mode of the
+ *          ADC minus one.
+ */
+typedef enum
+{
+    COLD_WATER_TEMP_SENSOR          = 0U,    //!< Cold Water Temperature Sensor (ADC1-CH0, Rank 1).
+    HOT_WATER_TEMP_SENSOR           = 1U,    //!< Hot Water Temperature Sensor (ADC1-CH1, Rank 2).
+    INTERNAL_AMBIENT_TEMP_SENSOR    = 2U     //!< Internal Ambient Temperature Sensor (ADC1-CH4, Rank 3).
+} Temp_Sensor_Channel;
+
+/**@brief	Temperature Sensors decimated sample structure.
+ *
+ * @details This holds the decimated ADC values of all the Temperature Sensors that were obtained from the same block
+ *          of Scans, together with the time at which that block was completed.
+ */
+typedef struct
+{
+    uint16_t adc_values[TEMP_SENSORS_TOTAL_CHANNELS];   //!< Decimated and filtered ADC values, of @ref TEMP_SENSORS_ADC_RESOLUTION_BITS bits each, ordered as in @ref Temp_Sensor_Channel . @note These values are compensated to an ADC supply voltage of @ref TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS .
+    uint16_t vdda_millivolts;                           //!< Average ADC supply voltage (VDDA), in millivolts, that was measured via the VREFINT channel during the block, or 0 if none of its VREFINT conversions was valid.
+    uint32_t timestamp;                                 //!< HAL Tick at which the last Scan of the block was completed.
+    uint32_t sequence;                                  //!< Number of decimated samples that have been published since the @ref temp_sensors was initialized, including this one. @note Two consecutive decimated samples are always @ref TEMP_SENSORS_SAMPLE_PERIOD milliseconds apart, so this field can be used to detect missed samples.
+} temp_sensors_sample_t;
+
+/**@brief	Gets the latest decimated ADC value that has been obtained for a desired Temperature Sensor.
+ *
+ * @details This function does not block, poll or lock anything since it only reads the corresponding element of the
+ *          latest decimated sample that has been published by the @ref temp_sensors .
+ *
+ * @param channel   Temperature Sensor whose latest ADC value is desired.
+ *
+ * @return  The latest decimated ADC value, of @ref TEMP_SENSORS_ADC_RESOLUTION_BITS bits, that has been obtained for
+ *          the requested Temperature Sensor.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint16_t get_temp_sensor_adc_value(Temp_Sensor_Channel channel);
+
+/**@brief   Converts a decimated ADC value of any of the LM35 Temperature Sensors into the Temperature that it stands for.
+ *
+ * @details This conversion is made in Fixed-Point arithmetic with a single multiplication by a Q16 constant that is
+ *          calculated by the compiler, followed by a rounding right shift of 16 bits, so that no Floating-Point
+ *          arithmetic is required. The result is within 0.6 centi-degrees Celsius of the exact conversion for any
+ *          decimated ADC value.
+ *
+ * @param adc_value Decimated ADC value (see @ref get_temp_sensor_adc_value ) that wants to be converted.
+ *
+ * @return  The Temperature, in centi-degrees Celsius, that the \p adc_value param stands for.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+int32_t convert_temp_sensor_adc_value_to_centi_celsius(uint16_t adc_value);
+
+/**@brief	Gets the current status of the ADC and DMA used by the @ref temp_sensors .
+ *
+ * @retval  TEMP_SENSORS_EC_OK  If the ADC conversions are currently running as expected.
+ * @retval  TEMP_SENSORS_EC_ERR If the @ref temp_sensors has not been initialized or if either the ADC or its DMA have
+ *                              reported an error, in which case the values of the Circular DMA buffer should not be
+ *                              trusted anymore.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Temp_Sensors_Status get_temp_sensors_status(void);
+
+/**@brief	Restarts the conversions of the ADC used by the @ref temp_sensors into its Circular DMA buffer after the ADC
+ *          or its DMA have reported an error, without stopping the Trigger Timer.
+ *
+ * @note    The @ref init_temp_sensors_module function must have been called successfully before.
+ *
+ * @retval  TEMP_SENSORS_EC_OK  If the ADC conversions have been restarted.
+ * @retval  TEMP_SENSORS_EC_ERR If the @ref temp_sensors has not been initialized or if the ADC could not be armed
+ *                              again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Temp_Sensors_Status restart_temp_sensors_module(void);
+
+/**@brief	Runs the self-calibration of the ADC used by the @ref temp_sensors and then restarts its conversions into
+ *          the Circular DMA buffer, without stopping the Trigger Timer.
+ *
+ * @details The self-calibration of the ADC of the STM32F1 series measures and removes its offset error, which drifts
+ *          with the Temperature of our MCU/MPU and, therefore, this function is expected to be called periodically.
+ *          It only takes a few microseconds, but the block of Scans that was being written at that moment is lost.
+ *
+ * @note    The @ref init_temp_sensors_module function must have been called successfully before.
+ *
+ * @retval  TEMP_SENSORS_EC_OK  If the ADC was calibrated and its conversions have been restarted.
+ * @retval  TEMP_SENSORS_EC_ERR If the @ref temp_sensors has not been initialized, if the self-calibration failed or if
+ *                              the ADC could not be armed again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Temp_Sensors_Status calibrate_temp_sensors_adc(void);
+
+/**@brief	Gets a copy of the latest decimated sample that has been published by the @ref temp_sensors .
+ *
+ * @details This function does not block or lock anything. If a new decimated sample is published while it is being
+ *          copied, then the copy is simply made again so that all the fields of the \p sample param always belong
+ *          to the same decimated sample.
+ *
+ * @param[out] sample   Pointer to the structure into which the latest decimated sample will be copied.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void get_temp_sensors_sample(temp_sensors_sample_t *sample);
+
+/**@brief   Initializes the @ref temp_sensors in order to be able to use its provided functions and also starts the
+ *          timer-triggered conversions of the given ADC into the Circular DMA buffer of this module.
+ *
+ * @note    <b>This function must be called only once</b> before calling any other function of the @ref temp_sensors .
+ *
+ * @param[in] hadc  Pointer to the ADC that the @ref temp_sensors will use, which must have already been initialized
+ *                  and configured as explained in the @ref temp_sensors description.
+ * @param[in] htim  Pointer to the Timer whose Output Compare event was configured as the External Trigger of the
+ *                  \p hadc param, which must have already been initialized in PWM Mode so that its frequency
+ *                  equals @ref TEMP_SENSORS_SCAN_RATE .
+ * @param tim_channel   Channel of the \p htim param whose Output Compare event triggers the \p hadc param.
+ * @param[in] filter_configs    Pointer to an array of @ref TEMP_SENSORS_TOTAL_CHANNELS configurations, ordered as in
+ *                              @ref Temp_Sensor_Channel , for the @ref sensor_filter of each channel. Note that the
+ *                              @ref sensor_filter_config_t::sample_rate field of each of them should be
+ *                              @ref TEMP_SENSORS_SAMPLE_RATE .
+ *
+ * @retval  TEMP_SENSORS_EC_OK  If the @ref temp_sensors was successfully initialized.
+ * @retval  TEMP_SENSORS_EC_ERR If any of the given filter configurations is invalid, if the self-calibration of the ADC
+ *                              failed or if either the ADC conversions in DMA Mode or the Trigger Timer could not be
+ *                              started.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Temp_Sensors_Status init_temp_sensors_module(ADC_HandleTypeDef *hadc, TIM_HandleTypeDef *htim, uint32_t tim_channel, const sensor_filter_config_t *filter_configs);
+
+#endif /* TEMPERATURE_SENSORS_H_ */
+
+/** @} */
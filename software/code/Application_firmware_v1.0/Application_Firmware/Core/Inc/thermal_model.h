@@ -0,0 +1,181 @@
+/**@file
+ * @brief	FOPDT Thermal Model Identifier Header file.
+ *
+ * @defgroup thermal_model FOPDT Thermal Model Identifier module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as an online
+ *          Recursive Least Squares (RLS) identifier of a First-Order-Plus-Dead-Time (FOPDT) model of a thermal process
+ *          with the purpose of being used by the application.
+ *
+ * @details The way that the @ref thermal_model works is that the implementer calls the @ref run_thermal_model function
+ *          periodically (e.g., at the rate of the controller of the process) with the current filtered measurement and
+ *          the input that has been applied to the process since the previous call. Those are averaged over each
+ *          @ref thermal_model_config_t::sample_period , so that the slow thermal process is sampled at a rate that
+ *          suits it, and each averaged sample updates the following discrete model of the process:
+ *          \f[ y_k - y_{k-1} = -\alpha y_{k-1} + b u_{k-d} + c \f]
+ *          where \f$y_k\f$ is the averaged measurement of the sample \f$k\f$ relative to the one of the first sample,
+ *          \f$u_k\f$ is the averaged input that was applied during the sample \f$k\f$ and \f$d\f$ is the dead time in
+ *          samples. Since the dead time cannot be estimated linearly, one RLS estimator with a forgetting factor is
+ *          run for each candidate dead time from 0 to @ref THERMAL_MODEL_DEAD_TIME_CANDIDATES - 1 samples, and the one
+ *          whose a priori prediction error has the lowest filtered power is taken as the model of the process.
+ * @details From the parameters of that model, the @ref get_thermal_model_estimate function gives the steady-state gain
+ *          \f$K = \frac{b}{\alpha}\f$ , the time constant \f$\tau \approx \frac{T_s}{\alpha} - \frac{T_s}{2}\f$ , the
+ *          dead time \f$\theta = d T_s\f$ and the measurement at which the process settles with no input
+ *          \f$y_0 + \frac{c}{\alpha}\f$ . These can then be turned into PI gains for a @ref pid_controller via the
+ *          @ref calculate_thermal_model_pid_gains function.
+ *
+ * @note    All the calculations are made in Q32.32 Fixed-Point arithmetic over normalized measurements and inputs (see
+ *          @ref thermal_model_config_t::measurement_scale and @ref thermal_model_config_t::input_scale ), so that the
+ *          covariance of the RLS estimators keeps enough resolution once they have converged. The resulting gains are
+ *          given in the same Q16 Fixed-Point format and units that are used by the @ref pid_controller .
+ * @note    The covariance of each RLS estimator stops being inflated by the forgetting factor once any of its diagonal
+ *          elements reaches its initial value, so that it cannot wind up while the process is not excited (e.g., while
+ *          the input is kept constant for hours).
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef THERMAL_MODEL_H_
+#define THERMAL_MODEL_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "pid_controller.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Fixed-Point PID Controller.
+
+#define THERMAL_MODEL_DEAD_TIME_CANDIDATES  (8)         /**< @brief Number of candidate dead times, in samples, for which an RLS estimator is run by the @ref thermal_model . */
+#define THERMAL_MODEL_TOTAL_PARAMETERS      (3)         /**< @brief Number of parameters (i.e., \f$\alpha\f$ , \f$b\f$ and \f$c\f$ ) that are estimated by each RLS estimator of the @ref thermal_model . */
+#define THERMAL_MODEL_Q32_SHIFT             (32)        /**< @brief Number of fractional bits of the Q32.32 Fixed-Point values of the @ref thermal_model . */
+
+/**@brief	FOPDT Thermal Model Identifier Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref thermal_model to indicate the resulting
+ *          status of having executed the process contained in each of those functions. For example, to indicate that
+ *          the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    THERMAL_MODEL_EC_OK         = 0U,   //!< FOPDT Thermal Model Identifier Process was successful.
+    THERMAL_MODEL_EC_ERR        = 4U,   //!< FOPDT Thermal Model Identifier Process has failed.
+    THERMAL_MODEL_EC_NO_DATA    = 6U    //!< FOPDT Thermal Model Identifier Process has concluded with no data to process (i.e., the model has not converged into a stable process yet).
+} Thermal_Model_Status;
+
+/**@brief	FOPDT Thermal Model Identifier Configuration parameters structure.
+ */
+typedef struct
+{
+    uint32_t sample_period;             //!< Time in milliseconds over which the measurements and inputs are averaged into each sample of the model, which should be at least a few times the period at which the @ref run_thermal_model function is called. @note This value must be greater than zero.
+    uint16_t forgetting_factor;         //!< Forgetting factor of the RLS estimators in Q16 Fixed-Point format (e.g., 65208 for 0.995), where lower values track changes of the process faster but with noisier estimates. @note This value must be greater than zero.
+    uint16_t min_samples;               //!< Number of samples that have to be taken before the model is considered to have converged.
+    uint16_t measurement_scale;         //!< Measurement units that stand for one normalized unit of the RLS estimators (e.g., 100 for measurements in centi-degrees Celsius). @note This value must be greater than zero.
+    uint16_t input_scale;               //!< Input units that stand for one normalized unit of the RLS estimators (e.g., 10000 for inputs in centi-percent). @note This value must be greater than zero.
+} thermal_model_config_t;
+
+/**@brief	FOPDT Thermal Model Identifier Estimate structure.
+ */
+typedef struct
+{
+    int32_t gain;                       //!< Steady-state gain \f$K\f$ in Q16 Fixed-Point format, in measurement units per input unit.
+    uint32_t time_constant;             //!< Time constant \f$\tau\f$ in milliseconds.
+    uint32_t dead_time;                 //!< Dead time \f$\theta\f$ in milliseconds.
+    int32_t equilibrium;                //!< Measurement at which the process settles while no input is applied, in measurement units (e.g., the temperature of the surroundings of a thermal process).
+    uint32_t samples;                   //!< Number of samples from which the model has been estimated.
+} thermal_model_estimate_t;
+
+/**@brief	RLS estimator structure of the @ref thermal_model for one candidate dead time.
+ */
+typedef struct
+{
+    int64_t parameters[THERMAL_MODEL_TOTAL_PARAMETERS];                                 //!< Estimated \f$\alpha\f$ , \f$b\f$ and \f$c\f$ parameters, in that order, in Q32.32 Fixed-Point format.
+    int64_t covariance[THERMAL_MODEL_TOTAL_PARAMETERS][THERMAL_MODEL_TOTAL_PARAMETERS]; //!< Covariance matrix of the estimated parameters in Q32.32 Fixed-Point format.
+    int64_t error_power;                                                                //!< Filtered power of the a priori prediction error in Q32.32 Fixed-Point format, with which the candidate dead times are compared.
+} thermal_model_rls_t;
+
+/**@brief	FOPDT Thermal Model Identifier Instance structure.
+ *
+ * @details This holds the state of one Identifier, which is populated by the functions of the @ref thermal_model .
+ */
+typedef struct
+{
+    thermal_model_config_t config;                              //!< Configuration with which the Identifier was initialized.
+    int64_t inverse_forgetting_factor;                          //!< Inverse of the @ref thermal_model_config_t::forgetting_factor in Q32.32 Fixed-Point format.
+    thermal_model_rls_t rls[THERMAL_MODEL_DEAD_TIME_CANDIDATES]; //!< RLS estimator of each candidate dead time, where the index stands for its number of samples.
+    int64_t inputs[THERMAL_MODEL_DEAD_TIME_CANDIDATES];         //!< Latest normalized inputs in Q32.32 Fixed-Point format, where the index stands for how many samples ago each of them was applied.
+    int64_t previous_measurement;                               //!< Normalized measurement of the previous sample, relative to the @ref thermal_model_t::reference , in Q32.32 Fixed-Point format.
+    int32_t reference;                                          //!< Measurement of the first sample, in measurement units, with respect to which the measurements are given to the RLS estimators.
+    int64_t measurements_sum;                                   //!< Sum of the measurements that have been given during the current sample.
+    int64_t inputs_sum;                                         //!< Sum of the inputs that have been given during the current sample.
+    uint16_t total_sums;                                        //!< Number of measurements and inputs that have been added into @ref thermal_model_t::measurements_sum and @ref thermal_model_t::inputs_sum .
+    uint32_t sample_start_tick;                                 //!< Tick, in milliseconds, at which the current sample started.
+    uint32_t samples;                                           //!< Number of samples that have updated the RLS estimators.
+    uint8_t is_started;                                         //!< Flag that indicates whether the first sample has been taken or not. @details 0 = Not taken<br>1 = Taken
+} thermal_model_t;
+
+/**@brief   Executes one period of an Identifier of the @ref thermal_model , which updates its RLS estimators once every
+ *          @ref thermal_model_config_t::sample_period .
+ *
+ * @param[in,out] model     Pointer to the Identifier, previously initialized via @ref init_thermal_model , that wants
+ *                          to be executed.
+ * @param measurement       Current filtered value of the controlled variable (e.g., in centi-degrees Celsius).
+ * @param input             Input that has been applied to the process since the previous call of this function (e.g.,
+ *                          in centi-percent of Fan Duty Cycle).
+ * @param tick              Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void run_thermal_model(thermal_model_t *model, int32_t measurement, int32_t input, uint32_t tick);
+
+/**@brief   Gets the FOPDT model that has been identified so far by an Identifier of the @ref thermal_model .
+ *
+ * @param[in] model     Pointer to the Identifier whose model wants to be obtained.
+ * @param[out] estimate Pointer to the structure into which the model will be written.
+ *
+ * @retval  THERMAL_MODEL_EC_OK
+ * @retval  THERMAL_MODEL_EC_NO_DATA    If fewer than @ref thermal_model_config_t::min_samples samples have been taken
+ *                                      or if the identified process is not stable, in which case only the
+ *                                      @ref thermal_model_estimate_t::samples of the \p estimate param is written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Thermal_Model_Status get_thermal_model_estimate(const thermal_model_t *model, thermal_model_estimate_t *estimate);
+
+/**@brief   Calculates the PI gains of a @ref pid_controller for the process of an identified FOPDT model with the SIMC
+ *          rules (i.e., \f$K_p = \frac{\tau}{K (\tau_c + \theta)}\f$ and \f$K_i = \frac{K_p}{\min(\tau, 4 (\tau_c +
+ *          \theta))}\f$ ).
+ *
+ * @param[in] estimate                  Pointer to the model, obtained via @ref get_thermal_model_estimate , of the
+ *                                      process that wants to be controlled.
+ * @param closed_loop_time_constant     Desired time constant \f$\tau_c\f$ , in milliseconds, of the controlled process,
+ *                                      where the dead time of the model is the fastest one that is recommended.
+ * @param[out] kp                       Pointer to the Proportional gain (see @ref pid_controller_config_t::kp ).
+ * @param[out] ki                       Pointer to the Integral gain (see @ref pid_controller_config_t::ki ).
+ *
+ * @retval  THERMAL_MODEL_EC_OK
+ * @retval  THERMAL_MODEL_EC_ERR    If the gain of the model is not positive or if the resulting gains do not fit in the
+ *                                  Q16 Fixed-Point format, in which case the \p kp and \p ki params are left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Thermal_Model_Status calculate_thermal_model_pid_gains(const thermal_model_estimate_t *estimate, uint32_t closed_loop_time_constant, int32_t *kp, int32_t *ki);
+
+/**@brief   Initializes an Identifier of the @ref thermal_model with a desired configuration, which discards any model
+ *          that it may have identified before.
+ *
+ * @param[out] model    Pointer to the Identifier that wants to be initialized.
+ * @param[in] config    Pointer to the desired configuration for the \p model param.
+ *
+ * @retval  THERMAL_MODEL_EC_OK
+ * @retval  THERMAL_MODEL_EC_ERR    If the \p config param has any invalid value, in which case the \p model param is
+ *                                  left unchanged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Thermal_Model_Status init_thermal_model(thermal_model_t *model, const thermal_model_config_t *config);
+
+#endif /* THERMAL_MODEL_H_ */
+
+/** @} */
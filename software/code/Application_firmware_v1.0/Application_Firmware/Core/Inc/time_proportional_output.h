@@ -0,0 +1,126 @@
+/**@file
+ * @brief	Time-Proportional Output Header file.
+ *
+ * @defgroup time_proportional_output Time-Proportional Output module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a
+ *          Time-Proportional Output (i.e., a slow PWM) for On/Off actuators, such as a relay or a Solid State Relay
+ *          (SSR), with the purpose of being used by the application.
+ *
+ * @details The way that the @ref time_proportional_output works is that the time is split into consecutive windows
+ *          of @ref time_proportional_output_config_t::window milliseconds, during each of which the actuator is turned
+ *          On only during the fraction of the window given by the latest Duty Cycle that was set via the
+ *          @ref set_time_proportional_output_duty_cycle function (e.g., the output of a @ref pid_controller ). The
+ *          Duty Cycle is latched at the start of each window, so that it can be updated at any time without
+ *          chopping the current window.
+ * @details In order to protect the actuator, any On time shorter than
+ *          @ref time_proportional_output_config_t::min_on_time is skipped, any Off time shorter than
+ *          @ref time_proportional_output_config_t::min_off_time is skipped as well (i.e., the actuator is kept On
+ *          during the whole window) and the state of the actuator is never changed before those minimum times have
+ *          elapsed since its last change.
+ *
+ * @note    The implementer has to call the @ref run_time_proportional_output function with a period much shorter
+ *          than the window, since the actuator can only be switched whenever that function is called.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef TIME_PROPORTIONAL_OUTPUT_H_
+#define TIME_PROPORTIONAL_OUTPUT_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE     (10000)     /**< @brief Duty Cycle, in centi-percent, that stands for keeping the actuator On during the whole window of the @ref time_proportional_output . */
+
+/**@brief	Time-Proportional Output Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref time_proportional_output to indicate the
+ *          resulting status of having executed the process contained in each of those functions. For example, to
+ *          indicate that the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    TIME_PROPORTIONAL_OUTPUT_EC_OK      = 0U,    //!< Time-Proportional Output Process was successful.
+    TIME_PROPORTIONAL_OUTPUT_EC_ERR     = 4U     //!< Time-Proportional Output Process has failed.
+} Time_Proportional_Output_Status;
+
+/**@brief	Time-Proportional Output Configuration parameters structure.
+ */
+typedef struct
+{
+    uint32_t window;                    //!< Length of each window, in milliseconds. @note This value must be greater than zero.
+    uint32_t min_on_time;               //!< Shortest time, in milliseconds, during which the actuator may be kept On. @note This value must be lower than the window.
+    uint32_t min_off_time;              //!< Shortest time, in milliseconds, during which the actuator may be kept Off. @note This value must be lower than the window.
+} time_proportional_output_config_t;
+
+/**@brief	Time-Proportional Output Instance structure.
+ *
+ * @details This holds the state of one output, which is populated by the functions of the
+ *          @ref time_proportional_output .
+ */
+typedef struct
+{
+    time_proportional_output_config_t config;   //!< Configuration with which the output was initialized.
+    uint16_t duty_cycle;                        //!< Latest Duty Cycle, in centi-percent, that was set for the output.
+    uint32_t on_time;                           //!< Time, in milliseconds, during which the actuator is to be kept On in the current window.
+    uint32_t window_start_tick;                 //!< Tick, in milliseconds, at which the current window started.
+    uint32_t last_switch_tick;                  //!< Tick, in milliseconds, at which the state of the actuator was lastly changed.
+    uint8_t is_on;                              //!< Flag that indicates whether the actuator is currently On (i.e., 1) or Off (i.e., 0).
+} time_proportional_output_t;
+
+/**@brief   Executes a Time-Proportional Output of the @ref time_proportional_output .
+ *
+ * @param[in,out] tpo   Pointer to the Time-Proportional Output that wants to be executed.
+ * @param tick          Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @retval  1   If the actuator is to be On.
+ * @retval  0   If the actuator is to be Off.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint8_t run_time_proportional_output(time_proportional_output_t *tpo, uint32_t tick);
+
+/**@brief   Sets the Duty Cycle of a Time-Proportional Output of the @ref time_proportional_output , which will be
+ *          applied from its next window on.
+ *
+ * @param[in,out] tpo   Pointer to the Time-Proportional Output whose Duty Cycle wants to be set.
+ * @param duty_cycle    Desired Duty Cycle in centi-percent. Any value outside of the range from zero to
+ *                      @ref TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE is limited to that range.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void set_time_proportional_output_duty_cycle(time_proportional_output_t *tpo, int32_t duty_cycle);
+
+/**@brief   Turns Off the actuator of a Time-Proportional Output of the @ref time_proportional_output , sets its Duty
+ *          Cycle to zero and starts a new window.
+ *
+ * @param[in,out] tpo   Pointer to the Time-Proportional Output that wants to be reset.
+ * @param tick          Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void reset_time_proportional_output(time_proportional_output_t *tpo, uint32_t tick);
+
+/**@brief   Initializes a Time-Proportional Output of the @ref time_proportional_output with a desired configuration,
+ *          with its actuator Off and with a zero Duty Cycle.
+ *
+ * @param[out] tpo      Pointer to the Time-Proportional Output that wants to be initialized.
+ * @param[in] config    Pointer to the desired configuration for the \p tpo param.
+ * @param tick          Current tick in milliseconds (e.g., @ref HAL_GetTick ).
+ *
+ * @retval  TIME_PROPORTIONAL_OUTPUT_EC_OK  If the Time-Proportional Output was successfully initialized.
+ * @retval  TIME_PROPORTIONAL_OUTPUT_EC_ERR If the \p config param has any invalid value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Time_Proportional_Output_Status init_time_proportional_output(time_proportional_output_t *tpo, const time_proportional_output_config_t *config, uint32_t tick);
+
+#endif /* TIME_PROPORTIONAL_OUTPUT_H_ */
+
+/** @} */
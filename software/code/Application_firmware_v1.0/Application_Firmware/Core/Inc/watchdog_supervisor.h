@@ -0,0 +1,158 @@
+/**@file
+ * @brief	Watchdog Supervisor Header file.
+ *
+ * @defgroup watchdog_supervisor Watchdog Supervisor module
+ * @{
+ *
+ * @brief   This module provides the functions, definitions, structures and variables that together work as a
+ *          supervisor of the tasks of the @ref task_scheduler via the Independent Watchdog (IWDG) of our MCU/MPU, with
+ *          the purpose of being used by the application.
+ *
+ * @details The way that the @ref watchdog_supervisor works is that each task of the @ref task_scheduler has to check
+ *          in, via the @ref watchdog_supervisor_check_in function, at most \f$period + deadline\f$ milliseconds after
+ *          its previous check-in. The @ref run_watchdog_supervisor function, which is expected to be called over and
+ *          over from the infinite loop of the main program, reloads the IWDG only once every task has checked in since
+ *          the previous reload and as long as none of them is currently late (i.e., past its window). Therefore, if
+ *          any task stops being executed or keeps missing its window, or if the main program gets stuck anywhere (e.g.,
+ *          inside an Interrupt that waits for the UART), then the IWDG resets our MCU/MPU once its timeout elapses,
+ *          while a task that is only late once in a while is tolerated as long as it checks in again within that
+ *          timeout.
+ * @details In addition, this module records in a retained RAM section (i.e., one that is not initialized by the
+ *          startup code) the last task that checked in and the task that is currently late, if any, so that after
+ *          our MCU/MPU is reset, the application can know via the @ref get_watchdog_supervisor_reset_info function
+ *          the cause of that reset, which task was to blame and how many resets have happened since it was powered
+ *          On.
+ *
+ * @note    The IWDG is configured directly via its registers, since the HAL IWDG driver is not part of this project,
+ *          and it can only be stopped by resetting our MCU/MPU. It is also frozen while the Core is halted by a
+ *          debugger.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef WATCHDOG_SUPERVISOR_H_
+#define WATCHDOG_SUPERVISOR_H_
+
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices. If yours is from a different type, then you will have to substitute the right one here for your particular STMicroelectronics device. However, if you cant figure out what the name of that header file is, then simply substitute this line of code by: #include "main.h"
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "task_scheduler.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Cooperative Task Scheduler.
+
+#define WATCHDOG_SUPERVISOR_NO_TASK             (0xFF)      /**< @brief Value that stands for no task in the fields of the @ref watchdog_supervisor_reset_info_t structure. */
+#define WATCHDOG_SUPERVISOR_LSI_FREQUENCY       (40000)     /**< @brief Typical frequency, in Hertz, of the LSI oscillator that clocks the IWDG. @note The actual frequency of the LSI of the STM32F1 series may vary from 30 kHz up to 60 kHz, so the actual IWDG timeout may be from 0.67 up to 1.33 times the requested one. */
+#define WATCHDOG_SUPERVISOR_MAX_TIMEOUT         (6552)      /**< @brief Longest IWDG timeout, in milliseconds, that can be requested to the @ref watchdog_supervisor , which is given by the 12-bit reload value of the IWDG with its prescaler set to divide the LSI by 64. */
+
+/**@brief	Watchdog Supervisor Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref watchdog_supervisor to indicate the
+ *          resulting status of having executed the process contained in each of those functions. For example, to
+ *          indicate that the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    WATCHDOG_SUPERVISOR_EC_OK       = 0U,   //!< Watchdog Supervisor Process was successful.
+    WATCHDOG_SUPERVISOR_EC_ERR      = 4U    //!< Watchdog Supervisor Process has failed.
+} Watchdog_Supervisor_Status;
+
+/**@brief	Causes of the latest reset of our MCU/MPU, as reported by the @ref watchdog_supervisor .
+ *
+ * @note    Whenever several reset flags are set at the same time, the most specific cause is the one reported (e.g.,
+ *          a Power-On reset also sets the flag of the NRST Pin reset).
+ */
+typedef enum
+{
+    RESET_CAUSE_UNKNOWN                 = 0U,   //!< No reset flag was set.
+    RESET_CAUSE_POWER_ON                = 1U,   //!< Power-On or Power-Down reset.
+    RESET_CAUSE_PIN                     = 2U,   //!< External reset via the NRST Pin.
+    RESET_CAUSE_SOFTWARE                = 3U,   //!< Software reset (e.g., via @ref HAL_NVIC_SystemReset ).
+    RESET_CAUSE_INDEPENDENT_WATCHDOG    = 4U,   //!< Reset by the IWDG because it was not reloaded in time.
+    RESET_CAUSE_WINDOW_WATCHDOG         = 5U,   //!< Reset by the Window Watchdog.
+    RESET_CAUSE_LOW_POWER               = 6U    //!< Illegal Low-Power mode entry reset.
+} Reset_Cause;
+
+/**@brief	Information about the latest reset of our MCU/MPU that is given by the @ref watchdog_supervisor .
+ */
+typedef struct
+{
+    Reset_Cause cause;                  //!< Cause of the latest reset.
+    uint8_t late_task;                  //!< Index, in the array given to the @ref init_watchdog_supervisor function, of the task that was late right before the latest reset, or @ref WATCHDOG_SUPERVISOR_NO_TASK if none.
+    uint8_t last_checked_in_task;       //!< Index of the task that lastly checked in right before the latest reset, or @ref WATCHDOG_SUPERVISOR_NO_TASK if none. @details Whenever the main program got stuck, this is either the task that got stuck or the task that was executed right before it got stuck.
+    uint32_t total_resets;              //!< Number of resets since our MCU/MPU was powered On.
+    uint32_t watchdog_resets;           //!< Number of those resets that were made by the IWDG.
+} watchdog_supervisor_reset_info_t;
+
+/**@brief   Records that a task of the @ref watchdog_supervisor is alive.
+ *
+ * @param task  Index, in the array given to the @ref init_watchdog_supervisor function, of the task.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void watchdog_supervisor_check_in(uint8_t task);
+
+/**@brief   Reloads the IWDG if every task of the @ref watchdog_supervisor has checked in since the previous reload
+ *          and none of them is currently late (i.e., past its check-in window).
+ *
+ * @note    This function is expected to be called over and over inside the infinite loop of the main program.
+ *
+ * @retval  WATCHDOG_SUPERVISOR_EC_OK   If the IWDG was reloaded or if some task has yet to check in within its window.
+ * @retval  WATCHDOG_SUPERVISOR_EC_ERR  If some task is currently late, in which case the IWDG will not be reloaded until
+ *                                      that task checks in again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Watchdog_Supervisor_Status run_watchdog_supervisor(void);
+
+/**@brief   Reloads the IWDG right away, without waiting for every task of the @ref watchdog_supervisor to check in,
+ *          as long as none of them is currently late (i.e., past its check-in window).
+ *
+ * @details This function is meant for the code that keeps the main program blocked for a bounded time on purpose
+ *          (e.g., an ETX OTA Transaction, which is handled inside the UART Interrupt), so that such code starts with
+ *          the whole IWDG timeout available. The tasks still have to check in as usual for the IWDG to be reloaded
+ *          again via @ref run_watchdog_supervisor .
+ *
+ * @retval  WATCHDOG_SUPERVISOR_EC_OK   If the IWDG was reloaded.
+ * @retval  WATCHDOG_SUPERVISOR_EC_ERR  If the @ref watchdog_supervisor has not been initialized or if some task is
+ *                                      currently late, in which case the IWDG is not reloaded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Watchdog_Supervisor_Status refresh_watchdog_supervisor(void);
+
+/**@brief   Gets the information about the latest reset of our MCU/MPU that the @ref watchdog_supervisor recorded when
+ *          it was initialized.
+ *
+ * @param[out] info Pointer to the structure into which the information will be written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void get_watchdog_supervisor_reset_info(watchdog_supervisor_reset_info_t *info);
+
+/**@brief   Records the cause of the latest reset of our MCU/MPU and then starts the IWDG to supervise the given tasks.
+ *
+ * @details The check-in window of each task is its period plus its deadline, and all the tasks are considered to have
+ *          checked in right when this function is called.
+ *
+ * @note    This function should be called right before starting to call the @ref run_task_scheduler function, since
+ *          any blocking initialization made after it would have to reload the IWDG by itself.
+ *
+ * @param[in] tasks     Pointer to the array of tasks given to the @ref task_scheduler .
+ * @param total_tasks   Number of tasks in the \p tasks param, which must be between 1 and
+ *                      @ref TASK_SCHEDULER_MAX_TASKS .
+ * @param timeout       IWDG timeout in milliseconds, which must be longer than the check-in window of every task and
+ *                      not longer than @ref WATCHDOG_SUPERVISOR_MAX_TIMEOUT .
+ *
+ * @retval  WATCHDOG_SUPERVISOR_EC_OK
+ * @retval  WATCHDOG_SUPERVISOR_EC_ERR  If any of the given params is invalid, in which case the IWDG is not started.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+Watchdog_Supervisor_Status init_watchdog_supervisor(const task_scheduler_task_t *tasks, uint8_t total_tasks, uint32_t timeout);
+
+#endif /* WATCHDOG_SUPERVISOR_H_ */
+
+/** @} */
@@ -6,6 +6,7 @@
 #include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
 
 #define SEVEN_SEGMENT_DISPLAY_5641AS_LEDS_SIZE      (8)        /**< @brief Total maximum LEDs available in single 7-segment Display of the 5641AS Device (including the Dp LED). */
+#define CENTI_UNITS_PER_UNIT                        (100)      /**< @brief Number of centi-units in one unit of the numbers that are given to the @ref convert_number_to_5641as_ASCII function. */
 
 static TIM_HandleTypeDef *p_htim;                                                                    /**< @brief Pointer to the Timer Handle Structure of the Timer that will be used in this @ref display_5641as to refresh/update the value shown at the 5641AS 7-segment Display Module. @details This pointer's value is defined in the @ref init_5641as_display_module function. */
 static Display_5641AS_peripherals_def_t *p_display_peripherals;                                      /**< @brief Pointer to the 5641AS 7-segment Display Device's Peripherals Definition Structure that will be used in this @ref display_5641as to control the GPIO Peripherals towards which the terminals of the 5641AS 7-segment Display device are connected to. @details This pointer's value is defined in the @ref init_5641as_display_module function. */
@@ -192,6 +193,214 @@ void stop_5641as_display_module(void)
     HAL_TIM_Base_Stop_IT(p_htim);
 }
 
+Display_5641AS_Status convert_number_to_5641as_ASCII(int32_t src, uint16_t *dst)
+{
+    if ((src>=(100*CENTI_UNITS_PER_UNIT)) || (src<=(-10*CENTI_UNITS_PER_UNIT)))
+    {
+        return Display_5641AS_EC_ERR;
+    }
+
+    if (src > 0)
+    {
+        uint8_t first_character = src/1000;
+        switch (first_character)
+        {
+            case 0:
+                dst[0] = Command_NULL_in_ASCII;
+                break;
+            case 1:
+                dst[0] = Number_1_in_ASCII;
+                break;
+            case 2:
+                dst[0] = Number_2_in_ASCII;
+                break;
+            case 3:
+                dst[0] = Number_3_in_ASCII;
+                break;
+            case 4:
+                dst[0] = Number_4_in_ASCII;
+                break;
+            case 5:
+                dst[0] = Number_5_in_ASCII;
+                break;
+            case 6:
+                dst[0] = Number_6_in_ASCII;
+                break;
+            case 7:
+                dst[0] = Number_7_in_ASCII;
+                break;
+            case 8:
+                dst[0] = Number_8_in_ASCII;
+                break;
+            case 9:
+                dst[0] = Number_9_in_ASCII;
+                break;
+            default:
+                // This case should not give place ever.
+        }
+
+        uint8_t second_character = (src/100) % 10;
+        switch (second_character)
+        {
+            case 0:
+                dst[1] = Number_0Dp_in_ASCII;
+                break;
+            case 1:
+                dst[1] = Number_1Dp_in_ASCII;
+                break;
+            case 2:
+                dst[1] = Number_2Dp_in_ASCII;
+                break;
+            case 3:
+                dst[1] = Number_3Dp_in_ASCII;
+                break;
+            case 4:
+                dst[1] = Number_4Dp_in_ASCII;
+                break;
+            case 5:
+                dst[1] = Number_5Dp_in_ASCII;
+                break;
+            case 6:
+                dst[1] = Number_6Dp_in_ASCII;
+                break;
+            case 7:
+                dst[1] = Number_7Dp_in_ASCII;
+                break;
+            case 8:
+                dst[1] = Number_8Dp_in_ASCII;
+                break;
+            case 9:
+                dst[1] = Number_9Dp_in_ASCII;
+                break;
+            default:
+                // This case should not give place ever.
+        }
+
+        uint8_t third_character = (src/10) % 10;
+        switch (third_character)
+        {
+            case 0:
+                dst[2] = Number_0_in_ASCII;
+                break;
+            case 1:
+                dst[2] = Number_1_in_ASCII;
+                break;
+            case 2:
+                dst[2] = Number_2_in_ASCII;
+                break;
+            case 3:
+                dst[2] = Number_3_in_ASCII;
+                break;
+            case 4:
+                dst[2] = Number_4_in_ASCII;
+                break;
+            case 5:
+                dst[2] = Number_5_in_ASCII;
+                break;
+            case 6:
+                dst[2] = Number_6_in_ASCII;
+                break;
+            case 7:
+                dst[2] = Number_7_in_ASCII;
+                break;
+            case 8:
+                dst[2] = Number_8_in_ASCII;
+                break;
+            case 9:
+                dst[2] = Number_9_in_ASCII;
+                break;
+            default:
+                // This case should not give place ever.
+        }
+    }
+    else if (src == 0)
+    {
+        dst[0] = Command_NULL_in_ASCII;
+        dst[1] = Number_0Dp_in_ASCII;
+        dst[2] = Number_0_in_ASCII;
+    }
+    else
+    {
+        dst[0] = Letter_minus_sign_in_ASCII;
+
+        uint8_t second_character = ((-1)*src)/100;
+        switch (second_character)
+        {
+            case 0:
+                dst[1] = Number_0Dp_in_ASCII;
+                break;
+            case 1:
+                dst[1] = Number_1Dp_in_ASCII;
+                break;
+            case 2:
+                dst[1] = Number_2Dp_in_ASCII;
+                break;
+            case 3:
+                dst[1] = Number_3Dp_in_ASCII;
+                break;
+            case 4:
+                dst[1] = Number_4Dp_in_ASCII;
+                break;
+            case 5:
+                dst[1] = Number_5Dp_in_ASCII;
+                break;
+            case 6:
+                dst[1] = Number_6Dp_in_ASCII;
+                break;
+            case 7:
+                dst[1] = Number_7Dp_in_ASCII;
+                break;
+            case 8:
+                dst[1] = Number_8Dp_in_ASCII;
+                break;
+            case 9:
+                dst[1] = Number_9Dp_in_ASCII;
+                break;
+            default:
+                // This case should not give place ever.
+        }
+
+        uint8_t third_character = (((-1)*src)/10) % 10;
+        switch (third_character)
+        {
+            case 0:
+                dst[2] = Number_0_in_ASCII;
+                break;
+            case 1:
+                dst[2] = Number_1_in_ASCII;
+                break;
+            case 2:
+                dst[2] = Number_2_in_ASCII;
+                break;
+            case 3:
+                dst[2] = Number_3_in_ASCII;
+                break;
+            case 4:
+                dst[2] = Number_4_in_ASCII;
+                break;
+            case 5:
+                dst[2] = Number_5_in_ASCII;
+                break;
+            case 6:
+                dst[2] = Number_6_in_ASCII;
+                break;
+            case 7:
+                dst[2] = Number_7_in_ASCII;
+                break;
+            case 8:
+                dst[2] = Number_8_in_ASCII;
+                break;
+            case 9:
+                dst[2] = Number_9_in_ASCII;
+                break;
+            default:
+                // This case should not give place ever.
+        }
+    }
+
+    return Display_5641AS_EC_OK;
+}
+
 void get_5641as_display_output(uint16_t display_output[DISPLAY_5641AS_CHARACTERS_SIZE])
 {
     memcpy(display_output, display_5641as_output, DISPLAY_5641AS_CHARACTERS_SIZE);
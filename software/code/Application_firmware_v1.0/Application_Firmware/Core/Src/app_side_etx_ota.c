@@ -17,6 +17,7 @@
 #define ETX_OTA_DATA_OVERHEAD 		(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE + ETX_OTA_CRC32_SIZE + ETX_OTA_EOF_SIZE)  	/**< @brief Data overhead in bytes of an ETX OTA Packet, which represents the bytes of an ETX OTA Packet except for the ones that it has at the Data field. */
 #define ETX_OTA_PACKET_MAX_SIZE 	(ETX_OTA_DATA_MAX_SIZE + ETX_OTA_DATA_OVERHEAD)																		/**< @brief Total bytes in an ETX OTA Packet. */
 #define ETX_OTA_DATA_FIELD_INDEX	(ETX_OTA_SOF_SIZE + ETX_OTA_PACKET_TYPE_SIZE + ETX_OTA_DATA_LENGTH_SIZE) 											/**< @brief Index position of where the Data field bytes of a ETX OTA Packet starts at. */
+#define ETX_OTA_REPLY_DATA_MAX_SIZE	(64U)			/**< @brief Designated maximum "Data" field's size in the ETX OTA Data Type Packets that our MCU/MPU sends back to the host via the @ref send_etx_ota_custom_data_reply function. */
 #define ETX_OTA_BL_FW_SIZE          (FLASH_PAGE_SIZE_IN_BYTES * ETX_BL_FLASH_PAGES_SIZE)   	/**< @brief Maximum size allowable for a Bootloader Firmware Image to have. */
 #define ETX_OTA_APP_FW_SIZE         (FLASH_PAGE_SIZE_IN_BYTES * ETX_APP_FLASH_PAGES_SIZE)   /**< @brief Maximum size allowable for an Application Firmware Image to have. */
 
@@ -107,6 +108,7 @@ typedef enum
 } is_ETX_OTA_enabled_flag_status;
 
 static uint8_t Rx_Buffer[ETX_OTA_PACKET_MAX_SIZE];			                    /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received ETX OTA Packet from the host. */
+static uint8_t Tx_Buffer[ETX_OTA_REPLY_DATA_MAX_SIZE + ETX_OTA_DATA_OVERHEAD];  /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of an ETX OTA Data Type Packet that is sent back to the host via the @ref send_etx_ota_custom_data_reply function. */
 static ETX_OTA_State etx_ota_state = ETX_OTA_STATE_IDLE;	                    /**< @brief Global variable used to hold the ETX OTA Process State at which our MCU/MPU is currently at. */
 static uint32_t etx_ota_fw_received_size = 0;				                    /**< @brief Global variable used to indicate the Total Size in bytes of the whole ETX OTA Payload that our MCU/MPU has received and written into the Flash Memory designated to the ETX OTA Protocol. */
 static is_ETX_OTA_enabled_flag_status is_etx_ota_enabled = ETX_OTA_DISABLED;    /**< @brief Global Flag used enable or disable ETX OTA Transactions. */
@@ -610,6 +612,47 @@ void stop_etx_ota()
 	is_etx_ota_enabled = ETX_OTA_DISABLED;
 }
 
+ETX_OTA_Status send_etx_ota_custom_data_reply(uint8_t *data, uint16_t size)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref ETX_OTA_Status function function type. */
+	ETX_OTA_Status ret;
+	/** <b>Local variable crc:</b> 32-bit CRC of the given data. */
+	uint32_t crc;
+
+	if ((size==0) || (size>ETX_OTA_REPLY_DATA_MAX_SIZE))
+	{
+		return ETX_OTA_EC_ERR;
+	}
+
+	/* Build the ETX OTA Data Type Packet with the General Data Format of the ETX OTA Packets. */
+	Tx_Buffer[0] = ETX_OTA_SOF;
+	Tx_Buffer[ETX_OTA_SOF_SIZE] = ETX_OTA_PACKET_TYPE_DATA;
+	memcpy(&Tx_Buffer[ETX_OTA_SOF_SIZE+ETX_OTA_PACKET_TYPE_SIZE], &size, ETX_OTA_DATA_LENGTH_SIZE);
+	memcpy(&Tx_Buffer[ETX_OTA_DATA_FIELD_INDEX], data, size);
+	crc = crc32_mpeg2(data, size);
+	memcpy(&Tx_Buffer[ETX_OTA_DATA_FIELD_INDEX+size], &crc, ETX_OTA_CRC32_SIZE);
+	Tx_Buffer[ETX_OTA_DATA_FIELD_INDEX+size+ETX_OTA_CRC32_SIZE] = ETX_OTA_EOF;
+
+	switch (ETX_OTA_hardware_protocol)
+	{
+		case ETX_OTA_hw_Protocol_UART:
+			ret = HAL_UART_Transmit(p_huart, Tx_Buffer, size+ETX_OTA_DATA_OVERHEAD, ETX_CUSTOM_HAL_TIMEOUT);
+			ret = HAL_ret_handler(ret);
+			break;
+		case ETX_OTA_hw_Protocol_BT:
+			ret = send_hm10_ota_data(Tx_Buffer, size+ETX_OTA_DATA_OVERHEAD, ETX_CUSTOM_HAL_TIMEOUT);
+			break;
+		default:
+			/* This should not happen since it should have been previously validated. */
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: Expected a Hardware Protocol value, but received something else: %d.\r\n", ETX_OTA_hardware_protocol);
+			#endif
+			return ETX_OTA_EC_ERR;
+	}
+
+	return ret;
+}
+
 /**@brief   Actions that are desired to be made with the ETX OTA Protocol whenever the non blocking mode, of the chosen
  *          Hardware Protocol, receives some data.
  *
@@ -0,0 +1,235 @@
+/** @addtogroup fault_manager
+ * @{
+ */
+
+#include "fault_manager.h"
+#include <stddef.h> // This library contains the NULL definition.
+
+#define FAULT_MANAGER_HISTORY_MASK          (FAULT_MANAGER_HISTORY_SIZE - 1)    /**< @brief Mask with which the indexes of the history of the @ref fault_manager are wrapped around. */
+
+/**@brief	Runtime state of a fault of the @ref fault_manager .
+ */
+typedef struct
+{
+    uint8_t is_active;                  //!< Flag that indicates whether the fault is currently active.
+    uint8_t is_latched;                 //!< Flag that indicates whether the fault has been latched until our MCU/MPU is reset.
+    uint8_t raise_count;                //!< Number of times that the fault has become active since its retry counter was last restarted.
+    uint32_t raise_sequence;            //!< Value of @ref raise_sequence_counter when the fault was lastly raised.
+    uint32_t last_present_tick;         //!< Tick, in milliseconds, at which the condition of the fault was lastly reported to be present.
+    uint32_t last_clear_tick;           //!< Tick, in milliseconds, at which the fault was lastly cleared.
+} fault_state_t;
+
+static const fault_def_t *p_faults = NULL;                                  /**< @brief Pointer to the definitions of the faults that are managed by the @ref fault_manager . @details This pointer's value is defined in the @ref init_fault_manager function. */
+static uint8_t total_managed_faults = 0;                                    /**< @brief Number of faults that are managed by the @ref fault_manager . */
+static fault_state_t fault_states[FAULT_MANAGER_MAX_FAULTS];                /**< @brief Runtime state of each fault. */
+static uint32_t raise_sequence_counter = 0;                                 /**< @brief Counter that is incremented each time that any fault is raised, so that the most recently raised fault can be told apart regardless of the tick overflow. */
+static fault_history_entry_t fault_history[FAULT_MANAGER_HISTORY_SIZE];     /**< @brief Ring buffer of the events of the faults. */
+static uint32_t fault_history_total_events = 0;                             /**< @brief Number of events that have been recorded since the @ref fault_manager was initialized, whose lowest bits are also the index at which the next event will be written into @ref fault_history . */
+
+/**@brief   Gets the index, in the array given to the @ref init_fault_manager function, of a fault.
+ *
+ * @param code  Exception Code of the fault.
+ *
+ * @return  The index of the fault, or -1 if the \p code param does not stand for any of the managed faults.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static int16_t find_fault(uint8_t code);
+
+/**@brief   Records an event into the history of the @ref fault_manager , overwriting its oldest event if it is full.
+ *
+ * @param code  Exception Code of the fault of the event.
+ * @param event Type of the event.
+ * @param tick  Tick, in milliseconds, at which the event gave place.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void record_fault_event(uint8_t code, Fault_Event_Type event, uint32_t tick);
+
+Fault_Manager_Status set_fault_condition(uint8_t code, uint8_t is_present, uint32_t tick)
+{
+    /** <b>Local variable index:</b> Index of the fault whose condition is being reported. */
+    int16_t index = find_fault(code);
+    /** <b>Local variable def:</b> Pointer to the definition of the fault whose condition is being reported. */
+    const fault_def_t *def;
+    /** <b>Local variable state:</b> Pointer to the runtime state of the fault whose condition is being reported. */
+    fault_state_t *state;
+
+    if (index < 0)
+    {
+        return FAULT_MANAGER_EC_ERR;
+    }
+    def = &p_faults[index];
+    state = &fault_states[index];
+
+    if (is_present)
+    {
+        state->last_present_tick = tick;
+        if (!state->is_active)
+        {
+            /* Forgive the previous retries of the fault if it has stayed cleared long enough. */
+            if ((state->raise_count > 0) && ((tick - state->last_clear_tick) >= FAULT_MANAGER_RETRY_RESET_TIME))
+            {
+                state->raise_count = 0;
+            }
+            if (state->raise_count < UINT8_MAX)
+            {
+                state->raise_count++;
+            }
+            state->is_active = 1;
+            state->raise_sequence = ++raise_sequence_counter;
+            record_fault_event(code, FAULT_EVENT_RAISED, tick);
+
+            /* Latch the fault if it is meant to be latched or if it has come back more times than allowed, where the first raise is not a retry. */
+            if (def->is_latched)
+            {
+                state->is_latched = 1;
+            }
+            else if (state->raise_count > (def->max_retries + 1))
+            {
+                state->is_latched = 1;
+                record_fault_event(code, FAULT_EVENT_LATCHED, tick);
+            }
+        }
+    }
+    else if (state->is_active && !state->is_latched && ((tick - state->last_present_tick) >= def->clear_time))
+    {
+        state->is_active = 0;
+        state->last_clear_tick = tick;
+        record_fault_event(code, FAULT_EVENT_CLEARED, tick);
+    }
+
+    return FAULT_MANAGER_EC_OK;
+}
+
+uint8_t is_fault_active(uint8_t code)
+{
+    /** <b>Local variable index:</b> Index of the requested fault. */
+    int16_t index = find_fault(code);
+
+    if (index < 0)
+    {
+        return 0;
+    }
+
+    return fault_states[index].is_active;
+}
+
+uint32_t get_fault_manager_lost_capabilities(void)
+{
+    /** <b>Local variable lost_capabilities:</b> Bitwise OR of the capabilities lost by the active faults. */
+    uint32_t lost_capabilities = 0;
+
+    for (uint8_t i=0; i<total_managed_faults; i++)
+    {
+        if (fault_states[i].is_active)
+        {
+            lost_capabilities |= p_faults[i].lost_capabilities;
+        }
+    }
+
+    return lost_capabilities;
+}
+
+uint8_t get_latest_active_fault(void)
+{
+    /** <b>Local variable latest_code:</b> Exception Code of the most recently raised active fault found so far. */
+    uint8_t latest_code = 0;
+    /** <b>Local variable latest_sequence:</b> Raise sequence of the most recently raised active fault found so far. */
+    uint32_t latest_sequence = 0;
+
+    for (uint8_t i=0; i<total_managed_faults; i++)
+    {
+        if (fault_states[i].is_active && ((latest_code == 0) || ((int32_t) (fault_states[i].raise_sequence - latest_sequence) > 0)))
+        {
+            latest_code = p_faults[i].code;
+            latest_sequence = fault_states[i].raise_sequence;
+        }
+    }
+
+    return latest_code;
+}
+
+uint32_t get_fault_history_total_events(void)
+{
+    return fault_history_total_events;
+}
+
+Fault_Manager_Status get_fault_history_entry(uint8_t index, fault_history_entry_t *entry)
+{
+    if ((index >= FAULT_MANAGER_HISTORY_SIZE) || (index >= fault_history_total_events))
+    {
+        return FAULT_MANAGER_EC_NO_DATA;
+    }
+
+    *entry = fault_history[(fault_history_total_events - 1 - index) & FAULT_MANAGER_HISTORY_MASK];
+
+    return FAULT_MANAGER_EC_OK;
+}
+
+Fault_Manager_Status init_fault_manager(const fault_def_t *faults, uint8_t total_faults)
+{
+    /* Validate the given parameters, including that each fault has a non-zero and unique Exception Code. */
+    if ((faults==NULL) || (total_faults==0) || (total_faults>FAULT_MANAGER_MAX_FAULTS))
+    {
+        return FAULT_MANAGER_EC_ERR;
+    }
+    for (uint8_t i=0; i<total_faults; i++)
+    {
+        if (faults[i].code == 0)
+        {
+            return FAULT_MANAGER_EC_ERR;
+        }
+        for (uint8_t j=i+1; j<total_faults; j++)
+        {
+            if (faults[i].code == faults[j].code)
+            {
+                return FAULT_MANAGER_EC_ERR;
+            }
+        }
+    }
+
+    p_faults = faults;
+    for (uint8_t i=0; i<total_faults; i++)
+    {
+        fault_states[i].is_active = 0;
+        fault_states[i].is_latched = 0;
+        fault_states[i].raise_count = 0;
+        fault_states[i].raise_sequence = 0;
+        fault_states[i].last_present_tick = 0;
+        fault_states[i].last_clear_tick = 0;
+    }
+    raise_sequence_counter = 0;
+    fault_history_total_events = 0;
+    total_managed_faults = total_faults;
+
+    return FAULT_MANAGER_EC_OK;
+}
+
+static int16_t find_fault(uint8_t code)
+{
+    for (uint8_t i=0; i<total_managed_faults; i++)
+    {
+        if (p_faults[i].code == code)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static void record_fault_event(uint8_t code, Fault_Event_Type event, uint32_t tick)
+{
+    /** <b>Local variable entry:</b> Pointer to the history entry into which the event is written. */
+    fault_history_entry_t *entry = &fault_history[fault_history_total_events & FAULT_MANAGER_HISTORY_MASK];
+
+    entry->tick = tick;
+    entry->code = code;
+    entry->event = event;
+    fault_history_total_events++;
+}
+
+/** @} */
@@ -12,12 +12,155 @@
     #include <stdio.h>	// Library from which "printf" is located at.
 #endif
 #include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
 #include "app_side_etx_ota.h" // This custom Mortrack's library contains the functions, definitions and variables required so that the Main module can receive and apply Firmware Update Images to our MCU/MPU.
 #include "5641as_display_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the 5641AS 7-segment Display Device.
+#include "task_scheduler.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Cooperative Task Scheduler.
+#include "temperature_sensors.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the ADC acquisition layer of the LM35 Temperature Sensors.
+#include "pid_controller.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Fixed-Point PID Controller.
+#include "pid_autotune.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Relay-Feedback PID Auto-Tuner.
+#include "time_proportional_output.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Time-Proportional Output.
+#include "push_buttons.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Debounced Push Buttons driver.
+#include "system_params.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the persistent storage of the MTKATR001 System Parameters in Flash Memory.
+#include "fault_manager.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a central manager of the faults of the MTKATR001 System.
+#include "sensor_calibration.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the per-channel calibration of the Temperature Sensors.
+#include "sensor_diagnostics.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the plausibility diagnostics of a sensor.
+#include "telemetry_log.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a RAM ring buffer of snapshots of the process variables of the MTKATR001 System.
+#include "telemetry_archive.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as an append-only archive of the Telemetry Log in Flash Memory.
+#include "telemetry_stream.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a periodic binary stream of the live Temperatures and actuators over the UART of the ETX OTA Protocol.
+#include "preheat_scheduler.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a predictive scheduler of the heating of a buffer that a heating loop needs to be ready.
+#include "thermal_model.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as an online RLS identifier of a First-Order-Plus-Dead-Time model of a thermal process.
+#include "watchdog_supervisor.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a supervisor of the tasks of the Cooperative Task Scheduler via the Independent Watchdog.
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
+/**@brief	MTKATR001 Exception codes.
+ *
+ * @details	These Exception Codes are returned by the functions of the @ref main to indicate the resulting status of
+ *          having executed the process contained in each of the processes of the main application. For example, to
+ *          indicate that the process executed by a certain function was successful or that it has failed.
+ */
+typedef enum
+{
+    MTKATR001_EC_OK                                 = 0U,   //!< MTKATR001 System Process was successful.
+    MTKATR001_EC_STOP                               = 1U,   //!< MTKATR001 ETX OTA Protocol Process or transaction has been stopped.
+    MTKATR001_EC_NR		                            = 2U,	//!< MTKATR001 ETX OTA Protocol has concluded with no response from Host.
+    MTKATR001_EC_NA                                 = 3U,   //!< MTKATR001 ETX OTA Payload received or to be received Not Applicable.
+    MTKATR001_EC_ERR                                = 4U,   //!< MTKATR001 ETX OTA Protocol has failed.
+    MTKATR001_EC_INIT_FW_UPDT_CONF_MODULE_ERR       = 5U,   //!< MTKATR001 Firmware Update Configurations Sub-module could not be initialized. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that the MCU/MPU's Flash Memory lifetime of the MTKATR001 Device has expired.
+    MTKATR001_EC_INIT_ETX_OTA_MODULE_ERR            = 6U,   //!< MTKATR001 ETX OTA Module could not be initialized. @note This case can might give place if the connection or requests between the Bluetooth Device and our MCU/MPU was temporarily lost or if a wrong configuration setting was sent to that Bluetooth Device. However, if this problem persists each time after energizing the MTKATR001 Device, then it is very likely that the Bluetooth Device's lifetime has expired.
+    MTKATR001_BOOTLOADER_FIRMWARE_VALIDATION_ERR    = 7U,   //!< MTKATR001 Bootloader Firmware Validation was unsuccessful. @note If this case ever gives place, although there is a ridiculously small probability that this can be due to a Bootloader Firmware that was mistakenly received as successful, when it was actually not it, the way most probable reason this Error will give place is due to having tampered with our MCU/MPU's Flash Memory (e.g., By attempting to reverse engineering it).
+    MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR   = 8U,   //!< MTKATR001 Application Firmware Validation was unsuccessful. @note If this case ever gives place, although there is a ridiculously small probability that this can be due to an Application Firmware that was mistakenly received as successful, when it was actually not it, the way most probable reason this Error will give place is due to having tampered with our MCU/MPU's Flash Memory (e.g., By attempting to reverse engineering it).
+    MTKATR001_HOT_WATER_TEMP_IS_UNDER_SHORTCIRCUIT  = 9U,   //!< MTKATR001 Hot Water Temperature Sensor is currently under a short-circuit. @note If this Error gives place, you can calmly disconnect the MTKATR001 Device from the AC Plug since it has a solid and very safe short-circuit protection that will not allow the current to go very high ever. However, the Hot Water Temperature Sensor will require to be changed with a new one after this in order for the MTKATR001 System to work as expected the next time you plug it back again the AC Cord.
+    MTKATR001_COLD_WATER_TEMP_IS_UNDER_SHORTCIRCUIT = 10U,  //!< MTKATR001 Cold Water Temperature Sensor is currently under a short-circuit. @note If this Error gives place, you can calmly disconnect the MTKATR001 Device from the AC Plug since it has a solid and very safe short-circuit protection that will not allow the current to go very high ever. However, the Cold Water Temperature Sensor will require to be changed with a new one after this in order for the MTKATR001 System to work as expected the next time you plug it back again the AC Cord.
+    MTKATR001_COLD_WATER_TEMP_ADC_ERR               = 11U,  //!< MTKATR001 Cold Water Temperature Sensor has been diagnosed as failed by the @ref sensor_diagnostics (e.g., it is being read outside the range that the LM35 can output, its readings are stuck or they have been implausible for too long), which means that either that sensor or its ADC Channel has failed. @note This fault is cleared once the readings are valid again, unless it keeps coming back (see @ref mtkatr001_faults ). If this problem persists each time you energize the MTKATR001 Device, then the Cold Water Temperature Sensor will require to be changed with a new one.
+    MTKATR001_HOT_WATER_TEMP_ADC_ERR                = 12U,  //!< MTKATR001 Hot Water Temperature Sensor has been diagnosed as failed by the @ref sensor_diagnostics (e.g., it is being read outside the range that the LM35 can output, its readings are stuck or they have been implausible for too long), which means that either that sensor or its ADC Channel has failed. @note This fault is cleared once the readings are valid again, unless it keeps coming back (see @ref mtkatr001_faults ). If this problem persists each time you energize the MTKATR001 Device, then the Hot Water Temperature Sensor will require to be changed with a new one.
+    MTKATR001_INTERNAL_AMBIENT_TEMP_ADC_ERR         = 13U,  //!< MTKATR001 Internal Ambient Temperature Sensor has been diagnosed as failed by the @ref sensor_diagnostics (e.g., it is being read outside the range that the LM35 can output, its readings are stuck or they have been implausible for too long), which means that either that sensor or its ADC Channel has failed. @note This fault is cleared once the readings are valid again, unless it keeps coming back (see @ref mtkatr001_faults ). If this problem persists each time you energize the MTKATR001 Device, then the Internal Ambient Temperature Sensor will require to be changed with a new one.
+    MTKATR001_TEMP_SENSORS_ADC_DMA_ERR              = 14U,  //!< MTKATR001 ADC, or its DMA, with which all the Temperature Sensors are being read with has responded with a HAL error/problem. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that either the MCU/MPU's ADC lifetime or even the lifetime of the actual MCU/MPU of the MTKATR001 Device has expired.
+    MTKATR001_SYSTEM_PARAMS_ERR                     = 15U,  //!< MTKATR001 System Parameters Storage module could not be initialized. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that the MCU/MPU's Flash Memory lifetime of the MTKATR001 Device has expired.
+    MTKATR001_HOT_WATER_OVER_TEMPERATURE            = 16U,  //!< MTKATR001 ADC Analog Watchdog has detected the Hot Water Temperature Sensor above the @ref HOT_WATER_MAX_TEMPERATURE and has de-energized the Water Heating Resistor (see @ref HAL_ADC_LevelOutOfWindowCallback ). @note If this Error gives place, then the Water Heating Resistor or its relay are very likely stuck On, so they should be checked before plugging the AC Cord back again.
+    MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE     = 17U,  //!< MTKATR001 Internal Ambient Temperature has risen above the @ref INTERNAL_AMBIENT_MAX_TEMPERATURE , as detected either by the @ref sensing_task or, if the tasks have stopped being executed, by the ADC Analog Watchdog that guards it (see @ref HAL_ADC_LevelOutOfWindowCallback ).
+    MTKATR001_WATCHDOG_RESET                        = 18U   //!< MTKATR001 System was reset by the Independent Watchdog because some of its tasks stopped checking in with the @ref watchdog_supervisor (see @ref MTKATR001_CMD_GET_RESET_INFO ). @note This fault is only informative, so it does not turn Off any capability of the MTKATR001 System and it is cleared after @ref WATCHDOG_RESET_FAULT_CLEAR_TIME milliseconds.
+} MTKATR001_Status;
+
+/**@brief	MTKATR001 ETX OTA Command identifiers.
+ *
+ * @details	These are the values that the first byte of an ETX OTA Custom Data must have so that it is handled as a
+ *          Command by the @ref comms_task instead of as the legacy 12 bytes with which the MTKATR001 System Parameters
+ *          are updated. This is possible because each byte of those legacy 12 bytes always has a value from 32 up to
+ *          126.
+ *
+ * @note    The multi-byte fields of the Commands are given in little-endian order.
+ */
+typedef enum
+{
+    MTKATR001_CMD_SET_PID_GAINS                     = 0x80U, //!< Sets and persists the gains of the Internal Ambient Temperature PID Controller. @details Followed by the Proportional, Integral and Derivative gains, each of them as a 32-bit signed integer in Q16 Fixed-Point format (see @ref pid_controller_config_t ), for a total of @ref ETX_OTA_SET_PID_GAINS_COMMAND_SIZE bytes.
+    MTKATR001_CMD_START_PID_AUTOTUNE                = 0x81U, //!< Starts the Auto-Tuning of the Internal Ambient Temperature PID Controller (see @ref start_internal_ambient_temp_autotune ). @details This Command has no other bytes.
+    MTKATR001_CMD_STOP_PID_AUTOTUNE                 = 0x82U, //!< Stops the on-going Auto-Tuning of the Internal Ambient Temperature PID Controller, if any, without changing its gains. @details This Command has no other bytes.
+    MTKATR001_CMD_GET_FAULT_HISTORY                 = 0x83U, //!< Requests the currently active fault and part of the fault history of the @ref fault_manager , which are sent back to the host via the @ref send_etx_ota_custom_data_reply function. @details Followed by a single byte with the index, where zero stands for the most recent event, of the first history event that wants to be received. The reply consists of this Command identifier, the Exception Code of the latest active fault (or zero if none), the lost capabilities (see @ref MTKATR001_ALL_CAPABILITIES ), the total number of recorded events as a 32-bit unsigned integer, the index of the first event, the number of events that follow (up to @ref ETX_OTA_FAULT_HISTORY_REPLY_MAX_ENTRIES ) and then, for each event, its tick as a 32-bit unsigned integer followed by its Exception Code and its @ref Fault_Event_Type .
+    MTKATR001_CMD_GET_RESET_INFO                    = 0x84U, //!< Requests the information about the latest reset of our MCU/MPU that was recorded by the @ref watchdog_supervisor , which is sent back to the host via the @ref send_etx_ota_custom_data_reply function. @details This Command has no other bytes. The reply consists of this Command identifier, the @ref Reset_Cause , the @ref MTKATR001_Task that was late and the one that lastly checked in right before that reset (or @ref WATCHDOG_SUPERVISOR_NO_TASK if none), and then the total number of resets and the number of Independent Watchdog resets since our MCU/MPU was powered On, each as a 32-bit unsigned integer.
+    MTKATR001_CMD_SET_SENSOR_CALIBRATION            = 0x85U, //!< Sets and persists the calibration table of a Temperature Sensor (see @ref set_sensor_calibration ). @details Followed by the @ref Temp_Sensor_Channel , the number of breakpoints (up to @ref SENSOR_CALIBRATION_MAX_POINTS , where zero removes the calibration) and then, for each breakpoint, its measured Temperature as a 16-bit unsigned integer followed by its actual Temperature as a 16-bit signed integer, both in centi-degrees Celsius and with strictly increasing measured Temperatures.
+    MTKATR001_CMD_GET_SENSOR_CALIBRATION            = 0x86U, //!< Requests the calibration table of a Temperature Sensor, which is sent back to the host via the @ref send_etx_ota_custom_data_reply function. @details Followed by a single byte with the @ref Temp_Sensor_Channel . The reply has the same format as the @ref MTKATR001_CMD_SET_SENSOR_CALIBRATION Command, but with this Command identifier.
+    MTKATR001_CMD_SET_TELEMETRY_STREAM_PERIOD       = 0x87U, //!< Sets the sample period of the @ref telemetry_stream (see @ref set_telemetry_stream_period ). @details Followed by the sample period in milliseconds as a 16-bit unsigned integer, where zero stops the streaming, for a total of @ref ETX_OTA_SET_TELEMETRY_STREAM_PERIOD_COMMAND_SIZE bytes. @note The sample period is not persisted, so the @ref telemetry_stream starts again with @ref TELEMETRY_STREAM_DEFAULT_PERIOD after our MCU/MPU is reset.
+    MTKATR001_CMD_GET_THERMAL_MODEL                 = 0x88U, //!< Requests the First-Order-Plus-Dead-Time model of the Internal Ambient Temperature that has been identified so far by the @ref thermal_model , which is sent back to the host via the @ref send_etx_ota_custom_data_reply function. @details This Command has no other bytes. The reply consists of this Command identifier, the @ref Thermal_Model_Status returned by the @ref get_thermal_model_estimate function and then the steady-state gain as a 32-bit signed integer in Q16 Fixed-Point format (in centi-degrees Celsius per centi-percent of Fan Duty Cycle), the time constant and the dead time in milliseconds, each as a 32-bit unsigned integer, the equilibrium Internal Ambient Temperature in centi-degrees Celsius as a 32-bit signed integer and the number of samples of the model as a 32-bit unsigned integer, where all but the last one are zero unless that status is @ref THERMAL_MODEL_EC_OK .
+    MTKATR001_CMD_APPLY_THERMAL_MODEL_GAINS         = 0x89U, //!< Calculates the gains of the Internal Ambient Temperature PID Controller from the model that has been identified by the @ref thermal_model , and then applies and persists them (see @ref apply_internal_ambient_thermal_model_gains ). @details This Command has no other bytes.
+    MTKATR001_CMD_GET_TELEMETRY_LOG                 = 0x8AU, //!< Requests records of the @ref telemetry_log , which are sent back to the host via the @ref send_telemetry_records_reply function. @details Followed by the sequence number of the first record that wants to be received as a 32-bit unsigned integer, for a total of @ref ETX_OTA_GET_TELEMETRY_RECORDS_COMMAND_SIZE bytes. The reply consists of this Command identifier, the sequence number that the next record written into the @ref telemetry_log will have, the sequence number that follows the last record that is sent (i.e., the one to be requested next), both as 32-bit unsigned integers, the number of records that follow (up to @ref ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS ) and then each @ref telemetry_record_t as it is packed in memory (i.e., in little-endian). @note If the requested first record has already been overwritten, then the oldest record that is still held is sent instead, so the host can tell how many records it missed.
+    MTKATR001_CMD_GET_TELEMETRY_ARCHIVE             = 0x8BU  //!< Requests records of the @ref telemetry_archive , which are sent back to the host via the @ref send_telemetry_records_reply function. @details Both this Command and its reply have the same format as with the @ref MTKATR001_CMD_GET_TELEMETRY_LOG Command, except that the sequence number that follows the last record that is sent also skips the records whose CRC does not match, so the reply may contain no records while that sequence number still advances.
+} MTKATR001_Command;
+
+/**@brief	Push Buttons of the MTKATR001 System, whose values are their indexes in the @ref mtkatr001_buttons Global
+ *          array variable.
+ */
+typedef enum
+{
+    MTKATR001_BUTTON_SHOW_DESIRED_TEMP              = 0U,   //!< Push Button with which the user requests to see the Desired Internal Ambient Temperature.
+    MTKATR001_BUTTON_SHOW_FIRMWARE_VERSION          = 1U,   //!< Push Button with which the user requests to see the current Application Firmware version.
+    MTKATR001_BUTTON_SHOW_HOT_FAN_DUTY_CYCLE        = 2U,   //!< Push Button with which the user requests to see the Hot Fan Duty Cycle.
+    MTKATR001_BUTTON_SHOW_COLD_FAN_DUTY_CYCLE       = 3U    //!< Push Button with which the user requests to see the Cold Fan Duty Cycle.
+} MTKATR001_Button;
+
+/**@brief	Tasks of the MTKATR001 System, whose values are their indexes in the @ref mtkatr001_tasks Global array
+ *          variable and, therefore, also their identifiers in the @ref watchdog_supervisor .
+ */
+typedef enum
+{
+    MTKATR001_TASK_SENSING                          = 0U,   //!< Sensing Task (see @ref sensing_task ).
+    MTKATR001_TASK_CONTROL                          = 1U,   //!< Control Task (see @ref control_task ).
+    MTKATR001_TASK_COMMS                            = 2U,   //!< Comms Task (see @ref comms_task ).
+    MTKATR001_TASK_DISPLAY                          = 3U    //!< Display Task (see @ref display_task ).
+} MTKATR001_Task;
+
+/**@brief	States of the Hot Air state machine of the MTKATR001 System (see @ref run_hot_air_state_machine ).
+ */
+typedef enum
+{
+    HOT_AIR_OFF                                     = 0U,   //!< The Hot Fan and the Hot Water Pump are turned Off because the Internal Ambient Temperature PID Controller does not request Hot Air.
+    HOT_AIR_WAITING_HOT_WATER                       = 1U,   //!< Hot Air is requested, but the Hot Fan and the Hot Water Pump are kept turned Off while the Hot Water is being heated above the @ref desired_hot_water_min_temperature .
+    HOT_AIR_ON                                      = 2U    //!< The Hot Fan is being driven with the requested Duty Cycle and the Hot Water Pump is turned On.
+} Hot_Air_State;
+
+/**@brief	States of the Cold Air state machine of the MTKATR001 System (see @ref run_cold_air_state_machine ).
+ */
+typedef enum
+{
+    COLD_AIR_OFF                                    = 0U,   //!< The Cold Fan and the Cold Water Pump are turned Off because the Internal Ambient Temperature PID Controller does not request Cold Air.
+    COLD_AIR_WAITING_COLD_WATER                     = 1U,   //!< Cold Air is requested, but the Cold Fan and the Cold Water Pump are kept turned Off while the user is requested to change the Cold Water for one colder than the @ref desired_cold_water_max_temperature .
+    COLD_AIR_ESCALATED                              = 2U,   //!< Cold Air has been requested for longer than @ref COLD_WATER_WAIT_TIMEOUT milliseconds without the Cold Water being changed, so the user is alerted more urgently and the Cold Fan is driven anyway while the Cold Water is still colder enough than the Internal Ambient Temperature.
+    COLD_AIR_ON                                     = 3U    //!< The Cold Fan is being driven with the requested Duty Cycle and the Cold Water Pump is turned On.
+} Cold_Air_State;
+
+/**@brief	ASCII code character definitions that are available in the @ref display_5641as and that are used by the
+ *          @ref main module for showing its own characters (e.g., the ones that light up all the 7-segment Displays).
+ *
+ * @note    These definitions are defined with respect to the decimal value that corresponds for each of the available
+ *          ASCII code characters.
+ */
+typedef enum
+{
+    Command_NULL_in_ASCII                   = 0,     //!< \f$[NULL]_{ASCII} = 0_d\f$.
+    Letter_minus_sign_in_ASCII              = 45,    //!< \f$-_{ASCII} = 45_d\f$.
+    Number_0_in_ASCII	                    = 48,    //!< \f$0_{ASCII} = 48_d\f$.
+    Number_1_in_ASCII	                    = 49,    //!< \f$1_{ASCII} = 49_d\f$.
+    Number_2_in_ASCII	                    = 50,    //!< \f$2_{ASCII} = 50_d\f$.
+    Number_3_in_ASCII	                    = 51,    //!< \f$3_{ASCII} = 51_d\f$.
+    Number_4_in_ASCII	                    = 52,    //!< \f$4_{ASCII} = 52_d\f$.
+    Number_5_in_ASCII	                    = 53,    //!< \f$5_{ASCII} = 53_d\f$.
+    Number_6_in_ASCII	                    = 54,    //!< \f$6_{ASCII} = 54_d\f$.
+    Number_7_in_ASCII	                    = 55,    //!< \f$7_{ASCII} = 55_d\f$.
+    Number_8_in_ASCII	                    = 56,    //!< \f$8_{ASCII} = 56_d\f$.
+    Number_9_in_ASCII	                    = 57,    //!< \f$9_{ASCII} = 57_d\f$.
+    Number_0Dp_in_ASCII	                    = 256,    //!< \f$0._{ASCII} = 256_d custom value\f$.
+    Number_1Dp_in_ASCII	                    = 257,    //!< \f$1._{ASCII} = 257_d custom value\f$.
+    Number_2Dp_in_ASCII	                    = 258,    //!< \f$2._{ASCII} = 258_d custom value\f$.
+    Number_3Dp_in_ASCII	                    = 259,    //!< \f$3._{ASCII} = 259_d custom value\f$.
+    Number_4Dp_in_ASCII	                    = 260,    //!< \f$4._{ASCII} = 260_d custom value\f$.
+    Number_5Dp_in_ASCII	                    = 261,    //!< \f$5._{ASCII} = 261_d custom value\f$.
+    Number_6Dp_in_ASCII	                    = 262,    //!< \f$6._{ASCII} = 262_d custom value\f$.
+    Number_7Dp_in_ASCII	                    = 263,    //!< \f$7._{ASCII} = 263_d custom value\f$.
+    Number_8Dp_in_ASCII	                    = 264,    //!< \f$8._{ASCII} = 264_d custom value\f$.
+    Number_9Dp_in_ASCII	                    = 265     //!< \f$9._{ASCII} = 265_d custom value\f$.
+} Display_ASCII_Characters;
 
 /* USER CODE END PTD */
 
@@ -28,32 +171,135 @@
 #define HOT_FAN_MAX_COMPARE_VALUE					(1818)									/**< @brief Maximum possible value for the Compare Register designated for the Hot Fan's PWM with respect to the ARR defined in the STM32CubeMx App. */
 #define COLD_FAN_TIMER_CHANNEL                      (TIM_CHANNEL_1)                         /**< @brief Timer Channel towards which the Cold Fan is connected to. */
 #define HOT_FAN_TIMER_CHANNEL                       (TIM_CHANNEL_2)                         /**< @brief Timer Channel towards which the Hot Fan is connected to. */
-#define ADC_POLL_TIMEOUT                            (100)                                   /**< @brief Designated Timeout for polling one Channel of the ADC of our MCU/MPU from which the MTKATR001 Temperature Sensors Outputs will be read from. */
-#define ADC_BITS_IN_DECIMAL_VALUE                   (4095.0)                                /**< @brief Bits of our MCU/MPU's ADC but in its equivalent decimal value. */
-#define MCU_POWER_SUPPLY_VOLTAGE                    (3.3)                                   /**< @brief Power Supply Voltage with which our MCU/MPU is being electrically energized with. */
-#define LM35_VOLTAGE_TO_CELSIUS_CONSTANT            (100.0)                                 /**< @brief Constant of the LM35 Temperature Sensor with which the Celsius Temperature can be obtained whenever multiplying this Constant with the Voltage read from the LM35 Sensor Output Pin. */
-#define INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED			(0.5)									/**< @brief Designated Error allowed in Celsius Degrees for the Internal Ambient Temperature to have. */
+#define TEMP_SENSORS_TRIGGER_TIMER_CHANNEL          (TIM_CHANNEL_4)                         /**< @brief Timer Channel whose Output Compare event triggers each Scan of the Temperature Sensors ADC. */
+#define COLD_WATER_TEMP_FILTER_MEDIAN_WINDOW        (3)                                     /**< @brief Number of samples used by the Median filter of the Cold Water Temperature Sensor. */
+#define COLD_WATER_TEMP_FILTER_CUTOFF_FREQUENCY     (500)                                   /**< @brief Cut-off frequency, in millihertz, of the IIR Low-Pass filter of the Cold Water Temperature Sensor. */
+#define HOT_WATER_TEMP_FILTER_MEDIAN_WINDOW         (3)                                     /**< @brief Number of samples used by the Median filter of the Hot Water Temperature Sensor. */
+#define HOT_WATER_TEMP_FILTER_CUTOFF_FREQUENCY      (500)                                   /**< @brief Cut-off frequency, in millihertz, of the IIR Low-Pass filter of the Hot Water Temperature Sensor. */
+#define INTERNAL_AMBIENT_TEMP_FILTER_MEDIAN_WINDOW  (5)                                     /**< @brief Number of samples used by the Median filter of the Internal Ambient Temperature Sensor. */
+#define INTERNAL_AMBIENT_TEMP_FILTER_CUTOFF_FREQUENCY (250)                                 /**< @brief Cut-off frequency, in millihertz, of the IIR Low-Pass filter of the Internal Ambient Temperature Sensor. */
+#define TEMP_SENSORS_TRIGGER_TIMER_FREQUENCY        (2000000)                               /**< @brief Frequency in Hertz at which the counter of the Timer that triggers each Scan of the Temperature Sensors ADC is incremented, with respect to the Prescaler defined in the STM32CubeMx App. */
+#define MCU_POWER_SUPPLY_MILLIVOLTS                 (TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS)  /**< @brief Power Supply Voltage, in millivolts, with which our MCU/MPU is being electrically energized with. @note The @ref temp_sensors compensates its decimated ADC values to this supply voltage via the VREFINT channel, so they can be converted as if it was exact. */
+#define INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED			(50)									/**< @brief Designated Error allowed in centi-degrees Celsius for the Internal Ambient Temperature to have. */
+#define INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KP        (20L << PID_CONTROLLER_Q16_SHIFT)       /**< @brief Default Proportional gain of the Internal Ambient Temperature PID Controller, which stands for 20 percent of Fan Duty Cycle per degree Celsius. @details This value is used whenever no gains have been persisted into the @ref system_params yet. */
+#define INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KI        ((1L << PID_CONTROLLER_Q16_SHIFT)/10)   /**< @brief Default Integral gain of the Internal Ambient Temperature PID Controller, which stands for 0.1 percent of Fan Duty Cycle per degree Celsius and per second. @details This value is used whenever no gains have been persisted into the @ref system_params yet. */
+#define INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KD        (0)                                     /**< @brief Default Derivative gain of the Internal Ambient Temperature PID Controller. @details This value is used whenever no gains have been persisted into the @ref system_params yet. */
+#define HOT_WATER_TEMP_PID_KP                       (10L << PID_CONTROLLER_Q16_SHIFT)       /**< @brief Proportional gain of the Hot Water Temperature PID Controller, which stands for 10 percent of Water Heating Resistor On time per degree Celsius. */
+#define HOT_WATER_TEMP_PID_KI                       ((1L << PID_CONTROLLER_Q16_SHIFT)/50)   /**< @brief Integral gain of the Hot Water Temperature PID Controller, which stands for 0.02 percent of Water Heating Resistor On time per degree Celsius and per second. */
+#define HOT_WATER_TEMP_PID_KD                       (0)                                     /**< @brief Derivative gain of the Hot Water Temperature PID Controller. */
+#define HOT_WATER_READY_HYSTERESIS                  (50)                                    /**< @brief Amount of centi-degrees Celsius above the @ref desired_hot_water_min_temperature that the Hot Water must reach so that the Hot Air state machine stops waiting for it, which prevents the Hot Fan from toggling whenever the Hot Water Temperature hovers around that threshold. */
+#define COLD_WATER_READY_HYSTERESIS                 (50)                                    /**< @brief Amount of centi-degrees Celsius below the @ref desired_cold_water_max_temperature that the Cold Water must reach so that the Cold Air state machine stops waiting for it, which prevents the Cold Fan from toggling whenever the Cold Water Temperature hovers around that threshold. */
+#define COLD_WATER_WAIT_TIMEOUT                     (600000)                                /**< @brief Time in milliseconds during which the Cold Air state machine waits for the Cold Water to be changed before escalating (see @ref COLD_AIR_ESCALATED ). */
+#define COLD_WATER_MIN_USEFUL_DIFFERENCE            (200)                                   /**< @brief Amount of centi-degrees Celsius that the Cold Water must be below the Internal Ambient Temperature so that the Cold Fan is driven anyway once the Cold Air state machine has escalated. */
+#define HOT_WATER_MAX_TEMPERATURE                   (70)                                    /**< @brief Highest Temperature, in degrees Celsius, that the Hot Water may reach before the ADC Analog Watchdog de-energizes the Water Heating Resistor. @note The @ref desired_hot_water_temperature should always be kept several degrees below this value. */
+#define INTERNAL_AMBIENT_MAX_TEMPERATURE            (45)                                    /**< @brief Highest Internal Ambient Temperature, in degrees Celsius, that the MTKATR001 System may reach before all its actuators are turned Off. */
+#define CENTI_CELSIUS_TO_RAW_ADC_VALUE(centi_celsius)   ((uint16_t) ((((uint32_t) (centi_celsius))*4095U + (MCU_POWER_SUPPLY_MILLIVOLTS*TEMP_SENSORS_LM35_CENTI_CELSIUS_PER_MILLIVOLT) - 1) / (MCU_POWER_SUPPLY_MILLIVOLTS*TEMP_SENSORS_LM35_CENTI_CELSIUS_PER_MILLIVOLT)))    /**< @brief Converts a positive Temperature of the LM35 Temperature Sensors, in centi-degrees Celsius, into the raw 12-bit ADC value that stands for it, rounded up. */
+#define OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD       (CENTI_CELSIUS_TO_RAW_ADC_VALUE(TO_CENTI_UNITS(HOT_WATER_MAX_TEMPERATURE)))    /**< @brief High Threshold, as a raw 12-bit ADC value, of the ADC Analog Watchdog that guards the Hot Water Temperature Sensor channel. @details The Analog Watchdog of the STM32F1 series has a single pair of thresholds for either one or all of the Regular Channels, and the VREFINT channel of the Temperature Sensors ADC is always above this threshold, so the Internal Ambient Temperature Sensor channel is guarded by the Analog Watchdog of a second ADC instead (see @ref AMBIENT_OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD ). @note This threshold is compared against the raw conversions, which are not compensated with the VREFINT channel, so it stands for a slightly lower Temperature while the ADC supply voltage is above the @ref MCU_POWER_SUPPLY_MILLIVOLTS and for a slightly higher one while it is below. */
+#define AMBIENT_OVER_TEMP_ADC_WATCHDOG_MARGIN       (2)                                     /**< @brief Temperature, in degrees Celsius, by which the @ref AMBIENT_OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD is above the @ref INTERNAL_AMBIENT_MAX_TEMPERATURE , so that the noise of the single unfiltered conversions that it is compared against does not trip it before the @ref sensing_task does. */
+#define AMBIENT_OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD   (CENTI_CELSIUS_TO_RAW_ADC_VALUE(TO_CENTI_UNITS(INTERNAL_AMBIENT_MAX_TEMPERATURE + AMBIENT_OVER_TEMP_ADC_WATCHDOG_MARGIN)))    /**< @brief High Threshold, as a raw 12-bit ADC value, of the ADC Analog Watchdog that guards the Internal Ambient Temperature Sensor channel. @details This is the hardware backstop of the @ref INTERNAL_AMBIENT_MAX_TEMPERATURE , which is otherwise enforced by software from the @ref sensing_task , so that the heating actuators are still turned Off if the tasks stop being executed. @note As the @ref OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD , this threshold is compared against raw conversions that are not compensated with the VREFINT channel. */
+#define LM35_MAX_TEMPERATURE                        (150)                                   /**< @brief Highest Temperature, in degrees Celsius, that the LM35 Temperature Sensors can output, so that any reading above it stands for a failed sensor or ADC Channel. */
+#define LM35_MIN_TEMPERATURE                        (0)                                     /**< @brief Lowest Temperature, in degrees Celsius, that the LM35 Temperature Sensors can output in the basic configuration of the MTKATR001 System, so that any reading below it stands for a failed sensor or ADC Channel. */
+#define WATER_TEMP_MAX_RATE                         (500)                                   /**< @brief Fastest change, in centi-degrees Celsius per second, that the Cold or the Hot Water Temperature can physically make, so that any faster change of their readings makes their Temperature Sensor suspect. */
+#define INTERNAL_AMBIENT_TEMP_MAX_RATE              (200)                                   /**< @brief Fastest change, in centi-degrees Celsius per second, that the Internal Ambient Temperature can physically make, so that any faster change of its readings makes its Temperature Sensor suspect. */
+#define TEMP_SENSOR_STUCK_TIME                      (600000)                                /**< @brief Time in milliseconds after which a Temperature Sensor whose readings have not changed at all is diagnosed as failed. @details The decimated samples have about 0.02 degrees Celsius of resolution, so the noise of a live LM35 always makes them change well within this time. */
+#define TEMP_SENSOR_SETTLE_TIME                     (2000)                                  /**< @brief Time in milliseconds during which a suspect Temperature Sensor must pass all its plausibility checks before it is trusted again. */
+#define TEMP_SENSOR_SUSPECT_FAIL_TIME               (10000)                                 /**< @brief Time in milliseconds after which a Temperature Sensor that keeps being suspect is diagnosed as failed. */
+#define HOT_WATER_CROSS_CHECK_MARGIN                (15)                                    /**< @brief Temperature, in degrees Celsius, by which the Internal Ambient Temperature has to be above the Hot Water Temperature, while the Hot Water is being heated, for the Hot Water Temperature Sensor to be suspect. @details The Hot Water is heated well above the Internal Ambient Temperature in normal operation, so such a difference means that the Hot Water Temperature Sensor is very likely reading too low, which would otherwise keep the Water Heating Resistor On. */
+#define HOT_WATER_CROSS_CHECK_HEATING_TIME          (60000)                                 /**< @brief Time in milliseconds during which the Water Heating Resistor must have been kept On without interruption before the Hot Water is considered to be being heated by the Cross check of the Hot Water Temperature Sensor. @details A Hot Water Temperature Sensor that reads too low makes the Hot Water Temperature PID Controller saturate, which keeps the Water Heating Resistor On through whole windows of its Time-Proportional Output. Requiring it to be On for several of those windows keeps the Cross check from failing while the Hot Water is just cooling down or starting to be heated from below the Internal Ambient Temperature. */
+#define MTKATR001_CAPABILITY_HEATING                (1U << 0)                               /**< @brief Capability of the MTKATR001 System to throw Heat inside it, which involves the Water Heating Resistor, the Hot Water Pump and the Hot Fan. */
+#define MTKATR001_CAPABILITY_COOLING                (1U << 1)                               /**< @brief Capability of the MTKATR001 System to throw Cold Air inside it, which involves the Cold Water Pump and the Cold Fan. */
+#define MTKATR001_ALL_CAPABILITIES                  (MTKATR001_CAPABILITY_HEATING | MTKATR001_CAPABILITY_COOLING)   /**< @brief All the capabilities of the MTKATR001 System, whose loss leaves it with no other choice than keeping all its actuators turned Off. */
+#define SENSOR_FAULT_MAX_RETRIES                    (3)                                     /**< @brief Number of times that a non-latched fault of the Temperature Sensors may come back, after having been cleared, before the @ref fault_manager latches it. */
+#define SENSOR_FAULT_CLEAR_TIME                     (5000)                                  /**< @brief Time in milliseconds during which a Temperature Sensor must be read within its valid range before its fault is cleared. */
+#define ADC_DMA_FAULT_CLEAR_TIME                    (1000)                                  /**< @brief Time in milliseconds during which the ADC and DMA of the Temperature Sensors must keep running after having been restarted before the @ref MTKATR001_TEMP_SENSORS_ADC_DMA_ERR fault is cleared. */
+#define AMBIENT_OVER_TEMP_FAULT_CLEAR_TIME          (60000)                                 /**< @brief Time in milliseconds during which the Internal Ambient Temperature must stay below the @ref INTERNAL_AMBIENT_MAX_TEMPERATURE before the @ref MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE fault is cleared. */
+#define WATCHDOG_RESET_FAULT_CLEAR_TIME             (60000)                                 /**< @brief Time in milliseconds, since our MCU/MPU was started, during which the @ref MTKATR001_WATCHDOG_RESET fault is kept active so that it can be seen at the 7-segment Display Device. */
+#define TEMP_SENSORS_ADC_CALIBRATION_PERIOD         (600000)                                /**< @brief Time in milliseconds between two consecutive self-calibrations of the Temperature Sensors ADC (see @ref calibrate_temp_sensors_adc ), which keep its offset calibrated as the Temperature of our MCU/MPU changes. */
+#define TELEMETRY_LOG_PERIOD                        (10000)                                 /**< @brief Time in milliseconds between two consecutive snapshots of the process variables of the MTKATR001 System that are written into the @ref telemetry_log . @details With the @ref TELEMETRY_LOG_CAPACITY records of the @ref telemetry_log , this keeps the latest 21 minutes of history in RAM, while the @ref telemetry_archive keeps about the latest 2.8 hours of it in Flash Memory. */
+#define THERMAL_MODEL_SAMPLE_PERIOD                 (10000)                                 /**< @brief Time in milliseconds over which the Internal Ambient Temperature and the output of the Fans are averaged into each sample of the @ref thermal_model , which is short enough for the dead times and long enough for the time constants of the MTKATR001 System. */
+#define THERMAL_MODEL_FORGETTING_FACTOR             (65208)                                 /**< @brief Forgetting factor, in Q16 Fixed-Point format, of the @ref thermal_model , which stands for 0.995 and thus makes it remember about the latest 200 samples (i.e., about 33 minutes). */
+#define THERMAL_MODEL_MIN_SAMPLES                   (180)                                   /**< @brief Number of samples (i.e., 30 minutes) that the @ref thermal_model has to take before its model is considered to have converged. */
+#define THERMAL_MODEL_MIN_CLOSED_LOOP_TIME          (60000)                                 /**< @brief Shortest closed-loop time constant, in milliseconds, with which the gains of the Internal Ambient Temperature PID Controller are calculated from the @ref thermal_model , which is used instead of its dead time whenever that one is shorter. */
+#define TOTAL_MTKATR001_FAULTS                      (12)                                    /**< @brief Total number of faults given to the @ref fault_manager . */
+#define WATER_HEATER_WINDOW_TIME                    (10000)                                 /**< @brief Length in milliseconds of each window of the Time-Proportional Output that drives the Water Heating Resistor. */
+#define WATER_HEATER_MIN_ON_TIME                    (1000)                                  /**< @brief Shortest time in milliseconds during which the Water Heating Resistor may be kept On, which protects its relay. */
+#define WATER_HEATER_MIN_OFF_TIME                   (1000)                                  /**< @brief Shortest time in milliseconds during which the Water Heating Resistor may be kept Off, which protects its relay. */
+#define PREHEAT_WINDOW_TIME                         (60000)                                 /**< @brief Time in milliseconds over which each change of the Hot Water and Internal Ambient Temperatures is measured by the @ref preheat_scheduler , which spans several windows of the Time-Proportional Output of the Water Heating Resistor. */
+#define PREHEAT_FILTER_SHIFT                        (3)                                     /**< @brief Number of bits by which the change of each rate learned by the @ref preheat_scheduler is divided with each new window, which makes it remember about the latest 8 windows. */
+#define PREHEAT_MIN_SAMPLES                         (3)                                     /**< @brief Number of windows from which each rate has to be learned by the @ref preheat_scheduler before the Hot Water is heated ahead of when it is needed, instead of only on demand. */
+#define PREHEAT_LEAD_MARGIN                         (120000)                                /**< @brief Extra time in milliseconds by which the Hot Water is requested to be ready before the Internal Ambient Temperature is predicted to need Heat, which covers the errors of the @ref preheat_scheduler . */
+#define PID_AUTOTUNE_HYSTERESIS                     (20)                                    /**< @brief Hysteresis, in centi-degrees Celsius, of the relay that is applied while Auto-Tuning the Internal Ambient Temperature PID Controller. @note This value must be greater than the noise of the filtered Internal Ambient Temperature. */
+#define PID_AUTOTUNE_CYCLES                         (3)                                     /**< @brief Number of oscillation cycles, after the first one, that are averaged while Auto-Tuning the Internal Ambient Temperature PID Controller. */
+#define PID_AUTOTUNE_TIMEOUT                        (3600000)                               /**< @brief Time in milliseconds after which the Auto-Tuning of the Internal Ambient Temperature PID Controller is abandoned if it has not finished yet. */
+#define BUTTONS_DEBOUNCE_TIME                       (15)                                    /**< @brief Time in milliseconds during which a Push Button must stay quiet before its new state is accepted by the @ref push_buttons . */
+#define BUTTONS_LONG_PRESS_TIME                     (3000)                                  /**< @brief Time in milliseconds during which a Push Button must be held to be considered as long-pressed. @details The user must long-press both the Show Hot Fan Duty Cycle and the Show Cold Fan Duty Cycle buttons at the same time to start, or to stop, the Auto-Tuning of the Internal Ambient Temperature PID Controller. */
+#define TOTAL_MTKATR001_BUTTONS                     (4)                                     /**< @brief Total number of Push Buttons given to the @ref push_buttons . */
+#define FAN_MIN_DUTY_CYCLE                          (10)                                    /**< @brief Lowest Duty Cycle, in percentage, at which the Hot and Cold Fans are driven, since they barely move any air below it. @details Whenever the Internal Ambient Temperature PID Controller requests a lower Duty Cycle, the corresponding Fan and Water Pump are turned Off instead. */
+#define SENSING_TASK_PERIOD                         (50)                                    /**< @brief Period in milliseconds at which the Sensing Task (see @ref sensing_task ) will be released by the @ref task_scheduler . */
+#define SENSING_TASK_DEADLINE                       (20)                                    /**< @brief Deadline in milliseconds, relative to each release, within which the Sensing Task (see @ref sensing_task ) is expected to finish. */
+#define CONTROL_TASK_PERIOD                         (500)                                   /**< @brief Period in milliseconds at which the Control Task (see @ref control_task ) will be released by the @ref task_scheduler . */
+#define CONTROL_TASK_DEADLINE                       (100)                                   /**< @brief Deadline in milliseconds, relative to each release, within which the Control Task (see @ref control_task ) is expected to finish. */
+#define COMMS_TASK_PERIOD                           (100)                                   /**< @brief Period in milliseconds at which the Comms Task (see @ref comms_task ) will be released by the @ref task_scheduler . */
+#define COMMS_TASK_DEADLINE                         (50)                                    /**< @brief Deadline in milliseconds, relative to each release, within which the Comms Task (see @ref comms_task ) is expected to finish. */
+#define DISPLAY_TASK_PERIOD                         (25)                                    /**< @brief Period in milliseconds at which the Display Task (see @ref display_task ) will be released by the @ref task_scheduler . */
+#define DISPLAY_TASK_DEADLINE                       (20)                                    /**< @brief Deadline in milliseconds, relative to each release, within which the Display Task (see @ref display_task ) is expected to finish. */
+#define TOTAL_MTKATR001_TASKS                       (4)                                     /**< @brief Total number of tasks given to the @ref task_scheduler . */
+#define WATCHDOG_TIMEOUT                            (3000)                                  /**< @brief Independent Watchdog timeout in milliseconds, after which our MCU/MPU is reset if the tasks of the MTKATR001 System have not all checked in with the @ref watchdog_supervisor . @note This value has to be longer than the period plus the deadline of every task, and it also bounds how long the main program may stay blocked anywhere (e.g., in an ETX OTA Transaction, whose whole duration is bounded by this value since the IWDG is refreshed right before it starts, and whose each wait for the host is bounded by @ref ETX_CUSTOM_HAL_TIMEOUT ). */
+#define DISPLAY_MESSAGE_DURATION                    (1000)                                  /**< @brief Time in milliseconds during which a message requested via @ref show_display_message will be shown at the 7-segment Display Device. */
+#define DISPLAY_ERROR_CODE_TOGGLE_TIME              (2000)                                  /**< @brief Time in milliseconds during which each of the "Err=" and the Exception Code screens will be shown, one after the other, whenever the MTKATR001 System has latched an Error. */
+#define DISPLAY_HOT_WATER_HEATING_TOGGLE_TIME       (500)                                   /**< @brief Time in milliseconds during which each of the "HEAt", " Hot", "AtEr" and " ..." screens will be shown, one after the other, while the Hot Air state machine is waiting for the Hot Water to be heated. */
+#define DISPLAY_COLD_WATER_NEEDED_TOGGLE_TIME       (500)                                   /**< @brief Time in milliseconds during which each of the "nEEd", "Cold", "AtEr" and " ..." screens will be shown, one after the other, while the Cold Air state machine is waiting for the Cold Water to be changed. */
+#define DISPLAY_COLD_WATER_ALERT_TOGGLE_TIME        (250)                                   /**< @brief Time in milliseconds during which each of the "nEEd", "Cold", "AtEr" and blank screens will be shown, one after the other, once the Cold Air state machine has escalated. */
+#define DISPLAY_AUTOTUNE_TOGGLE_TIME                (1000)                                  /**< @brief Time in milliseconds during which each screen will be shown, one after the other, whenever the Auto-Tuning of the Internal Ambient Temperature PID Controller is on-going or whenever its result is being reported. */
+#define DISPLAY_AUTOTUNE_RESULT_DURATION            (12000)                                 /**< @brief Time in milliseconds during which the result of a successful Auto-Tuning of the Internal Ambient Temperature PID Controller will be reported at the 7-segment Display Device. */
+#define DISPLAY_FIRMWARE_VERSION_TOGGLE_TIME        (500)                                   /**< @brief Time in milliseconds during which each of the "AF=" and the Application Firmware version screens will be shown, one after the other, whenever the user requests to see the current Application Firmware version. */
+#define ETX_OTA_LEGACY_CUSTOM_DATA_SIZE             (12)                                    /**< @brief Length in bytes of the ETX OTA Custom Data that is expected to be received from the host for updating the MTKATR001 System Parameters. */
+#define ETX_OTA_PENDING_CUSTOM_DATA_MAX_SIZE        (64)                                    /**< @brief Maximum length in bytes of the ETX OTA Custom Data that can be recorded for the @ref comms_task . @details Any ETX OTA Custom Data larger than this is reported as invalid. */
+#define ETX_OTA_COMMAND_MIN_ID                      (0x80)                                  /**< @brief Lowest value that the first byte of an ETX OTA Custom Data must have so that it is handled as one of the @ref MTKATR001_Command instead of as the legacy ETX OTA Custom Data. */
+#define ETX_OTA_SET_PID_GAINS_COMMAND_SIZE          (13)                                    /**< @brief Length in bytes of the @ref MTKATR001_CMD_SET_PID_GAINS Command. */
+#define ETX_OTA_GET_FAULT_HISTORY_COMMAND_SIZE      (2)                                     /**< @brief Length in bytes of the @ref MTKATR001_CMD_GET_FAULT_HISTORY Command. */
+#define ETX_OTA_FAULT_HISTORY_REPLY_HEADER_SIZE     (9)                                     /**< @brief Length in bytes of the reply to the @ref MTKATR001_CMD_GET_FAULT_HISTORY Command that precede its history events. */
+#define ETX_OTA_FAULT_HISTORY_ENTRY_SIZE            (6)                                     /**< @brief Length in bytes of each history event in the reply to the @ref MTKATR001_CMD_GET_FAULT_HISTORY Command. */
+#define ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE      (3)                                     /**< @brief Length in bytes of the @ref MTKATR001_CMD_SET_SENSOR_CALIBRATION Command, and of the reply to the @ref MTKATR001_CMD_GET_SENSOR_CALIBRATION Command, that precede their breakpoints. */
+#define ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE       (4)                                     /**< @brief Length in bytes of each breakpoint in the @ref MTKATR001_CMD_SET_SENSOR_CALIBRATION Command and in the reply to the @ref MTKATR001_CMD_GET_SENSOR_CALIBRATION Command. */
+#define ETX_OTA_GET_SENSOR_CALIBRATION_COMMAND_SIZE (2)                                     /**< @brief Length in bytes of the @ref MTKATR001_CMD_GET_SENSOR_CALIBRATION Command. */
+#define ETX_OTA_GET_RESET_INFO_REPLY_SIZE           (11)                                    /**< @brief Length in bytes of the reply to the @ref MTKATR001_CMD_GET_RESET_INFO Command. */
+#define ETX_OTA_SET_TELEMETRY_STREAM_PERIOD_COMMAND_SIZE (3)                                /**< @brief Length in bytes of the @ref MTKATR001_CMD_SET_TELEMETRY_STREAM_PERIOD Command, including its identifier. */
+#define ETX_OTA_GET_THERMAL_MODEL_REPLY_SIZE        (22)                                    /**< @brief Length in bytes of the reply to the @ref MTKATR001_CMD_GET_THERMAL_MODEL Command. */
+#define ETX_OTA_GET_TELEMETRY_RECORDS_COMMAND_SIZE  (5)                                     /**< @brief Length in bytes of the @ref MTKATR001_CMD_GET_TELEMETRY_LOG and of the @ref MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Commands. */
+#define ETX_OTA_TELEMETRY_RECORDS_REPLY_HEADER_SIZE (10)                                    /**< @brief Length in bytes of the reply to the @ref MTKATR001_CMD_GET_TELEMETRY_LOG and to the @ref MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Commands that precede their records. */
+#define ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS (1)                                     /**< @brief Maximum number of records that are sent in each reply to the @ref MTKATR001_CMD_GET_TELEMETRY_LOG and to the @ref MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Commands. @note This value keeps the blocking transmission of the reply at 9600 bauds within the @ref COMMS_TASK_DEADLINE , so the host pages through the records with one Command per record. */
+#define ETX_OTA_FAULT_HISTORY_REPLY_MAX_ENTRIES     (4)                                     /**< @brief Maximum number of history events that are sent in each reply to the @ref MTKATR001_CMD_GET_FAULT_HISTORY Command. @note This value keeps the blocking transmission of the reply at 9600 bauds within the @ref COMMS_TASK_DEADLINE . */
 #define MAJOR 										(1)										/**< @brief Major version number of our MCU/MPU's Application Firmware. */
 #define MINOR 										(0)										/**< @brief Minor version number of our MCU/MPU's Application Firmware. */
+
+#if (ETX_CUSTOM_HAL_TIMEOUT*3) >= (WATCHDOG_TIMEOUT*2)
+#error "Each wait of an ETX OTA Transaction for the host must be shorter than the shortest actual timeout of the Independent Watchdog (i.e., 2/3 of WATCHDOG_TIMEOUT, see WATCHDOG_SUPERVISOR_LSI_FREQUENCY)."
+#endif
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
 /* USER CODE BEGIN PM */
-
+#define TO_CENTI_UNITS(x)                           ((int32_t) (x)*100)                     /**< @brief Converts a whole number (e.g., a Temperature in Celsius Degrees) into centi-units (e.g., centi-degrees Celsius). */
 /* USER CODE END PM */
 
 /* Private variables ---------------------------------------------------------*/
 ADC_HandleTypeDef hadc1;
+ADC_HandleTypeDef hadc2;
+DMA_HandleTypeDef hdma_adc1;
 
 TIM_HandleTypeDef htim2;
 TIM_HandleTypeDef htim3;
+TIM_HandleTypeDef htim4;
 
 UART_HandleTypeDef huart3;
 
 /* USER CODE BEGIN PV */
-// NOTE: "hadc1" is used for the ADCs used to read the Temperature Sensors Outputs
+// NOTE: "hadc1" is used for the ADCs used to read the Temperature Sensors Outputs, which are converted in Scan Mode into a Circular DMA buffer via "hdma_adc1" each time that "htim4" triggers it.
+// NOTE: "hadc2" is only used for its Analog Watchdog, which guards the Internal Ambient Temperature Sensor Output that it converts, without any DMA, each time that "htim4" triggers "hadc1" too.
 // NOTE: "htim2" is used by the 5641AS Display Driver Library.
 // NOTE: "htim3" is used to generate two PWMs in its Channel 1 and Channel 2, for the Cold and Hot Fans respectively.
+// NOTE: "htim4" is used, via the Output Compare event of its Channel 4 and without any output pin, as the External Trigger that starts each Scan of "hadc1" at a fixed rate.
 // NOTE: "huart3" is used for communicating with the host that will be sending firmware images to our MCU via the ETX OTA Protocol with the BT Hardware Protocol.
 const uint8_t APP_version[2] = {MAJOR, MINOR};		/**< @brief Global array variable used to hold the Major and Minor version number of our MCU/MPU's Application Firmware in the 1st and 2nd byte respectively. */
 firmware_update_config_data_t fw_config;			        /**< @brief Global struct used to either pass to it the data that we want to write into the designated Flash Memory pages of the @ref firmware_update_config sub-module or, in the case of a read request, where that sub-module will write the latest data contained in the sub-module. */
@@ -65,53 +311,27 @@ uint16_t ascii_error_code[DISPLAY_5641AS_CHARACTERS_SIZE];  /**< @brief Global a
 int8_t desired_internal_ambient_temperature = 25;           /**< @brief Global variable that contains the Desired Internal Ambient Temperature at which it is desired that the MTKATR001 System regultates its internally controlled temperature to. */
 uint8_t desired_hot_fan_duty_cycle = 30;                   	/**< @brief Global variable that contains the Hot Fan Duty Cycle desired in the MTKATR001 System. @note The fan controlled by the PWM to which this duty cycle is linked to will bring hot air inside the MTKATR001 System. @note This value should always be equal or greater and 0 and equal or lower than 100. */
 uint8_t desired_cold_fan_duty_cycle = 30;                  	/**< @brief Global variable that contains the Cold Fan Duty Cycle desired in the MTKATR001 System. @note The fan controlled by the PWM to which this duty cycle is linked to will bring cold air inside the MTKATR001 System. @note This value should always be equal or greater and 0 and equal or lower than 100. */
-uint8_t desired_hot_water_temperature = 50;                 /**< @brief Global variable that contains the Hot Water Temperature desired in the MTKATR001 System. @details This Global Variable will basically define the temperature at which the MTKATR001 System will regulate the Hot Water to, which is the Water that will be used to bring Hot Air inside the MTKATR001 System via the Hot Fan. */
-uint8_t desired_hot_water_min_temperature = 40;             /**< @brief Global variable that contains the Hot Water Minimum Temperature desired in the MTKATR001 System. @details This Global Variable will be used as a threshold so that whenever the Hot Water's Temperature lowers below this point, then the MTKATR001 System will start heating it until it reaches the value of the @ref desired_hot_water_temperature Global Variable. */
+uint8_t desired_hot_water_temperature = 50;                 /**< @brief Global variable that contains the Hot Water Temperature desired in the MTKATR001 System. @details This Global Variable will basically define the temperature at which the MTKATR001 System will regulate the Hot Water to (see @ref run_water_heater ), which is the Water that will be used to bring Hot Air inside the MTKATR001 System via the Hot Fan. */
+uint8_t desired_hot_water_min_temperature = 40;             /**< @brief Global variable that contains the Hot Water Minimum Temperature desired in the MTKATR001 System. @details This Global Variable will be used as a threshold so that whenever the Hot Water's Temperature lowers below this point, then the MTKATR001 System will not throw Hot Air inside it until the Hot Water is heated above this point again. */
 uint8_t desired_cold_water_max_temperature = 25;            /**< @brief Global variable that contains the Cold Water Maximum Temperature desired in the MTKATR001 System. @details This global Variable will be used as a threshold so that whenever the Cold Water's Temperature is higher than this point, then the MTKATR001 System will emit a signal to the user to request to him/her to change the Cold Water for one colder than the value assigned to this variable. */
-float current_hot_water_temperature;                        /**< @brief Global variable that contains the current Hot Water Temperature. */
-float current_cold_water_temperature;                       /**< @brief Global variable that contains the current Cold Water Temperature. */
-float current_internal_ambient_temperature;                 /**< @brief Global variable that contains the current Internal Ambient Temperature. */
+int32_t current_hot_water_temperature;                      /**< @brief Global variable that contains the current Hot Water Temperature in centi-degrees Celsius. */
+int32_t current_cold_water_temperature;                     /**< @brief Global variable that contains the current Cold Water Temperature in centi-degrees Celsius. */
+int32_t current_internal_ambient_temperature;               /**< @brief Global variable that contains the current Internal Ambient Temperature in centi-degrees Celsius. */
 
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_USART3_UART_Init(void);
 static void MX_TIM2_Init(void);
 static void MX_TIM3_Init(void);
 static void MX_ADC1_Init(void);
+static void MX_TIM4_Init(void);
+static void MX_ADC2_Init(void);
 /* USER CODE BEGIN PFP */
 
-/**@brief   Selects a desired Channel at a specified ADC of our MCU/MPU and then gets the current output from it.
- *
- * @details This function will start by changing the Configuration Settings of the given ADC Handler to the requested
- *          Channel. Then that ADC will be enabled to then Poll the Output of the requested ADC and Channel. Finally,
- *          the Output Value will be stored into the requested Destination and then this ADC will be stopped.
- *
- * @notoe   This function will always set a sampling time of 239.5 ADC Cycles for the Channel selected.
- *
- * @param[in] hadc      Pointer towards the structure of the ADC from which it is desired to select a desired Channel.
- * @param adc_channel   Channel that wants to be selected from the desired ADC.
- * @param[out] dst      Pointer towards the Memory Address Location where the obtained ADC Output will be stored at.
- *
- * @retval  HAL_OK      If there are no HAL Errors during the ADC and Channel selection and the retrieval of the
- *                      respective output value from the requested ADC and Channel.
- * @retval  HAL_ERROR   If there was a HAL Error during the processes made by this function for the requested ADC and
- *                      Channel. Note that if this case gives place, then the ADC's Output might not have been retrieved
- *                      and, therefore, it would be best to consider that the Output was not obtain for safety purposes.
- * @retval  HAL_BUSY    If the ADC was Busy during a request made to it by this function. Note that if this case gives
- *                      place, then the ADC's Output might not have been retrieved and, therefore, it would be best to
- *                      consider that the Output was not obtain for safety purposes.
- * @retval  HAL_TIMEOUT If the Timeout @ref ADC_POLL_TIMEOUT expired during a request made to the ADC. Note that if this
- *                      case gives place, then the ADC's Output might not have been retrieved and, therefore, it would
- *                      be best to consider that the Output was not obtain for safety purposes.
- *
- * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
- * @date	February 10, 2024.
- */
-static HAL_StatusTypeDef get_adc_output(ADC_HandleTypeDef *hadc, uint32_t adc_channel, float *dst);
-
 /**@brief	Initializes the @ref display_5641as .
  *
  * @details	Before initializing that module, this function will populate the required parameters for that purpose by
@@ -138,27 +358,6 @@ static HAL_StatusTypeDef get_adc_output(ADC_HandleTypeDef *hadc, uint32_t adc_ch
  */
 static void custom_initialize_5641as_display_driver(void);
 
-/**@brief	Gets the equivalent of a certain number to its equivalent ASCII Numeric Characters.
- *
- * @details	This function is only able to get the equivalent ASCII Numeric Characters for any number greater than -10
- *          and lower than 100, with one decimal digit at the most.
- *
- * @details The \p dst param is expected to have a length of 3 bytes. In the first byte of the \p dst param, the value
- *          of the tens digit from the \p src param is going to be stored, if there is any. The value of the ones digit
- *          from the \p src param is going to be stored in the second byte of the \p dst param. Finally, the value of
- *          the tenths digit (i.e., the decimal digit) of the \p src param is going to be stored in the third byte of
- *          the \p dst param.
- *
- * @retval  0   If the given number to convert is greater than -10 and lower than 100 and if its conversion was
- *              successfully made and retrieved.
- * @retval  -1  If this function did not attempted to get or convert the requested number due to either being equal or
- *              lower than -10, or equal or greater than 100.
- *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
- * @date	March 26, 2024
- */
-static int convert_number_to_ASCII(float src, uint16_t *dst);
-
 /**@brief	Initializes the @ref firmware_update_config sub-module and then loads the latest data that has been written
  *          into it, if there is any. However, in the case that any of these processes fail, then this function will
  *          endlessly loop via a \c while() function and set the corresponding @ref MTKATR001_Status Exception Code on
@@ -175,14 +374,13 @@ static int convert_number_to_ASCII(float src, uint16_t *dst);
 static void custom_firmware_update_config_init();
 
 /**@brief	Initializes the @ref bl_side_firmware_update with a desired Hardware Protocol and, only in the case that the
- *          initialization is unsuccessful, then this function will endlessly loop via a \c while() function and set the
- *          corresponding @ref MTKATR001_Status Exception Code on the Display driven by @ref display_5641as .
+ *          initialization is unsuccessful, then this function will report the
+ *          @ref MTKATR001_EC_INIT_ETX_OTA_MODULE_ERR fault (see @ref report_mtkatr001_fault ).
  *
  * @details	This function populate the fields required for initializing the @ref bl_side_firmware_update via the
- *          @ref init_firmware_update_module function. In the case where that function initializes the
- *          @ref bl_side_firmware_update successfully, then this @ref custom_firmware_update_config_init function will
- *          terminate. Otherwise, it will endlessly loop via a \c while() function and set the corresponding
- *          @ref MTKATR001_Status Exception Code on the Display driven by @ref display_5641as .
+ *          @ref init_firmware_update_module function. In the case where that function could not initialize the
+ *          @ref bl_side_firmware_update , the MTKATR001 System keeps regulating its Internal Ambient Temperature
+ *          without the ETX OTA Protocol, instead of halting, while the @ref display_task shows that fault.
  *
  * @note    The @ref fw_config Global struct must have already been populated with the latest data written into the
  *          @ref firmware_update_config before calling this function.
@@ -193,6 +391,7 @@ static void custom_firmware_update_config_init();
  *
  * @author	César Miranda Meza
  * @date	November 19, 2023
+ * @date	LAST UPDATE: October 16, 2026.
  */
 static void custom_init_etx_ota_protocol_module(ETX_OTA_hw_Protocol hw_protocol, UART_HandleTypeDef *p_huart);
 
@@ -215,6 +414,36 @@ static void custom_init_etx_ota_protocol_module(ETX_OTA_hw_Protocol hw_protocol,
  */
 static void validate_application_firmware();
 
+/**@brief	Initializes the @ref system_params , loads the MTKATR001 System Parameters that have been persisted into it
+ *          into the @ref system_params Global struct and initializes the Internal Ambient Temperature PID Controller
+ *          with them.
+ *
+ * @details	If no valid PID Controller gains have been persisted yet, then the
+ *          @ref INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KP , @ref INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KI and
+ *          @ref INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KD gains are used instead. Likewise, the regulation setpoints (i.e.,
+ *          @ref desired_internal_ambient_temperature , @ref desired_hot_fan_duty_cycle ,
+ *          @ref desired_cold_fan_duty_cycle , @ref desired_hot_water_temperature ,
+ *          @ref desired_hot_water_min_temperature and @ref desired_cold_water_max_temperature ) keep their default
+ *          values if they have not been persisted yet. However, if the @ref system_params could not be initialized,
+ *          then the @ref MTKATR001_SYSTEM_PARAMS_ERR fault will be reported (see @ref report_mtkatr001_fault ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void custom_system_params_init(void);
+
+/**@brief	Persists the current regulation setpoints of the MTKATR001 System into the @ref system_params , so that
+ *          they are used again after our MCU/MPU is reset.
+ *
+ * @details	Nothing is written into the Flash Memory if none of those setpoints have changed since they were lastly
+ *          persisted (see @ref write_system_params ). If they could not be written, then the "FL E" message is
+ *          requested to be shown at the 7-segment Display Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void persist_setpoints(void);
+
 /**@brief   Gets the PWM Compare value required to set a desired PWM Duty Cycle.
  *
  * @param desired_duty_cycle    The desired Duty Cycle value from which it is desired to calculate the PWM Compare value
@@ -241,136 +470,723 @@ static void validate_application_firmware();
  */
 static uint16_t get_compare_value_for_fan_pwm(uint16_t desired_duty_cycle, uint16_t max_compare_value);
 
-/**@brief   Reads the ADC1-CH0 and then updates the @ref current_cold_water_temperature Global Variable.
+/**@brief   Gets the 32-bit signed integer that is stored in little-endian order at a desired byte array.
+ *
+ * @param[in] bytes Pointer to the first of the four bytes of the integer.
+ *
+ * @return  The 32-bit signed integer stored at the \p bytes param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static int32_t get_int32_from_little_endian(const uint8_t *bytes);
+
+/**@brief   Stores a 32-bit unsigned integer in little-endian order into a desired byte array.
+ *
+ * @param value         32-bit unsigned integer that wants to be stored.
+ * @param[out] bytes    Pointer to the first of the four bytes into which the \p value param will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void put_uint32_in_little_endian(uint32_t value, uint8_t *bytes);
+
+/**@brief   Gets the 16-bit unsigned integer that is stored in little-endian order at a desired byte array.
+ *
+ * @param[in] bytes Pointer to the first of the two bytes of the integer.
+ *
+ * @return  The 16-bit unsigned integer stored at the \p bytes param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static uint16_t get_uint16_from_little_endian(const uint8_t *bytes);
+
+/**@brief   Stores a 16-bit unsigned integer in little-endian order into a desired byte array.
+ *
+ * @param value         16-bit unsigned integer that wants to be stored.
+ * @param[out] bytes    Pointer to the first of the two bytes into which the \p value param will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void put_uint16_in_little_endian(uint16_t value, uint8_t *bytes);
+
+/**@brief   Reads the latest sample of the ADC1-CH0 that has been published by the @ref temp_sensors and then
+ *          updates the @ref current_cold_water_temperature Global Variable.
  *
- * @details This function will jump into an infinite while-loop if something goes wrong with the ADC1-CH0 when reading
- *          it and will also display the corresponding @ref MTKATR001_Status Exception Code via the 7-segment Display
- *          Device.
+ * @details This function does not block since the ADC1 converts all the Temperature Sensors in Scan Mode via DMA at
+ *          the fixed rate at which TIM4 triggers it. That sample is converted with the ideal LM35 formula and then
+ *          corrected with the calibration table of its channel (see @ref apply_sensor_calibration ). The resulting
+ *          Temperature is then checked by the @ref sensor_diagnostics of its channel, and that Global Variable is only
+ *          updated while that sensor is @ref SENSOR_VALID , so that it keeps the last trusted Temperature otherwise.
+ *          In addition, this function reports the @ref MTKATR001_COLD_WATER_TEMP_ADC_ERR fault while that sensor is
+ *          @ref SENSOR_FAILED (see @ref report_mtkatr001_fault ) and turns Off the actuators that depend on that
+ *          sensor while it is not valid (see @ref get_untrusted_temp_sensors_capabilities ).
+ *
+ * @note    The status of the ADC1 and its DMA is expected to have been validated before calling this function.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date	February 11, 2024.
+ * @date	LAST UPDATE: October 16, 2026.
  */
 static void update_current_cold_water_temperature(void);
 
-/**@brief   Reads the ADC1-CH1 and then updates the @ref current_hot_water_temperature Global Variable.
+/**@brief   Reads the latest sample of the ADC1-CH1 that has been published by the @ref temp_sensors and then
+ *          updates the @ref current_hot_water_temperature Global Variable.
+ *
+ * @details This function does not block since the ADC1 converts all the Temperature Sensors in Scan Mode via DMA at
+ *          the fixed rate at which TIM4 triggers it. That sample is converted with the ideal LM35 formula and then
+ *          corrected with the calibration table of its channel (see @ref apply_sensor_calibration ). The resulting
+ *          Temperature is then checked by the @ref sensor_diagnostics of its channel, and that Global Variable is only
+ *          updated while that sensor is @ref SENSOR_VALID , so that it keeps the last trusted Temperature otherwise.
+ *          In addition, this function reports the @ref MTKATR001_HOT_WATER_TEMP_ADC_ERR fault while that sensor is
+ *          @ref SENSOR_FAILED (see @ref report_mtkatr001_fault ) and turns Off the actuators that depend on that
+ *          sensor while it is not valid (see @ref get_untrusted_temp_sensors_capabilities ).
+ *          The Cross check of this sensor fails while the Water Heating Resistor has been kept On during the last
+ *          @ref HOT_WATER_CROSS_CHECK_HEATING_TIME milliseconds and the @ref current_internal_ambient_temperature of a
+ *          valid sensor is more than @ref HOT_WATER_CROSS_CHECK_MARGIN degrees Celsius above the Hot Water.
  *
- * @details This function will jump into an infinite while-loop if something goes wrong with the ADC1-CH1 when reading
- *          it and will also display the corresponding @ref MTKATR001_Status Exception Code via the 7-segment Display
- *          Device.
+ * @note    The status of the ADC1 and its DMA is expected to have been validated before calling this function.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date	February 11, 2024.
+ * @date	LAST UPDATE: October 16, 2026.
  */
 static void update_current_hot_water_temperature(void);
 
-/**@brief   Reads the ADC1-CH4 and then updates the @ref current_internal_ambient_temperature Global Variable.
+/**@brief   Reads the latest sample of the ADC1-CH4 that has been published by the @ref temp_sensors and then
+ *          updates the @ref current_internal_ambient_temperature Global Variable.
  *
- * @details This function will jump into an infinite while-loop if something goes wrong with the ADC1-CH4 when reading
- *          it and will also display the corresponding @ref MTKATR001_Status Exception Code via the 7-segment Display
- *          Device.
+ * @details This function does not block since the ADC1 converts all the Temperature Sensors in Scan Mode via DMA at
+ *          the fixed rate at which TIM4 triggers it. That sample is converted with the ideal LM35 formula and then
+ *          corrected with the calibration table of its channel (see @ref apply_sensor_calibration ). The resulting
+ *          Temperature is then checked by the @ref sensor_diagnostics of its channel, and that Global Variable is only
+ *          updated while that sensor is @ref SENSOR_VALID , so that it keeps the last trusted Temperature otherwise.
+ *          In addition, this function reports the @ref MTKATR001_INTERNAL_AMBIENT_TEMP_ADC_ERR fault while that sensor is
+ *          @ref SENSOR_FAILED (see @ref report_mtkatr001_fault ) and turns Off the actuators that depend on that
+ *          sensor while it is not valid (see @ref get_untrusted_temp_sensors_capabilities ).
+ *
+ * @note    The status of the ADC1 and its DMA is expected to have been validated before calling this function.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date	February 11, 2024.
+ * @date	LAST UPDATE: October 16, 2026.
  */
 static void update_current_internal_ambient_temperature(void);
 
-/* USER CODE END PFP */
+/**@brief   Initializes the Hot Water Temperature PID Controller and the Time-Proportional Output with which the
+ *          Water Heating Resistor is driven, together with the @ref preheat_scheduler that decides when it is driven.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void custom_water_heater_init(void);
 
-/* Private user code ---------------------------------------------------------*/
-/* USER CODE BEGIN 0 */
-/**@brief	MTKATR001 Exception codes.
+/**@brief   Configures the ADC Analog Watchdog of the Temperature Sensors ADC so that any conversion of its Hot Water
+ *          Temperature Sensor channel above the @ref OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD raises an Interrupt that
+ *          de-energizes the Water Heating Resistor, and the one of the second ADC so that any conversion of the
+ *          Internal Ambient Temperature Sensor channel above the @ref AMBIENT_OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD
+ *          raises an Interrupt that turns Off the heating actuators (see @ref HAL_ADC_LevelOutOfWindowCallback ).
  *
- * @details	These Exception Codes are returned by the functions of the @ref main to indicate the resulting status of
- *          having executed the process contained in each of the processes of the main application. For example, to
- *          indicate that the process executed by a certain function was successful or that it has failed.
+ * @details The second ADC is triggered by the same Timer event as the Temperature Sensors ADC, and it samples the
+ *          Internal Ambient Temperature Sensor channel while the Temperature Sensors ADC samples the Cold Water one,
+ *          so that both ADCs never sample the same channel at the same time.
+ *
+ * @note    This function must be called before starting the conversions of the Temperature Sensors.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
  */
-typedef enum
-{
-    MTKATR001_EC_OK                                 = 0U,   //!< MTKATR001 System Process was successful.
-    MTKATR001_EC_STOP                               = 1U,   //!< MTKATR001 ETX OTA Protocol Process or transaction has been stopped.
-    MTKATR001_EC_NR		                            = 2U,	//!< MTKATR001 ETX OTA Protocol has concluded with no response from Host.
-    MTKATR001_EC_NA                                 = 3U,   //!< MTKATR001 ETX OTA Payload received or to be received Not Applicable.
-    MTKATR001_EC_ERR                                = 4U,   //!< MTKATR001 ETX OTA Protocol has failed.
-    MTKATR001_EC_INIT_FW_UPDT_CONF_MODULE_ERR       = 5U,   //!< MTKATR001 Firmware Update Configurations Sub-module could not be initialized. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that the MCU/MPU's Flash Memory lifetime of the MTKATR001 Device has expired.
-    MTKATR001_EC_INIT_ETX_OTA_MODULE_ERR            = 6U,   //!< MTKATR001 ETX OTA Module could not be initialized. @note This case can might give place if the connection or requests between the Bluetooth Device and our MCU/MPU was temporarily lost or if a wrong configuration setting was sent to that Bluetooth Device. However, if this problem persists each time after energizing the MTKATR001 Device, then it is very likely that the Bluetooth Device's lifetime has expired.
-    MTKATR001_BOOTLOADER_FIRMWARE_VALIDATION_ERR    = 7U,   //!< MTKATR001 Bootloader Firmware Validation was unsuccessful. @note If this case ever gives place, although there is a ridiculously small probability that this can be due to a Bootloader Firmware that was mistakenly received as successful, when it was actually not it, the way most probable reason this Error will give place is due to having tampered with our MCU/MPU's Flash Memory (e.g., By attempting to reverse engineering it).
-    MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR   = 8U,   //!< MTKATR001 Application Firmware Validation was unsuccessful. @note If this case ever gives place, although there is a ridiculously small probability that this can be due to an Application Firmware that was mistakenly received as successful, when it was actually not it, the way most probable reason this Error will give place is due to having tampered with our MCU/MPU's Flash Memory (e.g., By attempting to reverse engineering it).
-    MTKATR001_HOT_WATER_TEMP_IS_UNDER_SHORTCIRCUIT  = 9U,   //!< MTKATR001 Hot Water Temperature Sensor is currently under a short-circuit. @note If this Error gives place, you can calmly disconnect the MTKATR001 Device from the AC Plug since it has a solid and very safe short-circuit protection that will not allow the current to go very high ever. However, the Hot Water Temperature Sensor will require to be changed with a new one after this in order for the MTKATR001 System to work as expected the next time you plug it back again the AC Cord.
-    MTKATR001_COLD_WATER_TEMP_IS_UNDER_SHORTCIRCUIT = 10U,  //!< MTKATR001 Cold Water Temperature Sensor is currently under a short-circuit. @note If this Error gives place, you can calmly disconnect the MTKATR001 Device from the AC Plug since it has a solid and very safe short-circuit protection that will not allow the current to go very high ever. However, the Cold Water Temperature Sensor will require to be changed with a new one after this in order for the MTKATR001 System to work as expected the next time you plug it back again the AC Cord.
-    MTKATR001_COLD_WATER_TEMP_ADC_ERR               = 11U,  //!< MTKATR001 ADC with which the Cold Water Temperature Sensor is being read with has responded with a HAL error/problem. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that either the MCU/MPU's ADC lifetime or even the lifetime of the actual MCU/MPU of the MTKATR001 Device has expired.
-    MTKATR001_HOT_WATER_TEMP_ADC_ERR                = 12U,  //!< MTKATR001 ADC with which the Hot Water Temperature Sensor is being read with has responded with a HAL error/problem. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that either the MCU/MPU's ADC lifetime or even the lifetime of the actual MCU/MPU of the MTKATR001 Device has expired.
-    MTKATR001_INTERNAL_AMBIENT_TEMP_ADC_ERR         = 13U   //!< MTKATR001 ADC with which the Internal Ambient Temperature Sensor is being read with has responded with a HAL error/problem. @note If this problem persists each time you energize the MTKATR001 Device, then this unfortunately means that either the MCU/MPU's ADC lifetime or even the lifetime of the actual MCU/MPU of the MTKATR001 Device has expired.
-} MTKATR001_Status;
+static void custom_over_temp_adc_watchdog_init(void);
 
-/**@brief	ASCII code character definitions that are available in the @ref display_5641as and that are used by the
- *          @ref convert_number_to_ASCII function for converting numbers into their equivalent ASCII Numeric Characters.
+/**@brief   Starts the @ref watchdog_supervisor with the tasks of the MTKATR001 System and, if the latest reset of our
+ *          MCU/MPU was made by the Independent Watchdog, reports the @ref MTKATR001_WATCHDOG_RESET fault.
  *
- * @note    These definitions are defined with respect to the decimal value that corresponds for each of the available
- *          ASCII code characters.
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
  */
-typedef enum
-{
-    Command_NULL_in_ASCII                   = 0,     //!< \f$[NULL]_{ASCII} = 0_d\f$.
-    Letter_minus_sign_in_ASCII              = 45,    //!< \f$-_{ASCII} = 45_d\f$.
-    Number_0_in_ASCII	                    = 48,    //!< \f$0_{ASCII} = 48_d\f$.
-    Number_1_in_ASCII	                    = 49,    //!< \f$1_{ASCII} = 49_d\f$.
-    Number_2_in_ASCII	                    = 50,    //!< \f$2_{ASCII} = 50_d\f$.
-    Number_3_in_ASCII	                    = 51,    //!< \f$3_{ASCII} = 51_d\f$.
-    Number_4_in_ASCII	                    = 52,    //!< \f$4_{ASCII} = 52_d\f$.
-    Number_5_in_ASCII	                    = 53,    //!< \f$5_{ASCII} = 53_d\f$.
-    Number_6_in_ASCII	                    = 54,    //!< \f$6_{ASCII} = 54_d\f$.
-    Number_7_in_ASCII	                    = 55,    //!< \f$7_{ASCII} = 55_d\f$.
-    Number_8_in_ASCII	                    = 56,    //!< \f$8_{ASCII} = 56_d\f$.
-    Number_9_in_ASCII	                    = 57,    //!< \f$9_{ASCII} = 57_d\f$.
-    Number_0Dp_in_ASCII	                    = 256,    //!< \f$0._{ASCII} = 256_d custom value\f$.
-    Number_1Dp_in_ASCII	                    = 257,    //!< \f$1._{ASCII} = 257_d custom value\f$.
-    Number_2Dp_in_ASCII	                    = 258,    //!< \f$2._{ASCII} = 258_d custom value\f$.
-    Number_3Dp_in_ASCII	                    = 259,    //!< \f$3._{ASCII} = 259_d custom value\f$.
-    Number_4Dp_in_ASCII	                    = 260,    //!< \f$4._{ASCII} = 260_d custom value\f$.
-    Number_5Dp_in_ASCII	                    = 261,    //!< \f$5._{ASCII} = 261_d custom value\f$.
-    Number_6Dp_in_ASCII	                    = 262,    //!< \f$6._{ASCII} = 262_d custom value\f$.
-    Number_7Dp_in_ASCII	                    = 263,    //!< \f$7._{ASCII} = 263_d custom value\f$.
-    Number_8Dp_in_ASCII	                    = 264,    //!< \f$8._{ASCII} = 264_d custom value\f$.
-    Number_9Dp_in_ASCII	                    = 265     //!< \f$9._{ASCII} = 265_d custom value\f$.
-} Display_ASCII_Characters;
+static void custom_watchdog_supervisor_init(void);
 
-/* USER CODE END 0 */
+/**@brief   Executes the Hot Water Temperature PID Controller and drives the Water Heating Resistor with the
+ *          Time-Proportional Output whose Duty Cycle is the output of that controller.
+ *
+ * @details This regulates the Hot Water to the @ref desired_hot_water_temperature and it is expected to be called
+ *          each @ref CONTROL_TASK_PERIOD milliseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void run_water_heater(void);
 
-/**
-  * @brief  The application entry point.
-  * @retval int
-  */
-int main(void)
-{
-  /* USER CODE BEGIN 1 */
+/**@brief   Turns Off the Water Heating Resistor and resets the Hot Water Temperature PID Controller and the
+ *          Time-Proportional Output with which it is driven, so that they start over once the Hot Water is needed
+ *          again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void turn_off_water_heater(void);
 
-  /* USER CODE END 1 */
+/**@brief   Tells whether the Hot Water has to be heated from now on, while feeding the @ref preheat_scheduler with the
+ *          current Hot Water and Internal Ambient Temperatures and with what the Water Heating Resistor and the Fans
+ *          did since the previous execution of the @ref control_task .
+ *
+ * @details The Hot Water is needed whenever Hot Air is being requested (i.e., the @ref hot_air_state is not
+ *          @ref HOT_AIR_OFF ), while the Auto-Tuning is on-going, since its relay requests Hot Air every other half
+ *          cycle, whenever the Internal Ambient Temperature is at or below the
+ *          @ref desired_internal_ambient_temperature or, once the @ref preheat_scheduler has learned its rates,
+ *          whenever it predicts that the Hot Water would not be ready in time otherwise for when the Internal Ambient
+ *          Temperature falls to that temperature.
+ *
+ * @return  1 if the Hot Water has to be heated or 0 if the Water Heating Resistor can be kept Off.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static uint8_t is_hot_water_needed(void);
 
-  /* MCU Configuration--------------------------------------------------------*/
+/**@brief   Advances the Hot Air state machine of the MTKATR001 System by one step and drives the Hot Fan and the Hot
+ *          Water Pump according to its resulting state.
+ *
+ * @details The transitions of the @ref hot_air_state are the following:<br>
+ *          <ul>
+ *              <li>Into @ref HOT_AIR_OFF from any state whenever the \p duty_cycle param is zero.</li>
+ *              <li>Into @ref HOT_AIR_WAITING_HOT_WATER from @ref HOT_AIR_OFF or @ref HOT_AIR_ON whenever Hot Air is requested, but the Hot Water is below the @ref desired_hot_water_min_temperature .</li>
+ *              <li>Into @ref HOT_AIR_ON from @ref HOT_AIR_OFF whenever Hot Air is requested and the Hot Water is hot enough, or from @ref HOT_AIR_WAITING_HOT_WATER once the Hot Water has been heated @ref HOT_WATER_READY_HYSTERESIS above the @ref desired_hot_water_min_temperature .</li>
+ *          </ul>
+ *
+ * @note    The Hot Water itself is heated by the @ref run_water_heater function whenever this state machine is not in
+ *          @ref HOT_AIR_OFF (see @ref is_hot_water_needed ), so this state machine never blocks while waiting for the
+ *          Hot Water.
+ *
+ * @param duty_cycle    Duty Cycle, in percentage, that is requested for the Hot Fan, where zero stands for no Hot Air
+ *                      being requested.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void run_hot_air_state_machine(uint16_t duty_cycle);
 
-  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
-  HAL_Init();
+/**@brief   Advances the Cold Air state machine of the MTKATR001 System by one step and drives the Cold Fan and the
+ *          Cold Water Pump according to its resulting state.
+ *
+ * @details The transitions of the @ref cold_air_state are the following:<br>
+ *          <ul>
+ *              <li>Into @ref COLD_AIR_OFF from any state whenever the \p duty_cycle param is zero.</li>
+ *              <li>Into @ref COLD_AIR_WAITING_COLD_WATER from @ref COLD_AIR_OFF or @ref COLD_AIR_ON whenever Cold Air is requested, but the Cold Water is above the @ref desired_cold_water_max_temperature .</li>
+ *              <li>Into @ref COLD_AIR_ESCALATED from @ref COLD_AIR_WAITING_COLD_WATER once it has waited for @ref COLD_WATER_WAIT_TIMEOUT milliseconds.</li>
+ *              <li>Into @ref COLD_AIR_ON from @ref COLD_AIR_OFF whenever Cold Air is requested and the Cold Water is cold enough, or from @ref COLD_AIR_WAITING_COLD_WATER or @ref COLD_AIR_ESCALATED once the Cold Water is @ref COLD_WATER_READY_HYSTERESIS below the @ref desired_cold_water_max_temperature .</li>
+ *          </ul>
+ *
+ * @note    This state machine never blocks while waiting for the Cold Water, so that the other tasks of the
+ *          MTKATR001 System keep running with their normal periods and the "nEEd Cold AtEr ..." alert is shown by the
+ *          @ref display_task instead.
+ *
+ * @param duty_cycle    Duty Cycle, in percentage, that is requested for the Cold Fan, where zero stands for no Cold
+ *                      Air being requested.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void run_cold_air_state_machine(uint16_t duty_cycle);
 
-  /* USER CODE BEGIN Init */
+/**@brief   Forces the Hot and Cold Fans, the Hot and Cold Water Pumps and the Water Heating Resistor of the MTKATR001
+ *          System into their safe state (i.e., Off) by only writing into their peripherals.
+ *
+ * @note    This function does not touch the state of any of the tasks of the MTKATR001 System and, therefore, it can
+ *          be safely called from an Interrupt context.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void force_actuators_safe_state(void);
 
-  /* USER CODE END Init */
+/**@brief   Turns Off the Hot and Cold Fans, the Hot and Cold Water Pumps and the Water Heating Resistor of the
+ *          MTKATR001 System, and resets the state of the controllers and state machines that drive them.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void turn_off_all_actuators(void);
 
-  /* Configure the system clock */
-  SystemClock_Config();
+/**@brief   Turns Off only the actuators of the MTKATR001 System that belong to some lost capabilities, and resets the
+ *          state of the controllers and state machines that drive them.
+ *
+ * @param lost_capabilities Bitmask of the lost capabilities (see @ref MTKATR001_CAPABILITY_HEATING and
+ *                          @ref MTKATR001_CAPABILITY_COOLING ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void turn_off_lost_actuators(uint32_t lost_capabilities);
 
-  /* USER CODE BEGIN SysInit */
+/**@brief   Gets the capabilities of the MTKATR001 System that depend on a Temperature Sensor that is currently not
+ *          trusted (i.e., that is not @ref SENSOR_VALID ) according to the @ref sensor_diagnostics .
+ *
+ * @details The Cold Water Temperature Sensor is needed for the @ref MTKATR001_CAPABILITY_COOLING , the Hot Water one
+ *          for the @ref MTKATR001_CAPABILITY_HEATING and the Internal Ambient one for both of them, in the same way as
+ *          for their faults in @ref mtkatr001_faults .
+ *
+ * @return  Bitmask of the capabilities that depend on an untrusted Temperature Sensor.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static uint32_t get_untrusted_temp_sensors_capabilities(void);
 
-  /* USER CODE END SysInit */
+/**@brief   Writes a snapshot of the current Temperatures, setpoints, actuators, Temperature Sensors validity and active
+ *          faults of the MTKATR001 System into the @ref telemetry_log .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void log_telemetry_snapshot(void);
 
-  /* Initialize all configured peripherals */
-  MX_GPIO_Init();
-  MX_USART3_UART_Init();
-  MX_TIM2_Init();
-  MX_TIM3_Init();
-  MX_ADC1_Init();
-  /* USER CODE BEGIN 2 */
+/**@brief   Gets which actuators of the MTKATR001 System are currently On, for the @ref telemetry_log and the
+ *          @ref telemetry_stream .
+ *
+ * @return  A bitmask of @ref TELEMETRY_HEATER_ON , @ref TELEMETRY_HOT_WATER_PUMP_ON , @ref TELEMETRY_COLD_WATER_PUMP_ON ,
+ *          @ref TELEMETRY_IIATR_LED_ON and @ref TELEMETRY_AUTOTUNE_RUNNING .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static uint8_t get_actuators_state(void);
 
-    /* Send a message from the Application showing the current Application version there. */
+/**@brief   Gives the current Temperatures and actuators of the MTKATR001 System to the @ref telemetry_stream .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void stream_telemetry_sample(void);
+
+/**@brief   Gets the output that is currently applied to the Hot and Cold Fans, for the @ref thermal_model .
+ *
+ * @return  The Duty Cycle of the Hot Fan minus the one of the Cold Fan, in centi-percent, as they are actually being
+ *          driven (e.g., zero while the Hot Air state machine waits for the Hot Water, even if the Internal Ambient
+ *          Temperature PID Controller requests Heat).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static int32_t get_applied_fans_output(void);
+
+/**@brief   Reports whether the condition of a fault of the MTKATR001 System is currently present or not to the
+ *          @ref fault_manager and, if it is present, immediately turns Off the actuators of every capability that is
+ *          lost from then on (see @ref turn_off_lost_actuators ).
+ *
+ * @param fault_code    @ref MTKATR001_Status Exception Code of the fault, which must be one of the
+ *                      @ref mtkatr001_faults .
+ * @param is_present    1 if the condition of the fault is currently present or 0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void report_mtkatr001_fault(MTKATR001_Status fault_code, uint8_t is_present);
+
+/**@brief   Raises a fault of the MTKATR001 System from an Interrupt context into the @ref isr_raised_faults Global
+ *          Variable, so that it is later reported to the @ref fault_manager by the @ref process_isr_raised_faults
+ *          function.
+ *
+ * @details The bit of the fault is set via an exclusive load and store pair, which is retried whenever anything else
+ *          has accessed the @ref isr_raised_faults Global Variable in between (e.g., an Interrupt of higher priority
+ *          that has raised another fault), so that no raised fault is ever lost and without having to disable the
+ *          Interrupts.
+ *
+ * @param fault_code    @ref MTKATR001_Status Exception Code of the fault, which must be one of the
+ *                      @ref mtkatr001_faults .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void raise_isr_fault(MTKATR001_Status fault_code);
+
+/**@brief   Reports to the @ref fault_manager every fault that has been raised from an Interrupt context into the
+ *          @ref isr_raised_faults Global Variable since the last time that this function was called.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void process_isr_raised_faults(void);
+
+/**@brief   Sets the four given ASCII Characters at the 7-segment Display Device via the @ref display_5641as .
+ *
+ * @param first     ASCII Character to be shown at the first 7-segment display of the 5641AS Device.
+ * @param second    ASCII Character to be shown at the second 7-segment display of the 5641AS Device.
+ * @param third     ASCII Character to be shown at the third 7-segment display of the 5641AS Device.
+ * @param fourth    ASCII Character to be shown at the fourth 7-segment display of the 5641AS Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void show_display_characters(uint16_t first, uint16_t second, uint16_t third, uint16_t fourth);
+
+/**@brief   Requests the @ref display_task to show the four given ASCII Characters at the 7-segment Display Device
+ *          during @ref DISPLAY_MESSAGE_DURATION milliseconds, with a higher priority than any other screen except for
+ *          the "Err=" and Exception Code screens of the active faults.
+ *
+ * @param first     ASCII Character to be shown at the first 7-segment display of the 5641AS Device.
+ * @param second    ASCII Character to be shown at the second 7-segment display of the 5641AS Device.
+ * @param third     ASCII Character to be shown at the third 7-segment display of the 5641AS Device.
+ * @param fourth    ASCII Character to be shown at the fourth 7-segment display of the 5641AS Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void show_display_message(uint16_t first, uint16_t second, uint16_t third, uint16_t fourth);
+
+/**@brief   Sensing Task of the MTKATR001 System, which is periodically executed by the @ref task_scheduler each
+ *          @ref SENSING_TASK_PERIOD milliseconds.
+ *
+ * @details This task first reports to the @ref fault_manager the faults that have been raised from an Interrupt
+ *          context (see @ref process_isr_raised_faults ) and whether the Hot or Cold Water Temperature Sensors are
+ *          under a short-circuit. Note that those short-circuits are primarily handled by their EXTI lines in the
+ *          @ref HAL_GPIO_EXTI_Callback function, so this validation only catches a short-circuit that was already
+ *          present before those EXTI lines were enabled. Then, if the ADC1 or its DMA have reported an error, this
+ *          task reports the @ref MTKATR001_TEMP_SENSORS_ADC_DMA_ERR fault and restarts their conversions (see
+ *          @ref restart_temp_sensors_module ) instead of reading any Temperature. Otherwise, this task will update the
+ *          current Cold Water, Hot Water and Internal Ambient Temperatures via the
+ *          @ref update_current_cold_water_temperature , @ref update_current_hot_water_temperature and
+ *          @ref update_current_internal_ambient_temperature functions, and it will report whether the Internal Ambient
+ *          Temperature is above the @ref INTERNAL_AMBIENT_MAX_TEMPERATURE via the
+ *          @ref MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE fault.
+ * @details In addition, this task self-calibrates the Temperature Sensors ADC each
+ *          @ref TEMP_SENSORS_ADC_CALIBRATION_PERIOD milliseconds via the @ref calibrate_temp_sensors_adc function, after
+ *          having read the Temperatures, so that the block of Scans that is lost by it is the one that has the most time
+ *          to be replaced before the next time that this task is executed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void sensing_task(void);
+
+/**@brief   Control Task of the MTKATR001 System, which is periodically executed by the @ref task_scheduler each
+ *          @ref CONTROL_TASK_PERIOD milliseconds.
+ *
+ * @details This task executes the Internal Ambient Temperature PID Controller with respect to the latest temperatures
+ *          measured by the @ref sensing_task , whose output is limited to the @ref desired_hot_fan_duty_cycle and to
+ *          the @ref desired_cold_fan_duty_cycle . A positive output is applied as the Duty Cycle of the Hot Fan, once the
+ *          Hot Water is hot enough (see @ref run_hot_air_state_machine ), and a negative output is applied as the
+ *          Duty Cycle of the Cold Fan, once the Cold Water is cold enough (see @ref run_cold_air_state_machine ). Each Water Pump is turned On only while its
+ *          Fan is being driven with at least @ref FAN_MIN_DUTY_CYCLE percent of Duty Cycle, and the IIATR LED is
+ *          turned On while the Internal Ambient Temperature is within @ref INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED of the
+ *          desired one.
+ * @details While the active faults of the @ref fault_manager have lost some of the capabilities of the MTKATR001
+ *          System, or while a Temperature Sensor that some of them depend on is not trusted by its
+ *          @ref sensor_diagnostics (see @ref get_untrusted_temp_sensors_capabilities ), this task keeps running in a
+ *          degraded mode where only the actuators of the lost capabilities are kept turned Off, the output of the PID
+ *          Controller is limited to zero on their side and the Auto-Tuning is stopped (e.g., it keeps cooling while
+ *          only the Hot Water Temperature Sensor has failed). However, if all the capabilities have been lost (see
+ *          @ref MTKATR001_ALL_CAPABILITIES ), then this task will only keep all the actuators and the IIATR LED turned
+ *          Off.
+ * @details In addition, this task regulates the Hot Water to the @ref desired_hot_water_temperature via the
+ *          @ref run_water_heater function, as long as the @ref MTKATR001_CAPABILITY_HEATING has not been lost, but
+ *          only while the Hot Water is needed or is predicted to be needed soon by the @ref preheat_scheduler (see
+ *          @ref is_hot_water_needed ). Otherwise, the Water Heating Resistor is kept Off instead of keeping the Hot
+ *          Water hot all the time.
+ * @details While the Auto-Tuning of the Internal Ambient Temperature PID Controller is on-going, the output of the
+ *          @ref pid_autotune is applied to the Fans instead, in the same way. Once it finishes successfully, the
+ *          resulting gains are applied to the PID Controller and persisted into the @ref system_params , together with
+ *          the measured Ultimate Gain and Ultimate Period. The Auto-Tuning can be started or stopped either via the
+ *          @ref apply_etx_ota_command function or via the @ref process_push_button_events function.
+ * @details Every @ref TELEMETRY_LOG_PERIOD milliseconds, including while in any degraded mode, this task also writes a
+ *          snapshot of the MTKATR001 System into the @ref telemetry_log (see @ref log_telemetry_snapshot ), whose
+ *          records are then archived in batches into the @ref telemetry_archive (see @ref feed_telemetry_archive ).
+ * @details While the Internal Ambient Temperature Sensor is trusted, this task also gives that Temperature, together
+ *          with the output that was applied to the Fans since its previous execution, to the @ref thermal_model , so
+ *          that the dynamics of the MTKATR001 System are identified while it is being regulated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void control_task(void);
+
+/**@brief   Starts the Auto-Tuning of the Internal Ambient Temperature PID Controller around the Desired Internal
+ *          Ambient Temperature and requests the corresponding message to be shown at the 7-segment Display Device.
+ *
+ * @details The amplitude of the relay that is applied during the Auto-Tuning is the lowest of the
+ *          @ref desired_hot_fan_duty_cycle and the @ref desired_cold_fan_duty_cycle , so that the relay is symmetrical
+ *          and within the Duty Cycles that the user allows. The "tUnE" message is shown if the Auto-Tuning was
+ *          started, or the "tU E" message if it could not be started because that amplitude is lower than
+ *          @ref FAN_MIN_DUTY_CYCLE or because the MTKATR001 System is in a degraded mode (see @ref control_task ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void start_internal_ambient_temp_autotune(void);
+
+/**@brief   Calculates the gains of the Internal Ambient Temperature PID Controller from the model that has been
+ *          identified by the @ref thermal_model , and then applies and persists them, in the same way as with a
+ *          successful Auto-Tuning, and requests the corresponding message to be shown at the 7-segment Display Device.
+ *
+ * @details The gains are the ones of a PI Controller (see @ref calculate_thermal_model_pid_gains ) whose closed-loop
+ *          time constant is the dead time of the model, or @ref THERMAL_MODEL_MIN_CLOSED_LOOP_TIME if that one is
+ *          shorter. The "PId " message is shown if the gains were applied and persisted, the "FL E" message if they
+ *          were applied but could not be persisted, or the "tU E" message if the model has not converged yet or if no
+ *          valid gains could be calculated from it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void apply_internal_ambient_thermal_model_gains(void);
+
+/**@brief   Applies one of the @ref MTKATR001_Command that has been received as ETX OTA Custom Data and requests the
+ *          corresponding message to be shown at the 7-segment Display Device.
+ *
+ * @details The following messages are shown:<br>
+ *          <ul>
+ *              <li>"PId " if the @ref MTKATR001_CMD_SET_PID_GAINS Command was successfully applied and persisted.</li>
+ *              <li>"PId ", "FL E" or "tU E" if the @ref MTKATR001_CMD_APPLY_THERMAL_MODEL_GAINS Command was received (see @ref apply_internal_ambient_thermal_model_gains ).</li>
+ *              <li>"tUnE" or "tU E" if the @ref MTKATR001_CMD_START_PID_AUTOTUNE Command was received (see @ref start_internal_ambient_temp_autotune ).</li>
+ *              <li>"tU S" if the @ref MTKATR001_CMD_STOP_PID_AUTOTUNE Command was received.</li>
+ *              <li>"CAL " if the @ref MTKATR001_CMD_SET_SENSOR_CALIBRATION Command was successfully applied and persisted.</li>
+ *              <li>"Str " if the @ref MTKATR001_CMD_SET_TELEMETRY_STREAM_PERIOD Command was successfully applied.</li>
+ *              <li>Nothing if the reply of the @ref MTKATR001_CMD_GET_FAULT_HISTORY , the @ref MTKATR001_CMD_GET_RESET_INFO , the @ref MTKATR001_CMD_GET_SENSOR_CALIBRATION , the @ref MTKATR001_CMD_GET_THERMAL_MODEL , the @ref MTKATR001_CMD_GET_TELEMETRY_LOG or the @ref MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Command was successfully sent.</li>
+ *              <li>"FL E" if the Command was applied but it could not be persisted into the @ref system_params or the @ref sensor_calibration .</li>
+ *              <li>"EO I" if the Command is not recognized, if it has an invalid size or invalid values, or if its reply could not be sent.</li>
+ *          </ul>
+ *
+ * @param[in] data  Pointer to the ETX OTA Custom Data, whose first byte is the identifier of the Command.
+ * @param size      Size in bytes of the ETX OTA Custom Data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void apply_etx_ota_command(const uint8_t *data, uint16_t size);
+
+/**@brief   Sends the reply of the @ref MTKATR001_CMD_GET_FAULT_HISTORY Command back to the host, which contains the
+ *          currently active fault and up to @ref ETX_OTA_FAULT_HISTORY_REPLY_MAX_ENTRIES events of the fault history of
+ *          the @ref fault_manager .
+ *
+ * @param first_index   Index, where zero stands for the most recent event, of the first history event that wants to
+ *                      be sent.
+ *
+ * @return  The @ref ETX_OTA_Status Exception Code returned by the @ref send_etx_ota_custom_data_reply function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static ETX_OTA_Status send_fault_history_reply(uint8_t first_index);
+
+/**@brief   Sends the reply of the @ref MTKATR001_CMD_GET_RESET_INFO Command back to the host, which contains the
+ *          information about the latest reset of our MCU/MPU that was recorded by the @ref watchdog_supervisor .
+ *
+ * @return  The @ref ETX_OTA_Status Exception Code returned by the @ref send_etx_ota_custom_data_reply function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static ETX_OTA_Status send_reset_info_reply(void);
+
+/**@brief   Sends the reply of the @ref MTKATR001_CMD_GET_SENSOR_CALIBRATION Command back to the host, which contains
+ *          the calibration table of a desired Temperature Sensor.
+ *
+ * @param channel   Value of the @ref Temp_Sensor_Channel that was received in that Command.
+ *
+ * @retval  ETX_OTA_EC_ERR  If the \p channel param is not valid.
+ * @return  Otherwise, the @ref ETX_OTA_Status Exception Code returned by the @ref send_etx_ota_custom_data_reply
+ *          function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static ETX_OTA_Status send_sensor_calibration_reply(uint8_t channel);
+
+/**@brief   Sends the reply of the @ref MTKATR001_CMD_GET_THERMAL_MODEL Command back to the host, which contains the
+ *          model of the Internal Ambient Temperature that has been identified so far by the @ref thermal_model .
+ *
+ * @return  The @ref ETX_OTA_Status Exception Code returned by the @ref send_etx_ota_custom_data_reply function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static ETX_OTA_Status send_thermal_model_reply(void);
+
+/**@brief   Sends the reply of a Command that requests telemetry records (e.g., @ref MTKATR001_CMD_GET_TELEMETRY_LOG )
+ *          back to the host, which contains the records that have been read for it.
+ *
+ * @param command           Identifier of the @ref MTKATR001_Command that is being replied.
+ * @param latest_sequence   Sequence number that the next record written into the records source will have.
+ * @param next_sequence     Sequence number that follows the last record that is sent.
+ * @param[in] records       Pointer to the records that are sent, in chronological order.
+ * @param total_records     Number of records in the \p records param, which must not be greater than
+ *                          @ref ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS .
+ *
+ * @return  The @ref ETX_OTA_Status Exception Code returned by the @ref send_etx_ota_custom_data_reply function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static ETX_OTA_Status send_telemetry_records_reply(uint8_t command, uint32_t latest_sequence, uint32_t next_sequence, const telemetry_record_t *records, uint8_t total_records);
+
+/**@brief   Comms Task of the MTKATR001 System, which is periodically executed by the @ref task_scheduler each
+ *          @ref COMMS_TASK_PERIOD milliseconds.
+ *
+ * @details This task applies, outside of the UART Interrupt context, the result of the latest ETX OTA Transaction that
+ *          was recorded by the @ref etx_ota_status_resp_handler function. This includes updating the MTKATR001 System
+ *          Parameters with any received ETX OTA Custom Data and requesting the corresponding "EO D", "EO I" or "EO Q"
+ *          message to be shown at the 7-segment Display Device, or applying the received @ref MTKATR001_Command via
+ *          the @ref apply_etx_ota_command function.
+ * @details Otherwise, this task gives the current Temperatures and actuators to the @ref telemetry_stream , which sends
+ *          them over the same UART in non-blocking mode.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void comms_task(void);
+
+/**@brief   Consumes all the pending events of the @ref push_buttons .
+ *
+ * @details Whenever both the Show Hot Fan Duty Cycle and the Show Cold Fan Duty Cycle buttons have been long-pressed
+ *          at the same time (see @ref BUTTONS_LONG_PRESS_TIME ), the Auto-Tuning of the Internal Ambient Temperature
+ *          PID Controller is started if it was not on-going, or it is stopped otherwise. Both buttons have to be
+ *          released before doing so again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void process_push_button_events(void);
+
+/**@brief   Display Task of the MTKATR001 System, which is periodically executed by the @ref task_scheduler each
+ *          @ref DISPLAY_TASK_PERIOD milliseconds.
+ *
+ * @details This task first consumes the pending events of the @ref push_buttons via the
+ *          @ref process_push_button_events function and then decides what is to be shown at the 7-segment Display
+ *          Device, with the following priority:<br>
+ *          <ol>
+ *              <li>The "Err=" message and the Exception Code of the latest active fault of the @ref fault_manager , one after the other, if all the capabilities of the MTKATR001 System have been lost (see @ref MTKATR001_ALL_CAPABILITIES ).</li>
+ *              <li>The "Err=" message, the Exception Code of the latest active fault and then whatever the following screens would show, one after the other, if there is any other active fault (i.e., while in a degraded mode).</li>
+ *              <li>The message requested via the @ref show_display_message function, if it has not expired yet.</li>
+ *              <li>The Desired Internal Ambient Temperature, the current Application Firmware version, the Hot Fan Duty Cycle or the Cold Fan Duty Cycle, if the user is pressing its corresponding button.</li>
+ *              <li>The "HEAt", " Hot", "AtEr" and " ..." screens, one after the other, while the Hot Air state machine is waiting for the Hot Water to be heated (see @ref HOT_AIR_WAITING_HOT_WATER ).</li>
+ *              <li>The "nEEd", "Cold", "AtEr" and " ..." screens, one after the other, while the Cold Air state machine is waiting for the Cold Water to be changed, which are shown faster and with a blank screen instead of the " ..." one once it has escalated (see @ref COLD_AIR_ESCALATED ).</li>
+ *              <li>The "tUnE" message and the current Internal Ambient Temperature, one after the other, while the Auto-Tuning of the Internal Ambient Temperature PID Controller is on-going.</li>
+ *              <li>The "tUnd" message and the resulting Proportional gain (in %/°C, followed by 'P'), Integral gain (in %/(°C·min), followed by 'I') and Derivative gain (in %·min/°C, followed by 'd'), one after the other, during @ref DISPLAY_AUTOTUNE_RESULT_DURATION milliseconds after the Auto-Tuning has finished successfully, where '-' is shown instead of any gain that does not fit in the Display.</li>
+ *              <li>The current Internal Ambient Temperature otherwise.</li>
+ *          </ol>
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+static void display_task(void);
+
+/* USER CODE END PFP */
+
+/* Private user code ---------------------------------------------------------*/
+/* USER CODE BEGIN 0 */
+task_scheduler_task_t mtkatr001_tasks[TOTAL_MTKATR001_TASKS] = {
+    {.callback = sensing_task, .period = SENSING_TASK_PERIOD, .deadline = SENSING_TASK_DEADLINE},
+    {.callback = control_task, .period = CONTROL_TASK_PERIOD, .deadline = CONTROL_TASK_DEADLINE},
+    {.callback = comms_task, .period = COMMS_TASK_PERIOD, .deadline = COMMS_TASK_DEADLINE},
+    {.callback = display_task, .period = DISPLAY_TASK_PERIOD, .deadline = DISPLAY_TASK_DEADLINE}
+};                                                                                  /**< @brief Global array variable that holds the tasks of the MTKATR001 System that are managed by the @ref task_scheduler , where their order in this array defines their priority. */
+const fault_def_t mtkatr001_faults[TOTAL_MTKATR001_FAULTS] = {
+    {.code = MTKATR001_EC_ERR, .is_latched = 1, .lost_capabilities = MTKATR001_ALL_CAPABILITIES},
+    {.code = MTKATR001_EC_INIT_ETX_OTA_MODULE_ERR, .is_latched = 1, .lost_capabilities = 0},
+    {.code = MTKATR001_HOT_WATER_TEMP_IS_UNDER_SHORTCIRCUIT, .is_latched = 1, .lost_capabilities = MTKATR001_CAPABILITY_HEATING},
+    {.code = MTKATR001_COLD_WATER_TEMP_IS_UNDER_SHORTCIRCUIT, .is_latched = 1, .lost_capabilities = MTKATR001_CAPABILITY_COOLING},
+    {.code = MTKATR001_COLD_WATER_TEMP_ADC_ERR, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = SENSOR_FAULT_CLEAR_TIME, .lost_capabilities = MTKATR001_CAPABILITY_COOLING},
+    {.code = MTKATR001_HOT_WATER_TEMP_ADC_ERR, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = SENSOR_FAULT_CLEAR_TIME, .lost_capabilities = MTKATR001_CAPABILITY_HEATING},
+    {.code = MTKATR001_INTERNAL_AMBIENT_TEMP_ADC_ERR, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = SENSOR_FAULT_CLEAR_TIME, .lost_capabilities = MTKATR001_ALL_CAPABILITIES},
+    {.code = MTKATR001_TEMP_SENSORS_ADC_DMA_ERR, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = ADC_DMA_FAULT_CLEAR_TIME, .lost_capabilities = MTKATR001_ALL_CAPABILITIES},
+    {.code = MTKATR001_SYSTEM_PARAMS_ERR, .is_latched = 1, .lost_capabilities = 0},
+    {.code = MTKATR001_HOT_WATER_OVER_TEMPERATURE, .is_latched = 1, .lost_capabilities = MTKATR001_CAPABILITY_HEATING},
+    {.code = MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = AMBIENT_OVER_TEMP_FAULT_CLEAR_TIME, .lost_capabilities = MTKATR001_CAPABILITY_HEATING},
+    {.code = MTKATR001_WATCHDOG_RESET, .is_latched = 0, .max_retries = 1, .clear_time = WATCHDOG_RESET_FAULT_CLEAR_TIME, .lost_capabilities = 0}
+};                                                                                  /**< @brief Global array variable that holds the faults of the MTKATR001 System that are managed by the @ref fault_manager , together with the capabilities that each of them loses while it is active. @details The faults that are detected while our MCU/MPU boots (i.e., @ref MTKATR001_EC_INIT_FW_UPDT_CONF_MODULE_ERR , @ref MTKATR001_BOOTLOADER_FIRMWARE_VALIDATION_ERR and @ref MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR ) are not managed here since the Application Firmware cannot be trusted to run after them. */
+volatile uint32_t isr_raised_faults = 0;                                            /**< @brief Global variable whose bit number N is set from an Interrupt context whenever the fault with the @ref MTKATR001_Status Exception Code N is detected there, after having forced its actuators into their safe state. @details These faults are set via the @ref raise_isr_fault function and then reported to the @ref fault_manager by the @ref process_isr_raised_faults function, since the @ref fault_manager must only be used from the tasks of the @ref task_scheduler . */
+uint16_t display_message[DISPLAY_5641AS_CHARACTERS_SIZE];                           /**< @brief Global array variable used to hold the ASCII characters of the message that was lastly requested via the @ref show_display_message function. */
+uint32_t display_message_end_tick = 0;                                              /**< @brief Global variable that holds the HAL Tick at which the message held by @ref display_message will stop being shown at the 7-segment Display Device. */
+volatile uint8_t is_etx_ota_response_pending = 0;                                   /**< @brief Flag that indicates whether the @ref comms_task has yet to apply the result of the latest ETX OTA Transaction or not. @details 0 = Not pending<br>1 = Pending */
+volatile ETX_OTA_Status etx_ota_pending_response;                                   /**< @brief Global variable that holds the ETX OTA Status Exception Code of the latest ETX OTA Transaction that the @ref comms_task has yet to apply. */
+uint8_t etx_ota_pending_custom_data[ETX_OTA_PENDING_CUSTOM_DATA_MAX_SIZE];          /**< @brief Global array variable that holds a copy of the ETX OTA Custom Data of the latest ETX OTA Transaction so that the @ref comms_task can apply it outside of the UART Interrupt context. */
+uint16_t etx_ota_pending_custom_data_size;                                          /**< @brief Global variable that holds the size in bytes of the ETX OTA Custom Data that was received in the latest ETX OTA Transaction. */
+const sensor_filter_config_t temp_sensors_filter_configs[TEMP_SENSORS_TOTAL_CHANNELS] = {
+    {.median_window = COLD_WATER_TEMP_FILTER_MEDIAN_WINDOW, .cutoff_frequency = COLD_WATER_TEMP_FILTER_CUTOFF_FREQUENCY, .sample_rate = TEMP_SENSORS_SAMPLE_RATE},
+    {.median_window = HOT_WATER_TEMP_FILTER_MEDIAN_WINDOW, .cutoff_frequency = HOT_WATER_TEMP_FILTER_CUTOFF_FREQUENCY, .sample_rate = TEMP_SENSORS_SAMPLE_RATE},
+    {.median_window = INTERNAL_AMBIENT_TEMP_FILTER_MEDIAN_WINDOW, .cutoff_frequency = INTERNAL_AMBIENT_TEMP_FILTER_CUTOFF_FREQUENCY, .sample_rate = TEMP_SENSORS_SAMPLE_RATE}
+};                                                                                  /**< @brief Global array variable that holds the Median plus IIR Sensor Filter configuration of the Cold Water, Hot Water and Internal Ambient Temperature Sensors, in that order (see @ref Temp_Sensor_Channel ). */
+system_params_data_t system_params;                                                 /**< @brief Global struct that holds a copy of the MTKATR001 System Parameters that have been lastly written into, or read from, the @ref system_params . */
+pid_autotune_t internal_ambient_temp_autotune;                                      /**< @brief Global variable that holds the Relay-Feedback Auto-Tuner of the Internal Ambient Temperature PID Controller. */
+const push_button_def_t mtkatr001_buttons[TOTAL_MTKATR001_BUTTONS] = {
+    {.GPIO_Port = Show_desired_internal_ambient_temperature_GPIO_Input_GPIO_Port, .GPIO_Pin = Show_desired_internal_ambient_temperature_GPIO_Input_Pin, .pressed_state = GPIO_PIN_SET, .is_exti = 1},
+    {.GPIO_Port = Show_current_firmware_version_GPIO_Input_GPIO_Port, .GPIO_Pin = Show_current_firmware_version_GPIO_Input_Pin, .pressed_state = GPIO_PIN_SET, .is_exti = 1},
+    {.GPIO_Port = Show_hot_fan_duty_cycle_GPIO_Input_GPIO_Port, .GPIO_Pin = Show_hot_fan_duty_cycle_GPIO_Input_Pin, .pressed_state = GPIO_PIN_SET, .is_exti = 1},
+    {.GPIO_Port = Show_cold_fan_duty_cycle_GPIO_Input_GPIO_Port, .GPIO_Pin = Show_cold_fan_duty_cycle_GPIO_Input_Pin, .pressed_state = GPIO_PIN_SET, .is_exti = 0}
+};                                                                                  /**< @brief Global array variable that holds the Push Buttons of the MTKATR001 System that are managed by the @ref push_buttons , ordered as in @ref MTKATR001_Button . @note The Show Cold Fan Duty Cycle button (i.e., PC15) is sampled by the debouncer instead of using an EXTI line, since the EXTI line 15 is already used by the Show Hot Fan Duty Cycle button (i.e., PA15). */
+uint8_t is_button_long_pressed[TOTAL_MTKATR001_BUTTONS];                            /**< @brief Global array variable that holds whether each Push Button of the MTKATR001 System, ordered as in @ref MTKATR001_Button , has been long-pressed since it was lastly pressed. */
+uint32_t autotune_result_end_tick = 0;                                              /**< @brief Global variable that holds the HAL Tick at which the result of the latest successful Auto-Tuning will stop being reported at the 7-segment Display Device. */
+pid_controller_t hot_water_temp_pid;                                                /**< @brief Global variable that holds the PID Controller of the Hot Water Temperature, whose output is given in centi-percent of Water Heating Resistor On time. */
+Hot_Air_State hot_air_state = HOT_AIR_OFF;                                          /**< @brief Global variable that holds the current state of the Hot Air state machine of the MTKATR001 System (see @ref run_hot_air_state_machine ). */
+Cold_Air_State cold_air_state = COLD_AIR_OFF;                                       /**< @brief Global variable that holds the current state of the Cold Air state machine of the MTKATR001 System (see @ref run_cold_air_state_machine ). */
+uint32_t cold_air_wait_start_tick = 0;                                              /**< @brief Global variable that holds the HAL Tick at which the Cold Air state machine started waiting for the Cold Water to be changed. */
+time_proportional_output_t water_heater_output;                                     /**< @brief Global variable that holds the Time-Proportional Output with which the Water Heating Resistor is driven. */
+pid_controller_t internal_ambient_temp_pid;                                         /**< @brief Global variable that holds the PID Controller of the Internal Ambient Temperature, whose output is given in centi-percent of Fan Duty Cycle, where positive values stand for the Hot Fan and negative values for the Cold Fan. */
+uint32_t last_adc_calibration_tick = 0;                                             /**< @brief Global variable that holds the HAL Tick at which the Temperature Sensors ADC was lastly self-calibrated. */
+const sensor_diagnostics_config_t temp_sensors_diagnostics_configs[TEMP_SENSORS_TOTAL_CHANNELS] = {
+    {.min_value = TO_CENTI_UNITS(LM35_MIN_TEMPERATURE), .max_value = TO_CENTI_UNITS(LM35_MAX_TEMPERATURE), .max_rate = WATER_TEMP_MAX_RATE, .stuck_time = TEMP_SENSOR_STUCK_TIME, .settle_time = TEMP_SENSOR_SETTLE_TIME, .fail_time = TEMP_SENSOR_SUSPECT_FAIL_TIME},
+    {.min_value = TO_CENTI_UNITS(LM35_MIN_TEMPERATURE), .max_value = TO_CENTI_UNITS(LM35_MAX_TEMPERATURE), .max_rate = WATER_TEMP_MAX_RATE, .stuck_time = TEMP_SENSOR_STUCK_TIME, .settle_time = TEMP_SENSOR_SETTLE_TIME, .fail_time = TEMP_SENSOR_SUSPECT_FAIL_TIME},
+    {.min_value = TO_CENTI_UNITS(LM35_MIN_TEMPERATURE), .max_value = TO_CENTI_UNITS(LM35_MAX_TEMPERATURE), .max_rate = INTERNAL_AMBIENT_TEMP_MAX_RATE, .stuck_time = TEMP_SENSOR_STUCK_TIME, .settle_time = TEMP_SENSOR_SETTLE_TIME, .fail_time = TEMP_SENSOR_SUSPECT_FAIL_TIME}
+};                                                                                  /**< @brief Global array variable that holds the configuration of the @ref sensor_diagnostics of the Cold Water, Hot Water and Internal Ambient Temperature Sensors, in that order (see @ref Temp_Sensor_Channel ), in centi-degrees Celsius. */
+sensor_diagnostics_t temp_sensors_diagnostics[TEMP_SENSORS_TOTAL_CHANNELS];         /**< @brief Global array variable that holds the @ref sensor_diagnostics of each Temperature Sensor, ordered as in @ref Temp_Sensor_Channel . */
+uint32_t last_telemetry_tick = 0;                                                   /**< @brief Global variable that holds the HAL Tick at which the latest snapshot was written into the @ref telemetry_log . */
+const thermal_model_config_t internal_ambient_thermal_model_config = {
+    .sample_period = THERMAL_MODEL_SAMPLE_PERIOD,
+    .forgetting_factor = THERMAL_MODEL_FORGETTING_FACTOR,
+    .min_samples = THERMAL_MODEL_MIN_SAMPLES,
+    .measurement_scale = TO_CENTI_UNITS(1),
+    .input_scale = TO_CENTI_UNITS(100)
+};                                                                                  /**< @brief Global variable that holds the configuration of the @ref thermal_model of the Internal Ambient Temperature, whose measurements are given in centi-degrees Celsius and whose inputs are given in centi-percent of Fan Duty Cycle. */
+const preheat_scheduler_config_t hot_water_preheat_scheduler_config = {
+    .window = PREHEAT_WINDOW_TIME,
+    .filter_shift = PREHEAT_FILTER_SHIFT,
+    .min_samples = PREHEAT_MIN_SAMPLES,
+    .lead_margin = PREHEAT_LEAD_MARGIN
+};                                                                                  /**< @brief Global variable that holds the configuration of the @ref preheat_scheduler of the Hot Water. */
+preheat_scheduler_t hot_water_preheat_scheduler;                                    /**< @brief Global variable that holds the @ref preheat_scheduler of the Hot Water, whose buffer is the Hot Water and whose heated process is the Internal Ambient Temperature, both in centi-degrees Celsius. */
+thermal_model_t internal_ambient_thermal_model;                                     /**< @brief Global variable that holds the @ref thermal_model of the Internal Ambient Temperature with respect to the output of the Fans, where positive values stand for the Hot Fan and negative values for the Cold Fan. */
+
+/* USER CODE END 0 */
+
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* USER CODE BEGIN 1 */
+
+  /* USER CODE END 1 */
+
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* USER CODE BEGIN Init */
+
+  /* USER CODE END Init */
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* USER CODE BEGIN SysInit */
+
+  /* USER CODE END SysInit */
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+  MX_DMA_Init();
+  MX_USART3_UART_Init();
+  MX_TIM2_Init();
+  MX_TIM3_Init();
+  MX_ADC1_Init();
+  MX_TIM4_Init();
+  MX_ADC2_Init();
+  /* USER CODE BEGIN 2 */
+
+    /* Send a message from the Application showing the current Application version there. */
     #if ETX_OTA_VERBOSE
         printf("Starting Application v%d.%d\r\n", APP_version[0], APP_version[1]);
     #endif
@@ -383,12 +1199,61 @@ int main(void)
     display_output[3] = Number_8Dp_in_ASCII;
     set_5641as_display_output(display_output);
 
+    /* Initialize the Fault Manager module before anything else that can report a fault to it. */
+    if (init_fault_manager(mtkatr001_faults, TOTAL_MTKATR001_FAULTS) != FAULT_MANAGER_EC_OK)
+    {
+        Error_Handler();
+    }
+
     /* We initialize the Firmware Update Configurations sub-module and the ETX OTA Firmware Update module, and also validate the currently installed Application Firmware in our MCU/MPU. */
     // NOTE: These initializations must be made in that order. After those, you may call the initialization functions of your actual application.
     custom_firmware_update_config_init();
     custom_init_etx_ota_protocol_module(ETX_OTA_hw_Protocol_BT, &huart3);
     validate_application_firmware();
 
+    /* Stream the live Temperatures and actuators over the same UART as the ETX OTA Protocol, which can only fail due to a programming error. */
+    if (init_telemetry_stream(&huart3, TELEMETRY_STREAM_DEFAULT_PERIOD) != TELEMETRY_STREAM_EC_OK)
+    {
+        Error_Handler();
+    }
+
+    /* Load the persisted MTKATR001 System Parameters and initialize the Internal Ambient Temperature PID Controller with them. */
+    custom_system_params_init();
+
+    /* Initialize the Hot Water Temperature PID Controller and the Time-Proportional Output of the Water Heating Resistor. */
+    custom_water_heater_init();
+
+    /* Make the ADC Analog Watchdogs turn Off the heating actuators, with no software loop involved, whenever the Hot Water or the Internal Ambient Temperature Sensor goes above its maximum. */
+    custom_over_temp_adc_watchdog_init();
+
+    /* Load the calibration tables of the Temperature Sensors, which are left uncalibrated if none have been persisted yet. */
+    init_sensor_calibration_module();
+
+    /* Start the telemetry history of the MTKATR001 System with an empty ring buffer, which is archived after the records that have been persisted before the latest reset, if any. */
+    init_telemetry_log();
+    init_telemetry_archive_module();
+
+    /* Initialize the plausibility diagnostics of the Temperature Sensors, whose configurations are constant and, therefore, can only fail due to a programming error. */
+    for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+    {
+        if (init_sensor_diagnostics(&temp_sensors_diagnostics[i], &temp_sensors_diagnostics_configs[i]) != SENSOR_DIAGNOSTICS_EC_OK)
+        {
+            Error_Handler();
+        }
+    }
+
+    /* Start identifying the model of the Internal Ambient Temperature from scratch, whose configuration is constant and, therefore, can only fail due to a programming error. */
+    if (init_thermal_model(&internal_ambient_thermal_model, &internal_ambient_thermal_model_config) != THERMAL_MODEL_EC_OK)
+    {
+        Error_Handler();
+    }
+
+    /* Start the timer-triggered conversions of the Cold Water, Hot Water and Internal Ambient Temperature Sensors into the Circular DMA buffer of the Temperature Sensors ADC Acquisition module. */
+    if (init_temp_sensors_module(&hadc1, &htim4, TEMP_SENSORS_TRIGGER_TIMER_CHANNEL, temp_sensors_filter_configs) != TEMP_SENSORS_EC_OK)
+    {
+        report_mtkatr001_fault(MTKATR001_TEMP_SENSORS_ADC_DMA_ERR, 1);
+    }
+
     /* Initialize the Cold and Hot Fan's PWMs. */
     HAL_TIM_PWM_Start(&htim3, COLD_FAN_TIMER_CHANNEL); // Starting the PWM of Timer3-CH1 for the Cold Fan.
     HAL_TIM_PWM_Start(&htim3, HOT_FAN_TIMER_CHANNEL); // Starting the PWM of Timer3-CH2 for the Hot Fan.
@@ -403,6 +1268,22 @@ int main(void)
 
     /* Set default MTKATR001 System Parameters values. */
     // NOTE: These default values have already been assigned at the moment of declaring the variables that will hold such values.
+
+    /* Initialize the Debounced Push Buttons module, whose debouncer runs from the SysTick Interrupt. */
+    if (init_push_buttons_module(mtkatr001_buttons, TOTAL_MTKATR001_BUTTONS, BUTTONS_DEBOUNCE_TIME, BUTTONS_LONG_PRESS_TIME) != PUSH_BUTTONS_EC_OK)
+    {
+        Error_Handler();
+    }
+
+    /* Initialize the Cooperative Task Scheduler with the Sensing, Control, Comms and Display Tasks of the MTKATR001 System. */
+    if (init_task_scheduler_module(mtkatr001_tasks, TOTAL_MTKATR001_TASKS) != TASK_SCHEDULER_EC_OK)
+    {
+        Error_Handler();
+    }
+
+    /* Start supervising the tasks of the MTKATR001 System with the Independent Watchdog, and report whether it was the one that reset our MCU/MPU. */
+    // NOTE: This must be the last initialization, since the Independent Watchdog cannot be stopped once started.
+    custom_watchdog_supervisor_init();
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -413,249 +1294,11 @@ int main(void)
 
     /* USER CODE BEGIN 3 */
 
-      /* Validate whether the Hot Water Temperature Sensor is currently under a short-circuit or not. */
-      if (HAL_GPIO_ReadPin(Hot_Water_Shortcircuit_Indicator_GPIO_Input_GPIO_Port, Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin) == GPIO_PIN_RESET)
-      {
-		  while (1)
-		  {
-			  convert_number_to_ASCII(MTKATR001_HOT_WATER_TEMP_IS_UNDER_SHORTCIRCUIT, ascii_error_code);
-			  ascii_error_code[3] = 0;
-			  display_output[0] = 'E';
-			  display_output[1] = 'r';
-			  display_output[2] = 'r';
-			  display_output[3] = '=';
-			  set_5641as_display_output(display_output);
-			  HAL_Delay(2000);
-			  set_5641as_display_output(ascii_error_code);
-			  HAL_Delay(2000);
-		  }
-      }
-      /* Validate whether the Cold Water Temperature Sensor is currently under a short-circuit or not. */
-      else if (HAL_GPIO_ReadPin(Cold_Water_Shortcircuit_Indicator_GPIO_Input_GPIO_Port, Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin) == GPIO_PIN_RESET)
-      {
-		  while (1)
-		  {
-			  convert_number_to_ASCII(MTKATR001_COLD_WATER_TEMP_IS_UNDER_SHORTCIRCUIT, ascii_error_code);
-			  ascii_error_code[3] = 0;
-			  display_output[0] = 'E';
-			  display_output[1] = 'r';
-			  display_output[2] = 'r';
-			  display_output[3] = '=';
-			  set_5641as_display_output(display_output);
-			  HAL_Delay(2000);
-			  set_5641as_display_output(ascii_error_code);
-			  HAL_Delay(2000);
-		  }
-      }
-      /* Show the Desired Internal Ambient temperature at the MTKATR001's Display if the user requests it. */
-      else if (HAL_GPIO_ReadPin(Show_desired_internal_ambient_temperature_GPIO_Input_GPIO_Port, Show_desired_internal_ambient_temperature_GPIO_Input_Pin) == GPIO_PIN_SET)
-      {
-          convert_number_to_ASCII((float) desired_internal_ambient_temperature, display_output);
-          display_output[3] = 'C';
-          set_5641as_display_output(display_output);
-          HAL_Delay(1000);
-      }
-      /* Show the current Application Firmware Version at the MTKATR001's Display if the user requests it. */
-      else if (HAL_GPIO_ReadPin(Show_current_firmware_version_GPIO_Input_GPIO_Port, Show_current_firmware_version_GPIO_Input_Pin) == GPIO_PIN_SET)
-      {
-          display_output[0] = '\0';
-          display_output[1] = 'A';
-          display_output[2] = 'F';
-          display_output[3] = '=';
-          set_5641as_display_output(display_output);
-          HAL_Delay(500);
-          convert_number_to_ASCII((float)(APP_version[0]) + ((float)APP_version[1]/10.0), display_output);
-          display_output[3] = 0;
-          set_5641as_display_output(display_output);
-          HAL_Delay(500);
-      }
-      /* Show the Duty Cycle of the Hot Fan at the MTKATR001's Display if the user requests it. */
-      else if (HAL_GPIO_ReadPin(Show_hot_fan_duty_cycle_GPIO_Input_GPIO_Port, Show_hot_fan_duty_cycle_GPIO_Input_Pin) == GPIO_PIN_SET)
-      {
-          if (desired_hot_fan_duty_cycle == 100)
-          {
-              display_output[0] = '1';
-              display_output[1] = '0';
-              display_output[2] = '0';
-              display_output[3] = 'd';
-          }
-          else
-          {
-              convert_number_to_ASCII((float) desired_hot_fan_duty_cycle, display_output);
-              display_output[3] = 'd';
-          }
-          set_5641as_display_output(display_output);
-          HAL_Delay(1000);
-      }
-      /* Show the Duty Cycle of the Cold Fan at the MTKATR001's Display if the user requests it. */
-      else if (HAL_GPIO_ReadPin(Show_cold_fan_duty_cycle_GPIO_Input_GPIO_Port, Show_cold_fan_duty_cycle_GPIO_Input_Pin) == GPIO_PIN_SET)
-      {
-          if (desired_cold_fan_duty_cycle == 100)
-          {
-              display_output[0] = '1';
-              display_output[1] = '0';
-              display_output[2] = '0';
-              display_output[3] = 'd';
-          }
-          else
-          {
-              convert_number_to_ASCII((float) desired_cold_fan_duty_cycle, display_output);
-              display_output[3] = 'd';
-          }
-          set_5641as_display_output(display_output);
-          HAL_Delay(1000);
-      }
-      /* Proceed into the main code if both the short-circuits validations passed and if the user did not requested to see a specific MTKATR001 System Parameter. */
-      else
-      {
-          /* Read and get the Cold Water Temperature. */
-          update_current_cold_water_temperature();
-
-          /* Read and get the Hot Water Temperature. */
-          update_current_hot_water_temperature();
-
-          /* Read and get the Current Internal Ambient temperature. */
-          update_current_internal_ambient_temperature();
-
-          /* Check whether Cold or Hot Water is needed to respectively lower or raise the Internal Ambient Temperature in the MTKATR001 System, and take the corresponding actions to achieve it. */
-          if (current_internal_ambient_temperature >= (((float) desired_internal_ambient_temperature)-INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED))
-          {
-              /* Turn Off the Hot Fan and Hot Water Pump to stop throwing heat inside the MTKATR001 System. */
-              __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(0, HOT_FAN_MAX_COMPARE_VALUE));
-              HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
-
-              /* Check whether Cold Water is needed to lower the Internal Ambient Temperature in the MTKATR001 or if the Current Internal Temperature is within the desired Temperature range, and take the corresponding actions. */
-              if (current_internal_ambient_temperature <= (((float) desired_internal_ambient_temperature)+INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED))
-              {
-                  /* Turn Off the Cold Fan and Cold Water Pump to stop throwing Cold Air inside the MTKATR001 System. */
-                  __HAL_TIM_SET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(0, COLD_FAN_MAX_COMPARE_VALUE));
-                  HAL_GPIO_WritePin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
-
-                  /* The Desired Internal Ambient Temperature has been reached. Therefore, turn On the IIART LED. */
-                  HAL_GPIO_WritePin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin, GPIO_PIN_SET);
-
-                  /* Show the value of the Current Internal Ambient Temperature on the 7-segment Display Device. */
-                  convert_number_to_ASCII(current_internal_ambient_temperature, display_output);
-                  display_output[3] = 'C';
-                  set_5641as_display_output(display_output);
-                  HAL_Delay(1000);
-              }
-              else
-              {
-                  /* The Desired Internal Ambient Temperature has not been reached. Therefore, turn Off the IIART LED. */
-                  HAL_GPIO_WritePin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin, GPIO_PIN_RESET);
-
-                  /* Inform the user if Cooler Water is needed and, if it is cooled enough, then start cooling inside the MTKATR0001 System. */
-                  while (current_cold_water_temperature > ((float) desired_cold_water_max_temperature))
-                  {
-                      /* Inform the user via the 7-segment Display that the Cold Water is currently being cooled. */
-                      display_output[0] = 'n';
-                      display_output[1] = 'E';
-                      display_output[2] = 'E';
-                      display_output[3] = 'd';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-                      display_output[0] = 'C';
-                      display_output[1] = 'o';
-                      display_output[2] = 'l';
-                      display_output[3] = 'd';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-                      display_output[0] = 'A';
-                      display_output[1] = 't';
-                      display_output[2] = 'E';
-                      display_output[3] = 'r';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-                      display_output[0] = 0;
-                      display_output[1] = '.';
-                      display_output[2] = '.';
-                      display_output[3] = '.';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-
-                      /* Read and get the Cold Water Temperature. */
-                      update_current_cold_water_temperature();
-                  }
-
-                  /* Turn On the Cold Fan and Cold Water Pump to throw Cold Air inside the MTKATR001 System. */
-                  __HAL_TIM_SET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(desired_cold_fan_duty_cycle, COLD_FAN_MAX_COMPARE_VALUE));
-                  HAL_GPIO_WritePin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin, GPIO_PIN_SET);
-
-                  /* Show the value of the Current Internal Ambient Temperature on the 7-segment Display Device. */
-                  convert_number_to_ASCII(current_internal_ambient_temperature, display_output);
-                  display_output[3] = 'C';
-                  set_5641as_display_output(display_output);
-                  HAL_Delay(1000);
-              }
-          }
-          else
-          {
-              /* The Desired Internal Ambient Temperature has not been reached. Therefore, turn Off the IIART LED. */
-              HAL_GPIO_WritePin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin, GPIO_PIN_RESET);
-
-              /* Throw Heat inside the MTKATR001 System if the Hot Water is hot enough. Otherwise, heat the Hot Water more. */
-              if (current_hot_water_temperature >= ((float) desired_hot_water_min_temperature))
-              {
-                  /* Turn On the Hot Fan and Hot Water Pump to throw heat inside the MTKATR001 System. */
-                  __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(desired_hot_fan_duty_cycle, HOT_FAN_MAX_COMPARE_VALUE));
-                  HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_SET);
-
-                  /* Show the value of the Current Internal Ambient Temperature on the 7-segment Display Device. */
-                  convert_number_to_ASCII(current_internal_ambient_temperature, display_output);
-                  display_output[3] = 'C';
-                  set_5641as_display_output(display_output);
-                  HAL_Delay(1000);
-              }
-              else
-              {
-                  /* Turn On the Water Heating Resistor in order to heat the Hot Water more. */
-                  HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_SET);
-
-                  /* Continue Heating the Hot Water more until it is heated to the desired temperature. */
-                  while (current_hot_water_temperature < ((float) desired_hot_water_temperature))
-                  {
-                      /* Inform the user via the 7-segment Display that the Hot Water is currently being heated. */
-                      display_output[0] = 'H';
-                      display_output[1] = 'E';
-                      display_output[2] = 'A';
-                      display_output[3] = 't';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-                      display_output[0] = 0;
-                      display_output[1] = 'H';
-                      display_output[2] = 'o';
-                      display_output[3] = 't';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-                      display_output[0] = 'A';
-                      display_output[1] = 't';
-                      display_output[2] = 'E';
-                      display_output[3] = 'r';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-                      display_output[0] = 0;
-                      display_output[1] = '.';
-                      display_output[2] = '.';
-                      display_output[3] = '.';
-                      set_5641as_display_output(display_output);
-                      HAL_Delay(500);
-
-                      /* Read and get the Hot Water Temperature. */
-                      update_current_hot_water_temperature();
-                  }
-
-                  /* Turn Off the Water Heating Resistor. */
-                  HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_RESET);
-
-                  /* Show the value of the Current Internal Ambient Temperature on the 7-segment Display Device. */
-                  convert_number_to_ASCII(current_internal_ambient_temperature, display_output);
-                  display_output[3] = 'C';
-                  set_5641as_display_output(display_output);
-                  HAL_Delay(1000);
-              }
-          }
-      }
+      /* Execute the highest priority task of the MTKATR001 System whose release time has been reached, if there is any. */
+      run_task_scheduler();
+
+      /* Reload the Independent Watchdog only if all the tasks of the MTKATR001 System have checked in within their windows. */
+      run_watchdog_supervisor();
   }
   /* USER CODE END 3 */
 }
@@ -695,7 +1338,7 @@ void SystemClock_Config(void)
     Error_Handler();
   }
   PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_ADC;
-  PeriphClkInit.AdcClockSelection = RCC_ADCPCLK2_DIV8;
+  PeriphClkInit.AdcClockSelection = RCC_ADCPCLK2_DIV2;
   if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
   {
     Error_Handler();
@@ -723,12 +1366,12 @@ static void MX_ADC1_Init(void)
   /** Common config
   */
   hadc1.Instance = ADC1;
-  hadc1.Init.ScanConvMode = ADC_SCAN_DISABLE;
+  hadc1.Init.ScanConvMode = ADC_SCAN_ENABLE;
   hadc1.Init.ContinuousConvMode = DISABLE;
   hadc1.Init.DiscontinuousConvMode = DISABLE;
-  hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+  hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T4_CC4;
   hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
-  hadc1.Init.NbrOfConversion = 1;
+  hadc1.Init.NbrOfConversion = 4;
   if (HAL_ADC_Init(&hadc1) != HAL_OK)
   {
     Error_Handler();
@@ -738,7 +1381,34 @@ static void MX_ADC1_Init(void)
   */
   sConfig.Channel = ADC_CHANNEL_0;
   sConfig.Rank = ADC_REGULAR_RANK_1;
-  sConfig.SamplingTime = ADC_SAMPLETIME_239CYCLES_5;
+  sConfig.SamplingTime = ADC_SAMPLETIME_71CYCLES_5;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+  */
+  sConfig.Channel = ADC_CHANNEL_1;
+  sConfig.Rank = ADC_REGULAR_RANK_2;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+  */
+  sConfig.Channel = ADC_CHANNEL_4;
+  sConfig.Rank = ADC_REGULAR_RANK_3;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+  */
+  sConfig.Channel = ADC_CHANNEL_VREFINT;
+  sConfig.Rank = ADC_REGULAR_RANK_4;
   if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
   {
     Error_Handler();
@@ -749,6 +1419,53 @@ static void MX_ADC1_Init(void)
 
 }
 
+/**
+  * @brief ADC2 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_ADC2_Init(void)
+{
+
+  /* USER CODE BEGIN ADC2_Init 0 */
+
+  /* USER CODE END ADC2_Init 0 */
+
+  ADC_ChannelConfTypeDef sConfig = {0};
+
+  /* USER CODE BEGIN ADC2_Init 1 */
+
+  /* USER CODE END ADC2_Init 1 */
+
+  /** Common config
+  */
+  hadc2.Instance = ADC2;
+  hadc2.Init.ScanConvMode = ADC_SCAN_DISABLE;
+  hadc2.Init.ContinuousConvMode = DISABLE;
+  hadc2.Init.DiscontinuousConvMode = DISABLE;
+  hadc2.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T4_CC4;
+  hadc2.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+  hadc2.Init.NbrOfConversion = 1;
+  if (HAL_ADC_Init(&hadc2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /** Configure Regular Channel
+  */
+  sConfig.Channel = ADC_CHANNEL_4;
+  sConfig.Rank = ADC_REGULAR_RANK_1;
+  sConfig.SamplingTime = ADC_SAMPLETIME_71CYCLES_5;
+  if (HAL_ADC_ConfigChannel(&hadc2, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN ADC2_Init 2 */
+
+  /* USER CODE END ADC2_Init 2 */
+
+}
+
 /**
   * @brief TIM2 Initialization Function
   * @param None
@@ -858,41 +1575,116 @@ static void MX_TIM3_Init(void)
 }
 
 /**
-  * @brief USART3 Initialization Function
+  * @brief TIM4 Initialization Function
   * @param None
   * @retval None
   */
-static void MX_USART3_UART_Init(void)
+static void MX_TIM4_Init(void)
 {
 
-  /* USER CODE BEGIN USART3_Init 0 */
+  /* USER CODE BEGIN TIM4_Init 0 */
 
-  /* USER CODE END USART3_Init 0 */
+  /* USER CODE END TIM4_Init 0 */
 
-  /* USER CODE BEGIN USART3_Init 1 */
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+  TIM_OC_InitTypeDef sConfigOC = {0};
 
-  /* USER CODE END USART3_Init 1 */
-  huart3.Instance = USART3;
-  huart3.Init.BaudRate = 9600;
-  huart3.Init.WordLength = UART_WORDLENGTH_8B;
-  huart3.Init.StopBits = UART_STOPBITS_1;
-  huart3.Init.Parity = UART_PARITY_NONE;
-  huart3.Init.Mode = UART_MODE_TX_RX;
-  huart3.Init.HwFlowCtl = UART_HWCONTROL_NONE;
-  huart3.Init.OverSampling = UART_OVERSAMPLING_16;
-  if (HAL_UART_Init(&huart3) != HAL_OK)
+  /* USER CODE BEGIN TIM4_Init 1 */
+
+  /* USER CODE END TIM4_Init 1 */
+  htim4.Instance = TIM4;
+  htim4.Init.Prescaler = 0;
+  htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim4.Init.Period = 1250-1;
+  htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim4) != HAL_OK)
   {
     Error_Handler();
   }
-  /* USER CODE BEGIN USART3_Init 2 */
-
-  /* USER CODE END USART3_Init 2 */
-
-}
-
-/**
-  * @brief GPIO Initialization Function
-  * @param None
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim4, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_PWM_Init(&htim4) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim4, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.Pulse = 1;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  if (HAL_TIM_PWM_ConfigChannel(&htim4, &sConfigOC, TIM_CHANNEL_4) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM4_Init 2 */
+  /* Make the frequency of the Temperature Sensors Trigger Timer match the Scan rate configured in the Temperature Sensors ADC Acquisition module. */
+  __HAL_TIM_SET_AUTORELOAD(&htim4, (TEMP_SENSORS_TRIGGER_TIMER_FREQUENCY/TEMP_SENSORS_SCAN_RATE)-1);
+  /* USER CODE END TIM4_Init 2 */
+
+}
+
+/**
+  * @brief USART3 Initialization Function
+  * @param None
+  * @retval None
+  */
+static void MX_USART3_UART_Init(void)
+{
+
+  /* USER CODE BEGIN USART3_Init 0 */
+
+  /* USER CODE END USART3_Init 0 */
+
+  /* USER CODE BEGIN USART3_Init 1 */
+
+  /* USER CODE END USART3_Init 1 */
+  huart3.Instance = USART3;
+  huart3.Init.BaudRate = 9600;
+  huart3.Init.WordLength = UART_WORDLENGTH_8B;
+  huart3.Init.StopBits = UART_STOPBITS_1;
+  huart3.Init.Parity = UART_PARITY_NONE;
+  huart3.Init.Mode = UART_MODE_TX_RX;
+  huart3.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  huart3.Init.OverSampling = UART_OVERSAMPLING_16;
+  if (HAL_UART_Init(&huart3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN USART3_Init 2 */
+
+  /* USER CODE END USART3_Init 2 */
+
+}
+
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Channel1_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+
+}
+
+/**
+  * @brief GPIO Initialization Function
+  * @param None
   * @retval None
   */
 static void MX_GPIO_Init(void)
@@ -949,18 +1741,31 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin Show_desired_internal_ambient_temperature_GPIO_Input_Pin Show_hot_fan_duty_cycle_GPIO_Input_Pin */
-  GPIO_InitStruct.Pin = Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin|Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin|Show_desired_internal_ambient_temperature_GPIO_Input_Pin|Show_hot_fan_duty_cycle_GPIO_Input_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  /*Configure GPIO pins : Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin */
+  GPIO_InitStruct.Pin = Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin|Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+  GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+  /*Configure GPIO pins : Show_desired_internal_ambient_temperature_GPIO_Input_Pin Show_hot_fan_duty_cycle_GPIO_Input_Pin */
+  GPIO_InitStruct.Pin = Show_desired_internal_ambient_temperature_GPIO_Input_Pin|Show_hot_fan_duty_cycle_GPIO_Input_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
   GPIO_InitStruct.Pull = GPIO_PULLDOWN;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
   /*Configure GPIO pin : Show_current_firmware_version_GPIO_Input_Pin */
   GPIO_InitStruct.Pin = Show_current_firmware_version_GPIO_Input_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(Show_current_firmware_version_GPIO_Input_GPIO_Port, &GPIO_InitStruct);
 
+  /* EXTI interrupt init*/
+  HAL_NVIC_SetPriority(EXTI9_5_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
 }
 
 /* USER CODE BEGIN 4 */
@@ -988,42 +1793,6 @@ static void MX_GPIO_Init(void)
     }
 #endif
 
-static HAL_StatusTypeDef get_adc_output(ADC_HandleTypeDef *hadc, uint32_t adc_channel, float *dst)
-{
-    /** <b>Local variable adc_config:</b> @ref ADC_ChannelConfTypeDef Struct Type used to define the Configurations required for the requested ADC so that the desired Channel is chosen in that particular ADC. */
-    ADC_ChannelConfTypeDef sConfig = {0};
-    /** <b>Local variable ret:</b> Local variable used to hold the return value of a @ref HAL_StatusTypeDef function type. */
-    HAL_StatusTypeDef ret;
-
-    /* Change the current ADC Configuration Settings so that the desired ADC and Channel are selected. */
-    sConfig.Channel = adc_channel;
-    sConfig.Rank = ADC_REGULAR_RANK_1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_239CYCLES_5;
-    ret = HAL_ADC_ConfigChannel(hadc, &sConfig);
-    if (ret != HAL_OK)
-    {
-    	return ret;
-    }
-
-    /* Start the selected ADC and Channel. */
-    ret = HAL_ADC_Start(hadc);
-    if (ret != HAL_OK)
-    {
-        return ret;
-    }
-
-    /* Get the output value of the selected ADC and Channel. */
-    ret = HAL_ADC_PollForConversion(hadc, ADC_POLL_TIMEOUT); // Polling a single conversion from the selected ADC and Channel.
-    if (ret != HAL_OK)
-    {
-        return ret;
-    }
-    *dst = HAL_ADC_GetValue(hadc); // Retrieve the polled value from the selected ADC Channel.
-
-    /* Stop the selected ADC and Channel. */
-    return HAL_ADC_Stop(hadc);
-}
-
 // Place PWM Function here.
 
 static void custom_initialize_5641as_display_driver(void)
@@ -1071,214 +1840,6 @@ static void custom_initialize_5641as_display_driver(void)
     init_5641as_display_module(&htim2, &display_peripherals, on_time_steps, off_time_steps);
 }
 
-static int convert_number_to_ASCII(float src, uint16_t *dst)
-{
-    if ((src>=100) || (src<=-10))
-    {
-        return -1;
-    }
-
-    if (src > 0)
-    {
-        uint8_t first_character = src/10;
-        switch (first_character)
-        {
-            case 0:
-                dst[0] = Command_NULL_in_ASCII;
-                break;
-            case 1:
-                dst[0] = Number_1_in_ASCII;
-                break;
-            case 2:
-                dst[0] = Number_2_in_ASCII;
-                break;
-            case 3:
-                dst[0] = Number_3_in_ASCII;
-                break;
-            case 4:
-                dst[0] = Number_4_in_ASCII;
-                break;
-            case 5:
-                dst[0] = Number_5_in_ASCII;
-                break;
-            case 6:
-                dst[0] = Number_6_in_ASCII;
-                break;
-            case 7:
-                dst[0] = Number_7_in_ASCII;
-                break;
-            case 8:
-                dst[0] = Number_8_in_ASCII;
-                break;
-            case 9:
-                dst[0] = Number_9_in_ASCII;
-                break;
-            default:
-                // This case should not give place ever.
-        }
-
-        uint8_t second_character = src - (first_character*10);
-        switch (second_character)
-        {
-            case 0:
-                dst[1] = Number_0Dp_in_ASCII;
-                break;
-            case 1:
-                dst[1] = Number_1Dp_in_ASCII;
-                break;
-            case 2:
-                dst[1] = Number_2Dp_in_ASCII;
-                break;
-            case 3:
-                dst[1] = Number_3Dp_in_ASCII;
-                break;
-            case 4:
-                dst[1] = Number_4Dp_in_ASCII;
-                break;
-            case 5:
-                dst[1] = Number_5Dp_in_ASCII;
-                break;
-            case 6:
-                dst[1] = Number_6Dp_in_ASCII;
-                break;
-            case 7:
-                dst[1] = Number_7Dp_in_ASCII;
-                break;
-            case 8:
-                dst[1] = Number_8Dp_in_ASCII;
-                break;
-            case 9:
-                dst[1] = Number_9Dp_in_ASCII;
-                break;
-            default:
-                // This case should not give place ever.
-        }
-
-        uint8_t third_character = (src - (first_character*10) - (second_character)) * 10;
-        switch (third_character)
-        {
-            case 0:
-                dst[2] = Number_0_in_ASCII;
-                break;
-            case 1:
-                dst[2] = Number_1_in_ASCII;
-                break;
-            case 2:
-                dst[2] = Number_2_in_ASCII;
-                break;
-            case 3:
-                dst[2] = Number_3_in_ASCII;
-                break;
-            case 4:
-                dst[2] = Number_4_in_ASCII;
-                break;
-            case 5:
-                dst[2] = Number_5_in_ASCII;
-                break;
-            case 6:
-                dst[2] = Number_6_in_ASCII;
-                break;
-            case 7:
-                dst[2] = Number_7_in_ASCII;
-                break;
-            case 8:
-                dst[2] = Number_8_in_ASCII;
-                break;
-            case 9:
-                dst[2] = Number_9_in_ASCII;
-                break;
-            default:
-                // This case should not give place ever.
-        }
-    }
-    else if (src == 0)
-    {
-        dst[0] = Command_NULL_in_ASCII;
-        dst[1] = Number_0Dp_in_ASCII;
-        dst[2] = Number_0_in_ASCII;
-    }
-    else
-    {
-        dst[0] = Letter_minus_sign_in_ASCII;
-
-        uint8_t second_character = (-1)*src;
-        switch (second_character)
-        {
-            case 0:
-                dst[1] = Number_0Dp_in_ASCII;
-                break;
-            case 1:
-                dst[1] = Number_1Dp_in_ASCII;
-                break;
-            case 2:
-                dst[1] = Number_2Dp_in_ASCII;
-                break;
-            case 3:
-                dst[1] = Number_3Dp_in_ASCII;
-                break;
-            case 4:
-                dst[1] = Number_4Dp_in_ASCII;
-                break;
-            case 5:
-                dst[1] = Number_5Dp_in_ASCII;
-                break;
-            case 6:
-                dst[1] = Number_6Dp_in_ASCII;
-                break;
-            case 7:
-                dst[1] = Number_7Dp_in_ASCII;
-                break;
-            case 8:
-                dst[1] = Number_8Dp_in_ASCII;
-                break;
-            case 9:
-                dst[1] = Number_9Dp_in_ASCII;
-                break;
-            default:
-                // This case should not give place ever.
-        }
-
-        uint8_t third_character = ((src*-1) - second_character) * 10;
-        switch (third_character)
-        {
-            case 0:
-                dst[2] = Number_0_in_ASCII;
-                break;
-            case 1:
-                dst[2] = Number_1_in_ASCII;
-                break;
-            case 2:
-                dst[2] = Number_2_in_ASCII;
-                break;
-            case 3:
-                dst[2] = Number_3_in_ASCII;
-                break;
-            case 4:
-                dst[2] = Number_4_in_ASCII;
-                break;
-            case 5:
-                dst[2] = Number_5_in_ASCII;
-                break;
-            case 6:
-                dst[2] = Number_6_in_ASCII;
-                break;
-            case 7:
-                dst[2] = Number_7_in_ASCII;
-                break;
-            case 8:
-                dst[2] = Number_8_in_ASCII;
-                break;
-            case 9:
-                dst[2] = Number_9_in_ASCII;
-                break;
-            default:
-                // This case should not give place ever.
-        }
-    }
-
-    return 0;
-}
-
 static void custom_firmware_update_config_init()
 {
     /** <b>Local variable ret:</b> Return value of a @ref FirmUpdConf_Status function type. */
@@ -1326,7 +1887,7 @@ static void custom_firmware_update_config_init()
     #endif
     while (1)
     {
-    	convert_number_to_ASCII(MTKATR001_EC_INIT_FW_UPDT_CONF_MODULE_ERR, ascii_error_code);
+    	convert_number_to_5641as_ASCII(TO_CENTI_UNITS(MTKATR001_EC_INIT_FW_UPDT_CONF_MODULE_ERR), ascii_error_code);
 		ascii_error_code[3] = 0;
 		display_output[0] = 'E';
 		display_output[1] = 'r';
@@ -1354,21 +1915,10 @@ static void custom_init_etx_ota_protocol_module(ETX_OTA_hw_Protocol hw_protocol,
     if (ret != ETX_OTA_EC_OK)
     {
         #if ETX_OTA_VERBOSE
-            printf("ERROR: The ETX OTA Firmware Update Module could not be initialized. Our MCU/MPU will halt!.\r\n");
+            printf("ERROR: The ETX OTA Firmware Update Module could not be initialized. Our MCU/MPU will keep regulating without it!.\r\n");
         #endif
-        while (1)
-        {
-        	convert_number_to_ASCII(MTKATR001_EC_INIT_ETX_OTA_MODULE_ERR, ascii_error_code);
-			ascii_error_code[3] = 0;
-			display_output[0] = 'E';
-			display_output[1] = 'r';
-			display_output[2] = 'r';
-			display_output[3] = '=';
-            set_5641as_display_output(display_output);
-            HAL_Delay(2000);
-            set_5641as_display_output(ascii_error_code);
-            HAL_Delay(2000);
-        }
+        report_mtkatr001_fault(MTKATR001_EC_INIT_ETX_OTA_MODULE_ERR, 1);
+        return;
     }
     #if ETX_OTA_VERBOSE
         printf("DONE: The ETX OTA Firmware Update Module has been successfully initialized.\r\n");
@@ -1387,7 +1937,7 @@ static void validate_application_firmware()
         #endif
         while (1)
         {
-        	convert_number_to_ASCII(MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR, ascii_error_code);
+        	convert_number_to_5641as_ASCII(TO_CENTI_UNITS(MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR), ascii_error_code);
 			ascii_error_code[3] = 0;
 			display_output[0] = 'E';
 			display_output[1] = 'r';
@@ -1407,7 +1957,7 @@ static void validate_application_firmware()
         #endif
         while (1)
         {
-        	convert_number_to_ASCII(MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR, ascii_error_code);
+        	convert_number_to_5641as_ASCII(TO_CENTI_UNITS(MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR), ascii_error_code);
 			ascii_error_code[3] = 0;
 			display_output[0] = 'E';
 			display_output[1] = 'r';
@@ -1431,7 +1981,7 @@ static void validate_application_firmware()
         #endif
         while (1)
         {
-        	convert_number_to_ASCII(MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR, ascii_error_code);
+        	convert_number_to_5641as_ASCII(TO_CENTI_UNITS(MTKATR001_APPLICATION_FIRMWARE_VALIDATION_ERR), ascii_error_code);
 			ascii_error_code[3] = 0;
 			display_output[0] = 'E';
 			display_output[1] = 'r';
@@ -1448,6 +1998,75 @@ static void validate_application_firmware()
     #endif
 }
 
+static void custom_system_params_init(void)
+{
+    /** <b>Local variable pid_config:</b> Configuration with which the Internal Ambient Temperature PID Controller is initialized. */
+    pid_controller_config_t pid_config = {
+        .kp = INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KP,
+        .ki = INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KI,
+        .kd = INTERNAL_AMBIENT_TEMP_PID_DEFAULT_KD,
+        .sample_period = CONTROL_TASK_PERIOD
+    };
+
+    /* Initialize the MTKATR001 System Parameters Storage module and read the latest data that has been written into it, if any. */
+    if (init_system_params_module() != SYSTEM_PARAMS_EC_OK)
+    {
+        report_mtkatr001_fault(MTKATR001_SYSTEM_PARAMS_ERR, 1);
+    }
+    read_system_params(&system_params);
+
+    /* Use the persisted regulation setpoints only if they have been written, which is told apart by the Fan Duty Cycles since those can never be greater than 100. */
+    if ((system_params.desired_hot_fan_duty_cycle<=100) && (system_params.desired_cold_fan_duty_cycle<=100))
+    {
+        desired_internal_ambient_temperature = system_params.desired_internal_ambient_temperature;
+        desired_hot_fan_duty_cycle = system_params.desired_hot_fan_duty_cycle;
+        desired_cold_fan_duty_cycle = system_params.desired_cold_fan_duty_cycle;
+        desired_hot_water_temperature = system_params.desired_hot_water_temperature;
+        desired_hot_water_min_temperature = system_params.desired_hot_water_min_temperature;
+        desired_cold_water_max_temperature = system_params.desired_cold_water_max_temperature;
+    }
+    else
+    {
+        system_params.desired_internal_ambient_temperature = desired_internal_ambient_temperature;
+        system_params.desired_hot_fan_duty_cycle = desired_hot_fan_duty_cycle;
+        system_params.desired_cold_fan_duty_cycle = desired_cold_fan_duty_cycle;
+        system_params.desired_hot_water_temperature = desired_hot_water_temperature;
+        system_params.desired_hot_water_min_temperature = desired_hot_water_min_temperature;
+        system_params.desired_cold_water_max_temperature = desired_cold_water_max_temperature;
+    }
+    pid_config.output_min = -TO_CENTI_UNITS(desired_cold_fan_duty_cycle);
+    pid_config.output_max = TO_CENTI_UNITS(desired_hot_fan_duty_cycle);
+
+    /* Use the persisted PID Controller gains only if all of them are valid (i.e., if they have been written and are not negative). */
+    if ((system_params.pid_kp>=0) && (system_params.pid_ki>=0) && (system_params.pid_kd>=0))
+    {
+        pid_config.kp = system_params.pid_kp;
+        pid_config.ki = system_params.pid_ki;
+        pid_config.kd = system_params.pid_kd;
+    }
+    else
+    {
+        system_params.pid_kp = pid_config.kp;
+        system_params.pid_ki = pid_config.ki;
+        system_params.pid_kd = pid_config.kd;
+    }
+    init_pid_controller(&internal_ambient_temp_pid, &pid_config);
+}
+
+static void persist_setpoints(void)
+{
+    system_params.desired_internal_ambient_temperature = desired_internal_ambient_temperature;
+    system_params.desired_hot_fan_duty_cycle = desired_hot_fan_duty_cycle;
+    system_params.desired_cold_fan_duty_cycle = desired_cold_fan_duty_cycle;
+    system_params.desired_hot_water_temperature = desired_hot_water_temperature;
+    system_params.desired_hot_water_min_temperature = desired_hot_water_min_temperature;
+    system_params.desired_cold_water_max_temperature = desired_cold_water_max_temperature;
+    if (write_system_params(&system_params) != SYSTEM_PARAMS_EC_OK)
+    {
+        show_display_message('F', 'L', ' ', 'E');
+    }
+}
+
 static uint16_t get_compare_value_for_fan_pwm(uint16_t desired_duty_cycle, uint16_t max_compare_value)
 {
     /* Validate the given Duty Cycle, and change it to the nearest valid value with respect to the one given in case that it has an invalid value. */
@@ -1464,91 +2083,1445 @@ static uint16_t get_compare_value_for_fan_pwm(uint16_t desired_duty_cycle, uint1
     return (desired_duty_cycle*max_compare_value)/100;
 }
 
-static void update_current_cold_water_temperature(void)
+static int32_t get_int32_from_little_endian(const uint8_t *bytes)
+{
+    return (int32_t) (((uint32_t) bytes[0]) | (((uint32_t) bytes[1]) << 8) | (((uint32_t) bytes[2]) << 16) | (((uint32_t) bytes[3]) << 24));
+}
+
+static uint16_t get_uint16_from_little_endian(const uint8_t *bytes)
+{
+    return (uint16_t) (((uint16_t) bytes[0]) | (((uint16_t) bytes[1]) << 8));
+}
+
+static void put_uint16_in_little_endian(uint16_t value, uint8_t *bytes)
 {
-	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref HAL_StatusTypeDef function type. */
-	HAL_StatusTypeDef ret;
+    bytes[0] = (uint8_t) value;
+    bytes[1] = (uint8_t) (value >> 8);
+}
+
+static void put_uint32_in_little_endian(uint32_t value, uint8_t *bytes)
+{
+    bytes[0] = (uint8_t) value;
+    bytes[1] = (uint8_t) (value >> 8);
+    bytes[2] = (uint8_t) (value >> 16);
+    bytes[3] = (uint8_t) (value >> 24);
+}
 
-	/* Read the corresponding ADC and update the Cold Water Temperature. */
-	ret = get_adc_output(&hadc1, ADC_CHANNEL_0, &current_cold_water_temperature);
-	if (ret != HAL_OK)
+static void update_current_cold_water_temperature(void)
+{
+	/** <b>Local variable temperature:</b> Calibrated Temperature, in centi-degrees Celsius, of the latest decimated and filtered sample of the corresponding ADC Channel. */
+	int32_t temperature = apply_sensor_calibration(COLD_WATER_TEMP_SENSOR, convert_temp_sensor_adc_value_to_centi_celsius(get_temp_sensor_adc_value(COLD_WATER_TEMP_SENSOR)));
+	/** <b>Local variable validity:</b> Validity of the Cold Water Temperature Sensor after having checked the sample. */
+	Sensor_Validity validity = run_sensor_diagnostics(&temp_sensors_diagnostics[COLD_WATER_TEMP_SENSOR], temperature, 0, HAL_GetTick());
+
+	/* Report the Temperature Sensor as failed, or hold the actuators that depend on it while it is not trusted. */
+	report_mtkatr001_fault(MTKATR001_COLD_WATER_TEMP_ADC_ERR, (validity == SENSOR_FAILED) ? 1 : 0);
+	if (validity != SENSOR_VALID)
 	{
-		while (1)
-		{
-			convert_number_to_ASCII(MTKATR001_COLD_WATER_TEMP_ADC_ERR, ascii_error_code);
-			ascii_error_code[3] = 0;
-			display_output[0] = 'E';
-			display_output[1] = 'r';
-			display_output[2] = 'r';
-			display_output[3] = '=';
-			set_5641as_display_output(display_output);
-			HAL_Delay(2000);
-			set_5641as_display_output(ascii_error_code);
-			HAL_Delay(2000);
-		}
+		turn_off_lost_actuators(MTKATR001_CAPABILITY_COOLING);
+		return;
 	}
-	current_cold_water_temperature = ((current_cold_water_temperature)*(LM35_VOLTAGE_TO_CELSIUS_CONSTANT)*(MCU_POWER_SUPPLY_VOLTAGE))/(ADC_BITS_IN_DECIMAL_VALUE); // Converting the Polled value to the Temperature that it stands for.
+
+	/* Update the Cold Water Temperature. */
+	current_cold_water_temperature = temperature;
 }
 
 static void update_current_hot_water_temperature(void)
 {
-	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref HAL_StatusTypeDef function type. */
-	HAL_StatusTypeDef ret;
-
-	/* Read the corresponding ADC and update the Hot Water Temperature. */
-	ret = get_adc_output(&hadc1, ADC_CHANNEL_1, &current_hot_water_temperature);
-	if (ret != HAL_OK)
+	/** <b>Local variable temperature:</b> Calibrated Temperature, in centi-degrees Celsius, of the latest decimated and filtered sample of the corresponding ADC Channel. */
+	int32_t temperature = apply_sensor_calibration(HOT_WATER_TEMP_SENSOR, convert_temp_sensor_adc_value_to_centi_celsius(get_temp_sensor_adc_value(HOT_WATER_TEMP_SENSOR)));
+	/** <b>Local variable is_inconsistent:</b> Whether the sample is inconsistent with the Internal Ambient Temperature while the Hot Water is being heated or not. */
+	uint8_t is_inconsistent = (water_heater_output.is_on &&
+	                           ((HAL_GetTick() - water_heater_output.last_switch_tick) >= HOT_WATER_CROSS_CHECK_HEATING_TIME) &&
+	                           (get_sensor_diagnostics_validity(&temp_sensors_diagnostics[INTERNAL_AMBIENT_TEMP_SENSOR]) == SENSOR_VALID) &&
+	                           (current_internal_ambient_temperature > (temperature + TO_CENTI_UNITS(HOT_WATER_CROSS_CHECK_MARGIN)))) ? 1 : 0;
+	/** <b>Local variable validity:</b> Validity of the Hot Water Temperature Sensor after having checked the sample. */
+	Sensor_Validity validity = run_sensor_diagnostics(&temp_sensors_diagnostics[HOT_WATER_TEMP_SENSOR], temperature, is_inconsistent, HAL_GetTick());
+
+	/* Report the Temperature Sensor as failed, or hold the actuators that depend on it while it is not trusted. */
+	report_mtkatr001_fault(MTKATR001_HOT_WATER_TEMP_ADC_ERR, (validity == SENSOR_FAILED) ? 1 : 0);
+	if (validity != SENSOR_VALID)
 	{
-		while (1)
-		{
-			convert_number_to_ASCII(MTKATR001_HOT_WATER_TEMP_ADC_ERR, ascii_error_code);
-			ascii_error_code[3] = 0;
-			display_output[0] = 'E';
-			display_output[1] = 'r';
-			display_output[2] = 'r';
-			display_output[3] = '=';
-			set_5641as_display_output(display_output);
-			HAL_Delay(2000);
-			set_5641as_display_output(ascii_error_code);
-			HAL_Delay(2000);
-		}
+		turn_off_lost_actuators(MTKATR001_CAPABILITY_HEATING);
+		return;
 	}
-	current_hot_water_temperature = ((current_hot_water_temperature)*(LM35_VOLTAGE_TO_CELSIUS_CONSTANT)*(MCU_POWER_SUPPLY_VOLTAGE))/(ADC_BITS_IN_DECIMAL_VALUE); // Converting the Polled value to the Temperature that it stands for.
+
+	/* Update the Hot Water Temperature. */
+	current_hot_water_temperature = temperature;
 }
 
 static void update_current_internal_ambient_temperature(void)
 {
-	/** <b>Local variable ret:</b> Used to hold the exception code value returned by a @ref HAL_StatusTypeDef function type. */
-	HAL_StatusTypeDef ret;
-
-	/* Read the corresponding ADC and update the Current Internal Ambient temperature. */
-	ret = get_adc_output(&hadc1, ADC_CHANNEL_4, &current_internal_ambient_temperature);
-	if (ret != HAL_OK)
+	/** <b>Local variable temperature:</b> Calibrated Temperature, in centi-degrees Celsius, of the latest decimated and filtered sample of the corresponding ADC Channel. */
+	int32_t temperature = apply_sensor_calibration(INTERNAL_AMBIENT_TEMP_SENSOR, convert_temp_sensor_adc_value_to_centi_celsius(get_temp_sensor_adc_value(INTERNAL_AMBIENT_TEMP_SENSOR)));
+	/** <b>Local variable validity:</b> Validity of the Internal Ambient Temperature Sensor after having checked the sample. */
+	Sensor_Validity validity = run_sensor_diagnostics(&temp_sensors_diagnostics[INTERNAL_AMBIENT_TEMP_SENSOR], temperature, 0, HAL_GetTick());
+
+	/* Report the Temperature Sensor as failed, or hold the actuators that depend on it while it is not trusted. */
+	report_mtkatr001_fault(MTKATR001_INTERNAL_AMBIENT_TEMP_ADC_ERR, (validity == SENSOR_FAILED) ? 1 : 0);
+	if (validity != SENSOR_VALID)
 	{
-		while (1)
-		{
-			convert_number_to_ASCII(MTKATR001_INTERNAL_AMBIENT_TEMP_ADC_ERR, ascii_error_code);
-			ascii_error_code[3] = 0;
-			display_output[0] = 'E';
-			display_output[1] = 'r';
-			display_output[2] = 'r';
-			display_output[3] = '=';
-			set_5641as_display_output(display_output);
-			HAL_Delay(2000);
-			set_5641as_display_output(ascii_error_code);
-			HAL_Delay(2000);
-		}
+		turn_off_lost_actuators(MTKATR001_ALL_CAPABILITIES);
+		return;
 	}
-	current_internal_ambient_temperature = ((current_internal_ambient_temperature)*(LM35_VOLTAGE_TO_CELSIUS_CONSTANT)*(MCU_POWER_SUPPLY_VOLTAGE))/(ADC_BITS_IN_DECIMAL_VALUE); // Converting the Polled value to the Temperature that it stands for.
+
+	/* Update the Current Internal Ambient temperature. */
+	current_internal_ambient_temperature = temperature;
 }
 
-/**@brief	Callback function before an ETX OTA Transaction with the host machine is about to give place.
- *
- * @note    For more details on how this function works with respect to the ETX OTA Protocol, see the Doxygen
- *          Documentation available for it at the @ref app_side_etx_ota .
- *
- * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+static void custom_water_heater_init(void)
+{
+    /** <b>Local variable pid_config:</b> Configuration with which the Hot Water Temperature PID Controller is initialized. */
+    pid_controller_config_t pid_config = {
+        .kp = HOT_WATER_TEMP_PID_KP,
+        .ki = HOT_WATER_TEMP_PID_KI,
+        .kd = HOT_WATER_TEMP_PID_KD,
+        .sample_period = CONTROL_TASK_PERIOD,
+        .output_min = 0,
+        .output_max = TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE
+    };
+    /** <b>Local variable tpo_config:</b> Configuration with which the Time-Proportional Output of the Water Heating Resistor is initialized. */
+    time_proportional_output_config_t tpo_config = {
+        .window = WATER_HEATER_WINDOW_TIME,
+        .min_on_time = WATER_HEATER_MIN_ON_TIME,
+        .min_off_time = WATER_HEATER_MIN_OFF_TIME
+    };
+
+    if (init_pid_controller(&hot_water_temp_pid, &pid_config) != PID_CONTROLLER_EC_OK)
+    {
+        Error_Handler();
+    }
+    if (init_time_proportional_output(&water_heater_output, &tpo_config, HAL_GetTick()) != TIME_PROPORTIONAL_OUTPUT_EC_OK)
+    {
+        Error_Handler();
+    }
+    if (init_preheat_scheduler(&hot_water_preheat_scheduler, &hot_water_preheat_scheduler_config) != PREHEAT_SCHEDULER_EC_OK)
+    {
+        Error_Handler();
+    }
+}
+
+static void custom_over_temp_adc_watchdog_init(void)
+{
+    /** <b>Local variable awd_config:</b> Configuration with which the ADC Analog Watchdog is initialized. */
+    ADC_AnalogWDGConfTypeDef awd_config = {0};
+
+    awd_config.WatchdogMode = ADC_ANALOGWATCHDOG_SINGLE_REG;
+    awd_config.Channel = ADC_CHANNEL_1;
+    awd_config.HighThreshold = OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD;
+    awd_config.LowThreshold = 0;
+    awd_config.ITMode = ENABLE;
+    if (HAL_ADC_AnalogWDGConfig(&hadc1, &awd_config) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    /* Guard the Internal Ambient Temperature Sensor channel from the second ADC, which converts it at each Trigger Timer event from now on. */
+    awd_config.Channel = ADC_CHANNEL_4;
+    awd_config.HighThreshold = AMBIENT_OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD;
+    if ((HAL_ADC_AnalogWDGConfig(&hadc2, &awd_config) != HAL_OK) || (HAL_ADCEx_Calibration_Start(&hadc2) != HAL_OK) || (HAL_ADC_Start(&hadc2) != HAL_OK))
+    {
+        Error_Handler();
+    }
+}
+
+static void custom_watchdog_supervisor_init(void)
+{
+    /** <b>Local variable reset_info:</b> Information about the latest reset of our MCU/MPU. */
+    watchdog_supervisor_reset_info_t reset_info;
+
+    if (init_watchdog_supervisor(mtkatr001_tasks, TOTAL_MTKATR001_TASKS, WATCHDOG_TIMEOUT) != WATCHDOG_SUPERVISOR_EC_OK)
+    {
+        Error_Handler();
+    }
+    get_watchdog_supervisor_reset_info(&reset_info);
+    #if ETX_OTA_VERBOSE
+        printf("Reset cause: %d (late task: %d, last checked-in task: %d, resets: %lu, watchdog resets: %lu).\r\n",
+               reset_info.cause, reset_info.late_task, reset_info.last_checked_in_task, reset_info.total_resets, reset_info.watchdog_resets);
+    #endif
+    if (reset_info.cause == RESET_CAUSE_INDEPENDENT_WATCHDOG)
+    {
+        report_mtkatr001_fault(MTKATR001_WATCHDOG_RESET, 1);
+    }
+}
+
+static void run_water_heater(void)
+{
+    set_time_proportional_output_duty_cycle(&water_heater_output, run_pid_controller(&hot_water_temp_pid, TO_CENTI_UNITS(desired_hot_water_temperature), current_hot_water_temperature));
+    if (run_time_proportional_output(&water_heater_output, HAL_GetTick()))
+    {
+        HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_SET);
+    }
+    else
+    {
+        HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_RESET);
+    }
+}
+
+static void turn_off_water_heater(void)
+{
+    HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_RESET);
+    reset_time_proportional_output(&water_heater_output, HAL_GetTick());
+    reset_pid_controller(&hot_water_temp_pid);
+}
+
+static uint8_t is_hot_water_needed(void)
+{
+    /** <b>Local variable inputs:</b> Current inputs of the @ref preheat_scheduler of the Hot Water. */
+    preheat_scheduler_inputs_t inputs = {
+        .buffer_temperature = current_hot_water_temperature,
+        .buffer_ready_temperature = TO_CENTI_UNITS(desired_hot_water_min_temperature) + HOT_WATER_READY_HYSTERESIS,
+        .process_temperature = current_internal_ambient_temperature,
+        .process_heat_temperature = TO_CENTI_UNITS(desired_internal_ambient_temperature),
+        .is_heater_on = (HAL_GPIO_ReadPin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin) == GPIO_PIN_SET) ? 1 : 0,
+        .is_air_on = (get_applied_fans_output() != 0) ? 1 : 0
+    };
+    /** <b>Local variable is_preheat_needed:</b> Flag that indicates whether the @ref preheat_scheduler requests the Hot Water to be heated or not. */
+    uint8_t is_preheat_needed;
+
+    // NOTE: The Preheat Scheduler is always executed, even while the Hot Water is needed anyway, so that it keeps learning its rates.
+    is_preheat_needed = run_preheat_scheduler(&hot_water_preheat_scheduler, &inputs, HAL_GetTick());
+
+    return ((hot_air_state != HOT_AIR_OFF) || (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_RUNNING) || is_preheat_needed) ? 1 : 0;
+}
+
+static void run_hot_air_state_machine(uint16_t duty_cycle)
+{
+    switch (hot_air_state)
+    {
+        case HOT_AIR_WAITING_HOT_WATER:
+            if (duty_cycle == 0)
+            {
+                hot_air_state = HOT_AIR_OFF;
+            }
+            else if (current_hot_water_temperature >= (TO_CENTI_UNITS(desired_hot_water_min_temperature)+HOT_WATER_READY_HYSTERESIS))
+            {
+                hot_air_state = HOT_AIR_ON;
+            }
+            break;
+        default:
+            if (duty_cycle == 0)
+            {
+                hot_air_state = HOT_AIR_OFF;
+            }
+            else if (current_hot_water_temperature < TO_CENTI_UNITS(desired_hot_water_min_temperature))
+            {
+                hot_air_state = HOT_AIR_WAITING_HOT_WATER;
+            }
+            else
+            {
+                hot_air_state = HOT_AIR_ON;
+            }
+            break;
+    }
+
+    /* Throw Heat inside the MTKATR001 System only while the Hot Water is hot enough. */
+    if (hot_air_state == HOT_AIR_ON)
+    {
+        __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(duty_cycle, HOT_FAN_MAX_COMPARE_VALUE));
+        HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_SET);
+    }
+    else
+    {
+        __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(0, HOT_FAN_MAX_COMPARE_VALUE));
+        HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+    }
+}
+
+static void run_cold_air_state_machine(uint16_t duty_cycle)
+{
+    /** <b>Local variable is_cold_water_ready:</b> Flag that indicates whether the Cold Water is cold enough to stop waiting for it. */
+    uint8_t is_cold_water_ready = (current_cold_water_temperature <= (TO_CENTI_UNITS(desired_cold_water_max_temperature)-COLD_WATER_READY_HYSTERESIS)) ? 1 : 0;
+
+    switch (cold_air_state)
+    {
+        case COLD_AIR_WAITING_COLD_WATER:
+            if (duty_cycle == 0)
+            {
+                cold_air_state = COLD_AIR_OFF;
+            }
+            else if (is_cold_water_ready)
+            {
+                cold_air_state = COLD_AIR_ON;
+            }
+            else if ((HAL_GetTick() - cold_air_wait_start_tick) >= COLD_WATER_WAIT_TIMEOUT)
+            {
+                cold_air_state = COLD_AIR_ESCALATED;
+            }
+            break;
+        case COLD_AIR_ESCALATED:
+            if (duty_cycle == 0)
+            {
+                cold_air_state = COLD_AIR_OFF;
+            }
+            else if (is_cold_water_ready)
+            {
+                cold_air_state = COLD_AIR_ON;
+            }
+            break;
+        default:
+            if (duty_cycle == 0)
+            {
+                cold_air_state = COLD_AIR_OFF;
+            }
+            else if (current_cold_water_temperature > TO_CENTI_UNITS(desired_cold_water_max_temperature))
+            {
+                cold_air_state = COLD_AIR_WAITING_COLD_WATER;
+                cold_air_wait_start_tick = HAL_GetTick();
+            }
+            else
+            {
+                cold_air_state = COLD_AIR_ON;
+            }
+            break;
+    }
+
+    /* Throw Cold Air inside the MTKATR001 System while the Cold Water is cold enough or, once escalated, while it is still colder enough than the Internal Ambient Temperature. */
+    if ((cold_air_state == COLD_AIR_ON) ||
+        ((cold_air_state == COLD_AIR_ESCALATED) && (current_cold_water_temperature <= (current_internal_ambient_temperature-COLD_WATER_MIN_USEFUL_DIFFERENCE))))
+    {
+        __HAL_TIM_SET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(duty_cycle, COLD_FAN_MAX_COMPARE_VALUE));
+        HAL_GPIO_WritePin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin, GPIO_PIN_SET);
+    }
+    else
+    {
+        __HAL_TIM_SET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL, get_compare_value_for_fan_pwm(0, COLD_FAN_MAX_COMPARE_VALUE));
+        HAL_GPIO_WritePin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+    }
+}
+
+static void force_actuators_safe_state(void)
+{
+    HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+    __HAL_TIM_SET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL, 0);
+    __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, 0);
+}
+
+static void turn_off_all_actuators(void)
+{
+    force_actuators_safe_state();
+    reset_time_proportional_output(&water_heater_output, HAL_GetTick());
+    reset_pid_controller(&hot_water_temp_pid);
+    hot_air_state = HOT_AIR_OFF;
+    cold_air_state = COLD_AIR_OFF;
+}
+
+static void turn_off_lost_actuators(uint32_t lost_capabilities)
+{
+    if (lost_capabilities & MTKATR001_CAPABILITY_HEATING)
+    {
+        HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_RESET);
+        HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+        __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, 0);
+        reset_time_proportional_output(&water_heater_output, HAL_GetTick());
+        reset_pid_controller(&hot_water_temp_pid);
+        hot_air_state = HOT_AIR_OFF;
+    }
+    if (lost_capabilities & MTKATR001_CAPABILITY_COOLING)
+    {
+        HAL_GPIO_WritePin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+        __HAL_TIM_SET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL, 0);
+        cold_air_state = COLD_AIR_OFF;
+    }
+}
+
+static uint32_t get_untrusted_temp_sensors_capabilities(void)
+{
+    /** <b>Local variable capabilities:</b> Capabilities that depend on an untrusted Temperature Sensor. */
+    uint32_t capabilities = 0;
+
+    if (get_sensor_diagnostics_validity(&temp_sensors_diagnostics[COLD_WATER_TEMP_SENSOR]) != SENSOR_VALID)
+    {
+        capabilities |= MTKATR001_CAPABILITY_COOLING;
+    }
+    if (get_sensor_diagnostics_validity(&temp_sensors_diagnostics[HOT_WATER_TEMP_SENSOR]) != SENSOR_VALID)
+    {
+        capabilities |= MTKATR001_CAPABILITY_HEATING;
+    }
+    if (get_sensor_diagnostics_validity(&temp_sensors_diagnostics[INTERNAL_AMBIENT_TEMP_SENSOR]) != SENSOR_VALID)
+    {
+        capabilities |= MTKATR001_ALL_CAPABILITIES;
+    }
+
+    return capabilities;
+}
+
+static uint8_t get_actuators_state(void)
+{
+    /** <b>Local variable actuators:</b> Bitmask of the actuators that are On. */
+    uint8_t actuators = 0;
+
+    if (HAL_GPIO_ReadPin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin) == GPIO_PIN_SET)
+    {
+        actuators |= TELEMETRY_HEATER_ON;
+    }
+    if (HAL_GPIO_ReadPin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin) == GPIO_PIN_SET)
+    {
+        actuators |= TELEMETRY_HOT_WATER_PUMP_ON;
+    }
+    if (HAL_GPIO_ReadPin(Cold_Water_Pump_GPIO_Output_GPIO_Port, Cold_Water_Pump_GPIO_Output_Pin) == GPIO_PIN_SET)
+    {
+        actuators |= TELEMETRY_COLD_WATER_PUMP_ON;
+    }
+    if (HAL_GPIO_ReadPin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin) == GPIO_PIN_SET)
+    {
+        actuators |= TELEMETRY_IIATR_LED_ON;
+    }
+    if (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_RUNNING)
+    {
+        actuators |= TELEMETRY_AUTOTUNE_RUNNING;
+    }
+
+    return actuators;
+}
+
+static void stream_telemetry_sample(void)
+{
+    /** <b>Local variable sample:</b> Current sample of the MTKATR001 System that is given to the @ref telemetry_stream . */
+    telemetry_stream_sample_t sample;
+
+    sample.cold_water_temperature = (int16_t) current_cold_water_temperature;
+    sample.hot_water_temperature = (int16_t) current_hot_water_temperature;
+    sample.internal_ambient_temperature = (int16_t) current_internal_ambient_temperature;
+    sample.actuators = get_actuators_state();
+    run_telemetry_stream(&sample, HAL_GetTick());
+}
+
+static int32_t get_applied_fans_output(void)
+{
+    return (int32_t) ((__HAL_TIM_GET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL)*TO_CENTI_UNITS(100)) / HOT_FAN_MAX_COMPARE_VALUE) -
+           (int32_t) ((__HAL_TIM_GET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL)*TO_CENTI_UNITS(100)) / COLD_FAN_MAX_COMPARE_VALUE);
+}
+
+static void log_telemetry_snapshot(void)
+{
+    /** <b>Local variable record:</b> Snapshot that is written into the @ref telemetry_log . */
+    telemetry_record_t record = {0};
+
+    record.timestamp = HAL_GetTick();
+    record.cold_water_temperature = (int16_t) current_cold_water_temperature;
+    record.hot_water_temperature = (int16_t) current_hot_water_temperature;
+    record.internal_ambient_temperature = (int16_t) current_internal_ambient_temperature;
+    record.desired_internal_ambient_temperature = desired_internal_ambient_temperature;
+    record.desired_hot_water_temperature = desired_hot_water_temperature;
+    record.cold_fan_compare = (uint16_t) __HAL_TIM_GET_COMPARE(&htim3, COLD_FAN_TIMER_CHANNEL);
+    record.hot_fan_compare = (uint16_t) __HAL_TIM_GET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL);
+    record.actuators = get_actuators_state();
+    for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+    {
+        record.sensors_validity |= (uint8_t) (get_sensor_diagnostics_validity(&temp_sensors_diagnostics[i]) << (2*i));
+    }
+    for (uint8_t i=0; i<TOTAL_MTKATR001_FAULTS; i++)
+    {
+        if (is_fault_active(mtkatr001_faults[i].code))
+        {
+            record.active_faults |= (uint16_t) (1U << i);
+        }
+    }
+
+    write_telemetry_record(&record);
+}
+
+static void report_mtkatr001_fault(MTKATR001_Status fault_code, uint8_t is_present)
+{
+    set_fault_condition(fault_code, is_present, HAL_GetTick());
+    if (is_present)
+    {
+        turn_off_lost_actuators(get_fault_manager_lost_capabilities());
+    }
+}
+
+static void raise_isr_fault(MTKATR001_Status fault_code)
+{
+    /** <b>Local variable raised_faults:</b> Value that wants to be stored into the @ref isr_raised_faults Global Variable. */
+    uint32_t raised_faults;
+
+    do
+    {
+        raised_faults = __LDREXW(&isr_raised_faults) | (1UL << fault_code);
+    }
+    while (__STREXW(raised_faults, &isr_raised_faults) != 0);
+}
+
+static void process_isr_raised_faults(void)
+{
+    /** <b>Local variable raised_faults:</b> Copy of the @ref isr_raised_faults Global Variable that is being processed. */
+    uint32_t raised_faults;
+
+    /* Take and clear the raised faults at once, so that none raised meanwhile by an Interrupt is lost. */
+    __disable_irq();
+    raised_faults = isr_raised_faults;
+    isr_raised_faults = 0;
+    __enable_irq();
+
+    for (uint8_t fault_code=0; raised_faults!=0; fault_code++)
+    {
+        if (raised_faults & (1UL << fault_code))
+        {
+            report_mtkatr001_fault((MTKATR001_Status) fault_code, 1);
+            raised_faults &= ~(1UL << fault_code);
+        }
+    }
+}
+
+static void show_display_characters(uint16_t first, uint16_t second, uint16_t third, uint16_t fourth)
+{
+    display_output[0] = first;
+    display_output[1] = second;
+    display_output[2] = third;
+    display_output[3] = fourth;
+    set_5641as_display_output(display_output);
+}
+
+static void show_display_message(uint16_t first, uint16_t second, uint16_t third, uint16_t fourth)
+{
+    display_message[0] = first;
+    display_message[1] = second;
+    display_message[2] = third;
+    display_message[3] = fourth;
+    display_message_end_tick = HAL_GetTick() + DISPLAY_MESSAGE_DURATION;
+}
+
+static void sensing_task(void)
+{
+    /* Let the Watchdog Supervisor know that this task is still alive. */
+    watchdog_supervisor_check_in(MTKATR001_TASK_SENSING);
+
+    /* Report the faults that have been detected from an Interrupt context since the last time. */
+    process_isr_raised_faults();
+
+    /* Validate whether the Hot or the Cold Water Temperature Sensors are currently under a short-circuit or not. */
+    report_mtkatr001_fault(MTKATR001_HOT_WATER_TEMP_IS_UNDER_SHORTCIRCUIT,
+                           (HAL_GPIO_ReadPin(Hot_Water_Shortcircuit_Indicator_GPIO_Input_GPIO_Port, Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin) == GPIO_PIN_RESET) ? 1 : 0);
+    report_mtkatr001_fault(MTKATR001_COLD_WATER_TEMP_IS_UNDER_SHORTCIRCUIT,
+                           (HAL_GPIO_ReadPin(Cold_Water_Shortcircuit_Indicator_GPIO_Input_GPIO_Port, Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin) == GPIO_PIN_RESET) ? 1 : 0);
+
+    /* Validate that the ADC conversions of the Temperature Sensors are still running as expected, and restart them otherwise. */
+    if (get_temp_sensors_status() != TEMP_SENSORS_EC_OK)
+    {
+        report_mtkatr001_fault(MTKATR001_TEMP_SENSORS_ADC_DMA_ERR, 1);
+        restart_temp_sensors_module();
+        return;
+    }
+    report_mtkatr001_fault(MTKATR001_TEMP_SENSORS_ADC_DMA_ERR, 0);
+
+    /* Read and get the Cold Water Temperature. */
+    update_current_cold_water_temperature();
+
+    /* Read and get the Hot Water Temperature. */
+    update_current_hot_water_temperature();
+
+    /* Read and get the Current Internal Ambient temperature. */
+    update_current_internal_ambient_temperature();
+
+    /* Validate the Internal Ambient Temperature against its own maximum, and re-arm its ADC Analog Watchdog once it is back below it. */
+    if (current_internal_ambient_temperature > TO_CENTI_UNITS(INTERNAL_AMBIENT_MAX_TEMPERATURE))
+    {
+        report_mtkatr001_fault(MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE, 1);
+    }
+    else
+    {
+        report_mtkatr001_fault(MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE, 0);
+        if (__HAL_ADC_GET_IT_SOURCE(&hadc2, ADC_IT_AWD) == RESET)
+        {
+            __HAL_ADC_CLEAR_FLAG(&hadc2, ADC_FLAG_AWD);
+            __HAL_ADC_ENABLE_IT(&hadc2, ADC_IT_AWD);
+        }
+    }
+
+    /* Self-calibrate the Temperature Sensors ADC periodically, whose failure is handled as any other ADC error the next time. */
+    if ((HAL_GetTick() - last_adc_calibration_tick) >= TEMP_SENSORS_ADC_CALIBRATION_PERIOD)
+    {
+        last_adc_calibration_tick = HAL_GetTick();
+        calibrate_temp_sensors_adc();
+    }
+
+    /* Let the informative fault of a previous Independent Watchdog reset, if any, be cleared. */
+    report_mtkatr001_fault(MTKATR001_WATCHDOG_RESET, 0);
+}
+
+static void control_task(void)
+{
+    /** <b>Local variable output:</b> Output of the Internal Ambient Temperature PID Controller, in centi-percent of Fan Duty Cycle, where positive values stand for the Hot Fan and negative values for the Cold Fan. */
+    int32_t output;
+    /** <b>Local variable duty_cycle:</b> Duty Cycle, in percentage, that the Internal Ambient Temperature PID Controller requests for the Hot or the Cold Fan. */
+    uint16_t duty_cycle;
+    /** <b>Local variable autotune_result:</b> Result of the Auto-Tuning of the Internal Ambient Temperature PID Controller, once it has finished successfully. */
+    pid_autotune_result_t autotune_result;
+    /** <b>Local variable lost_capabilities:</b> Capabilities of the MTKATR001 System that are currently lost due to the active faults of the @ref fault_manager . */
+    uint32_t lost_capabilities;
+
+    /* Let the Watchdog Supervisor know that this task is still alive. */
+    watchdog_supervisor_check_in(MTKATR001_TASK_CONTROL);
+
+    /* Get the current degraded mode, if any, including the faults that an Interrupt may have detected since the Sensing Task was lastly executed and the capabilities whose Temperature Sensors are currently not trusted. */
+    process_isr_raised_faults();
+    lost_capabilities = get_fault_manager_lost_capabilities() | get_untrusted_temp_sensors_capabilities();
+
+    /* Periodically record into the Telemetry Log what the MTKATR001 System has done so far, including while in a degraded mode. */
+    if ((HAL_GetTick() - last_telemetry_tick) >= TELEMETRY_LOG_PERIOD)
+    {
+        last_telemetry_tick = HAL_GetTick();
+        log_telemetry_snapshot();
+
+        // NOTE: The records that cannot be archived now due to a Flash Memory error are retried with the next snapshot.
+        feed_telemetry_archive();
+    }
+
+    /* Keep identifying the model of the Internal Ambient Temperature, including while in a degraded mode, as long as its readings are trusted. */
+    if (get_sensor_diagnostics_validity(&temp_sensors_diagnostics[INTERNAL_AMBIENT_TEMP_SENSOR]) == SENSOR_VALID)
+    {
+        run_thermal_model(&internal_ambient_thermal_model, current_internal_ambient_temperature, get_applied_fans_output(), HAL_GetTick());
+    }
+
+    /* Keep all the actuators of the MTKATR001 System turned Off if all its capabilities have been lost. */
+    if ((lost_capabilities & MTKATR001_ALL_CAPABILITIES) == MTKATR001_ALL_CAPABILITIES)
+    {
+        stop_pid_autotune(&internal_ambient_temp_autotune);
+        turn_off_all_actuators();
+        HAL_GPIO_WritePin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin, GPIO_PIN_RESET);
+        return;
+    }
+
+    /* The Auto-Tuning needs both the Hot and the Cold Air, so it is abandoned while in a degraded mode. */
+    if ((lost_capabilities != 0) && (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_RUNNING))
+    {
+        stop_pid_autotune(&internal_ambient_temp_autotune);
+        show_display_message('t', 'U', ' ', 'E');
+    }
+
+    /* Regulate the Hot Water Temperature with the Water Heating Resistor only while the Hot Water is needed or will be needed soon, unless Heating has been lost. */
+    if ((lost_capabilities & MTKATR001_CAPABILITY_HEATING) == 0)
+    {
+        if (is_hot_water_needed())
+        {
+            run_water_heater();
+        }
+        else
+        {
+            turn_off_water_heater();
+        }
+    }
+
+    /* Execute the Auto-Tuning if it is on-going, or the Internal Ambient Temperature PID Controller with its output limited to the Desired Duty Cycles of the Hot and Cold Fans otherwise, where the side of any lost capability is limited to zero. */
+    set_pid_controller_output_limits(&internal_ambient_temp_pid,
+                                     (lost_capabilities & MTKATR001_CAPABILITY_COOLING) ? 0 : -TO_CENTI_UNITS(desired_cold_fan_duty_cycle),
+                                     (lost_capabilities & MTKATR001_CAPABILITY_HEATING) ? 0 : TO_CENTI_UNITS(desired_hot_fan_duty_cycle));
+    if (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_RUNNING)
+    {
+        output = run_pid_autotune(&internal_ambient_temp_autotune, current_internal_ambient_temperature, HAL_GetTick());
+    }
+    else
+    {
+        output = run_pid_controller(&internal_ambient_temp_pid, TO_CENTI_UNITS(desired_internal_ambient_temperature), current_internal_ambient_temperature);
+    }
+
+    /* Apply and persist the result of the Auto-Tuning once it has finished successfully, or inform the user if it has failed. */
+    if (get_pid_autotune_result(&internal_ambient_temp_autotune, &autotune_result) == PID_AUTOTUNE_EC_OK)
+    {
+        set_pid_controller_gains(&internal_ambient_temp_pid, autotune_result.kp, autotune_result.ki, autotune_result.kd);
+        reset_pid_controller(&internal_ambient_temp_pid);
+        system_params.pid_kp = autotune_result.kp;
+        system_params.pid_ki = autotune_result.ki;
+        system_params.pid_kd = autotune_result.kd;
+        system_params.autotune_ku = autotune_result.ku;
+        system_params.autotune_pu = autotune_result.pu;
+        if (write_system_params(&system_params) != SYSTEM_PARAMS_EC_OK)
+        {
+            show_display_message('F', 'L', ' ', 'E');
+        }
+        autotune_result_end_tick = HAL_GetTick() + DISPLAY_AUTOTUNE_RESULT_DURATION;
+        stop_pid_autotune(&internal_ambient_temp_autotune);
+    }
+    else if (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_FAILED)
+    {
+        show_display_message('t', 'U', ' ', 'E');
+        stop_pid_autotune(&internal_ambient_temp_autotune);
+    }
+    duty_cycle = (uint16_t) (((output < 0) ? -output : output) / 100);
+    if (duty_cycle < FAN_MIN_DUTY_CYCLE)
+    {
+        duty_cycle = 0;
+    }
+
+    /* Turn On the IIART LED only while the Desired Internal Ambient Temperature has been reached. */
+    if ((current_internal_ambient_temperature >= (TO_CENTI_UNITS(desired_internal_ambient_temperature)-INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED)) &&
+        (current_internal_ambient_temperature <= (TO_CENTI_UNITS(desired_internal_ambient_temperature)+INTERNAL_AMBIENT_TEMP_ERROR_ALLOWED)))
+    {
+        HAL_GPIO_WritePin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin, GPIO_PIN_SET);
+    }
+    else
+    {
+        HAL_GPIO_WritePin(IIATR_LED_GPIO_Output_GPIO_Port, IIATR_LED_GPIO_Output_Pin, GPIO_PIN_RESET);
+    }
+
+    /* Throw Heat inside the MTKATR001 System if the PID Controller requests it and once the Hot Water is hot enough. */
+    run_hot_air_state_machine(((output > 0) && (duty_cycle > 0)) ? duty_cycle : 0);
+
+    /* Throw Cold Air inside the MTKATR001 System if the PID Controller requests it and once the Cold Water is cold enough. */
+    run_cold_air_state_machine(((output < 0) && (duty_cycle > 0)) ? duty_cycle : 0);
+
+    /* Undo whatever this task may have turned On if an Interrupt has detected a fault while it was being executed. */
+    if (isr_raised_faults != 0)
+    {
+        process_isr_raised_faults();
+    }
+}
+
+static void start_internal_ambient_temp_autotune(void)
+{
+    /** <b>Local variable autotune_config:</b> Configuration with which the Auto-Tuning of the Internal Ambient Temperature PID Controller is started. */
+    pid_autotune_config_t autotune_config = {
+        .setpoint = TO_CENTI_UNITS(desired_internal_ambient_temperature),
+        .relay_amplitude = TO_CENTI_UNITS((desired_hot_fan_duty_cycle < desired_cold_fan_duty_cycle) ? desired_hot_fan_duty_cycle : desired_cold_fan_duty_cycle),
+        .hysteresis = PID_AUTOTUNE_HYSTERESIS,
+        .cycles = PID_AUTOTUNE_CYCLES,
+        .timeout = PID_AUTOTUNE_TIMEOUT
+    };
+
+    /* A relay whose amplitude would not even turn On the Fans, or that lacks either the Hot or the Cold Air, cannot make the Internal Ambient Temperature oscillate. */
+    if ((autotune_config.relay_amplitude < TO_CENTI_UNITS(FAN_MIN_DUTY_CYCLE)) || (get_fault_manager_lost_capabilities() != 0))
+    {
+        show_display_message('t', 'U', ' ', 'E');
+        return;
+    }
+    if (start_pid_autotune(&internal_ambient_temp_autotune, &autotune_config, current_internal_ambient_temperature, HAL_GetTick()) != PID_AUTOTUNE_EC_OK)
+    {
+        show_display_message('t', 'U', ' ', 'E');
+        return;
+    }
+    autotune_result_end_tick = HAL_GetTick();
+    show_display_message('t', 'U', 'n', 'E');
+}
+
+static void apply_internal_ambient_thermal_model_gains(void)
+{
+    /** <b>Local variable estimate:</b> Model of the Internal Ambient Temperature that has been identified so far. */
+    thermal_model_estimate_t estimate;
+    /** <b>Local variable kp:</b> Proportional gain calculated from the model. */
+    int32_t kp;
+    /** <b>Local variable ki:</b> Integral gain calculated from the model. */
+    int32_t ki;
+
+    if ((get_thermal_model_estimate(&internal_ambient_thermal_model, &estimate) != THERMAL_MODEL_EC_OK) ||
+        (calculate_thermal_model_pid_gains(&estimate, (estimate.dead_time > THERMAL_MODEL_MIN_CLOSED_LOOP_TIME) ? estimate.dead_time : THERMAL_MODEL_MIN_CLOSED_LOOP_TIME, &kp, &ki) != THERMAL_MODEL_EC_OK) ||
+        (set_pid_controller_gains(&internal_ambient_temp_pid, kp, ki, 0) != PID_CONTROLLER_EC_OK))
+    {
+        show_display_message('t', 'U', ' ', 'E');
+        return;
+    }
+    stop_pid_autotune(&internal_ambient_temp_autotune);
+    reset_pid_controller(&internal_ambient_temp_pid);
+
+    /* Persist the new gains so that they are used again after our MCU/MPU is reset. */
+    system_params.pid_kp = kp;
+    system_params.pid_ki = ki;
+    system_params.pid_kd = 0;
+    if (write_system_params(&system_params) != SYSTEM_PARAMS_EC_OK)
+    {
+        show_display_message('F', 'L', ' ', 'E');
+        return;
+    }
+    show_display_message('P', 'I', 'd', 0);
+}
+
+static void apply_etx_ota_command(const uint8_t *data, uint16_t size)
+{
+    /** <b>Local variable kp:</b> Proportional gain received in the @ref MTKATR001_CMD_SET_PID_GAINS Command. */
+    int32_t kp;
+    /** <b>Local variable ki:</b> Integral gain received in the @ref MTKATR001_CMD_SET_PID_GAINS Command. */
+    int32_t ki;
+    /** <b>Local variable kd:</b> Derivative gain received in the @ref MTKATR001_CMD_SET_PID_GAINS Command. */
+    int32_t kd;
+    /** <b>Local variable calibration_table:</b> Calibration table received in the @ref MTKATR001_CMD_SET_SENSOR_CALIBRATION Command. */
+    sensor_calibration_table_t calibration_table;
+    /** <b>Local variable calibration_ret:</b> Return value of the @ref set_sensor_calibration function. */
+    Sensor_Calibration_Status calibration_ret;
+    /** <b>Local variable sequence:</b> Sequence number of the first telemetry record that is read for the @ref MTKATR001_CMD_GET_TELEMETRY_LOG and the @ref MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Commands. */
+    uint32_t sequence;
+    /** <b>Local variable records:</b> Telemetry records that are read for the @ref MTKATR001_CMD_GET_TELEMETRY_LOG and the @ref MTKATR001_CMD_GET_TELEMETRY_ARCHIVE Commands. */
+    telemetry_record_t records[ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS];
+    /** <b>Local variable total_records:</b> Number of telemetry records that have been read into the \c records Local Variable. */
+    uint8_t total_records;
+
+    switch (data[0])
+    {
+        case MTKATR001_CMD_SET_PID_GAINS:
+            /* Validate the received Command and apply its gains to the Internal Ambient Temperature PID Controller. */
+            if (size != ETX_OTA_SET_PID_GAINS_COMMAND_SIZE)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            kp = get_int32_from_little_endian(&data[1]);
+            ki = get_int32_from_little_endian(&data[5]);
+            kd = get_int32_from_little_endian(&data[9]);
+            if (set_pid_controller_gains(&internal_ambient_temp_pid, kp, ki, kd) != PID_CONTROLLER_EC_OK)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+
+            /* Persist the new gains so that they are used again after our MCU/MPU is reset. */
+            system_params.pid_kp = kp;
+            system_params.pid_ki = ki;
+            system_params.pid_kd = kd;
+            if (write_system_params(&system_params) != SYSTEM_PARAMS_EC_OK)
+            {
+                show_display_message('F', 'L', ' ', 'E');
+                break;
+            }
+            show_display_message('P', 'I', 'd', 0);
+            break;
+        case MTKATR001_CMD_START_PID_AUTOTUNE:
+            if (size != 1)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            start_internal_ambient_temp_autotune();
+            break;
+        case MTKATR001_CMD_STOP_PID_AUTOTUNE:
+            if (size != 1)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            stop_pid_autotune(&internal_ambient_temp_autotune);
+            show_display_message('t', 'U', ' ', 'S');
+            break;
+        case MTKATR001_CMD_GET_FAULT_HISTORY:
+            if ((size != ETX_OTA_GET_FAULT_HISTORY_COMMAND_SIZE) || (send_fault_history_reply(data[1]) != ETX_OTA_EC_OK))
+            {
+                show_display_message('E', 'O', ' ', 'I');
+            }
+            break;
+        case MTKATR001_CMD_GET_RESET_INFO:
+            if ((size != 1) || (send_reset_info_reply() != ETX_OTA_EC_OK))
+            {
+                show_display_message('E', 'O', ' ', 'I');
+            }
+            break;
+        case MTKATR001_CMD_SET_SENSOR_CALIBRATION:
+            /* Validate the received Command and apply its calibration table, which is persisted by the Temperature Sensors Calibration module. */
+            if ((size < ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE) || (data[2] > SENSOR_CALIBRATION_MAX_POINTS) ||
+                (size != (ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE + data[2]*ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE)))
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            calibration_table.total_points = data[2];
+            for (uint8_t i=0; i<calibration_table.total_points; i++)
+            {
+                calibration_table.points[i].measured = get_uint16_from_little_endian(&data[ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE + i*ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE]);
+                calibration_table.points[i].actual = (int16_t) get_uint16_from_little_endian(&data[ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE + i*ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE + 2]);
+            }
+            calibration_ret = set_sensor_calibration((Temp_Sensor_Channel) data[1], &calibration_table);
+            if (calibration_ret == SENSOR_CALIBRATION_EC_ERR)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            if (calibration_ret != SENSOR_CALIBRATION_EC_OK)
+            {
+                show_display_message('F', 'L', ' ', 'E');
+                break;
+            }
+            show_display_message('C', 'A', 'L', 0);
+            break;
+        case MTKATR001_CMD_SET_TELEMETRY_STREAM_PERIOD:
+            if ((size != ETX_OTA_SET_TELEMETRY_STREAM_PERIOD_COMMAND_SIZE) || (set_telemetry_stream_period(get_uint16_from_little_endian(&data[1])) != TELEMETRY_STREAM_EC_OK))
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            show_display_message('S', 't', 'r', 0);
+            break;
+        case MTKATR001_CMD_GET_SENSOR_CALIBRATION:
+            if ((size != ETX_OTA_GET_SENSOR_CALIBRATION_COMMAND_SIZE) || (send_sensor_calibration_reply(data[1]) != ETX_OTA_EC_OK))
+            {
+                show_display_message('E', 'O', ' ', 'I');
+            }
+            break;
+        case MTKATR001_CMD_GET_THERMAL_MODEL:
+            if ((size != 1) || (send_thermal_model_reply() != ETX_OTA_EC_OK))
+            {
+                show_display_message('E', 'O', ' ', 'I');
+            }
+            break;
+        case MTKATR001_CMD_APPLY_THERMAL_MODEL_GAINS:
+            if (size != 1)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            apply_internal_ambient_thermal_model_gains();
+            break;
+        case MTKATR001_CMD_GET_TELEMETRY_LOG:
+            if (size != ETX_OTA_GET_TELEMETRY_RECORDS_COMMAND_SIZE)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            sequence = (uint32_t) get_int32_from_little_endian(&data[1]);
+            total_records = (uint8_t) read_telemetry_records(&sequence, records, ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS);
+            if (send_telemetry_records_reply(MTKATR001_CMD_GET_TELEMETRY_LOG, get_telemetry_log_total_records(), sequence + total_records, records, total_records) != ETX_OTA_EC_OK)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+            }
+            break;
+        case MTKATR001_CMD_GET_TELEMETRY_ARCHIVE:
+            if (size != ETX_OTA_GET_TELEMETRY_RECORDS_COMMAND_SIZE)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+            sequence = (uint32_t) get_int32_from_little_endian(&data[1]);
+            total_records = (uint8_t) read_telemetry_archive_records(&sequence, records, ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS);
+            if (send_telemetry_records_reply(MTKATR001_CMD_GET_TELEMETRY_ARCHIVE, get_telemetry_archive_next_sequence(), sequence, records, total_records) != ETX_OTA_EC_OK)
+            {
+                show_display_message('E', 'O', ' ', 'I');
+            }
+            break;
+        default:
+            /* Show via the 7-segment Display Device that the received Command is not recognized. */
+            show_display_message('E', 'O', ' ', 'I');
+            break;
+    }
+}
+
+static ETX_OTA_Status send_fault_history_reply(uint8_t first_index)
+{
+    /** <b>Local variable reply:</b> Reply of the @ref MTKATR001_CMD_GET_FAULT_HISTORY Command that is sent back to the host. */
+    uint8_t reply[ETX_OTA_FAULT_HISTORY_REPLY_HEADER_SIZE + ETX_OTA_FAULT_HISTORY_REPLY_MAX_ENTRIES*ETX_OTA_FAULT_HISTORY_ENTRY_SIZE];
+    /** <b>Local variable entry:</b> History event of the @ref fault_manager that is being added to the reply. */
+    fault_history_entry_t entry;
+    /** <b>Local variable total_entries:</b> Number of history events that have been added to the reply. */
+    uint8_t total_entries = 0;
+    /** <b>Local variable p_entry:</b> Pointer to the bytes of the reply into which the next history event will be written. */
+    uint8_t *p_entry = &reply[ETX_OTA_FAULT_HISTORY_REPLY_HEADER_SIZE];
+
+    /* Add the requested history events, from the most recent to the oldest one, until the reply is full or the history has no more of them. */
+    while ((total_entries < ETX_OTA_FAULT_HISTORY_REPLY_MAX_ENTRIES) && ((first_index+total_entries) <= UINT8_MAX) &&
+           (get_fault_history_entry(first_index+total_entries, &entry) == FAULT_MANAGER_EC_OK))
+    {
+        put_uint32_in_little_endian(entry.tick, p_entry);
+        p_entry[4] = entry.code;
+        p_entry[5] = (uint8_t) entry.event;
+        p_entry += ETX_OTA_FAULT_HISTORY_ENTRY_SIZE;
+        total_entries++;
+    }
+
+    /* Fill the header of the reply. */
+    reply[0] = MTKATR001_CMD_GET_FAULT_HISTORY;
+    reply[1] = get_latest_active_fault();
+    reply[2] = (uint8_t) get_fault_manager_lost_capabilities();
+    put_uint32_in_little_endian(get_fault_history_total_events(), &reply[3]);
+    reply[7] = first_index;
+    reply[8] = total_entries;
+
+    return send_etx_ota_custom_data_reply(reply, ETX_OTA_FAULT_HISTORY_REPLY_HEADER_SIZE + total_entries*ETX_OTA_FAULT_HISTORY_ENTRY_SIZE);
+}
+
+static ETX_OTA_Status send_reset_info_reply(void)
+{
+    /** <b>Local variable reply:</b> Reply of the @ref MTKATR001_CMD_GET_RESET_INFO Command that is sent back to the host. */
+    uint8_t reply[ETX_OTA_GET_RESET_INFO_REPLY_SIZE];
+    /** <b>Local variable reset_info:</b> Information about the latest reset of our MCU/MPU. */
+    watchdog_supervisor_reset_info_t reset_info;
+
+    get_watchdog_supervisor_reset_info(&reset_info);
+    reply[0] = MTKATR001_CMD_GET_RESET_INFO;
+    reply[1] = (uint8_t) reset_info.cause;
+    reply[2] = reset_info.late_task;
+    reply[3] = reset_info.last_checked_in_task;
+    put_uint32_in_little_endian(reset_info.total_resets, &reply[4]);
+    put_uint32_in_little_endian(reset_info.watchdog_resets, &reply[8]);
+
+    return send_etx_ota_custom_data_reply(reply, ETX_OTA_GET_RESET_INFO_REPLY_SIZE);
+}
+
+static ETX_OTA_Status send_sensor_calibration_reply(uint8_t channel)
+{
+    /** <b>Local variable reply:</b> Reply of the @ref MTKATR001_CMD_GET_SENSOR_CALIBRATION Command that is sent back to the host. */
+    uint8_t reply[ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE + SENSOR_CALIBRATION_MAX_POINTS*ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE];
+    /** <b>Local variable table:</b> Calibration table of the requested Temperature Sensor. */
+    sensor_calibration_table_t table;
+    /** <b>Local pointer p_point:</b> Pointer to the bytes of the reply into which the next breakpoint will be written. */
+    uint8_t *p_point = &reply[ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE];
+
+    if (get_sensor_calibration((Temp_Sensor_Channel) channel, &table) != SENSOR_CALIBRATION_EC_OK)
+    {
+        return ETX_OTA_EC_ERR;
+    }
+    reply[0] = MTKATR001_CMD_GET_SENSOR_CALIBRATION;
+    reply[1] = channel;
+    reply[2] = table.total_points;
+    for (uint8_t i=0; i<table.total_points; i++)
+    {
+        put_uint16_in_little_endian(table.points[i].measured, p_point);
+        put_uint16_in_little_endian((uint16_t) table.points[i].actual, &p_point[2]);
+        p_point += ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE;
+    }
+
+    return send_etx_ota_custom_data_reply(reply, ETX_OTA_SENSOR_CALIBRATION_HEADER_SIZE + table.total_points*ETX_OTA_SENSOR_CALIBRATION_POINT_SIZE);
+}
+
+static ETX_OTA_Status send_thermal_model_reply(void)
+{
+    /** <b>Local variable reply:</b> Reply of the @ref MTKATR001_CMD_GET_THERMAL_MODEL Command that is sent back to the host. */
+    uint8_t reply[ETX_OTA_GET_THERMAL_MODEL_REPLY_SIZE];
+    /** <b>Local variable estimate:</b> Model of the Internal Ambient Temperature that has been identified so far. */
+    thermal_model_estimate_t estimate = {0};
+
+    reply[0] = MTKATR001_CMD_GET_THERMAL_MODEL;
+    reply[1] = (uint8_t) get_thermal_model_estimate(&internal_ambient_thermal_model, &estimate);
+    put_uint32_in_little_endian((uint32_t) estimate.gain, &reply[2]);
+    put_uint32_in_little_endian(estimate.time_constant, &reply[6]);
+    put_uint32_in_little_endian(estimate.dead_time, &reply[10]);
+    put_uint32_in_little_endian((uint32_t) estimate.equilibrium, &reply[14]);
+    put_uint32_in_little_endian(estimate.samples, &reply[18]);
+
+    return send_etx_ota_custom_data_reply(reply, ETX_OTA_GET_THERMAL_MODEL_REPLY_SIZE);
+}
+
+static ETX_OTA_Status send_telemetry_records_reply(uint8_t command, uint32_t latest_sequence, uint32_t next_sequence, const telemetry_record_t *records, uint8_t total_records)
+{
+    /** <b>Local variable reply:</b> Reply of the Command that is sent back to the host. */
+    uint8_t reply[ETX_OTA_TELEMETRY_RECORDS_REPLY_HEADER_SIZE + ETX_OTA_TELEMETRY_RECORDS_REPLY_MAX_RECORDS*sizeof(telemetry_record_t)];
+
+    reply[0] = command;
+    put_uint32_in_little_endian(latest_sequence, &reply[1]);
+    put_uint32_in_little_endian(next_sequence, &reply[5]);
+    reply[9] = total_records;
+    // NOTE: The records are packed and our MCU/MPU is little-endian, so they are sent as they are held in memory.
+    memcpy(&reply[ETX_OTA_TELEMETRY_RECORDS_REPLY_HEADER_SIZE], records, total_records*sizeof(telemetry_record_t));
+
+    return send_etx_ota_custom_data_reply(reply, ETX_OTA_TELEMETRY_RECORDS_REPLY_HEADER_SIZE + total_records*sizeof(telemetry_record_t));
+}
+
+static void comms_task(void)
+{
+    /** <b>Local variable response:</b> ETX OTA Status Exception Code of the latest ETX OTA Transaction. */
+    ETX_OTA_Status response;
+
+    /* Let the Watchdog Supervisor know that this task is still alive. */
+    watchdog_supervisor_check_in(MTKATR001_TASK_COMMS);
+
+    /* Stream the telemetry only while there is no pending ETX OTA Transaction result to apply, so that the UART is free for its reply, if any. */
+    if (is_etx_ota_response_pending == 0)
+    {
+        stream_telemetry_sample();
+        return;
+    }
+    response = etx_ota_pending_response;
+
+    switch (response)
+    {
+        case ETX_OTA_EC_OK:
+            /* Apply the received ETX OTA Custom Data as a Command if its first byte identifies it as such. */
+            if ((etx_ota_pending_custom_data_size > 0) && (etx_ota_pending_custom_data_size <= ETX_OTA_PENDING_CUSTOM_DATA_MAX_SIZE) &&
+                (etx_ota_pending_custom_data[0] >= ETX_OTA_COMMAND_MIN_ID))
+            {
+                apply_etx_ota_command(etx_ota_pending_custom_data, etx_ota_pending_custom_data_size);
+                break;
+            }
+
+            /* Validate having received the right amount of bytes from the ETX OTA Custom Data Transaction. */
+            if (etx_ota_pending_custom_data_size != ETX_OTA_LEGACY_CUSTOM_DATA_SIZE)
+            {
+                /* Show via the 7-segment Display Device that a ETX OTA Custom Data Transaction has been completed, but a different number of bytes was expected. */
+                show_display_message('E', 'O', ' ', 'I');
+                break;
+            }
+
+            /* Show via the 7-segment Display Device that a ETX OTA Custom Data Transaction has been successfully completed. */
+            show_display_message('E', 'O', ' ', 'D');
+
+            /* Update the parameters of the MTKATR001 System with the Custom Data that has just been recieved via the ETX OTA Protocol. */
+            // NOTE:    With the purpose of recycling the Java Host App for sending ETX OTA Custom Data (i.e., to not
+            //          modify its code) for simplicity purposes, the valid range of values that will be send from that
+            //          App to our MCU/MPU will be from 32 up to 126 for each byte.
+            /* Update the Desired Internal Ambient Temperature Global Variable. */
+            desired_internal_ambient_temperature = etx_ota_pending_custom_data[0] - 42;
+
+            /* Update the Desired Hot Fan Duty Cycle Global Variable. */
+            desired_hot_fan_duty_cycle = etx_ota_pending_custom_data[1];
+            if (etx_ota_pending_custom_data[2] == 48)
+            {
+                desired_hot_fan_duty_cycle -= 42;
+            }
+            desired_hot_fan_duty_cycle += (etx_ota_pending_custom_data[3]);
+            if (etx_ota_pending_custom_data[4] == 48)
+            {
+                desired_hot_fan_duty_cycle -= 42;
+            }
+            if (desired_hot_fan_duty_cycle > 100)
+            {
+                desired_hot_fan_duty_cycle = 100;
+            }
+
+            /* Update the Desired Cold Fan Duty Cycle Global Variable. */
+            desired_cold_fan_duty_cycle = etx_ota_pending_custom_data[5];
+            if (etx_ota_pending_custom_data[6] == 48)
+            {
+                desired_cold_fan_duty_cycle -= 42;
+            }
+            desired_cold_fan_duty_cycle += etx_ota_pending_custom_data[7];
+            if (etx_ota_pending_custom_data[8] == 48)
+            {
+                desired_cold_fan_duty_cycle -= 42;
+            }
+            if (desired_cold_fan_duty_cycle > 100)
+            {
+                desired_cold_fan_duty_cycle = 100;
+            }
+
+            /* Update the Hot Water Temperature Global Variable. */
+            desired_hot_water_temperature = etx_ota_pending_custom_data[9];
+
+            /* Update the Hot Water Min Temperature Global Variable. */
+            desired_hot_water_min_temperature = etx_ota_pending_custom_data[10];
+
+            /* Update the Cold Water Maximum Temperature Global Variable. */
+            desired_cold_water_max_temperature = etx_ota_pending_custom_data[11] - 42;
+
+            /* Persist the updated parameters so that they are used again after our MCU/MPU is reset. */
+            persist_setpoints();
+            break;
+        case ETX_OTA_EC_STOP:
+            show_display_message('E', 'O', ' ', 'Q');
+            break;
+        default:
+            /* Nothing else is shown for the other ETX OTA Status Exception Codes. */
+            break;
+    }
+
+    /* Allow the @ref etx_ota_status_resp_handler to record the result of the next ETX OTA Transaction. */
+    is_etx_ota_response_pending = 0;
+}
+
+static void process_push_button_events(void)
+{
+    /** <b>Local variable event:</b> Event of the @ref push_buttons that is being processed. */
+    push_button_event_t event;
+
+    while (get_push_button_event(&event) == PUSH_BUTTONS_EC_OK)
+    {
+        switch (event.type)
+        {
+            case PUSH_BUTTON_EVENT_LONG_PRESS:
+                is_button_long_pressed[event.button] = 1;
+
+                /* Start or stop the Auto-Tuning once both the Show Hot and Cold Fan Duty Cycle buttons have been long-pressed. */
+                if (is_button_long_pressed[MTKATR001_BUTTON_SHOW_HOT_FAN_DUTY_CYCLE] && is_button_long_pressed[MTKATR001_BUTTON_SHOW_COLD_FAN_DUTY_CYCLE] &&
+                    ((event.button == MTKATR001_BUTTON_SHOW_HOT_FAN_DUTY_CYCLE) || (event.button == MTKATR001_BUTTON_SHOW_COLD_FAN_DUTY_CYCLE)))
+                {
+                    if (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_RUNNING)
+                    {
+                        stop_pid_autotune(&internal_ambient_temp_autotune);
+                        show_display_message('t', 'U', ' ', 'S');
+                    }
+                    else
+                    {
+                        start_internal_ambient_temp_autotune();
+                    }
+                }
+                break;
+            case PUSH_BUTTON_EVENT_RELEASE:
+                is_button_long_pressed[event.button] = 0;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void display_task(void)
+{
+    /** <b>Local variable current_tick:</b> Current HAL Tick in our MCU/MPU. */
+    uint32_t current_tick = HAL_GetTick();
+    /** <b>Local variable autotune_gain:</b> Gain, in centi-units, that resulted from the latest successful Auto-Tuning of the Internal Ambient Temperature PID Controller and that is currently being reported. */
+    int32_t autotune_gain = 0;
+    /** <b>Local variable active_fault:</b> @ref MTKATR001_Status Exception Code of the latest active fault of the @ref fault_manager , or zero if there is none. */
+    uint8_t active_fault = get_latest_active_fault();
+    /** <b>Local variable fault_screen:</b> Screen that is to be shown with respect to the active faults, where 0 stands for the "Err=" message, 1 for the Exception Code of the latest active fault and 2 for whatever would be shown if there were no active faults. */
+    uint32_t fault_screen = 2;
+
+    /* Let the Watchdog Supervisor know that this task is still alive. */
+    watchdog_supervisor_check_in(MTKATR001_TASK_DISPLAY);
+
+    /* Consume the events of the Push Buttons before deciding what is to be shown. */
+    process_push_button_events();
+
+    /* Alternate between the "Err=" message and the Exception Code of the latest active fault if all the capabilities have been lost, or also with the rest of the screens while in a degraded mode. */
+    if (active_fault != 0)
+    {
+        if ((get_fault_manager_lost_capabilities() & MTKATR001_ALL_CAPABILITIES) == MTKATR001_ALL_CAPABILITIES)
+        {
+            fault_screen = (current_tick/DISPLAY_ERROR_CODE_TOGGLE_TIME) % 2;
+        }
+        else
+        {
+            fault_screen = (current_tick/DISPLAY_ERROR_CODE_TOGGLE_TIME) % 3;
+        }
+    }
+
+    /* Show the active fault, if any, by alternating between the "Err=" message and its corresponding Exception Code. */
+    if (fault_screen == 0)
+    {
+        show_display_characters('E', 'r', 'r', '=');
+    }
+    else if (fault_screen == 1)
+    {
+        convert_number_to_5641as_ASCII(TO_CENTI_UNITS(active_fault), ascii_error_code);
+        ascii_error_code[3] = 0;
+        set_5641as_display_output(ascii_error_code);
+    }
+    /* Show the lastly requested message if it has not expired yet. */
+    else if ((int32_t) (display_message_end_tick - current_tick) > 0)
+    {
+        set_5641as_display_output(display_message);
+    }
+    /* Show the Desired Internal Ambient temperature at the MTKATR001's Display if the user requests it. */
+    else if (is_push_button_pressed(MTKATR001_BUTTON_SHOW_DESIRED_TEMP))
+    {
+        convert_number_to_5641as_ASCII(TO_CENTI_UNITS(desired_internal_ambient_temperature), display_output);
+        display_output[3] = 'C';
+        set_5641as_display_output(display_output);
+    }
+    /* Show the current Application Firmware Version at the MTKATR001's Display if the user requests it. */
+    else if (is_push_button_pressed(MTKATR001_BUTTON_SHOW_FIRMWARE_VERSION))
+    {
+        if (((current_tick/DISPLAY_FIRMWARE_VERSION_TOGGLE_TIME) % 2) == 0)
+        {
+            show_display_characters('\0', 'A', 'F', '=');
+        }
+        else
+        {
+            convert_number_to_5641as_ASCII(TO_CENTI_UNITS(APP_version[0]) + (APP_version[1]*10), display_output);
+            display_output[3] = 0;
+            set_5641as_display_output(display_output);
+        }
+    }
+    /* Show the Duty Cycle of the Hot Fan at the MTKATR001's Display if the user requests it. */
+    else if (is_push_button_pressed(MTKATR001_BUTTON_SHOW_HOT_FAN_DUTY_CYCLE))
+    {
+        if (desired_hot_fan_duty_cycle == 100)
+        {
+            show_display_characters('1', '0', '0', 'd');
+        }
+        else
+        {
+            convert_number_to_5641as_ASCII(TO_CENTI_UNITS(desired_hot_fan_duty_cycle), display_output);
+            display_output[3] = 'd';
+            set_5641as_display_output(display_output);
+        }
+    }
+    /* Show the Duty Cycle of the Cold Fan at the MTKATR001's Display if the user requests it. */
+    else if (is_push_button_pressed(MTKATR001_BUTTON_SHOW_COLD_FAN_DUTY_CYCLE))
+    {
+        if (desired_cold_fan_duty_cycle == 100)
+        {
+            show_display_characters('1', '0', '0', 'd');
+        }
+        else
+        {
+            convert_number_to_5641as_ASCII(TO_CENTI_UNITS(desired_cold_fan_duty_cycle), display_output);
+            display_output[3] = 'd';
+            set_5641as_display_output(display_output);
+        }
+    }
+    /* Inform the user that the Hot Water is currently being heated while the Hot Air is waiting for it. */
+    else if (hot_air_state == HOT_AIR_WAITING_HOT_WATER)
+    {
+        switch ((current_tick/DISPLAY_HOT_WATER_HEATING_TOGGLE_TIME) % 4)
+        {
+            case 0:
+                show_display_characters('H', 'E', 'A', 't');
+                break;
+            case 1:
+                show_display_characters(0, 'H', 'o', 't');
+                break;
+            case 2:
+                show_display_characters('A', 't', 'E', 'r');
+                break;
+            default:
+                show_display_characters(0, '.', '.', '.');
+                break;
+        }
+    }
+    /* Request the user to change the Cold Water while the Cold Air is waiting for it, more urgently once it has escalated. */
+    else if ((cold_air_state == COLD_AIR_WAITING_COLD_WATER) || (cold_air_state == COLD_AIR_ESCALATED))
+    {
+        switch ((current_tick/((cold_air_state == COLD_AIR_ESCALATED) ? DISPLAY_COLD_WATER_ALERT_TOGGLE_TIME : DISPLAY_COLD_WATER_NEEDED_TOGGLE_TIME)) % 4)
+        {
+            case 0:
+                show_display_characters('n', 'E', 'E', 'd');
+                break;
+            case 1:
+                show_display_characters('C', 'o', 'l', 'd');
+                break;
+            case 2:
+                show_display_characters('A', 't', 'E', 'r');
+                break;
+            default:
+                if (cold_air_state == COLD_AIR_ESCALATED)
+                {
+                    show_display_characters(0, 0, 0, 0);
+                }
+                else
+                {
+                    show_display_characters(0, '.', '.', '.');
+                }
+                break;
+        }
+    }
+    /* Show that the Auto-Tuning is on-going by alternating between the "tUnE" message and the Current Internal Ambient Temperature. */
+    else if (get_pid_autotune_state(&internal_ambient_temp_autotune) == PID_AUTOTUNE_RUNNING)
+    {
+        if (((current_tick/DISPLAY_AUTOTUNE_TOGGLE_TIME) % 2) == 0)
+        {
+            show_display_characters('t', 'U', 'n', 'E');
+        }
+        else
+        {
+            convert_number_to_5641as_ASCII(current_internal_ambient_temperature, display_output);
+            display_output[3] = 'C';
+            set_5641as_display_output(display_output);
+        }
+    }
+    /* Report the gains that resulted from the latest successful Auto-Tuning, one after the other, if they have not expired yet. */
+    else if ((int32_t) (autotune_result_end_tick - current_tick) > 0)
+    {
+        switch ((current_tick/DISPLAY_AUTOTUNE_TOGGLE_TIME) % 4)
+        {
+            case 0:
+                show_display_characters('t', 'U', 'n', 'd');
+                break;
+            case 1:
+                autotune_gain = (int32_t) (((int64_t) system_params.pid_kp*100) >> PID_CONTROLLER_Q16_SHIFT);
+                display_output[3] = 'P';
+                break;
+            case 2:
+                autotune_gain = (int32_t) (((int64_t) system_params.pid_ki*100*60) >> PID_CONTROLLER_Q16_SHIFT);
+                display_output[3] = 'I';
+                break;
+            default:
+                autotune_gain = (int32_t) ((((int64_t) system_params.pid_kd*100)/60) >> PID_CONTROLLER_Q16_SHIFT);
+                display_output[3] = 'd';
+                break;
+        }
+        if (((current_tick/DISPLAY_AUTOTUNE_TOGGLE_TIME) % 4) != 0)
+        {
+            if (convert_number_to_5641as_ASCII(autotune_gain, display_output) != Display_5641AS_EC_OK)
+            {
+                display_output[0] = '-';
+                display_output[1] = '-';
+                display_output[2] = '-';
+            }
+            set_5641as_display_output(display_output);
+        }
+    }
+    /* Show the value of the Current Internal Ambient Temperature on the 7-segment Display Device otherwise. */
+    else
+    {
+        convert_number_to_5641as_ASCII(current_internal_ambient_temperature, display_output);
+        display_output[3] = 'C';
+        set_5641as_display_output(display_output);
+    }
+}
+
+/**@brief	Callback function of the Analog Watchdogs of the Temperature Sensors ADC and of the second ADC, which is
+ *          called from their Interrupt whenever a conversion of the Hot Water Temperature Sensor is above the
+ *          @ref OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD or one of the Internal Ambient Temperature Sensor is above the
+ *          @ref AMBIENT_OVER_TEMP_ADC_WATCHDOG_HIGH_THRESHOLD respectively.
+ *
+ * @details For the Hot Water, this de-energizes the Water Heating Resistor right away, disables the Analog Watchdog
+ *          Interrupt so that it is not raised again at each conversion and raises the
+ *          @ref MTKATR001_HOT_WATER_OVER_TEMPERATURE fault via the @ref isr_raised_faults Global Variable, which the
+ *          @ref fault_manager latches so that the @ref control_task keeps the Heating actuators Off from then on while
+ *          it keeps cooling if requested.
+ * @details For the Internal Ambient, this turns Off the Water Heating Resistor, the Hot Water Pump and the Hot Fan
+ *          right away, disables the Analog Watchdog Interrupt and raises the
+ *          @ref MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE fault in the same way, whose Interrupt is then re-armed by
+ *          the @ref sensing_task once the Internal Ambient Temperature is back below its maximum.
+ *
+ * @param[in,out] hadc  Handle of the ADC whose Analog Watchdog has been triggered.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+void HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc)
+{
+    HAL_GPIO_WritePin(Water_Heating_Resistor_GPIO_Output_GPIO_Port, Water_Heating_Resistor_GPIO_Output_Pin, GPIO_PIN_RESET);
+    __HAL_ADC_DISABLE_IT(hadc, ADC_IT_AWD);
+    if (hadc->Instance == hadc2.Instance)
+    {
+        HAL_GPIO_WritePin(Hot_Water_Pump_GPIO_Output_GPIO_Port, Hot_Water_Pump_GPIO_Output_Pin, GPIO_PIN_RESET);
+        __HAL_TIM_SET_COMPARE(&htim3, HOT_FAN_TIMER_CHANNEL, 0);
+        raise_isr_fault(MTKATR001_INTERNAL_AMBIENT_OVER_TEMPERATURE);
+        return;
+    }
+    raise_isr_fault(MTKATR001_HOT_WATER_OVER_TEMPERATURE);
+}
+
+/**@brief	Callback function of the EXTI lines of our MCU/MPU, which handles the short-circuit indicators of the Water
+ *          Temperature Sensors and reports the edges of the Push Buttons of the MTKATR001 System to the
+ *          @ref push_buttons .
+ *
+ * @details Whenever the short-circuit indicator of the Hot or the Cold Water Temperature Sensor falls into its Low
+ *          State, all the actuators are forced into their safe state via the @ref force_actuators_safe_state function
+ *          from within this Interrupt, which has the highest priority of our MCU/MPU, and the corresponding fault is
+ *          raised via the @ref isr_raised_faults Global Variable so that the @ref fault_manager latches it, the
+ *          @ref control_task only turns back On the actuators that do not depend on that sensor and the
+ *          @ref display_task shows it.
+ *
+ * @param GPIO_Pin  GPIO Pin whose EXTI line has been triggered.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    /* Force the safe state right away whenever a Water Temperature Sensor is under a short-circuit, and let the tasks handle the fault from then on. */
+    if ((GPIO_Pin == Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin) && (HAL_GPIO_ReadPin(Hot_Water_Shortcircuit_Indicator_GPIO_Input_GPIO_Port, Hot_Water_Shortcircuit_Indicator_GPIO_Input_Pin) == GPIO_PIN_RESET))
+    {
+        force_actuators_safe_state();
+        raise_isr_fault(MTKATR001_HOT_WATER_TEMP_IS_UNDER_SHORTCIRCUIT);
+        return;
+    }
+    if ((GPIO_Pin == Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin) && (HAL_GPIO_ReadPin(Cold_Water_Shortcircuit_Indicator_GPIO_Input_GPIO_Port, Cold_Water_Shortcircuit_Indicator_GPIO_Input_Pin) == GPIO_PIN_RESET))
+    {
+        force_actuators_safe_state();
+        raise_isr_fault(MTKATR001_COLD_WATER_TEMP_IS_UNDER_SHORTCIRCUIT);
+        return;
+    }
+
+    push_buttons_exti_handler(GPIO_Pin);
+}
+
+/**@brief	Callback function of the SysTick Interrupt, which is executed once each millisecond and which executes the
+ *          debouncer of the @ref push_buttons .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+void HAL_SYSTICK_Callback(void)
+{
+    run_push_buttons_debouncer();
+}
+
+/**@brief	Callback function before an ETX OTA Transaction with the host machine is about to give place.
+ *
+ * @note    For more details on how this function works with respect to the ETX OTA Protocol, see the Doxygen
+ *          Documentation available for it at the @ref app_side_etx_ota .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    February 10, 2024.
+ * @date    LAST UPDATE: October 16, 2026.
  */
 void etx_ota_pre_transaction_handler()
 {
@@ -1556,6 +3529,12 @@ void etx_ota_pre_transaction_handler()
     // NOTE:    This must be done in order to guarantee a successful ETX OTA Transaction (the non-blocking interrupts
     //          can be enabled back again after the ETX OTA Transaction has been completed).
     stop_5641as_display_module();
+
+    /* Leave the UART free for the ETX OTA Transaction. */
+    pause_telemetry_stream();
+
+    /* Give the ETX OTA Transaction the whole IWDG timeout, since the IWDG is not reloaded while it is being handled. */
+    refresh_watchdog_supervisor();
 }
 
 /**@brief	ETX OTA Status Response Callback.
@@ -1593,6 +3572,13 @@ void etx_ota_pre_transaction_handler()
  *          about this by showing the "EO I" message in the Display of the MTKATR001 System. Conversely, if the received
  *          data size is what is expected, then this function will update the values of the corresponding Global
  *          Variables and will show the "EO D" message in the Display of the MTKATR001 System.
+ * @details However, if the first byte of the received data has a value of @ref ETX_OTA_COMMAND_MIN_ID or greater, then
+ *          that data is handled as one of the @ref MTKATR001_Command instead (see @ref apply_etx_ota_command ), where
+ *          up to @ref ETX_OTA_PENDING_CUSTOM_DATA_MAX_SIZE bytes can be received.
+ *
+ * @note    Since this function is called from the UART Interrupt context, it will only record a copy of the result of
+ *          the ETX OTA Transaction and of its Custom Data, so that the @ref comms_task is the one that actually updates
+ *          the corresponding Global Variables and shows the corresponding message in the Display.
  *
  * @param  resp  Resulting ETX OTA Status Exception Code of the ETX OTA Transaction that has just been completed, where
  *               the only possible values that can be given are the following:<br>
@@ -1604,93 +3590,36 @@ void etx_ota_pre_transaction_handler()
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    February 10, 2024.
- * @date    LAST UPDATE: April 23, 2024.
+ * @date    LAST UPDATE: October 16, 2026.
  */
 void etx_ota_status_resp_handler(ETX_OTA_Status resp)
 {
 	start_5641as_display_module(); // We start back again the 5641AS Driver Timer's Base generation in Interrupt Mode.
+    resume_telemetry_stream();
     switch (resp)
     {
         case ETX_OTA_EC_OK:
-        	/* Validate having received the right amount of bytes from the current ETX OTA Custom Data Transaction. */
-        	if (etx_ota_custom_data.size != 12)
-        	{
-        		/* Show via the 7-segment Display Device that a ETX OTA Custom Data Transaction has been completed, but a different number of bytes was expected. */
-				display_output[0] = 'E';
-				display_output[1] = 'O';
-				display_output[2] = ' ';
-				display_output[3] = 'I';
-				set_5641as_display_output(display_output);
-        	}
-        	else
-        	{
-        		/* Show via the 7-segment Display Device that a ETX OTA Custom Data Transaction has been successfully completed. */
-				display_output[0] = 'E';
-				display_output[1] = 'O';
-				display_output[2] = ' ';
-				display_output[3] = 'D';
-				set_5641as_display_output(display_output);
-
-				/* Update the parameters of the MTKATR001 System with the Custom Data that has just been recieved via the ETX OTA Protocol. */
-				// NOTE:    With the purpose of recycling the Java Host App for sending ETX OTA Custom Data (i.e., to not
-				//          modify its code) for simplicity purposes, the valid range of values that will be send from that
-				//          App to our MCU/MPU will be from
-				/* Update the Desired Internal Ambient Temperature Global Variable. */
-				desired_internal_ambient_temperature = etx_ota_custom_data.data[0] - 42;
-
-				/* Update the Desired Hot Fan Duty Cycle Global Variable. */
-				desired_hot_fan_duty_cycle = etx_ota_custom_data.data[1];
-				if (etx_ota_custom_data.data[2] == 48)
-				{
-					desired_hot_fan_duty_cycle -= 42;
-				}
-				desired_hot_fan_duty_cycle += (etx_ota_custom_data.data[3]);
-				if (etx_ota_custom_data.data[4] == 48)
-				{
-					desired_hot_fan_duty_cycle -= 42;
-				}
-				if (desired_hot_fan_duty_cycle > 100)
-				{
-					desired_hot_fan_duty_cycle = 100;
-				}
-
-				/* Update the Desired Cold Fan Duty Cycle Global Variable. */
-				desired_cold_fan_duty_cycle = etx_ota_custom_data.data[5];
-				if (etx_ota_custom_data.data[6] == 48)
-				{
-					desired_cold_fan_duty_cycle -= 42;
-				}
-				desired_cold_fan_duty_cycle += etx_ota_custom_data.data[7];
-				if (etx_ota_custom_data.data[8] == 48)
-				{
-					desired_cold_fan_duty_cycle -= 42;
-				}
-				if (desired_cold_fan_duty_cycle > 100)
-				{
-					desired_cold_fan_duty_cycle = 100;
-				}
-
-				/* Update the Hot Water Temperature Global Variable. */
-				desired_hot_water_temperature = etx_ota_custom_data.data[9];
-
-				/* Update the Hot Water Min Temperature Global Variable. */
-				desired_hot_water_min_temperature = etx_ota_custom_data.data[10];
-
-				/* Update the Cold Water Maximum Temperature Global Variable. */
-				desired_cold_water_max_temperature = etx_ota_custom_data.data[11] - 42;
-        	}
-	    	break;
         case ETX_OTA_EC_STOP:
-            #if ETX_OTA_VERBOSE
-                printf("DONE: ETX OTA process has been aborted. Try again...\r\n");
-            #endif
-            display_output[0] = 'E';
-            display_output[1] = 'O';
-            display_output[2] = ' ';
-            display_output[3] = 'Q';
-            set_5641as_display_output(display_output);
-			start_etx_ota();
-	    	break;
+            /* Record the result of the current ETX OTA Transaction so that the @ref comms_task applies it outside of this Interrupt context. */
+            // NOTE: If the @ref comms_task has not applied the previous result yet, then the current one will be discarded.
+            if (is_etx_ota_response_pending == 0)
+            {
+                etx_ota_pending_response = resp;
+                etx_ota_pending_custom_data_size = etx_ota_custom_data.size;
+                if ((resp==ETX_OTA_EC_OK) && (etx_ota_custom_data.size<=ETX_OTA_PENDING_CUSTOM_DATA_MAX_SIZE))
+                {
+                    memcpy(etx_ota_pending_custom_data, etx_ota_custom_data.data, etx_ota_custom_data.size);
+                }
+                is_etx_ota_response_pending = 1;
+            }
+            if (resp == ETX_OTA_EC_STOP)
+            {
+                #if ETX_OTA_VERBOSE
+                    printf("DONE: ETX OTA process has been aborted. Try again...\r\n");
+                #endif
+                start_etx_ota();
+            }
+            break;
         case ETX_OTA_EC_NR:
             // No response was received from host. Therefore, try hearing for a response from the host again in case our MCU/MPU is still in DFU mode.
             break;
@@ -1710,21 +3639,10 @@ void etx_ota_status_resp_handler(ETX_OTA_Status resp)
         default:
         	/* This should never be called. */
             #if ETX_OTA_VERBOSE
-                printf("ERROR: Exception Code received %d is not recognized. Our MCU/MPU will halt!.\r\n", resp);
+                printf("ERROR: Exception Code received %d is not recognized. All the actuators will be kept turned Off!.\r\n", resp);
             #endif
-            while (1)
-            {
-            	convert_number_to_ASCII(MTKATR001_EC_ERR, ascii_error_code);
-				ascii_error_code[3] = 0;
-				display_output[0] = 'E';
-				display_output[1] = 'r';
-				display_output[2] = 'r';
-				display_output[3] = '=';
-                set_5641as_display_output(display_output);
-                HAL_Delay(2000);
-                set_5641as_display_output(ascii_error_code);
-                HAL_Delay(2000);
-            }
+            force_actuators_safe_state();
+            raise_isr_fault(MTKATR001_EC_ERR);
     }
 }
 
@@ -0,0 +1,151 @@
+/** @addtogroup pid_autotune
+ * @{
+ */
+
+#include "pid_autotune.h"
+
+#define PID_AUTOTUNE_PI_TIMES_1000      (3142)      /**< @brief \f$\pi\f$ constant multiplied by 1000. */
+
+/**@brief   Calculates the Ultimate Gain, the Ultimate Period and the PID gains from the averaged oscillation cycles of
+ *          an Auto-Tuner and moves it into either the @ref PID_AUTOTUNE_DONE or the @ref PID_AUTOTUNE_FAILED state.
+ *
+ * @param[in,out] autotune  Pointer to the Auto-Tuner that has finished measuring its oscillation cycles.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void calculate_pid_autotune_result(pid_autotune_t *autotune);
+
+int32_t run_pid_autotune(pid_autotune_t *autotune, int32_t measurement, uint32_t tick)
+{
+    if (autotune->state != PID_AUTOTUNE_RUNNING)
+    {
+        return 0;
+    }
+
+    /* Give up if the oscillation cycles could not be measured within the configured time. */
+    if ((tick - autotune->start_tick) >= autotune->config.timeout)
+    {
+        autotune->state = PID_AUTOTUNE_FAILED;
+        autotune->output = 0;
+        return 0;
+    }
+
+    /* Keep track of the peaks of the current oscillation cycle. */
+    if (measurement > autotune->cycle_max)
+    {
+        autotune->cycle_max = measurement;
+    }
+    if (measurement < autotune->cycle_min)
+    {
+        autotune->cycle_min = measurement;
+    }
+
+    /* Switch the relay whenever the measurement crosses the hysteresis band around the setpoint. */
+    if ((autotune->output > 0) && (measurement > (autotune->config.setpoint + autotune->config.hysteresis)))
+    {
+        autotune->output = -autotune->config.relay_amplitude;
+    }
+    else if ((autotune->output < 0) && (measurement < (autotune->config.setpoint - autotune->config.hysteresis)))
+    {
+        autotune->output = autotune->config.relay_amplitude;
+
+        /* Each switch into the positive output ends one oscillation cycle, where the first one is discarded since it contains the initial transient. */
+        if (autotune->positive_switches >= 2)
+        {
+            autotune->periods_sum += tick - autotune->cycle_start_tick;
+            autotune->peak_to_peak_sum += autotune->cycle_max - autotune->cycle_min;
+        }
+        autotune->positive_switches++;
+        if (autotune->positive_switches >= (autotune->config.cycles + 2))
+        {
+            calculate_pid_autotune_result(autotune);
+            return 0;
+        }
+        autotune->cycle_start_tick = tick;
+        autotune->cycle_max = measurement;
+        autotune->cycle_min = measurement;
+    }
+
+    return autotune->output;
+}
+
+PID_Autotune_State get_pid_autotune_state(const pid_autotune_t *autotune)
+{
+    return autotune->state;
+}
+
+PID_Autotune_Status get_pid_autotune_result(const pid_autotune_t *autotune, pid_autotune_result_t *result)
+{
+    if (autotune->state != PID_AUTOTUNE_DONE)
+    {
+        return PID_AUTOTUNE_EC_ERR;
+    }
+
+    *result = autotune->result;
+    return PID_AUTOTUNE_EC_OK;
+}
+
+void stop_pid_autotune(pid_autotune_t *autotune)
+{
+    autotune->state = PID_AUTOTUNE_IDLE;
+    autotune->output = 0;
+}
+
+PID_Autotune_Status start_pid_autotune(pid_autotune_t *autotune, const pid_autotune_config_t *config, int32_t measurement, uint32_t tick)
+{
+    /* Validate the given configuration. */
+    if ((config->relay_amplitude<=0) || (config->hysteresis<0) || (config->cycles==0) || (config->cycles>PID_AUTOTUNE_MAX_CYCLES) || (config->timeout==0))
+    {
+        return PID_AUTOTUNE_EC_ERR;
+    }
+
+    autotune->config = *config;
+    autotune->output = (measurement < config->setpoint) ? config->relay_amplitude : -config->relay_amplitude;
+    autotune->start_tick = tick;
+    autotune->cycle_start_tick = tick;
+    autotune->cycle_max = measurement;
+    autotune->cycle_min = measurement;
+    autotune->positive_switches = 0;
+    autotune->periods_sum = 0;
+    autotune->peak_to_peak_sum = 0;
+    autotune->state = PID_AUTOTUNE_RUNNING;
+
+    return PID_AUTOTUNE_EC_OK;
+}
+
+static void calculate_pid_autotune_result(pid_autotune_t *autotune)
+{
+    /** <b>Local variable peak_to_peak:</b> Average peak-to-peak amplitude (i.e., \f$2a\f$ ) of the measured oscillation cycles. */
+    int32_t peak_to_peak = autotune->peak_to_peak_sum / autotune->config.cycles;
+    /** <b>Local variable ku:</b> Ultimate Gain in Q16 Fixed-Point format. */
+    int64_t ku;
+    /** <b>Local variable kp:</b> Proportional gain in Q16 Fixed-Point format. */
+    int64_t kp;
+
+    autotune->output = 0;
+    autotune->result.pu = autotune->periods_sum / autotune->config.cycles;
+    if ((peak_to_peak <= 0) || (autotune->result.pu == 0))
+    {
+        autotune->state = PID_AUTOTUNE_FAILED;
+        return;
+    }
+
+    /* Calculate the Ultimate Gain as 4d/(pi*a), which equals 8d/(pi*peak_to_peak). */
+    ku = (((int64_t) 8*autotune->config.relay_amplitude*1000) << PID_CONTROLLER_Q16_SHIFT) / ((int64_t) PID_AUTOTUNE_PI_TIMES_1000*peak_to_peak);
+    if (ku > INT32_MAX)
+    {
+        autotune->state = PID_AUTOTUNE_FAILED;
+        return;
+    }
+
+    /* Calculate the PID gains with the classic Ziegler-Nichols rules, where the Ultimate Period is given in milliseconds. */
+    kp = (ku*6) / 10;
+    autotune->result.ku = (int32_t) ku;
+    autotune->result.kp = (int32_t) kp;
+    autotune->result.ki = (int32_t) ((kp*2*1000) / autotune->result.pu);
+    autotune->result.kd = (int32_t) ((kp*autotune->result.pu) / (8*1000));
+    autotune->state = PID_AUTOTUNE_DONE;
+}
+
+/** @} */
@@ -0,0 +1,124 @@
+/** @addtogroup pid_controller
+ * @{
+ */
+
+#include "pid_controller.h"
+
+/**@brief   Limits a value to a desired range.
+ *
+ * @param value Value that wants to be limited.
+ * @param min   Lowest value allowed.
+ * @param max   Highest value allowed.
+ *
+ * @return  The \p value param if it is within the given range or, otherwise, the nearest limit to it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static int64_t clamp(int64_t value, int64_t min, int64_t max);
+
+int32_t run_pid_controller(pid_controller_t *pid, int32_t setpoint, int32_t measurement)
+{
+    /** <b>Local variable error:</b> Difference between the given setpoint and measurement. */
+    int32_t error = setpoint - measurement;
+    /** <b>Local variable proportional:</b> Proportional term, in output units and in Q16 Fixed-Point format. */
+    int64_t proportional = (int64_t) pid->kp * error;
+    /** <b>Local variable derivative:</b> Derivative term, in output units and in Q16 Fixed-Point format. */
+    int64_t derivative = 0;
+    /** <b>Local variable integral:</b> Integral term, in output units and in Q16 Fixed-Point format, that would result from accumulating the current error. */
+    int64_t integral = pid->integral + pid->ki_times_period*error;
+    /** <b>Local variable unsaturated_output:</b> Output that the controller would have if the current error was accumulated and if no limits were applied to it. */
+    int64_t unsaturated_output;
+    /** <b>Local variable output_min_q16:</b> Lowest value that the output of the controller may have, in Q16 Fixed-Point format. */
+    int64_t output_min_q16 = ((int64_t) pid->output_min) << PID_CONTROLLER_Q16_SHIFT;
+    /** <b>Local variable output_max_q16:</b> Highest value that the output of the controller may have, in Q16 Fixed-Point format. */
+    int64_t output_max_q16 = ((int64_t) pid->output_max) << PID_CONTROLLER_Q16_SHIFT;
+
+    /* Calculate the Derivative term from the measurement, so that changes in the setpoint do not kick the output. */
+    if (pid->is_primed)
+    {
+        derivative = -pid->kd_over_period*(measurement - pid->previous_measurement);
+    }
+    pid->previous_measurement = measurement;
+    pid->is_primed = 1;
+
+    /* Accumulate the current error only if doing so does not drive the output further into saturation. */
+    unsaturated_output = proportional + integral + derivative;
+    if (!(((unsaturated_output > output_max_q16) && (error > 0)) || ((unsaturated_output < output_min_q16) && (error < 0))))
+    {
+        pid->integral = clamp(integral, output_min_q16, output_max_q16);
+    }
+
+    /* Calculate the output and limit it to the output limits of the controller. */
+    pid->output = (int32_t) clamp((proportional + pid->integral + derivative + (1 << (PID_CONTROLLER_Q16_SHIFT-1))) >> PID_CONTROLLER_Q16_SHIFT, pid->output_min, pid->output_max);
+
+    return pid->output;
+}
+
+void reset_pid_controller(pid_controller_t *pid)
+{
+    pid->integral = 0;
+    pid->previous_measurement = 0;
+    pid->output = 0;
+    pid->is_primed = 0;
+}
+
+PID_Controller_Status set_pid_controller_output_limits(pid_controller_t *pid, int32_t output_min, int32_t output_max)
+{
+    if (output_min > output_max)
+    {
+        return PID_CONTROLLER_EC_ERR;
+    }
+
+    pid->output_min = output_min;
+    pid->output_max = output_max;
+    pid->integral = clamp(pid->integral, ((int64_t) output_min) << PID_CONTROLLER_Q16_SHIFT, ((int64_t) output_max) << PID_CONTROLLER_Q16_SHIFT);
+
+    return PID_CONTROLLER_EC_OK;
+}
+
+PID_Controller_Status set_pid_controller_gains(pid_controller_t *pid, int32_t kp, int32_t ki, int32_t kd)
+{
+    if ((kp<0) || (ki<0) || (kd<0))
+    {
+        return PID_CONTROLLER_EC_ERR;
+    }
+
+    /* Calculate the products of the Integral and Derivative gains with the period of the controller only once, since the period is given in milliseconds. */
+    pid->kp = kp;
+    pid->ki_times_period = ((int64_t) ki*pid->sample_period) / 1000;
+    pid->kd_over_period = ((int64_t) kd*1000) / pid->sample_period;
+
+    return PID_CONTROLLER_EC_OK;
+}
+
+PID_Controller_Status init_pid_controller(pid_controller_t *pid, const pid_controller_config_t *config)
+{
+    /* Validate the given configuration. */
+    if ((config->sample_period==0) || (config->output_min>config->output_max))
+    {
+        return PID_CONTROLLER_EC_ERR;
+    }
+
+    pid->sample_period = config->sample_period;
+    pid->output_min = config->output_min;
+    pid->output_max = config->output_max;
+    reset_pid_controller(pid);
+
+    return set_pid_controller_gains(pid, config->kp, config->ki, config->kd);
+}
+
+static int64_t clamp(int64_t value, int64_t min, int64_t max)
+{
+    if (value < min)
+    {
+        return min;
+    }
+    if (value > max)
+    {
+        return max;
+    }
+    return value;
+}
+
+/** @} */
@@ -0,0 +1,161 @@
+/** @addtogroup preheat_scheduler
+ * @{
+ */
+
+#include "preheat_scheduler.h"
+
+#define MILLISECONDS_PER_MINUTE     (60000)     /**< @brief Number of milliseconds in one minute. */
+
+/**@brief	Starts a new window of a Scheduler of the @ref preheat_scheduler from its current inputs.
+ *
+ * @param[in,out] scheduler Pointer to the Scheduler whose window wants to be started.
+ * @param[in] inputs        Pointer to the current inputs of the \p scheduler param.
+ * @param tick              Current tick in milliseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void start_preheat_scheduler_window(preheat_scheduler_t *scheduler, const preheat_scheduler_inputs_t *inputs, uint32_t tick);
+
+/**@brief	Adds a new sample into the exponential moving average of a learned rate.
+ *
+ * @param[in] scheduler     Pointer to the Scheduler to which the learned rate belongs.
+ * @param[in,out] rate      Pointer to the learned rate.
+ * @param[in,out] samples   Pointer to the number of windows from which the \p rate param has been learned, which is
+ *                          incremented up to @ref preheat_scheduler_config_t::min_samples .
+ * @param new_rate          Rate that was measured during the latest window.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void learn_preheat_scheduler_rate(const preheat_scheduler_t *scheduler, int32_t *rate, uint8_t *samples, int32_t new_rate);
+
+uint8_t run_preheat_scheduler(preheat_scheduler_t *scheduler, const preheat_scheduler_inputs_t *inputs, uint32_t tick)
+{
+    /** <b>Local variable elapsed:</b> Time in milliseconds since the current window started. */
+    uint32_t elapsed;
+    /** <b>Local variable heating_rate:</b> Rate at which the buffer warmed up during the latest window, in temperature units per minute. */
+    int32_t heating_rate;
+    /** <b>Local variable time_to_ready:</b> Predicted time in milliseconds for the buffer to be ready. */
+    int64_t time_to_ready = 0;
+    /** <b>Local variable time_to_heat:</b> Predicted time in milliseconds for the heated process to need the buffer. */
+    int64_t time_to_heat;
+
+    /* Learn the rates from the windows during which the heater was On all the time, or no air was thrown at all. */
+    if (!scheduler->is_window_started)
+    {
+        start_preheat_scheduler_window(scheduler, inputs, tick);
+    }
+    else
+    {
+        if (!inputs->is_heater_on)
+        {
+            scheduler->is_heater_always_on = 0;
+        }
+        if (inputs->is_air_on)
+        {
+            scheduler->is_air_always_off = 0;
+        }
+        elapsed = tick - scheduler->window_start_tick;
+        if (elapsed >= (2*scheduler->config.window))
+        {
+            // NOTE: A window that was not followed all along cannot tell what happened in between, so it is discarded.
+            start_preheat_scheduler_window(scheduler, inputs, tick);
+        }
+        else if (elapsed >= scheduler->config.window)
+        {
+            // NOTE: A buffer that does not warm up with its heater On all the time is already at its highest temperature, which says nothing about how fast it warms up.
+            heating_rate = (int32_t) ((((int64_t) inputs->buffer_temperature - scheduler->window_start_buffer)*MILLISECONDS_PER_MINUTE) / elapsed);
+            if (scheduler->is_heater_always_on && (heating_rate > 0))
+            {
+                learn_preheat_scheduler_rate(scheduler, &scheduler->rates.heating_rate, &scheduler->rates.heating_samples, heating_rate);
+            }
+            if (scheduler->is_air_always_off)
+            {
+                learn_preheat_scheduler_rate(scheduler, &scheduler->rates.heat_loss_rate, &scheduler->rates.heat_loss_samples,
+                                             (int32_t) ((((int64_t) scheduler->window_start_process - inputs->process_temperature)*MILLISECONDS_PER_MINUTE) / elapsed));
+            }
+            start_preheat_scheduler_window(scheduler, inputs, tick);
+        }
+    }
+
+    /* Heat the buffer whenever the heated process already needs it. */
+    if (inputs->process_temperature <= inputs->process_heat_temperature)
+    {
+        return 1;
+    }
+
+    /* Only heat the buffer on demand until both rates have been learned, and a heated process that does not cool down by itself will never need the buffer. */
+    if ((scheduler->rates.heating_samples < scheduler->config.min_samples) || (scheduler->rates.heat_loss_samples < scheduler->config.min_samples) ||
+        (scheduler->rates.heating_rate <= 0) || (scheduler->rates.heat_loss_rate <= 0))
+    {
+        return 0;
+    }
+
+    /* Start heating the buffer once it would not be ready in time otherwise. */
+    if (inputs->buffer_temperature < inputs->buffer_ready_temperature)
+    {
+        time_to_ready = (((int64_t) inputs->buffer_ready_temperature - inputs->buffer_temperature)*MILLISECONDS_PER_MINUTE) / scheduler->rates.heating_rate;
+    }
+    time_to_heat = (((int64_t) inputs->process_temperature - inputs->process_heat_temperature)*MILLISECONDS_PER_MINUTE) / scheduler->rates.heat_loss_rate;
+
+    return ((time_to_ready + scheduler->config.lead_margin) >= time_to_heat) ? 1 : 0;
+}
+
+Preheat_Scheduler_Status get_preheat_scheduler_rates(const preheat_scheduler_t *scheduler, preheat_scheduler_rates_t *rates)
+{
+    *rates = scheduler->rates;
+    if ((rates->heating_samples < scheduler->config.min_samples) || (rates->heat_loss_samples < scheduler->config.min_samples))
+    {
+        return PREHEAT_SCHEDULER_EC_NO_DATA;
+    }
+
+    return PREHEAT_SCHEDULER_EC_OK;
+}
+
+Preheat_Scheduler_Status init_preheat_scheduler(preheat_scheduler_t *scheduler, const preheat_scheduler_config_t *config)
+{
+    /* Validate the given configuration. */
+    if ((config->window==0) || (config->filter_shift>PREHEAT_SCHEDULER_MAX_FILTER_SHIFT))
+    {
+        return PREHEAT_SCHEDULER_EC_ERR;
+    }
+
+    scheduler->config = *config;
+    scheduler->rates.heating_rate = 0;
+    scheduler->rates.heat_loss_rate = 0;
+    scheduler->rates.heating_samples = 0;
+    scheduler->rates.heat_loss_samples = 0;
+    scheduler->is_window_started = 0;
+
+    return PREHEAT_SCHEDULER_EC_OK;
+}
+
+static void start_preheat_scheduler_window(preheat_scheduler_t *scheduler, const preheat_scheduler_inputs_t *inputs, uint32_t tick)
+{
+    scheduler->window_start_tick = tick;
+    scheduler->window_start_buffer = inputs->buffer_temperature;
+    scheduler->window_start_process = inputs->process_temperature;
+    scheduler->is_heater_always_on = 1;
+    scheduler->is_air_always_off = 1;
+    scheduler->is_window_started = 1;
+}
+
+static void learn_preheat_scheduler_rate(const preheat_scheduler_t *scheduler, int32_t *rate, uint8_t *samples, int32_t new_rate)
+{
+    /* The first window sets the rate as is, since there is nothing to average it with yet. */
+    if (*samples == 0)
+    {
+        *rate = new_rate;
+    }
+    else
+    {
+        *rate += (new_rate - *rate) / (1 << scheduler->config.filter_shift);
+    }
+    if (*samples < scheduler->config.min_samples)
+    {
+        (*samples)++;
+    }
+}
+
+/** @} */
@@ -0,0 +1,186 @@
+/** @addtogroup push_buttons
+ * @{
+ */
+
+#include "push_buttons.h"
+
+#define PUSH_BUTTONS_EVENT_QUEUE_MASK       (PUSH_BUTTONS_EVENT_QUEUE_SIZE - 1)    /**< @brief Mask with which the indexes of the ring buffer of the @ref push_buttons are wrapped around. */
+
+/**@brief	Debouncing state of a Push Button of the @ref push_buttons .
+ */
+typedef struct
+{
+    volatile uint8_t is_edge_pending;   //!< Flag that is set by the @ref push_buttons_exti_handler function whenever an edge of the Push Button is detected.
+    volatile uint8_t is_pressed;        //!< Debounced state of the Push Button.
+    uint8_t quiet_time_left;            //!< Time in milliseconds that is left before the Push Button is sampled, where zero stands for no sampling being scheduled.
+    uint8_t is_long_press_reported;     //!< Flag that indicates whether the @ref PUSH_BUTTON_EVENT_LONG_PRESS event of the current press has already been generated.
+    uint16_t held_time;                 //!< Time in milliseconds during which the Push Button has been held in its current press.
+} push_button_state_t;
+
+static const push_button_def_t *p_buttons = NULL;                                   /**< @brief Pointer to the definitions of the Push Buttons that are managed by the @ref push_buttons . @details This pointer's value is defined in the @ref init_push_buttons_module function. */
+static uint8_t total_push_buttons = 0;                                              /**< @brief Number of Push Buttons that are managed by the @ref push_buttons . */
+static uint8_t push_buttons_debounce_time;                                          /**< @brief Time in milliseconds during which a Push Button must stay quiet before it is sampled. */
+static uint16_t push_buttons_long_press_time;                                       /**< @brief Time in milliseconds during which a Push Button must be held to generate a @ref PUSH_BUTTON_EVENT_LONG_PRESS event. */
+static push_button_state_t push_buttons_states[PUSH_BUTTONS_MAX_BUTTONS];           /**< @brief Debouncing state of each Push Button. */
+static push_button_event_t event_queue[PUSH_BUTTONS_EVENT_QUEUE_SIZE];              /**< @brief Ring buffer of the events of the Push Buttons. */
+static volatile uint8_t event_queue_head = 0;                                       /**< @brief Index at which the next event will be written into @ref event_queue , which is only written by the @ref run_push_buttons_debouncer function. */
+static volatile uint8_t event_queue_tail = 0;                                       /**< @brief Index from which the next event will be read from @ref event_queue , which is only written by the @ref get_push_button_event function. */
+static volatile uint32_t dropped_events = 0;                                        /**< @brief Number of events that have been discarded because @ref event_queue was full. */
+
+/**@brief   Writes an event into the ring buffer of the @ref push_buttons , unless it is full.
+ *
+ * @param button    Index of the Push Button that generated the event.
+ * @param type      Type of the event.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void push_event(uint8_t button, Push_Button_Event_Type type);
+
+void push_buttons_exti_handler(uint16_t GPIO_Pin)
+{
+    for (uint8_t i=0; i<total_push_buttons; i++)
+    {
+        if (p_buttons[i].is_exti && (p_buttons[i].GPIO_Pin == GPIO_Pin))
+        {
+            push_buttons_states[i].is_edge_pending = 1;
+        }
+    }
+}
+
+void run_push_buttons_debouncer(void)
+{
+    /** <b>Local variable is_pressed:</b> Current raw state of the Push Button that is being debounced. */
+    uint8_t is_pressed;
+    /** <b>Local variable state:</b> Pointer to the debouncing state of the Push Button that is being debounced. */
+    push_button_state_t *state;
+
+    for (uint8_t i=0; i<total_push_buttons; i++)
+    {
+        state = &push_buttons_states[i];
+
+        /* Restart the quiet time of the Push Button whenever an edge is detected, either by its EXTI line or by sampling it. */
+        if (p_buttons[i].is_exti)
+        {
+            if (state->is_edge_pending)
+            {
+                state->is_edge_pending = 0;
+                state->quiet_time_left = push_buttons_debounce_time;
+            }
+        }
+        else if (state->quiet_time_left == 0)
+        {
+            is_pressed = (HAL_GPIO_ReadPin(p_buttons[i].GPIO_Port, p_buttons[i].GPIO_Pin) == p_buttons[i].pressed_state) ? 1 : 0;
+            if (is_pressed != state->is_pressed)
+            {
+                state->quiet_time_left = push_buttons_debounce_time;
+            }
+        }
+
+        /* Sample the Push Button once it has stayed quiet for the whole debounce time and report its change, if any. */
+        if ((state->quiet_time_left > 0) && (--state->quiet_time_left == 0))
+        {
+            is_pressed = (HAL_GPIO_ReadPin(p_buttons[i].GPIO_Port, p_buttons[i].GPIO_Pin) == p_buttons[i].pressed_state) ? 1 : 0;
+            if (is_pressed != state->is_pressed)
+            {
+                state->is_pressed = is_pressed;
+                state->held_time = 0;
+                state->is_long_press_reported = 0;
+                push_event(i, is_pressed ? PUSH_BUTTON_EVENT_PRESS : PUSH_BUTTON_EVENT_RELEASE);
+            }
+        }
+
+        /* Report a single long-press per press of the Push Button. */
+        if (state->is_pressed && !state->is_long_press_reported)
+        {
+            state->held_time++;
+            if (state->held_time >= push_buttons_long_press_time)
+            {
+                state->is_long_press_reported = 1;
+                push_event(i, PUSH_BUTTON_EVENT_LONG_PRESS);
+            }
+        }
+    }
+}
+
+Push_Buttons_Status get_push_button_event(push_button_event_t *event)
+{
+    /** <b>Local variable tail:</b> Index from which the next event will be read. */
+    uint8_t tail = event_queue_tail;
+
+    if (tail == event_queue_head)
+    {
+        return PUSH_BUTTONS_EC_NO_DATA;
+    }
+
+    /* Make sure that the event is read only after its head has been read, and that it is fully read before freeing its slot. */
+    __DMB();
+    *event = event_queue[tail];
+    __DMB();
+    event_queue_tail = (tail + 1) & PUSH_BUTTONS_EVENT_QUEUE_MASK;
+
+    return PUSH_BUTTONS_EC_OK;
+}
+
+uint8_t is_push_button_pressed(uint8_t button)
+{
+    if (button >= total_push_buttons)
+    {
+        return 0;
+    }
+
+    return push_buttons_states[button].is_pressed;
+}
+
+uint32_t get_push_buttons_dropped_events(void)
+{
+    return dropped_events;
+}
+
+Push_Buttons_Status init_push_buttons_module(const push_button_def_t *buttons, uint8_t total_buttons, uint16_t debounce_time, uint16_t long_press_time)
+{
+    /* Validate the given parameters. */
+    if ((buttons==NULL) || (total_buttons==0) || (total_buttons>PUSH_BUTTONS_MAX_BUTTONS) || (debounce_time==0) || (debounce_time>UINT8_MAX) || (long_press_time==0))
+    {
+        return PUSH_BUTTONS_EC_ERR;
+    }
+
+    p_buttons = buttons;
+    push_buttons_debounce_time = (uint8_t) debounce_time;
+    push_buttons_long_press_time = long_press_time;
+    for (uint8_t i=0; i<total_buttons; i++)
+    {
+        push_buttons_states[i].is_edge_pending = 0;
+        push_buttons_states[i].is_pressed = 0;
+        push_buttons_states[i].quiet_time_left = push_buttons_debounce_time;
+        push_buttons_states[i].is_long_press_reported = 0;
+        push_buttons_states[i].held_time = 0;
+    }
+    event_queue_head = 0;
+    event_queue_tail = 0;
+    dropped_events = 0;
+    total_push_buttons = total_buttons;
+
+    return PUSH_BUTTONS_EC_OK;
+}
+
+static void push_event(uint8_t button, Push_Button_Event_Type type)
+{
+    /** <b>Local variable head:</b> Index at which the event will be written. */
+    uint8_t head = event_queue_head;
+    /** <b>Local variable next_head:</b> Index that the head will have once the event has been written. */
+    uint8_t next_head = (head + 1) & PUSH_BUTTONS_EVENT_QUEUE_MASK;
+
+    if (next_head == event_queue_tail)
+    {
+        dropped_events++;
+        return;
+    }
+
+    event_queue[head].button = button;
+    event_queue[head].type = type;
+    __DMB(); // This makes sure that the event is fully written before it is published via the head of the ring buffer.
+    event_queue_head = next_head;
+}
+
+/** @} */
@@ -0,0 +1,283 @@
+/** @addtogroup sensor_calibration
+ * @{
+ */
+
+#include "sensor_calibration.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include "main.h" // This is where the HAL Flash functions of our MCU/MPU are included from.
+#include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
+
+#define SENSOR_CALIBRATION_PAGE_1_START_ADDR    (SENSOR_CALIBRATION_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR)    /**< @brief Designated Flash Memory address for the start of the first page of the @ref sensor_calibration , which should be 0x0801'D800. */
+#define NO_PAGE                                 (0xFF)      /**< @brief Value of @ref current_page whenever none of the pages of the @ref sensor_calibration holds a valid record. */
+
+/**@brief	Temperature Sensors Calibration record structure. This contains all the fields that are written into one
+ *          Flash Memory page of the @ref sensor_calibration .
+ *
+ * @note	The size of this struct must be a multiple of 4 bytes (i.e., 32-bits) since the Flash Memory is written
+ *          word by word (see @ref FLASH_TYPEPROGRAM_WORD ).
+ */
+typedef struct __attribute__ ((__packed__)) __attribute__ ((aligned (4)))
+{
+	uint32_t crc32;                                                     //!< Recorded 32-bits CRC of all the other fields of this struct.
+	uint32_t sequence;                                                  //!< Number that is incremented with each new record, so that the most recent one of the two pages can be told apart.
+	sensor_calibration_table_t tables[TEMP_SENSORS_TOTAL_CHANNELS];     //!< Calibration tables, ordered as in @ref Temp_Sensor_Channel .
+} sensor_calibration_record_t;
+
+_Static_assert((sizeof(sensor_calibration_record_t) % 4) == 0, "The size of sensor_calibration_record_t must be a multiple of 4 bytes.");
+_Static_assert(sizeof(sensor_calibration_record_t) <= FLASH_PAGE_SIZE_IN_BYTES, "The size of sensor_calibration_record_t must fit in one Flash Memory page.");
+
+static sensor_calibration_record_t record;                                                          /**< @brief Copy of the calibration tables that are currently applied, together with the sequence number of the record that holds them. */
+static int32_t segment_slopes[TEMP_SENSORS_TOTAL_CHANNELS][SENSOR_CALIBRATION_MAX_POINTS];         /**< @brief Slope, in Q16 Fixed-Point, of the segment that starts at each breakpoint of each calibration table. */
+static uint8_t current_page = NO_PAGE;                                                              /**< @brief Index of the page of the @ref sensor_calibration that holds the record of @ref record , or @ref NO_PAGE if none. */
+
+/**@brief	Gets a pointer to the record that is held by a desired page of the @ref sensor_calibration .
+ *
+ * @param page	Index of the page, from 0 up to @ref SENSOR_CALIBRATION_TOTAL_PAGES minus one.
+ *
+ * @return  The pointer to the record held by that page, which may not be valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static const sensor_calibration_record_t *get_page_record(uint8_t page);
+
+/**@brief	Calculates the slopes of the segments of the calibration table of a desired Temperature Sensor.
+ *
+ * @param channel	Temperature Sensor whose calibration table has been loaded or changed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void update_segment_slopes(Temp_Sensor_Channel channel);
+
+/**@brief	Writes a new record, with its 32-bit CRC, into the page of the @ref sensor_calibration that does not hold
+ *          the current record, after having erased it.
+ *
+ * @param[in,out] p_new_record	Pointer to the new record, whose 32-bit CRC will be calculated by this function.
+ *
+ * @retval  SENSOR_CALIBRATION_EC_OK
+ * @retval  SENSOR_CALIBRATION_EC_NR
+ * @retval  SENSOR_CALIBRATION_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static Sensor_Calibration_Status write_record(sensor_calibration_record_t *p_new_record);
+
+/**@brief	Gets the corresponding @ref Sensor_Calibration_Status value depending on the given @ref HAL_StatusTypeDef
+ *          value.
+ *
+ * @param HAL_status	HAL Status value that wants to be converted.
+ *
+ * @retval  SENSOR_CALIBRATION_EC_NR if \p HAL_status param equals \c HAL_BUSY or \c HAL_TIMEOUT .
+ * @retval  SENSOR_CALIBRATION_EC_ERR if \p HAL_status param equals \c HAL_ERROR .
+ * @retval  SENSOR_CALIBRATION_EC_OK otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static Sensor_Calibration_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
+
+int32_t apply_sensor_calibration(Temp_Sensor_Channel channel, int32_t measured)
+{
+    /** <b>Local pointer p_table:</b> Pointer to the calibration table of the requested Temperature Sensor. */
+    const sensor_calibration_table_t *p_table;
+    /** <b>Local variable segment:</b> Index of the breakpoint at which the segment that is used for the interpolation starts. */
+    uint8_t segment = 0;
+
+    if (channel >= TEMP_SENSORS_TOTAL_CHANNELS)
+    {
+        return measured;
+    }
+    p_table = &record.tables[channel];
+
+    switch (p_table->total_points)
+    {
+        case 0:
+            return measured;
+        case 1:
+            return measured + p_table->points[0].actual - p_table->points[0].measured;
+        default:
+            /* Find the segment that contains the measured Temperature, or the first or last one if it lies outside of the table. */
+            while ((segment < (p_table->total_points-2)) && (measured >= p_table->points[segment+1].measured))
+            {
+                segment++;
+            }
+            return p_table->points[segment].actual +
+                   (int32_t) ((((int64_t) (measured - p_table->points[segment].measured))*segment_slopes[channel][segment] + (1L << 15)) >> 16);
+    }
+}
+
+Sensor_Calibration_Status get_sensor_calibration(Temp_Sensor_Channel channel, sensor_calibration_table_t *table)
+{
+    if (channel >= TEMP_SENSORS_TOTAL_CHANNELS)
+    {
+        return SENSOR_CALIBRATION_EC_ERR;
+    }
+
+    memcpy(table, &record.tables[channel], sizeof(sensor_calibration_table_t));
+    return SENSOR_CALIBRATION_EC_OK;
+}
+
+Sensor_Calibration_Status set_sensor_calibration(Temp_Sensor_Channel channel, const sensor_calibration_table_t *table)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref Sensor_Calibration_Status function. */
+    Sensor_Calibration_Status ret;
+    /** <b>Local variable new_record:</b> Record that holds the new calibration table together with the current ones of the other Temperature Sensors. */
+    sensor_calibration_record_t new_record;
+
+    /* Validate the given parameters, including that the measured Temperatures of the breakpoints are strictly increasing. */
+    if ((channel >= TEMP_SENSORS_TOTAL_CHANNELS) || (table->total_points > SENSOR_CALIBRATION_MAX_POINTS))
+    {
+        return SENSOR_CALIBRATION_EC_ERR;
+    }
+    for (uint8_t i=1; i<table->total_points; i++)
+    {
+        if (table->points[i].measured <= table->points[i-1].measured)
+        {
+            return SENSOR_CALIBRATION_EC_ERR;
+        }
+    }
+
+    /* Build the new record, keeping the unused breakpoints and padding of the new table at zero so that the record of equal tables is always the same. */
+    memcpy(&new_record, &record, sizeof(sensor_calibration_record_t));
+    memset(&new_record.tables[channel], 0, sizeof(sensor_calibration_table_t));
+    new_record.tables[channel].total_points = table->total_points;
+    memcpy(new_record.tables[channel].points, table->points, table->total_points*sizeof(sensor_calibration_point_t));
+    new_record.sequence++;
+
+    /* Persist the new record and only then apply it, so that the applied calibration tables are always the persisted ones. */
+    ret = write_record(&new_record);
+    if (ret != SENSOR_CALIBRATION_EC_OK)
+    {
+        return ret;
+    }
+    memcpy(&record, &new_record, sizeof(sensor_calibration_record_t));
+    update_segment_slopes(channel);
+
+    return SENSOR_CALIBRATION_EC_OK;
+}
+
+Sensor_Calibration_Status init_sensor_calibration_module(void)
+{
+    /** <b>Local pointer p_page_record:</b> Pointer to the record held by the page that is being inspected. */
+    const sensor_calibration_record_t *p_page_record;
+
+    /* Look for the most recent record whose 32-bit CRC is valid. */
+    current_page = NO_PAGE;
+    for (uint8_t page=0; page<SENSOR_CALIBRATION_TOTAL_PAGES; page++)
+    {
+        p_page_record = get_page_record(page);
+        if ((crc32_mpeg2((uint8_t *) &p_page_record->sequence, sizeof(sensor_calibration_record_t) - sizeof(uint32_t)) == p_page_record->crc32) &&
+            ((current_page == NO_PAGE) || ((int32_t) (p_page_record->sequence - get_page_record(current_page)->sequence) > 0)))
+        {
+            current_page = page;
+        }
+    }
+
+    /* Load the calibration tables of that record, or leave all the Temperature Sensors uncalibrated if there is none. */
+    if (current_page == NO_PAGE)
+    {
+        memset(&record, 0, sizeof(sensor_calibration_record_t));
+    }
+    else
+    {
+        memcpy(&record, get_page_record(current_page), sizeof(sensor_calibration_record_t));
+    }
+    for (uint8_t channel=0; channel<TEMP_SENSORS_TOTAL_CHANNELS; channel++)
+    {
+        if (record.tables[channel].total_points > SENSOR_CALIBRATION_MAX_POINTS)
+        {
+            record.tables[channel].total_points = 0;
+        }
+        update_segment_slopes((Temp_Sensor_Channel) channel);
+    }
+
+    return (current_page == NO_PAGE) ? SENSOR_CALIBRATION_EC_NO_DATA : SENSOR_CALIBRATION_EC_OK;
+}
+
+static const sensor_calibration_record_t *get_page_record(uint8_t page)
+{
+    return (const sensor_calibration_record_t *) (SENSOR_CALIBRATION_PAGE_1_START_ADDR + page*FLASH_PAGE_SIZE_IN_BYTES);
+}
+
+static void update_segment_slopes(Temp_Sensor_Channel channel)
+{
+    /** <b>Local pointer p_table:</b> Pointer to the calibration table whose slopes are calculated. */
+    const sensor_calibration_table_t *p_table = &record.tables[channel];
+
+    for (uint8_t i=0; (i+1)<p_table->total_points; i++)
+    {
+        segment_slopes[channel][i] = (int32_t) ((((int64_t) (p_table->points[i+1].actual - p_table->points[i].actual)) << 16) /
+                                                (p_table->points[i+1].measured - p_table->points[i].measured));
+    }
+}
+
+static Sensor_Calibration_Status write_record(sensor_calibration_record_t *p_new_record)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref Sensor_Calibration_Status function. */
+    Sensor_Calibration_Status ret;
+    /** <b>Local variable erase_init:</b> Erase request given to the HAL Flash driver. */
+    FLASH_EraseInitTypeDef erase_init;
+    /** <b>Local variable page_error:</b> Address of the Flash Memory page that could not be erased, if any. */
+    uint32_t page_error;
+    /** <b>Local variable next_page:</b> Index of the page into which the record is written. */
+    uint8_t next_page = (current_page == 0) ? 1 : 0;
+    /** <b>Local variable page_start_addr:</b> Flash Memory start address of the page into which the record is written. */
+    uint32_t page_start_addr = (uint32_t) get_page_record(next_page);
+    /** <b>Local pointer p_record_in_words:</b> Pointer to the new record but in \c uint32_t Type. */
+    uint32_t *p_record_in_words = (uint32_t *) p_new_record;
+
+    p_new_record->crc32 = crc32_mpeg2((uint8_t *) &p_new_record->sequence, sizeof(sensor_calibration_record_t) - sizeof(uint32_t));
+
+    ret = HAL_ret_handler(HAL_FLASH_Unlock());
+    if (ret != SENSOR_CALIBRATION_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Erase the page that does not hold the current record and then write the new record into it word by word. */
+    erase_init.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase_init.Banks = FLASH_BANK_1;
+    erase_init.PageAddress = page_start_addr;
+    erase_init.NbPages = 1;
+    ret = HAL_ret_handler(HAL_FLASHEx_Erase(&erase_init, &page_error));
+    if (ret != SENSOR_CALIBRATION_EC_OK)
+    {
+        HAL_FLASH_Lock();
+        return ret;
+    }
+    for (uint8_t words_written=0; words_written<(sizeof(sensor_calibration_record_t)/4); words_written++)
+    {
+        ret = HAL_ret_handler(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, page_start_addr + words_written*4, p_record_in_words[words_written]));
+        if (ret != SENSOR_CALIBRATION_EC_OK)
+        {
+            HAL_FLASH_Lock();
+            return ret;
+        }
+    }
+    ret = HAL_ret_handler(HAL_FLASH_Lock());
+    if (ret != SENSOR_CALIBRATION_EC_OK)
+    {
+        return ret;
+    }
+    current_page = next_page;
+
+    return SENSOR_CALIBRATION_EC_OK;
+}
+
+static Sensor_Calibration_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
+{
+    switch (HAL_status)
+    {
+        case HAL_BUSY:
+        case HAL_TIMEOUT:
+            return SENSOR_CALIBRATION_EC_NR;
+        case HAL_ERROR:
+            return SENSOR_CALIBRATION_EC_ERR;
+        default:
+            return SENSOR_CALIBRATION_EC_OK;
+    }
+}
+
+/** @} */
@@ -0,0 +1,122 @@
+/** @addtogroup sensor_diagnostics
+ * @{
+ */
+
+#include "sensor_diagnostics.h"
+
+#define FAILING_CHECKS      (SENSOR_DIAGNOSTICS_RANGE_CHECK | SENSOR_DIAGNOSTICS_STUCK_CHECK)  /**< @brief Checks whose failure makes a sensor @ref SENSOR_FAILED right away. */
+
+Sensor_Validity run_sensor_diagnostics(sensor_diagnostics_t *diagnostics, int32_t reading, uint8_t is_inconsistent, uint32_t tick)
+{
+    /** <b>Local variable failed_checks:</b> Bitmask of the checks that fail with the given reading. */
+    uint8_t failed_checks = 0;
+    /** <b>Local variable change:</b> Absolute change of the given reading with respect to the previous one. */
+    uint32_t change;
+    /** <b>Local variable elapsed_time:</b> Time in milliseconds since the previous reading. */
+    uint32_t elapsed_time;
+
+    /* Range check. */
+    if ((reading < diagnostics->config.min_value) || (reading > diagnostics->config.max_value))
+    {
+        failed_checks |= SENSOR_DIAGNOSTICS_RANGE_CHECK;
+    }
+
+    if (diagnostics->has_previous_reading)
+    {
+        /* Stuck check, where any change at all restarts the time during which the readings are considered unchanged. */
+        if (reading != diagnostics->previous_reading)
+        {
+            diagnostics->unchanged_since_tick = tick;
+        }
+        else if ((diagnostics->config.stuck_time != 0) && ((tick - diagnostics->unchanged_since_tick) >= diagnostics->config.stuck_time))
+        {
+            failed_checks |= SENSOR_DIAGNOSTICS_STUCK_CHECK;
+        }
+
+        /* Rate check, where the change is compared in milli-units so that no division is needed. */
+        // NOTE: Both sides fit in 32 bits as long as the range of the sensor is narrower than 4'294'967 units and its readings are given at least once every 4'294'967 milliseconds.
+        change = (reading > diagnostics->previous_reading) ? (uint32_t) (reading - diagnostics->previous_reading) : (uint32_t) (diagnostics->previous_reading - reading);
+        elapsed_time = tick - diagnostics->previous_tick;
+        if ((diagnostics->config.max_rate != 0) && (elapsed_time != 0) && ((change*1000) > (diagnostics->config.max_rate*elapsed_time)))
+        {
+            failed_checks |= SENSOR_DIAGNOSTICS_RATE_CHECK;
+        }
+    }
+    else
+    {
+        diagnostics->unchanged_since_tick = tick;
+        diagnostics->has_previous_reading = 1;
+    }
+    diagnostics->previous_reading = reading;
+    diagnostics->previous_tick = tick;
+
+    /* Cross check, which is made by the implementer. */
+    if (is_inconsistent)
+    {
+        failed_checks |= SENSOR_DIAGNOSTICS_CROSS_CHECK;
+    }
+    diagnostics->failed_checks = failed_checks;
+
+    /* Update the validity of the sensor with the checks that have failed. */
+    if (failed_checks != 0)
+    {
+        if (diagnostics->validity == SENSOR_VALID)
+        {
+            diagnostics->suspect_since_tick = tick;
+        }
+        diagnostics->last_failed_check_tick = tick;
+        if ((failed_checks & FAILING_CHECKS) || ((tick - diagnostics->suspect_since_tick) >= diagnostics->config.fail_time))
+        {
+            diagnostics->validity = SENSOR_FAILED;
+        }
+        else
+        {
+            diagnostics->validity = SENSOR_SUSPECT;
+        }
+    }
+    else if (diagnostics->validity != SENSOR_VALID)
+    {
+        if ((tick - diagnostics->last_failed_check_tick) >= diagnostics->config.settle_time)
+        {
+            diagnostics->validity = SENSOR_VALID;
+        }
+        else
+        {
+            diagnostics->validity = SENSOR_SUSPECT;
+        }
+    }
+
+    return diagnostics->validity;
+}
+
+Sensor_Validity get_sensor_diagnostics_validity(const sensor_diagnostics_t *diagnostics)
+{
+    return diagnostics->validity;
+}
+
+uint8_t get_sensor_diagnostics_failed_checks(const sensor_diagnostics_t *diagnostics)
+{
+    return diagnostics->failed_checks;
+}
+
+Sensor_Diagnostics_Status init_sensor_diagnostics(sensor_diagnostics_t *diagnostics, const sensor_diagnostics_config_t *config)
+{
+    if ((config->min_value >= config->max_value) || (config->fail_time <= config->settle_time))
+    {
+        return SENSOR_DIAGNOSTICS_EC_ERR;
+    }
+
+    diagnostics->config = *config;
+    diagnostics->validity = SENSOR_VALID;
+    diagnostics->failed_checks = 0;
+    diagnostics->has_previous_reading = 0;
+    diagnostics->previous_reading = 0;
+    diagnostics->previous_tick = 0;
+    diagnostics->unchanged_since_tick = 0;
+    diagnostics->suspect_since_tick = 0;
+    diagnostics->last_failed_check_tick = 0;
+
+    return SENSOR_DIAGNOSTICS_EC_OK;
+}
+
+/** @} */
@@ -0,0 +1,106 @@
+/** @addtogroup sensor_filter
+ * @{
+ */
+
+#include "sensor_filter.h"
+
+#define SENSOR_FILTER_TWO_PI_TIMES_1000     (6283)     /**< @brief \f$2 \pi\f$ constant multiplied by 1000 so that it can be used with cut-off frequencies given in millihertz. */
+
+/**@brief   Gets the median of the samples that are currently in the window of the Median filter of a certain filter.
+ *
+ * @details The samples are copied and sorted via Insertion Sort, which takes a constant and small time for the
+ *          window sizes that are allowed by @ref SENSOR_FILTER_MAX_MEDIAN_WINDOW .
+ *
+ * @param[in] filter    Pointer to the filter whose median wants to be obtained.
+ *
+ * @return  The median of the samples that are currently in the window of the \p filter param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint16_t get_median(const sensor_filter_t *filter);
+
+uint16_t run_sensor_filter(sensor_filter_t *filter, uint16_t sample)
+{
+    /** <b>Local variable median:</b> Output of the Median filter. */
+    uint16_t median;
+
+    /* Initialize the whole state of the filter with the very first sample that it receives. */
+    if (!filter->is_primed)
+    {
+        for (uint8_t i=0; i<filter->window_size; i++)
+        {
+            filter->window[i] = sample;
+        }
+        filter->output = ((int32_t) sample) << 8;
+        filter->is_primed = 1;
+    }
+
+    /* Pass the sample through the Median filter. */
+    filter->window[filter->window_index] = sample;
+    filter->window_index++;
+    if (filter->window_index >= filter->window_size)
+    {
+        filter->window_index = 0;
+    }
+    median = get_median(filter);
+
+    /* Pass the output of the Median filter through the IIR Low-Pass filter. */
+    filter->output += (int32_t) (((int64_t) ((((int32_t) median) << 8) - filter->output) * filter->alpha) >> 15);
+
+    return (uint16_t) ((filter->output + (1 << 7)) >> 8);
+}
+
+static uint16_t get_median(const sensor_filter_t *filter)
+{
+    /** <b>Local variable sorted:</b> Copy of the window of the Median filter, sorted in ascending order. */
+    uint16_t sorted[SENSOR_FILTER_MAX_MEDIAN_WINDOW];
+    /** <b>Local variable key:</b> Sample that is being inserted in its sorted position. */
+    uint16_t key;
+    /** <b>Local variable j:</b> Index used to find the sorted position of @ref key . */
+    int8_t j;
+
+    for (uint8_t i=0; i<filter->window_size; i++)
+    {
+        key = filter->window[i];
+        for (j=i-1; (j>=0) && (sorted[j]>key); j--)
+        {
+            sorted[j+1] = sorted[j];
+        }
+        sorted[j+1] = key;
+    }
+
+    return sorted[filter->window_size/2];
+}
+
+Sensor_Filter_Status init_sensor_filter(sensor_filter_t *filter, const sensor_filter_config_t *config)
+{
+    /** <b>Local variable omega:</b> Cut-off angular frequency multiplied by 1000 (i.e., in milliradians per second). */
+    uint64_t omega;
+
+    /* Validate the given configuration. */
+    if ((config->median_window==0) || ((config->median_window%2)==0) || (config->median_window>SENSOR_FILTER_MAX_MEDIAN_WINDOW) || (config->sample_rate==0))
+    {
+        return SENSOR_FILTER_EC_ERR;
+    }
+
+    /* Calculate the coefficient of the IIR Low-Pass filter, where a coefficient of 1 (i.e., 32768 in Q15) leaves the samples unchanged. */
+    if (config->cutoff_frequency == 0)
+    {
+        filter->alpha = 1 << 15;
+    }
+    else
+    {
+        omega = ((uint64_t) SENSOR_FILTER_TWO_PI_TIMES_1000 * config->cutoff_frequency) / 1000;
+        filter->alpha = (uint16_t) ((omega << 15) / (omega + ((uint64_t) config->sample_rate*1000)));
+    }
+
+    filter->window_size = config->median_window;
+    filter->window_index = 0;
+    filter->is_primed = 0;
+    filter->output = 0;
+
+    return SENSOR_FILTER_EC_OK;
+}
+
+/** @} */
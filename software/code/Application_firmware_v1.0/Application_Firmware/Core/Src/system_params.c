@@ -0,0 +1,396 @@
+/** @addtogroup system_params
+ * @{
+ */
+
+#include "system_params.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include "main.h" // This is where the HAL Flash functions of our MCU/MPU are included from.
+#include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
+
+#define SYSTEM_PARAMS_PAGE_1_START_ADDR     (SYSTEM_PARAMS_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR)  /**< @brief Designated Flash Memory address for the start of the System Parameters page 1, which should be 0x0801'F000. */
+#define SYSTEM_PARAMS_PAGE_2_START_ADDR     (SYSTEM_PARAMS_PAGE_1_START_ADDR + SYSTEM_PARAMS_PAGE_SIZE)             /**< @brief Designated Flash Memory address for the start of the System Parameters page 2, which should be 0x0801'F800. */
+#define SYSTEM_PARAMS_END_ADDR_PLUS_ONE     (SYSTEM_PARAMS_PAGE_2_START_ADDR + SYSTEM_PARAMS_PAGE_SIZE)             /**< @brief Flash Memory address right after the last one designated for the @ref system_params , which should be 0x0802'0000. */
+#define FLASH_BLOCK_NOT_ERASED              (0x00)      /**< @brief Designated value to indicate that a System Parameters Data Block has been written via @ref system_params_flags_t::is_erased . */
+#define FLASH_BLOCK_ERASED                  (0xFF)      /**< @brief Designated value to indicate that a System Parameters Data Block has not been written since its last erase via @ref system_params_flags_t::is_erased . */
+
+/**@brief	MTKATR001 System Parameters Flags structure. This contains all the fields needed for the flags used by the
+ *          MTKATR001 System Parameters Data Blocks (i.e., @ref system_params_block_t ).
+ */
+typedef struct
+{
+	uint16_t reserved2;			//!< 16-bits reserved for future possible uses for the @ref system_params .
+	uint8_t reserved1;			//!< 8-bits reserved for future possible uses for the @ref system_params .
+	uint8_t is_erased;			//!< Flag to indicate whether a Data Block has been written or not. @details 0x00 = Written<br> 0xFF = Erased
+} system_params_flags_t;
+
+/**@brief	MTKATR001 System Parameters Data Blocks structure. This contains all the fields needed to write/read/erase
+ *          the Data Blocks of the @ref system_params .
+ *
+ * @note	The size of this struct must be a multiple of 4 bytes (i.e., 32-bits) since the Flash Memory is written
+ *          word by word (see @ref FLASH_TYPEPROGRAM_WORD ).
+ */
+typedef struct __attribute__ ((__packed__)) __attribute__ ((aligned (4)))
+{
+	uint32_t crc32;							//!< Recorded 32-bits CRC of all the other fields of this struct.
+	system_params_data_t data;				//!< Block data, which is where the actual MTKATR001 System Parameters are stored.
+	system_params_flags_t flags;			//!< MTKATR001 System Parameters Flags.
+} system_params_block_t;
+
+_Static_assert(sizeof(system_params_block_t) == SYSTEM_PARAMS_BLOCK_SIZE, "The size of system_params_block_t must be equal to SYSTEM_PARAMS_BLOCK_SIZE.");
+_Static_assert((SYSTEM_PARAMS_PAGE_SIZE % SYSTEM_PARAMS_BLOCK_SIZE) == 0, "SYSTEM_PARAMS_PAGE_SIZE must be divisible by SYSTEM_PARAMS_BLOCK_SIZE.");
+
+static system_params_block_t *p_most_recent_block = NULL;   /**< @brief Pointer to the Data Block of the @ref system_params that contains the most recently written MTKATR001 System Parameters. @details If this pointer is \c NULL , then there is currently no data in the @ref system_params . */
+
+/**@brief	Erases a desired page of the @ref system_params .
+ *
+ * @param page_start_addr	Flash Memory start address of the System Parameters Page that is desired to be erased.
+ *
+ * @retval  SYSTEM_PARAMS_EC_OK
+ * @retval  SYSTEM_PARAMS_EC_NR
+ * @retval  SYSTEM_PARAMS_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static System_Params_Status page_erase(uint32_t page_start_addr);
+
+/**@brief	Indicates whether all the words of a Data Block of the @ref system_params are erased or not.
+ *
+ * @param[in] p_block	Pointer to the Data Block.
+ *
+ * @return  1 if all the words of the Data Block read 0xFFFFFFFF, or 0 otherwise (e.g., if it was only partially
+ *          written because our MCU/MPU was reset in the middle of a write).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint8_t is_block_erased(const system_params_block_t *p_block);
+
+/**@brief	Indicates whether a Data Block of the @ref system_params was completely written and matches its 32-bit CRC.
+ *
+ * @param[in] p_block	Pointer to the Data Block.
+ *
+ * @return  1 if the Data Block is valid, or 0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint8_t is_block_valid(const system_params_block_t *p_block);
+
+/**@brief	Counts the Data Blocks that have been written into a System Parameters Page since it was lastly erased,
+ *          including the ones that were only partially written.
+ *
+ * @details Since the Data Blocks of a System Parameters Page are always written from its start and one after the
+ *          other, the written ones are a prefix of that page and, therefore, they are counted with a binary search.
+ *
+ * @param[in] p_page_start	Pointer to the first Data Block of the System Parameters Page.
+ *
+ * @return  The number of written Data Blocks, from 0 up to @ref SYSTEM_PARAMS_BLOCKS_PER_PAGE .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint16_t count_written_blocks(const system_params_block_t *p_page_start);
+
+/**@brief	Looks for the most recently written Data Block of a System Parameters Page that is valid (see
+ *          @ref is_block_valid ), starting from a desired number of written Data Blocks and going backwards.
+ *
+ * @param[in] p_page_start	Pointer to the first Data Block of the System Parameters Page.
+ * @param written_blocks	Number of written Data Blocks of that page (see @ref count_written_blocks ).
+ *
+ * @return  The pointer to that Data Block, or \c NULL if none of the written Data Blocks of that page is valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static system_params_block_t *find_most_recent_valid_block(system_params_block_t *p_page_start, uint16_t written_blocks);
+
+/**@brief	Identifies if there is a System Parameters Page that is currently full of data while the other one has
+ *          already started to be written, in which case the full one is erased. Otherwise, this function does nothing.
+ *
+ * @retval  SYSTEM_PARAMS_EC_OK
+ * @retval  SYSTEM_PARAMS_EC_NR
+ * @retval  SYSTEM_PARAMS_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static System_Params_Status prep_page_swap(void);
+
+/**@brief	Gets the corresponding @ref System_Params_Status value depending on the given @ref HAL_StatusTypeDef value.
+ *
+ * @param HAL_status	HAL Status value that wants to be converted.
+ *
+ * @retval  SYSTEM_PARAMS_EC_NR if \p HAL_status param equals \c HAL_BUSY or \c HAL_TIMEOUT .
+ * @retval  SYSTEM_PARAMS_EC_ERR if \p HAL_status param equals \c HAL_ERROR .
+ * @retval  SYSTEM_PARAMS_EC_OK otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static System_Params_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
+
+System_Params_Status read_system_params(system_params_data_t *p_data)
+{
+    if (p_most_recent_block == NULL)
+    {
+        memset(p_data, 0xFF, sizeof(system_params_data_t));
+        return SYSTEM_PARAMS_EC_NO_DATA;
+    }
+
+    memcpy(p_data, &p_most_recent_block->data, sizeof(system_params_data_t));
+    return SYSTEM_PARAMS_EC_OK;
+}
+
+System_Params_Status write_system_params(const system_params_data_t *p_data)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref System_Params_Status function. */
+    System_Params_Status ret;
+    /** <b>Local variable new_block:</b> New Data Block into which the data that wants to be written is passed, together with its flags and 32-bit CRC. */
+    system_params_block_t new_block;
+    /** <b>Local pointer p_new_block_in_words:</b> Pointer to the \c new_block data but in \c uint32_t Type. */
+    uint32_t *p_new_block_in_words = (uint32_t *) &new_block;
+    /** <b>Local pointer p_next_block:</b> Pointer to the next available Data Block of the @ref system_params . */
+    system_params_block_t *p_next_block = (system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR;
+
+    /* Avoid wearing out the Flash Memory if the data that wants to be written is already the most recent one. */
+    if ((p_most_recent_block != NULL) && (memcmp(&p_most_recent_block->data, p_data, sizeof(system_params_data_t)) == 0))
+    {
+        return SYSTEM_PARAMS_EC_OK;
+    }
+
+    /* Pass the received data into a new Data Block and calculate its 32-bit CRC. */
+    memcpy(&new_block.data, p_data, sizeof(system_params_data_t));
+    new_block.flags.reserved2 = 0xFFFF; // Make sure to keep reserved data's bits set to 1's.
+    new_block.flags.reserved1 = 0xFF; // Make sure to keep reserved data's bits set to 1's.
+    new_block.flags.is_erased = FLASH_BLOCK_NOT_ERASED;
+    new_block.crc32 = crc32_mpeg2((uint8_t *) &new_block.data, sizeof(system_params_block_t) - sizeof(uint32_t));
+
+    /* Calculate the next available Data Block. */
+    if (p_most_recent_block != NULL)
+    {
+        p_next_block = p_most_recent_block + 1;
+        if (p_next_block == (system_params_block_t *) SYSTEM_PARAMS_END_ADDR_PLUS_ONE)
+        {
+            p_next_block = (system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR;
+        }
+    }
+
+    /* Skip the Data Blocks that cannot be programmed again until their page is erased (e.g., the ones that were left partially written by a reset or a failed write). */
+    // NOTE: If the start of a page is not erased, then that page does not hold the most recently written Data Block, since the writes would have already gone through it, and, therefore, it is erased.
+    while (!is_block_erased(p_next_block))
+    {
+        if ((p_next_block == (system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR) || (p_next_block == (system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR))
+        {
+            ret = page_erase((uint32_t) p_next_block);
+            if (ret != SYSTEM_PARAMS_EC_OK)
+            {
+                return ret;
+            }
+            if (!is_block_erased(p_next_block))
+            {
+                return SYSTEM_PARAMS_EC_ERR;
+            }
+            break;
+        }
+        p_next_block++;
+        if (p_next_block == (system_params_block_t *) SYSTEM_PARAMS_END_ADDR_PLUS_ONE)
+        {
+            p_next_block = (system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR;
+        }
+    }
+
+    /* Write the new Data Block into the Flash Memory word by word. */
+    ret = HAL_ret_handler(HAL_FLASH_Unlock());
+    if (ret != SYSTEM_PARAMS_EC_OK)
+    {
+        return ret;
+    }
+    for (uint8_t words_written=0; words_written<(sizeof(system_params_block_t)/4); words_written++)
+    {
+        ret = HAL_ret_handler(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, (uint32_t) (((uint32_t *) p_next_block) + words_written), p_new_block_in_words[words_written]));
+        if (ret != SYSTEM_PARAMS_EC_OK)
+        {
+            HAL_FLASH_Lock();
+            return ret;
+        }
+    }
+    ret = HAL_ret_handler(HAL_FLASH_Lock());
+    if (ret != SYSTEM_PARAMS_EC_OK)
+    {
+        return ret;
+    }
+    p_most_recent_block = p_next_block;
+
+    /* If one of the System Parameters Pages is full, then erase it. */
+    return prep_page_swap();
+}
+
+System_Params_Status init_system_params_module(void)
+{
+    /** <b>Local variable page_1_blocks:</b> Number of written Data Blocks in the System Parameters Page 1. */
+    uint16_t page_1_blocks = count_written_blocks((system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR);
+    /** <b>Local variable page_2_blocks:</b> Number of written Data Blocks in the System Parameters Page 2. */
+    uint16_t page_2_blocks = count_written_blocks((system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR);
+
+    /* The most recent Data Block is the last valid one of the page 1 unless that page is full, in which case it is the last valid one of the page 2, and, if there is none, then it is the last valid one of the other page. */
+    // NOTE: If the writes have wrapped around into a partially written page 1, then the page 2 is the full one whose erase is still pending and, therefore, it only holds older Data Blocks.
+    if ((page_1_blocks == SYSTEM_PARAMS_BLOCKS_PER_PAGE) || (page_1_blocks == 0))
+    {
+        p_most_recent_block = find_most_recent_valid_block((system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR, page_2_blocks);
+        if (p_most_recent_block == NULL)
+        {
+            p_most_recent_block = find_most_recent_valid_block((system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR, page_1_blocks);
+        }
+    }
+    else
+    {
+        p_most_recent_block = find_most_recent_valid_block((system_params_block_t *) SYSTEM_PARAMS_PAGE_1_START_ADDR, page_1_blocks);
+        if (p_most_recent_block == NULL)
+        {
+            p_most_recent_block = find_most_recent_valid_block((system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR, page_2_blocks);
+        }
+    }
+
+    /* If no written Data Block is valid, then leave the @ref system_params without data. */
+    if ((p_most_recent_block == NULL) && ((page_1_blocks > 0) || (page_2_blocks > 0)))
+    {
+        if ((page_erase(SYSTEM_PARAMS_PAGE_1_START_ADDR) != SYSTEM_PARAMS_EC_OK) || (page_erase(SYSTEM_PARAMS_PAGE_2_START_ADDR) != SYSTEM_PARAMS_EC_OK))
+        {
+            return SYSTEM_PARAMS_EC_CRPT;
+        }
+        return SYSTEM_PARAMS_EC_OK;
+    }
+
+    /* If one of the System Parameters Pages is full, then erase it. */
+    return prep_page_swap();
+}
+
+static System_Params_Status prep_page_swap(void)
+{
+    /* Erase the page 2 if it is full while the writes are already in the page 1, or erase the page 1 if it is full while the writes are already in the page 2. */
+    // NOTE: Looking at the last Data Block of each page, instead of only at the moment in which the writes move into the other page, also erases a full page that was left unerased because our MCU/MPU was reset right after moving into the other page.
+    if (p_most_recent_block == NULL)
+    {
+        return SYSTEM_PARAMS_EC_OK;
+    }
+    if ((p_most_recent_block < (system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR) &&
+        !is_block_erased(((system_params_block_t *) SYSTEM_PARAMS_END_ADDR_PLUS_ONE) - 1))
+    {
+        return page_erase(SYSTEM_PARAMS_PAGE_2_START_ADDR);
+    }
+    if ((p_most_recent_block >= (system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR) &&
+        !is_block_erased(((system_params_block_t *) SYSTEM_PARAMS_PAGE_2_START_ADDR) - 1))
+    {
+        return page_erase(SYSTEM_PARAMS_PAGE_1_START_ADDR);
+    }
+
+    return SYSTEM_PARAMS_EC_OK;
+}
+
+static uint16_t count_written_blocks(const system_params_block_t *p_page_start)
+{
+    /** <b>Local variable low:</b> Number of Data Blocks that are known to be written. */
+    uint16_t low = 0;
+    /** <b>Local variable high:</b> Number of Data Blocks after which all of them are known to be erased. */
+    uint16_t high = SYSTEM_PARAMS_BLOCKS_PER_PAGE;
+    /** <b>Local variable middle:</b> Index of the Data Block that is being inspected. */
+    uint16_t middle;
+
+    while (low < high)
+    {
+        middle = (low + high) / 2;
+        if (!is_block_erased(&p_page_start[middle]))
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static uint8_t is_block_erased(const system_params_block_t *p_block)
+{
+    /** <b>Local pointer p_block_in_words:</b> Pointer to the Data Block but in \c uint32_t Type. */
+    const uint32_t *p_block_in_words = (const uint32_t *) p_block;
+
+    for (uint8_t word=0; word<(sizeof(system_params_block_t)/4); word++)
+    {
+        if (p_block_in_words[word] != 0xFFFFFFFF)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static uint8_t is_block_valid(const system_params_block_t *p_block)
+{
+    return (p_block->flags.is_erased == FLASH_BLOCK_NOT_ERASED) &&
+           (crc32_mpeg2((uint8_t *) &p_block->data, sizeof(system_params_block_t) - sizeof(uint32_t)) == p_block->crc32);
+}
+
+static system_params_block_t *find_most_recent_valid_block(system_params_block_t *p_page_start, uint16_t written_blocks)
+{
+    while (written_blocks > 0)
+    {
+        written_blocks--;
+        if (is_block_valid(&p_page_start[written_blocks]))
+        {
+            return &p_page_start[written_blocks];
+        }
+    }
+
+    return NULL;
+}
+
+static System_Params_Status page_erase(uint32_t page_start_addr)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref System_Params_Status function. */
+    System_Params_Status ret;
+    /** <b>Local variable erase_init:</b> Erase request given to the HAL Flash driver. */
+    FLASH_EraseInitTypeDef erase_init;
+    /** <b>Local variable page_error:</b> Address of the Flash Memory page that could not be erased, if any. */
+    uint32_t page_error;
+
+    ret = HAL_ret_handler(HAL_FLASH_Unlock());
+    if (ret != SYSTEM_PARAMS_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Erase all the Flash Memory pages that make up the requested System Parameters Page. */
+    erase_init.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase_init.Banks = FLASH_BANK_1;
+    erase_init.PageAddress = page_start_addr;
+    erase_init.NbPages = SYSTEM_PARAMS_PAGE_SIZE/FLASH_PAGE_SIZE_IN_BYTES;
+    ret = HAL_ret_handler(HAL_FLASHEx_Erase(&erase_init, &page_error));
+    if (ret != SYSTEM_PARAMS_EC_OK)
+    {
+        HAL_FLASH_Lock();
+        return ret;
+    }
+
+    return HAL_ret_handler(HAL_FLASH_Lock());
+}
+
+static System_Params_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
+{
+    switch (HAL_status)
+    {
+        case HAL_BUSY:
+        case HAL_TIMEOUT:
+            return SYSTEM_PARAMS_EC_NR;
+        case HAL_ERROR:
+            return SYSTEM_PARAMS_EC_ERR;
+        default:
+            return SYSTEM_PARAMS_EC_OK;
+    }
+}
+
+/** @} */
@@ -0,0 +1,125 @@
+/** @addtogroup task_scheduler
+ * @{
+ */
+
+#include "task_scheduler.h"
+
+static task_scheduler_task_t *p_tasks = NULL;     /**< @brief Pointer to the array of tasks that are managed by the @ref task_scheduler . @details This pointer's value is defined in the @ref init_task_scheduler_module function. */
+static uint8_t total_tasks = 0;                   /**< @brief Number of tasks contained in the array pointed by @ref p_tasks . @details This variable's value is defined in the @ref init_task_scheduler_module function. */
+
+/**@brief   Indicates whether a certain HAL Tick has already been reached or not.
+ *
+ * @details This comparison is made via a signed difference so that it keeps working as expected whenever the HAL Tick
+ *          overflows (i.e., approximately each 49.7 days).
+ *
+ * @param current_tick  Current HAL Tick.
+ * @param target_tick   HAL Tick that wants to be evaluated.
+ *
+ * @retval  1   If the \p target_tick param has already been reached.
+ * @retval  0   If the \p target_tick param has not been reached yet.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static inline uint8_t is_tick_reached(uint32_t current_tick, uint32_t target_tick);
+
+Task_Scheduler_Status run_task_scheduler(void)
+{
+    /** <b>Local variable current_tick:</b> Current HAL Tick in our MCU/MPU. */
+    uint32_t current_tick;
+    /** <b>Local variable release_tick:</b> HAL Tick at which the task that is to be executed was released. */
+    uint32_t release_tick;
+    /** <b>Local variable start_tick:</b> HAL Tick at which the task that is to be executed started its execution. */
+    uint32_t start_tick;
+    /** <b>Local variable execution_time:</b> Time in milliseconds that the executed task took to finish. */
+    uint32_t execution_time;
+    /** <b>Local variable skipped_releases:</b> Number of releases of the executed task that have already been missed. */
+    uint32_t skipped_releases;
+    /** <b>Local variable task:</b> Pointer to the task that is currently being evaluated. */
+    task_scheduler_task_t *task;
+
+    if (p_tasks == NULL)
+    {
+        return TASK_SCHEDULER_EC_ERR;
+    }
+
+    current_tick = HAL_GetTick();
+    for (uint8_t i=0; i<total_tasks; i++)
+    {
+        task = &p_tasks[i];
+        if (!is_tick_reached(current_tick, task->next_release_tick))
+        {
+            continue;
+        }
+
+        /* Execute the task whose release time has been reached. */
+        release_tick = task->next_release_tick;
+        start_tick = HAL_GetTick();
+        task->callback();
+
+        /* Update the execution statistics of the task that has just been executed. */
+        current_tick = HAL_GetTick();
+        execution_time = current_tick - start_tick;
+        if (execution_time > task->max_execution_time)
+        {
+            task->max_execution_time = execution_time;
+        }
+        if ((current_tick - release_tick) > task->deadline)
+        {
+            task->deadline_misses++;
+        }
+
+        /* Define the next release time of the task without drifting, but skip the releases that have already been missed. */
+        task->next_release_tick = release_tick + task->period;
+        if (is_tick_reached(current_tick, task->next_release_tick + task->period))
+        {
+            skipped_releases = (current_tick - task->next_release_tick)/task->period + 1;
+            task->skipped_releases += skipped_releases;
+            task->next_release_tick += skipped_releases*task->period;
+        }
+        return TASK_SCHEDULER_EC_OK;
+    }
+
+    return TASK_SCHEDULER_EC_IDLE;
+}
+
+static inline uint8_t is_tick_reached(uint32_t current_tick, uint32_t target_tick)
+{
+    return ((int32_t) (current_tick - target_tick)) >= 0;
+}
+
+Task_Scheduler_Status init_task_scheduler_module(task_scheduler_task_t *tasks, uint8_t tasks_size)
+{
+    /** <b>Local variable current_tick:</b> Current HAL Tick in our MCU/MPU. */
+    uint32_t current_tick = HAL_GetTick();
+
+    /* Validate the given tasks. */
+    if ((tasks==NULL) || (tasks_size==0) || (tasks_size>TASK_SCHEDULER_MAX_TASKS))
+    {
+        return TASK_SCHEDULER_EC_ERR;
+    }
+    for (uint8_t i=0; i<tasks_size; i++)
+    {
+        if ((tasks[i].callback==NULL) || (tasks[i].period==0) || (tasks[i].deadline==0) || (tasks[i].deadline>tasks[i].period))
+        {
+            return TASK_SCHEDULER_EC_ERR;
+        }
+    }
+
+    /* Release all the given tasks right away and reset their execution statistics. */
+    for (uint8_t i=0; i<tasks_size; i++)
+    {
+        tasks[i].next_release_tick = current_tick;
+        tasks[i].max_execution_time = 0;
+        tasks[i].deadline_misses = 0;
+        tasks[i].skipped_releases = 0;
+    }
+
+    /* Persist the given tasks into the @ref task_scheduler . */
+    p_tasks = tasks;
+    total_tasks = tasks_size;
+
+    return TASK_SCHEDULER_EC_OK;
+}
+
+/** @} */
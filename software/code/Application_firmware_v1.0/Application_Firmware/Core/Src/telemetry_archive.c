@@ -0,0 +1,414 @@
+/** @addtogroup telemetry_archive
+ * @{
+ */
+
+#include "telemetry_archive.h"
+#include "main.h" // This is where the HAL Flash functions of our MCU/MPU are included from.
+#include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
+
+#define TELEMETRY_ARCHIVE_PAGE_1_START_ADDR     (TELEMETRY_ARCHIVE_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR)    /**< @brief Designated Flash Memory address for the start of the first page of the @ref telemetry_archive , which should be 0x0801'7800. */
+#define NO_PAGE                                 (0xFF)      /**< @brief Value of @ref head_page whenever no page of the @ref telemetry_archive has been written yet. */
+#define ERASED_WORD                             (0xFFFFFFFF)    /**< @brief Value of a word of an erased Flash Memory page. */
+
+/**@brief	Telemetry Archive page header structure, which is written at the start of each page of the
+ *          @ref telemetry_archive right after erasing it.
+ */
+typedef struct __attribute__ ((__packed__)) __attribute__ ((aligned (4)))
+{
+    uint32_t sequence;                  //!< Page sequence number, which is one more than the one of the page that was filled before this one and never zero.
+    uint32_t crc32;                     //!< Recorded 32-bits CRC of \c sequence .
+} telemetry_archive_header_t;
+
+/**@brief	Telemetry Archive slot structure, which holds one archived record.
+ *
+ * @note	The size of this struct must be a multiple of 4 bytes (i.e., 32-bits) since the Flash Memory is written
+ *          word by word (see @ref FLASH_TYPEPROGRAM_WORD ).
+ */
+typedef struct __attribute__ ((__packed__)) __attribute__ ((aligned (4)))
+{
+    telemetry_record_t record;          //!< Archived record.
+    uint32_t crc32;                     //!< Recorded 32-bits CRC of \c record .
+} telemetry_archive_slot_t;
+
+/**@brief	Telemetry Archive page structure. This contains all the fields of one Flash Memory page of the
+ *          @ref telemetry_archive .
+ */
+typedef struct
+{
+    telemetry_archive_header_t header;                                      //!< Header of the page.
+    telemetry_archive_slot_t slots[TELEMETRY_ARCHIVE_RECORDS_PER_PAGE];     //!< Slots of the page, which are filled in order.
+} telemetry_archive_page_t;
+
+_Static_assert((sizeof(telemetry_archive_header_t) % 4) == 0, "The size of telemetry_archive_header_t must be a multiple of 4 bytes.");
+_Static_assert((sizeof(telemetry_archive_slot_t) % 4) == 0, "The size of telemetry_archive_slot_t must be a multiple of 4 bytes.");
+_Static_assert(sizeof(telemetry_archive_page_t) <= FLASH_PAGE_SIZE_IN_BYTES, "The size of telemetry_archive_page_t must fit in one Flash Memory page.");
+_Static_assert(TELEMETRY_ARCHIVE_BATCH_RECORDS < TELEMETRY_LOG_CAPACITY, "A batch of the Telemetry Archive must fit in the Telemetry Log.");
+
+static uint8_t head_page = NO_PAGE;             /**< @brief Index of the latest page of the @ref telemetry_archive (i.e., the one into which records are appended), or @ref NO_PAGE if none. */
+static uint32_t head_sequence = 0;              /**< @brief Page sequence number of @ref head_page . */
+static uint8_t head_slots_used = 0;             /**< @brief Number of slots of @ref head_page that have already been written, including any that could not be completely written. */
+static uint32_t log_sequence = 0;               /**< @brief Sequence number, in the @ref telemetry_log , of the next record that has to be archived. */
+
+/**@brief	Gets a pointer to a desired page of the @ref telemetry_archive .
+ *
+ * @param page	Index of the page, from 0 up to @ref TELEMETRY_ARCHIVE_TOTAL_PAGES minus one.
+ *
+ * @return  The pointer to that page.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static const telemetry_archive_page_t *get_page(uint8_t page);
+
+/**@brief	Gets the page sequence number of a desired page of the @ref telemetry_archive .
+ *
+ * @param page	Index of the page, from 0 up to @ref TELEMETRY_ARCHIVE_TOTAL_PAGES minus one.
+ *
+ * @return  The page sequence number held by its header, or zero if that header is erased or its 32-bit CRC does not
+ *          match.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint32_t get_page_sequence(uint8_t page);
+
+/**@brief	Checks whether a desired slot of a page of the @ref telemetry_archive is still erased.
+ *
+ * @param[in] p_slot	Pointer to the slot.
+ *
+ * @return  1 if all the words of the slot are erased, or 0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint8_t is_slot_erased(const telemetry_archive_slot_t *p_slot);
+
+/**@brief	Erases the page that follows @ref head_page and writes its header, so that it becomes the new
+ *          @ref head_page .
+ *
+ * @note    The Flash Memory must have been unlocked before calling this function.
+ *
+ * @retval  TELEMETRY_ARCHIVE_EC_OK
+ * @retval  TELEMETRY_ARCHIVE_EC_NR
+ * @retval  TELEMETRY_ARCHIVE_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static Telemetry_Archive_Status start_next_page(void);
+
+/**@brief	Writes consecutive words into the Flash Memory.
+ *
+ * @note    The Flash Memory must have been unlocked before calling this function.
+ *
+ * @param address       Flash Memory address into which the first word is written.
+ * @param[in] p_words   Pointer to the words that want to be written.
+ * @param total_words   Number of words that want to be written.
+ *
+ * @retval  TELEMETRY_ARCHIVE_EC_OK
+ * @retval  TELEMETRY_ARCHIVE_EC_NR
+ * @retval  TELEMETRY_ARCHIVE_EC_ERR
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static Telemetry_Archive_Status write_words(uint32_t address, const uint32_t *p_words, uint16_t total_words);
+
+/**@brief	Gets the corresponding @ref Telemetry_Archive_Status value depending on the given @ref HAL_StatusTypeDef
+ *          value.
+ *
+ * @param HAL_status	HAL Status value that wants to be converted.
+ *
+ * @retval  TELEMETRY_ARCHIVE_EC_NR if \p HAL_status param equals \c HAL_BUSY or \c HAL_TIMEOUT .
+ * @retval  TELEMETRY_ARCHIVE_EC_ERR if \p HAL_status param equals \c HAL_ERROR .
+ * @retval  TELEMETRY_ARCHIVE_EC_OK otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static Telemetry_Archive_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
+
+Telemetry_Archive_Status feed_telemetry_archive(void)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref Telemetry_Archive_Status function. */
+    Telemetry_Archive_Status ret;
+    /** <b>Local variable batch:</b> Records of the @ref telemetry_log that are archived by this call. */
+    telemetry_record_t batch[TELEMETRY_ARCHIVE_BATCH_RECORDS];
+    /** <b>Local variable batch_size:</b> Number of records in the \c batch variable. */
+    uint16_t batch_size;
+    /** <b>Local variable slot:</b> Slot that is written for each record of the \c batch variable. */
+    telemetry_archive_slot_t slot;
+    /** <b>Local variable records_archived:</b> Number of records of the \c batch variable that have been archived. */
+    uint16_t records_archived;
+
+    if ((get_telemetry_log_total_records() - log_sequence) < TELEMETRY_ARCHIVE_BATCH_RECORDS)
+    {
+        return TELEMETRY_ARCHIVE_EC_NO_DATA;
+    }
+
+    ret = HAL_ret_handler(HAL_FLASH_Unlock());
+    if (ret != TELEMETRY_ARCHIVE_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Archive whole batches until less than one is left, so that the records that could not be archived before are caught up with. */
+    while ((ret == TELEMETRY_ARCHIVE_EC_OK) && ((get_telemetry_log_total_records() - log_sequence) >= TELEMETRY_ARCHIVE_BATCH_RECORDS))
+    {
+        batch_size = read_telemetry_records(&log_sequence, batch, TELEMETRY_ARCHIVE_BATCH_RECORDS);
+
+        /* Append each record into the next slot of the latest page, moving on to the next page of the ring whenever it is full. */
+        for (records_archived=0; records_archived<batch_size; records_archived++)
+        {
+            if ((head_page == NO_PAGE) || (head_slots_used >= TELEMETRY_ARCHIVE_RECORDS_PER_PAGE))
+            {
+                ret = start_next_page();
+                if (ret != TELEMETRY_ARCHIVE_EC_OK)
+                {
+                    break;
+                }
+            }
+            slot.record = batch[records_archived];
+            slot.crc32 = crc32_mpeg2((uint8_t *) &slot.record, sizeof(telemetry_record_t));
+
+            // NOTE: A slot that could not be completely written is never written again, so its record is retried in the next one.
+            ret = write_words((uint32_t) &get_page(head_page)->slots[head_slots_used], (const uint32_t *) &slot, sizeof(telemetry_archive_slot_t)/4);
+            head_slots_used++;
+            if (ret != TELEMETRY_ARCHIVE_EC_OK)
+            {
+                break;
+            }
+        }
+        log_sequence += records_archived;
+    }
+
+    if (ret != TELEMETRY_ARCHIVE_EC_OK)
+    {
+        HAL_FLASH_Lock();
+        return ret;
+    }
+    return HAL_ret_handler(HAL_FLASH_Lock());
+}
+
+uint32_t get_telemetry_archive_next_sequence(void)
+{
+    return (head_page == NO_PAGE) ? 0 : ((head_sequence - 1)*TELEMETRY_ARCHIVE_RECORDS_PER_PAGE + head_slots_used);
+}
+
+uint16_t read_telemetry_archive_records(uint32_t *sequence, telemetry_record_t *records, uint16_t max_records)
+{
+    /** <b>Local variable next_sequence:</b> Sequence number of the next record that will be written. */
+    uint32_t next_sequence = get_telemetry_archive_next_sequence();
+    /** <b>Local variable oldest_sequence:</b> Sequence number of the first slot of the oldest page that may still be held. */
+    uint32_t oldest_sequence;
+    /** <b>Local variable page_sequence:</b> Page sequence number of the page that holds the slot that is being examined. */
+    uint32_t page_sequence;
+    /** <b>Local variable page:</b> Index of the page that holds the slot that is being examined. */
+    uint8_t page;
+    /** <b>Local pointer p_slot:</b> Pointer to the slot that is being examined. */
+    const telemetry_archive_slot_t *p_slot;
+    /** <b>Local variable count:</b> Number of records that are copied. */
+    uint16_t count = 0;
+
+    if ((head_page == NO_PAGE) || (((int32_t) (next_sequence - *sequence)) <= 0))
+    {
+        return 0;
+    }
+    oldest_sequence = (head_sequence > TELEMETRY_ARCHIVE_TOTAL_PAGES) ? ((head_sequence - TELEMETRY_ARCHIVE_TOTAL_PAGES)*TELEMETRY_ARCHIVE_RECORDS_PER_PAGE) : 0;
+    if ((next_sequence - *sequence) > (next_sequence - oldest_sequence))
+    {
+        *sequence = oldest_sequence;
+    }
+
+    while ((count < max_records) && (*sequence != next_sequence))
+    {
+        page_sequence = *sequence/TELEMETRY_ARCHIVE_RECORDS_PER_PAGE + 1;
+        page = (uint8_t) ((head_page + TELEMETRY_ARCHIVE_TOTAL_PAGES - (head_sequence - page_sequence)) % TELEMETRY_ARCHIVE_TOTAL_PAGES);
+
+        /* Skip the whole page if it does not hold the expected records (e.g., if it was being erased during a reset). */
+        if (get_page_sequence(page) != page_sequence)
+        {
+            *sequence = page_sequence*TELEMETRY_ARCHIVE_RECORDS_PER_PAGE;
+            continue;
+        }
+
+        p_slot = &get_page(page)->slots[*sequence % TELEMETRY_ARCHIVE_RECORDS_PER_PAGE];
+        if (crc32_mpeg2((uint8_t *) &p_slot->record, sizeof(telemetry_record_t)) == p_slot->crc32)
+        {
+            records[count++] = p_slot->record;
+        }
+        (*sequence)++;
+    }
+
+    return count;
+}
+
+Telemetry_Archive_Status init_telemetry_archive_module(void)
+{
+    /** <b>Local variable first_sequence:</b> Page sequence number of the first page of the @ref telemetry_archive . */
+    uint32_t first_sequence = get_page_sequence(0);
+    /** <b>Local variable low:</b> Lower bound of the binary searches. */
+    uint8_t low;
+    /** <b>Local variable high:</b> Upper bound of the binary searches. */
+    uint8_t high;
+    /** <b>Local variable middle:</b> Index that is examined in each step of the binary searches. */
+    uint8_t middle;
+
+    /* Archive the records of the Telemetry Log from the moment that this module is mounted. */
+    log_sequence = get_telemetry_log_total_records();
+
+    /* Find the latest page, which is the last one whose page sequence number is not lower than the one of the first page, since the page sequence numbers only decrease right after it. */
+    if (first_sequence == 0)
+    {
+        // NOTE: The first page is only left with an invalid header when it was being erased to follow the last page, or when nothing has been archived yet.
+        head_page = (get_page_sequence(TELEMETRY_ARCHIVE_TOTAL_PAGES-1) == 0) ? NO_PAGE : (TELEMETRY_ARCHIVE_TOTAL_PAGES-1);
+    }
+    else
+    {
+        low = 0;
+        high = TELEMETRY_ARCHIVE_TOTAL_PAGES-1;
+        while (low < high)
+        {
+            middle = (uint8_t) ((low + high + 1)/2);
+            if (get_page_sequence(middle) >= first_sequence)
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle - 1;
+            }
+        }
+        head_page = low;
+    }
+    if (head_page == NO_PAGE)
+    {
+        head_sequence = 0;
+        head_slots_used = 0;
+        return TELEMETRY_ARCHIVE_EC_NO_DATA;
+    }
+    head_sequence = get_page_sequence(head_page);
+
+    /* Find the first erased slot of the latest page, since its slots are written in order. */
+    low = 0;
+    high = TELEMETRY_ARCHIVE_RECORDS_PER_PAGE;
+    while (low < high)
+    {
+        middle = (uint8_t) ((low + high)/2);
+        if (is_slot_erased(&get_page(head_page)->slots[middle]))
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    head_slots_used = low;
+
+    return TELEMETRY_ARCHIVE_EC_OK;
+}
+
+static const telemetry_archive_page_t *get_page(uint8_t page)
+{
+    return (const telemetry_archive_page_t *) (TELEMETRY_ARCHIVE_PAGE_1_START_ADDR + page*FLASH_PAGE_SIZE_IN_BYTES);
+}
+
+static uint32_t get_page_sequence(uint8_t page)
+{
+    /** <b>Local pointer p_header:</b> Pointer to the header of the requested page. */
+    const telemetry_archive_header_t *p_header = &get_page(page)->header;
+
+    if ((p_header->sequence == 0) || (p_header->sequence == ERASED_WORD) ||
+        (crc32_mpeg2((uint8_t *) &p_header->sequence, sizeof(uint32_t)) != p_header->crc32))
+    {
+        return 0;
+    }
+    return p_header->sequence;
+}
+
+static uint8_t is_slot_erased(const telemetry_archive_slot_t *p_slot)
+{
+    /** <b>Local pointer p_words:</b> Pointer to the slot but in \c uint32_t Type. */
+    const uint32_t *p_words = (const uint32_t *) p_slot;
+
+    for (uint8_t i=0; i<(sizeof(telemetry_archive_slot_t)/4); i++)
+    {
+        if (p_words[i] != ERASED_WORD)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static Telemetry_Archive_Status start_next_page(void)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref Telemetry_Archive_Status function. */
+    Telemetry_Archive_Status ret;
+    /** <b>Local variable erase_init:</b> Erase request given to the HAL Flash driver. */
+    FLASH_EraseInitTypeDef erase_init;
+    /** <b>Local variable page_error:</b> Address of the Flash Memory page that could not be erased, if any. */
+    uint32_t page_error;
+    /** <b>Local variable next_page:</b> Index of the page that follows @ref head_page in the ring. */
+    uint8_t next_page = (head_page == NO_PAGE) ? 0 : (uint8_t) ((head_page + 1) % TELEMETRY_ARCHIVE_TOTAL_PAGES);
+    /** <b>Local variable header:</b> Header that is written into the next page. */
+    telemetry_archive_header_t header;
+
+    header.sequence = (head_page == NO_PAGE) ? 1 : (head_sequence + 1);
+    header.crc32 = crc32_mpeg2((uint8_t *) &header.sequence, sizeof(uint32_t));
+
+    /* Erase the page that holds the oldest records and then write its new header. */
+    erase_init.TypeErase = FLASH_TYPEERASE_PAGES;
+    erase_init.Banks = FLASH_BANK_1;
+    erase_init.PageAddress = (uint32_t) get_page(next_page);
+    erase_init.NbPages = 1;
+    ret = HAL_ret_handler(HAL_FLASHEx_Erase(&erase_init, &page_error));
+    if (ret != TELEMETRY_ARCHIVE_EC_OK)
+    {
+        return ret;
+    }
+    ret = write_words((uint32_t) &get_page(next_page)->header, (const uint32_t *) &header, sizeof(telemetry_archive_header_t)/4);
+    if (ret != TELEMETRY_ARCHIVE_EC_OK)
+    {
+        return ret;
+    }
+    head_page = next_page;
+    head_sequence = header.sequence;
+    head_slots_used = 0;
+
+    return TELEMETRY_ARCHIVE_EC_OK;
+}
+
+static Telemetry_Archive_Status write_words(uint32_t address, const uint32_t *p_words, uint16_t total_words)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref Telemetry_Archive_Status function. */
+    Telemetry_Archive_Status ret;
+
+    for (uint16_t words_written=0; words_written<total_words; words_written++)
+    {
+        ret = HAL_ret_handler(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address + words_written*4, p_words[words_written]));
+        if (ret != TELEMETRY_ARCHIVE_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    return TELEMETRY_ARCHIVE_EC_OK;
+}
+
+static Telemetry_Archive_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
+{
+    switch (HAL_status)
+    {
+        case HAL_BUSY:
+        case HAL_TIMEOUT:
+            return TELEMETRY_ARCHIVE_EC_NR;
+        case HAL_ERROR:
+            return TELEMETRY_ARCHIVE_EC_ERR;
+        default:
+            return TELEMETRY_ARCHIVE_EC_OK;
+    }
+}
+
+/** @} */
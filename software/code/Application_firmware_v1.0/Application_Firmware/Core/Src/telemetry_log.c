@@ -0,0 +1,57 @@
+/** @addtogroup telemetry_log
+ * @{
+ */
+
+#include "telemetry_log.h"
+
+static telemetry_record_t telemetry_records[TELEMETRY_LOG_CAPACITY];    /**< @brief Ring buffer of the @ref telemetry_log , where the record with the sequence number N is held at the index N modulo @ref TELEMETRY_LOG_CAPACITY . */
+static volatile uint32_t total_records = 0;                             /**< @brief Total number of records that have been written into @ref telemetry_records since the @ref telemetry_log was initialized. @details This is only incremented once its record has been completely written. */
+
+void write_telemetry_record(const telemetry_record_t *record)
+{
+    telemetry_records[total_records & (TELEMETRY_LOG_CAPACITY-1)] = *record;
+    __asm volatile ("" ::: "memory"); // Keep the compiler from publishing the new record before it has been completely written.
+    total_records++;
+}
+
+uint32_t get_telemetry_log_total_records(void)
+{
+    return total_records;
+}
+
+uint16_t read_telemetry_records(uint32_t *sequence, telemetry_record_t *records, uint16_t max_records)
+{
+    /** <b>Local variable written:</b> Value of @ref total_records before copying the records. */
+    uint32_t written;
+    /** <b>Local variable count:</b> Number of records that are copied. */
+    uint16_t count;
+
+    /* Copy the records again whenever the writer has overwritten the first of them in the middle of the copy. */
+    do
+    {
+        written = total_records;
+        if (((int32_t) (written - *sequence)) <= 0)
+        {
+            return 0;
+        }
+        if ((written - *sequence) > TELEMETRY_LOG_CAPACITY)
+        {
+            *sequence = written - TELEMETRY_LOG_CAPACITY;
+        }
+        count = ((written - *sequence) < max_records) ? (uint16_t) (written - *sequence) : max_records;
+        for (uint16_t i=0; i<count; i++)
+        {
+            records[i] = telemetry_records[(*sequence + i) & (TELEMETRY_LOG_CAPACITY-1)];
+        }
+        __asm volatile ("" ::: "memory"); // Keep the compiler from reading @ref total_records again before the records have been copied.
+    } while ((total_records - *sequence) > TELEMETRY_LOG_CAPACITY);
+
+    return count;
+}
+
+void init_telemetry_log(void)
+{
+    total_records = 0;
+}
+
+/** @} */
@@ -0,0 +1,249 @@
+/** @addtogroup telemetry_stream
+ * @{
+ */
+
+#include "telemetry_stream.h"
+#include <string.h>	// Library from which "memcpy()" is located at.
+#include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
+
+#define TELEMETRY_STREAM_SOF            (0xAA)      /**< @brief Start Of Frame (SOF) byte of the frames of the @ref telemetry_stream , which is the same one as in the ETX OTA Packets. */
+#define TELEMETRY_STREAM_EOF            (0xBB)      /**< @brief End Of Frame (EOF) byte of the frames of the @ref telemetry_stream , which is the same one as in the ETX OTA Packets. */
+#define FRAME_HEADER_SIZE               (8U)        /**< @brief Length in bytes of the frame sequence number, the number of samples, the sample period and the HAL Tick of the first sample at the Data field of a frame. */
+#define KEY_SAMPLE_SIZE                 (7U)        /**< @brief Length in bytes of the first sample at the Data field of a frame. */
+#define DELTA_SAMPLE_SIZE               (4U)        /**< @brief Length in bytes of each of the other samples at the Data field of a frame. */
+#define FRAME_DATA_MAX_SIZE             (FRAME_HEADER_SIZE + KEY_SAMPLE_SIZE + (TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME-1)*DELTA_SAMPLE_SIZE)   /**< @brief Maximum length in bytes of the Data field of a frame. */
+#define FRAME_OVERHEAD                  (9U)        /**< @brief Length in bytes of the SOF, Packet Type, Data Length, 32-bit CRC and EOF fields of a frame. */
+#define FRAME_MAX_SIZE                  (FRAME_DATA_MAX_SIZE + FRAME_OVERHEAD)      /**< @brief Maximum length in bytes of a whole frame. */
+
+static UART_HandleTypeDef *p_huart = NULL;              /**< @brief Our MCU/MPU's UART Handle through which the frames are sent. */
+static uint16_t sample_period = 0;                      /**< @brief Sample period in milliseconds, or zero if streaming is stopped. */
+static uint32_t next_sample_tick = 0;                   /**< @brief HAL Tick at which the next sample is due. */
+static uint8_t frame_data[FRAME_DATA_MAX_SIZE];         /**< @brief Data field of the frame that is being filled with samples. */
+static uint8_t frame_data_size = 0;                     /**< @brief Number of bytes of @ref frame_data that have been filled. */
+static uint8_t frame_samples = 0;                       /**< @brief Number of samples in @ref frame_data , where zero means that the next sample starts a new frame. */
+static uint8_t frame_sequence = 0;                      /**< @brief Frame sequence number of the next frame. */
+static telemetry_stream_sample_t previous_sample;       /**< @brief Latest sample that was added into @ref frame_data , from which the changes of the next sample are calculated. */
+static uint8_t pending_frame[FRAME_MAX_SIZE];           /**< @brief Whole frame that is waiting for the UART to be free. */
+static uint8_t pending_frame_size = 0;                  /**< @brief Length in bytes of @ref pending_frame , or zero if no frame is waiting. */
+static uint8_t tx_frame[FRAME_MAX_SIZE];                /**< @brief Whole frame that is being sent by the UART Interrupts. */
+static volatile uint8_t is_transmitting = 0;            /**< @brief Flag that indicates whether @ref tx_frame is being sent or not. @details 0 = UART free of frames<br>1 = Sending a frame */
+static volatile uint8_t is_paused = 0;                  /**< @brief Flag that indicates whether the @ref telemetry_stream has been paused via the @ref pause_telemetry_stream function or not. @details 0 = Not paused<br>1 = Paused */
+static volatile uint8_t is_restart_pending = 0;         /**< @brief Flag that indicates whether the samples of the current frame and the frame that waits to be sent have to be discarded in the next call of the @ref run_telemetry_stream function or not. @details 0 = No<br>1 = Discard them */
+
+/**@brief	Adds a sample into @ref frame_data , closing the current frame first if the changes of that sample do not
+ *          fit in 8 bits, and then closing the frame if it becomes full.
+ *
+ * @param[in] sample    Pointer to the sample that wants to be added.
+ * @param sample_tick   HAL Tick at which the sample was due.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void add_sample(const telemetry_stream_sample_t *sample, uint32_t sample_tick);
+
+/**@brief	Wraps @ref frame_data into a whole frame and leaves it into @ref pending_frame , replacing the frame that
+ *          was waiting there, if any, so that the next sample starts a new frame.
+ *
+ * @note    This function does nothing if @ref frame_data has no samples.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void close_frame(void);
+
+/**@brief	Starts sending @ref pending_frame in non-blocking mode if there is one and if the UART is free.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void send_pending_frame(void);
+
+void run_telemetry_stream(const telemetry_stream_sample_t *sample, uint32_t tick)
+{
+    if ((p_huart == NULL) || (sample_period == 0) || is_paused)
+    {
+        return;
+    }
+
+    /* Start over with a new frame after having been paused or after the sample period has changed. */
+    if (is_restart_pending)
+    {
+        is_restart_pending = 0;
+        frame_samples = 0;
+        pending_frame_size = 0;
+        next_sample_tick = tick;
+    }
+
+    /* Take a sample once its period has elapsed, where a missed period closes the current frame since its samples must be one period apart. */
+    if (((int32_t) (tick - next_sample_tick)) >= 0)
+    {
+        if ((tick - next_sample_tick) >= sample_period)
+        {
+            close_frame();
+            next_sample_tick = tick;
+        }
+        add_sample(sample, next_sample_tick);
+        next_sample_tick += sample_period;
+    }
+
+    send_pending_frame();
+}
+
+Telemetry_Stream_Status set_telemetry_stream_period(uint16_t period)
+{
+    if ((period != 0) && (period < TELEMETRY_STREAM_MIN_PERIOD))
+    {
+        return TELEMETRY_STREAM_EC_ERR;
+    }
+
+    sample_period = period;
+    is_restart_pending = 1;
+    return TELEMETRY_STREAM_EC_OK;
+}
+
+uint16_t get_telemetry_stream_period(void)
+{
+    return sample_period;
+}
+
+void pause_telemetry_stream(void)
+{
+    is_paused = 1;
+    if (is_transmitting)
+    {
+        HAL_UART_AbortTransmit(p_huart);
+        is_transmitting = 0;
+    }
+}
+
+void resume_telemetry_stream(void)
+{
+    is_restart_pending = 1;
+    is_paused = 0;
+}
+
+Telemetry_Stream_Status init_telemetry_stream(UART_HandleTypeDef *huart, uint16_t period)
+{
+    if ((huart == NULL) || (set_telemetry_stream_period(period) != TELEMETRY_STREAM_EC_OK))
+    {
+        return TELEMETRY_STREAM_EC_ERR;
+    }
+
+    p_huart = huart;
+    is_transmitting = 0;
+    is_paused = 0;
+    return TELEMETRY_STREAM_EC_OK;
+}
+
+/**@brief	UART Transmission Complete Callback, which frees the UART from the frame of the @ref telemetry_stream that
+ *          was being sent.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that has completed a transmission.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == p_huart)
+    {
+        is_transmitting = 0;
+    }
+}
+
+static void add_sample(const telemetry_stream_sample_t *sample, uint32_t sample_tick)
+{
+    /** <b>Local variable cold_water_change:</b> Change of the Cold Water Temperature with respect to the previous sample. */
+    int32_t cold_water_change = sample->cold_water_temperature - previous_sample.cold_water_temperature;
+    /** <b>Local variable hot_water_change:</b> Change of the Hot Water Temperature with respect to the previous sample. */
+    int32_t hot_water_change = sample->hot_water_temperature - previous_sample.hot_water_temperature;
+    /** <b>Local variable internal_ambient_change:</b> Change of the Internal Ambient Temperature with respect to the previous sample. */
+    int32_t internal_ambient_change = sample->internal_ambient_temperature - previous_sample.internal_ambient_temperature;
+
+    /* Close the current frame if any of the changes cannot be encoded in 8 bits. */
+    if ((frame_samples > 0) &&
+        ((cold_water_change < INT8_MIN) || (cold_water_change > INT8_MAX) ||
+         (hot_water_change < INT8_MIN) || (hot_water_change > INT8_MAX) ||
+         (internal_ambient_change < INT8_MIN) || (internal_ambient_change > INT8_MAX)))
+    {
+        close_frame();
+    }
+
+    if (frame_samples == 0)
+    {
+        /* Start a new frame with the whole sample. */
+        memcpy(&frame_data[2], &sample_period, sizeof(uint16_t));
+        memcpy(&frame_data[4], &sample_tick, sizeof(uint32_t));
+        memcpy(&frame_data[FRAME_HEADER_SIZE], &sample->cold_water_temperature, sizeof(int16_t));
+        memcpy(&frame_data[FRAME_HEADER_SIZE+2], &sample->hot_water_temperature, sizeof(int16_t));
+        memcpy(&frame_data[FRAME_HEADER_SIZE+4], &sample->internal_ambient_temperature, sizeof(int16_t));
+        frame_data[FRAME_HEADER_SIZE+6] = sample->actuators;
+        frame_data_size = FRAME_HEADER_SIZE + KEY_SAMPLE_SIZE;
+    }
+    else
+    {
+        /* Append only the changes with respect to the previous sample. */
+        frame_data[frame_data_size] = (uint8_t) ((int8_t) cold_water_change);
+        frame_data[frame_data_size+1] = (uint8_t) ((int8_t) hot_water_change);
+        frame_data[frame_data_size+2] = (uint8_t) ((int8_t) internal_ambient_change);
+        frame_data[frame_data_size+3] = sample->actuators;
+        frame_data_size += DELTA_SAMPLE_SIZE;
+    }
+    frame_samples++;
+    previous_sample = *sample;
+
+    if (frame_samples >= TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME)
+    {
+        close_frame();
+    }
+}
+
+static void close_frame(void)
+{
+    /** <b>Local variable crc:</b> 32-bit CRC of the Data field of the frame. */
+    uint32_t crc;
+    /** <b>Local variable data_length:</b> Length in bytes of the Data field of the frame. */
+    uint16_t data_length = frame_data_size;
+
+    if (frame_samples == 0)
+    {
+        return;
+    }
+    frame_data[0] = frame_sequence++;
+    frame_data[1] = frame_samples;
+
+    /* Wrap the Data field with the General Data Format of the ETX OTA Packets. */
+    pending_frame[0] = TELEMETRY_STREAM_SOF;
+    pending_frame[1] = TELEMETRY_STREAM_PACKET_TYPE;
+    memcpy(&pending_frame[2], &data_length, sizeof(uint16_t));
+    memcpy(&pending_frame[4], frame_data, data_length);
+    crc = crc32_mpeg2(frame_data, data_length);
+    memcpy(&pending_frame[4+data_length], &crc, sizeof(uint32_t));
+    pending_frame[8+data_length] = TELEMETRY_STREAM_EOF;
+    pending_frame_size = (uint8_t) (data_length + FRAME_OVERHEAD);
+
+    frame_samples = 0;
+}
+
+static void send_pending_frame(void)
+{
+    if (pending_frame_size == 0)
+    {
+        return;
+    }
+
+    // NOTE: The Interrupts are disabled so that an ETX OTA Transaction cannot pause this module in between checking whether the UART is free and starting to send the frame.
+    __disable_irq();
+    if (!is_paused && !is_transmitting && (p_huart->gState == HAL_UART_STATE_READY))
+    {
+        memcpy(tx_frame, pending_frame, pending_frame_size);
+        if (HAL_UART_Transmit_IT(p_huart, tx_frame, pending_frame_size) == HAL_OK)
+        {
+            is_transmitting = 1;
+            pending_frame_size = 0;
+        }
+    }
+    __enable_irq();
+}
+
+/** @} */
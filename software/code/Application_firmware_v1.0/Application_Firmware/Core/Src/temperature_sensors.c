@@ -0,0 +1,286 @@
+/** @addtogroup temp_sensors
+ * @{
+ */
+
+#include "temperature_sensors.h"
+
+#define VREFINT_CHANNEL_INDEX           (TEMP_SENSORS_TOTAL_CHANNELS)      /**< @brief Index of the VREFINT conversion inside each Scan of the Circular DMA buffer. */
+#define VREFINT_MIN_VALUE               ((TEMP_SENSORS_VREFINT_MILLIVOLTS*4095U) / TEMP_SENSORS_MAX_VDDA_MILLIVOLTS)   /**< @brief Lowest raw 12-bit ADC value of the VREFINT channel that is considered valid, which stands for the @ref TEMP_SENSORS_MAX_VDDA_MILLIVOLTS . */
+#define VREFINT_MAX_VALUE               ((TEMP_SENSORS_VREFINT_MILLIVOLTS*4095U) / TEMP_SENSORS_MIN_VDDA_MILLIVOLTS)   /**< @brief Highest raw 12-bit ADC value of the VREFINT channel that is considered valid, which stands for the @ref TEMP_SENSORS_MIN_VDDA_MILLIVOLTS . */
+#define COMPENSATION_EXTRA_BITS         (4)                                 /**< @brief Number of fractional bits with which each compensated conversion is accumulated, so that the rounding of the division by the VREFINT conversion does not bias the decimated samples. */
+#define ADC_TO_CENTI_CELSIUS_Q16_MULTIPLIER ((uint32_t) (((((uint64_t) TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS*TEMP_SENSORS_LM35_CENTI_CELSIUS_PER_MILLIVOLT) << 16) + (TEMP_SENSORS_ADC_MAX_VALUE/2)) / TEMP_SENSORS_ADC_MAX_VALUE))    /**< @brief Q16 Fixed-Point multiplier with which a decimated ADC value of the LM35 Temperature Sensors (see @ref TEMP_SENSORS_ADC_MAX_VALUE ) is converted into centi-degrees Celsius. @note This value is calculated by the compiler, so that each conversion costs only one multiplication and one shift at runtime. */
+#define DMA_BUFFER_LENGTH               (2*TEMP_SENSORS_OVERSAMPLING_RATIO*TEMP_SENSORS_ADC_TOTAL_CHANNELS)   /**< @brief Number of Half-Words of the Circular DMA buffer of the @ref temp_sensors . */
+
+static ADC_HandleTypeDef *p_hadc = NULL;                                            /**< @brief Pointer to the ADC Handle Structure of the ADC that is used by the @ref temp_sensors . @details This pointer's value is defined in the @ref init_temp_sensors_module function. */
+static volatile uint16_t temp_sensors_dma_buffer[DMA_BUFFER_LENGTH];              /**< @brief Circular DMA buffer into which the ADC used by the @ref temp_sensors writes two consecutive blocks of @ref TEMP_SENSORS_OVERSAMPLING_RATIO Scans each, where each Scan is ordered as in @ref Temp_Sensor_Channel and is followed by its VREFINT conversion. */
+static sensor_filter_t temp_sensors_filters[TEMP_SENSORS_TOTAL_CHANNELS];          /**< @brief Median plus IIR Sensor Filter of each channel, ordered as in @ref Temp_Sensor_Channel . */
+static volatile temp_sensors_sample_t latest_sample;                                /**< @brief Latest decimated sample of the Temperature Sensors, which is published by the @ref publish_decimated_sample function. */
+static volatile uint32_t latest_sample_write_count = 0;                             /**< @brief Counter that is incremented right before and right after each time that @ref latest_sample is written, so that it holds an odd value only while @ref latest_sample is being written. */
+static volatile Temp_Sensors_Status temp_sensors_status = TEMP_SENSORS_EC_ERR;      /**< @brief Current status of the ADC and DMA used by the @ref temp_sensors . */
+
+/**@brief   Compensates, oversamples and decimates a block of @ref TEMP_SENSORS_OVERSAMPLING_RATIO Scans of the
+ *          Circular DMA buffer, filters the result and publishes it into @ref latest_sample .
+ *
+ * @details Each conversion is multiplied by @ref TEMP_SENSORS_VREFINT_NOMINAL_VALUE and divided by the VREFINT
+ *          conversion of its Scan, or used as it is if that VREFINT conversion is not between @ref VREFINT_MIN_VALUE
+ *          and @ref VREFINT_MAX_VALUE . The compensated Scans of each channel are then accumulated and the result is
+ *          shifted to the right by @ref TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS plus @ref COMPENSATION_EXTRA_BITS bits,
+ *          and then passed through the @ref sensor_filter of that channel.
+ *
+ * @param[in] block Pointer to the first Scan of the block that the DMA has just finished writing.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void publish_decimated_sample(const volatile uint16_t *block);
+
+uint16_t get_temp_sensor_adc_value(Temp_Sensor_Channel channel)
+{
+    return latest_sample.adc_values[channel];
+}
+
+int32_t convert_temp_sensor_adc_value_to_centi_celsius(uint16_t adc_value)
+{
+    return (int32_t) ((((uint32_t) adc_value)*ADC_TO_CENTI_CELSIUS_Q16_MULTIPLIER + (1UL << 15)) >> 16);
+}
+
+void get_temp_sensors_sample(temp_sensors_sample_t *sample)
+{
+    /** <b>Local variable write_count:</b> Value of @ref latest_sample_write_count before copying @ref latest_sample . */
+    uint32_t write_count;
+
+    /* Copy the latest decimated sample again whenever the DMA Interrupts have published a new one in the middle of the copy. */
+    do
+    {
+        write_count = latest_sample_write_count;
+        for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+        {
+            sample->adc_values[i] = latest_sample.adc_values[i];
+        }
+        sample->vdda_millivolts = latest_sample.vdda_millivolts;
+        sample->timestamp = latest_sample.timestamp;
+        sample->sequence = latest_sample.sequence;
+    } while ((write_count & 1U) || (write_count != latest_sample_write_count));
+}
+
+Temp_Sensors_Status get_temp_sensors_status(void)
+{
+    return temp_sensors_status;
+}
+
+Temp_Sensors_Status restart_temp_sensors_module(void)
+{
+    if (p_hadc == NULL)
+    {
+        return TEMP_SENSORS_EC_ERR;
+    }
+
+    /* Re-arm the ADC from the start of the Circular DMA buffer, while the Trigger Timer keeps pacing its conversions. */
+    HAL_ADC_Stop_DMA(p_hadc);
+    if (HAL_ADC_Start_DMA(p_hadc, (uint32_t *) temp_sensors_dma_buffer, DMA_BUFFER_LENGTH) != HAL_OK)
+    {
+        return TEMP_SENSORS_EC_ERR;
+    }
+    temp_sensors_status = TEMP_SENSORS_EC_OK;
+
+    return TEMP_SENSORS_EC_OK;
+}
+
+Temp_Sensors_Status calibrate_temp_sensors_adc(void)
+{
+    if (p_hadc == NULL)
+    {
+        return TEMP_SENSORS_EC_ERR;
+    }
+
+    /* The self-calibration can only be started while the ADC is disabled, which stopping its DMA conversions does. */
+    HAL_ADC_Stop_DMA(p_hadc);
+    if (HAL_ADCEx_Calibration_Start(p_hadc) != HAL_OK)
+    {
+        temp_sensors_status = TEMP_SENSORS_EC_ERR;
+        return TEMP_SENSORS_EC_ERR;
+    }
+
+    /* Re-arm the ADC from the start of the Circular DMA buffer, while the Trigger Timer keeps pacing its conversions. */
+    if (HAL_ADC_Start_DMA(p_hadc, (uint32_t *) temp_sensors_dma_buffer, DMA_BUFFER_LENGTH) != HAL_OK)
+    {
+        temp_sensors_status = TEMP_SENSORS_EC_ERR;
+        return TEMP_SENSORS_EC_ERR;
+    }
+
+    return TEMP_SENSORS_EC_OK;
+}
+
+Temp_Sensors_Status init_temp_sensors_module(ADC_HandleTypeDef *hadc, TIM_HandleTypeDef *htim, uint32_t tim_channel, const sensor_filter_config_t *filter_configs)
+{
+    /* Initialize the Median plus IIR Sensor Filter of each channel. */
+    for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+    {
+        if (init_sensor_filter(&temp_sensors_filters[i], &filter_configs[i]) != SENSOR_FILTER_EC_OK)
+        {
+            return TEMP_SENSORS_EC_ERR;
+        }
+    }
+
+    /* Persist the given ADC into the @ref temp_sensors . */
+    p_hadc = hadc;
+
+    /* Calibrate the offset of the ADC, which requires it to still be disabled as it is right after its initialization. */
+    if (HAL_ADCEx_Calibration_Start(p_hadc) != HAL_OK)
+    {
+        return TEMP_SENSORS_EC_ERR;
+    }
+
+    /* Arm the ADC so that each Trigger Timer event converts one Scan of the Temperature Sensors into the Circular DMA buffer. */
+    // NOTE: The DMA Half-Transfer and Transfer-Complete Interrupts will call the @ref HAL_ADC_ConvHalfCpltCallback and the @ref HAL_ADC_ConvCpltCallback functions each time that the first and the second block of Scans are completed respectively.
+    if (HAL_ADC_Start_DMA(p_hadc, (uint32_t *) temp_sensors_dma_buffer, DMA_BUFFER_LENGTH) != HAL_OK)
+    {
+        return TEMP_SENSORS_EC_ERR;
+    }
+
+    /* Start the Trigger Timer, which will pace the ADC conversions at a fixed rate from now on. */
+    if (HAL_TIM_PWM_Start(htim, tim_channel) != HAL_OK)
+    {
+        HAL_ADC_Stop_DMA(p_hadc);
+        return TEMP_SENSORS_EC_ERR;
+    }
+    temp_sensors_status = TEMP_SENSORS_EC_OK;
+
+    return TEMP_SENSORS_EC_OK;
+}
+
+static void publish_decimated_sample(const volatile uint16_t *block)
+{
+    /** <b>Local variable accumulators:</b> Sum of all the compensated Scans of the given block for each channel, with @ref COMPENSATION_EXTRA_BITS fractional bits. */
+    uint32_t accumulators[TEMP_SENSORS_TOTAL_CHANNELS] = {0};
+    /** <b>Local variable vrefint_accumulator:</b> Sum of all the valid VREFINT conversions of the given block. */
+    uint32_t vrefint_accumulator = 0;
+    /** <b>Local variable valid_vrefint_scans:</b> Number of Scans of the given block whose VREFINT conversion is valid. */
+    uint32_t valid_vrefint_scans = 0;
+    /** <b>Local variable vrefint:</b> VREFINT conversion of the current Scan. */
+    uint32_t vrefint;
+    /** <b>Local variable decimated_value:</b> Decimated sample of the current channel, before it is filtered. */
+    uint32_t decimated_value;
+    /** <b>Local variable filtered_values:</b> Decimated and filtered sample of each channel. */
+    uint16_t filtered_values[TEMP_SENSORS_TOTAL_CHANNELS];
+    /** <b>Local variable vdda_millivolts:</b> Average ADC supply voltage, in millivolts, during the given block. */
+    uint16_t vdda_millivolts = 0;
+
+    for (uint16_t scan=0; scan<TEMP_SENSORS_OVERSAMPLING_RATIO; scan++)
+    {
+        vrefint = block[scan*TEMP_SENSORS_ADC_TOTAL_CHANNELS + VREFINT_CHANNEL_INDEX];
+        if ((vrefint>=VREFINT_MIN_VALUE) && (vrefint<=VREFINT_MAX_VALUE))
+        {
+            // NOTE: The largest product is 4095*(TEMP_SENSORS_VREFINT_NOMINAL_VALUE << COMPENSATION_EXTRA_BITS), which fits in 32 bits.
+            for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+            {
+                accumulators[i] += (block[scan*TEMP_SENSORS_ADC_TOTAL_CHANNELS + i]*(TEMP_SENSORS_VREFINT_NOMINAL_VALUE << COMPENSATION_EXTRA_BITS) + vrefint/2) / vrefint;
+            }
+            vrefint_accumulator += vrefint;
+            valid_vrefint_scans++;
+        }
+        else
+        {
+            for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+            {
+                accumulators[i] += ((uint32_t) block[scan*TEMP_SENSORS_ADC_TOTAL_CHANNELS + i]) << COMPENSATION_EXTRA_BITS;
+            }
+        }
+    }
+    if (valid_vrefint_scans != 0)
+    {
+        vdda_millivolts = (TEMP_SENSORS_VREFINT_MILLIVOLTS*4095U*valid_vrefint_scans + vrefint_accumulator/2) / vrefint_accumulator;
+    }
+
+    for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+    {
+        decimated_value = accumulators[i] >> (TEMP_SENSORS_OVERSAMPLING_EXTRA_BITS + COMPENSATION_EXTRA_BITS);
+        if (decimated_value > TEMP_SENSORS_ADC_MAX_VALUE)
+        {
+            decimated_value = TEMP_SENSORS_ADC_MAX_VALUE;
+        }
+        filtered_values[i] = run_sensor_filter(&temp_sensors_filters[i], decimated_value);
+    }
+
+    latest_sample_write_count++;
+    for (uint8_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+    {
+        latest_sample.adc_values[i] = filtered_values[i];
+    }
+    latest_sample.vdda_millivolts = vdda_millivolts;
+    latest_sample.timestamp = HAL_GetTick();
+    latest_sample.sequence++;
+    latest_sample_write_count++;
+}
+
+/**@brief   This is the overridden function @ref HAL_ADC_ConvHalfCpltCallback that the STMicroelectronics Library
+ *          provides in order for the implementers of that function to state some desired actions for each time that
+ *          an ADC, in DMA Mode, completes half of the number of conversions requested to it.
+ *
+ * @details In this particular case, this overridden function will be used to decimate and publish the first block of
+ *          Scans of the Circular DMA buffer of the @ref temp_sensors while the DMA writes the second one.
+ *
+ * @note    This function must not be called by the implementer and the only reason it exists here is because it
+ *          overrides the @ref HAL_ADC_ConvHalfCpltCallback function provided by the STMicroelectronics Library.
+ *
+ * @param[in] hadc	Pointer to the ADC that has completed half of its conversions.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if ((p_hadc!=NULL) && (hadc->Instance==p_hadc->Instance))
+    {
+        publish_decimated_sample(&temp_sensors_dma_buffer[0]);
+    }
+}
+
+/**@brief   This is the overridden function @ref HAL_ADC_ConvCpltCallback that the STMicroelectronics Library provides in
+ *          order for the implementers of that function to state some desired actions for each time that an ADC, in DMA
+ *          Mode, completes the number of conversions requested to it.
+ *
+ * @details In this particular case, this overridden function will be used to decimate and publish the second block of
+ *          Scans of the Circular DMA buffer of the @ref temp_sensors while the DMA writes the first one.
+ *
+ * @note    This function must not be called by the implementer and the only reason it exists here is because it
+ *          overrides the @ref HAL_ADC_ConvCpltCallback function provided by the STMicroelectronics Library.
+ *
+ * @param[in] hadc	Pointer to the ADC that has completed its conversions.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+    if ((p_hadc!=NULL) && (hadc->Instance==p_hadc->Instance))
+    {
+        publish_decimated_sample(&temp_sensors_dma_buffer[TEMP_SENSORS_OVERSAMPLING_RATIO*TEMP_SENSORS_ADC_TOTAL_CHANNELS]);
+    }
+}
+
+/**@brief   This is the overridden function @ref HAL_ADC_ErrorCallback that the STMicroelectronics Library provides in
+ *          order for the implementers of that function to state some desired actions for each time that an ADC, or
+ *          its DMA, reports an error.
+ *
+ * @details In this particular case, this overridden function will be used to record that the conversions of the ADC
+ *          used by the @ref temp_sensors can no longer be trusted, so that the application can know about it via the
+ *          @ref get_temp_sensors_status function.
+ *
+ * @note    This function must not be called by the implementer and the only reason it exists here is because it
+ *          overrides the @ref HAL_ADC_ErrorCallback function provided by the STMicroelectronics Library.
+ *
+ * @param[in] hadc	Pointer to the ADC that has reported an error.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
+{
+    if ((p_hadc!=NULL) && (hadc->Instance==p_hadc->Instance))
+    {
+        temp_sensors_status = TEMP_SENSORS_EC_ERR;
+    }
+}
+
+/** @} */
@@ -0,0 +1,406 @@
+/** @addtogroup thermal_model
+ * @{
+ */
+
+#include "thermal_model.h"
+
+#define THERMAL_MODEL_ONE                   ((int64_t) 1 << THERMAL_MODEL_Q32_SHIFT)    /**< @brief Value of 1 in Q32.32 Fixed-Point format. */
+#define THERMAL_MODEL_INITIAL_COVARIANCE    (1000*THERMAL_MODEL_ONE)                    /**< @brief Value of the diagonal elements of the covariance matrix of each RLS estimator when it starts, which stands for no confidence at all on its initial parameters, and up to which that covariance may be inflated by the forgetting factor. */
+#define THERMAL_MODEL_MAX_ERROR             (64*THERMAL_MODEL_ONE)                      /**< @brief Largest a priori prediction error, in normalized measurement units and in Q32.32 Fixed-Point format, with which an RLS estimator is updated, so that a single outlier cannot overflow its calculations. */
+#define THERMAL_MODEL_ERROR_FILTER_SHIFT    (5)                                         /**< @brief Number of bits by which the change of the filtered power of the a priori prediction error is divided with each sample, which makes that filter remember about the latest 32 samples. */
+#define THERMAL_MODEL_MAX_RATIO             ((int64_t) 1 << 47)                         /**< @brief Largest magnitude, in Q32.32 Fixed-Point format, of the ratios between the estimated parameters that are converted into measurement units, so that those conversions cannot overflow. */
+
+/**@brief	Multiplies two Q32.32 Fixed-Point values without overflowing in between, since our MCU/MPU has no 128-bit
+ *          integers.
+ *
+ * @param a First factor in Q32.32 Fixed-Point format.
+ * @param b Second factor in Q32.32 Fixed-Point format.
+ *
+ * @return  The product of the \p a and \p b params in Q32.32 Fixed-Point format, which is only valid if its magnitude
+ *          is lower than \f$2^{31}\f$ .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static int64_t multiply_q32(int64_t a, int64_t b);
+
+/**@brief	Divides two Q32.32 Fixed-Point values without overflowing in between, by long division of their magnitudes.
+ *
+ * @param a Dividend in Q32.32 Fixed-Point format.
+ * @param b Divisor in Q32.32 Fixed-Point format, which must not be zero.
+ *
+ * @return  The quotient of the \p a and \p b params in Q32.32 Fixed-Point format, which is saturated to the largest
+ *          positive or negative value of that format if its magnitude is not lower than \f$2^{31}\f$ .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static int64_t divide_q32(int64_t a, int64_t b);
+
+/**@brief	Limits a Q32.32 Fixed-Point ratio between estimated parameters to @ref THERMAL_MODEL_MAX_RATIO .
+ *
+ * @param ratio Ratio in Q32.32 Fixed-Point format.
+ *
+ * @return  The \p ratio param, limited to plus or minus @ref THERMAL_MODEL_MAX_RATIO .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static int64_t limit_ratio(int64_t ratio);
+
+/**@brief	Resets an RLS estimator of the @ref thermal_model into zero parameters and an initial covariance of
+ *          @ref THERMAL_MODEL_INITIAL_COVARIANCE times the identity matrix.
+ *
+ * @param[out] rls  Pointer to the RLS estimator that wants to be reset.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void reset_thermal_model_rls(thermal_model_rls_t *rls);
+
+/**@brief	Updates an RLS estimator of the @ref thermal_model with one sample.
+ *
+ * @param[in] model         Pointer to the Identifier to which the \p rls param belongs.
+ * @param[in,out] rls       Pointer to the RLS estimator that wants to be updated.
+ * @param[in] regressors    Pointer to the @ref THERMAL_MODEL_TOTAL_PARAMETERS regressors of the sample (i.e.,
+ *                          \f$-y_{k-1}\f$ , \f$u_{k-d}\f$ and 1) in Q32.32 Fixed-Point format.
+ * @param target            Change of the normalized measurement during the sample (i.e., \f$y_k - y_{k-1}\f$ ) in
+ *                          Q32.32 Fixed-Point format.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void update_thermal_model_rls(const thermal_model_t *model, thermal_model_rls_t *rls, const int64_t *regressors, int64_t target);
+
+void run_thermal_model(thermal_model_t *model, int32_t measurement, int32_t input, uint32_t tick)
+{
+    /** <b>Local variable measurement_avg:</b> Average of the measurements of the sample. */
+    int32_t measurement_avg;
+    /** <b>Local variable normalized_measurement:</b> Average of the measurements of the sample, relative to the @ref thermal_model_t::reference and normalized, in Q32.32 Fixed-Point format. */
+    int64_t normalized_measurement;
+    /** <b>Local variable normalized_input:</b> Average of the inputs of the sample, normalized, in Q32.32 Fixed-Point format. */
+    int64_t normalized_input;
+    /** <b>Local variable regressors:</b> Regressors of the sample for the RLS estimator of each candidate dead time. */
+    int64_t regressors[THERMAL_MODEL_TOTAL_PARAMETERS];
+
+    /* Average the measurements and inputs until a whole sample period has elapsed. */
+    if (!model->is_started && (model->total_sums == 0))
+    {
+        model->sample_start_tick = tick;
+    }
+    model->measurements_sum += measurement;
+    model->inputs_sum += input;
+    model->total_sums++;
+    if ((tick - model->sample_start_tick) < model->config.sample_period)
+    {
+        return;
+    }
+    measurement_avg = (int32_t) (model->measurements_sum / model->total_sums);
+    normalized_input = ((model->inputs_sum / model->total_sums) << THERMAL_MODEL_Q32_SHIFT) / model->config.input_scale;
+    model->measurements_sum = 0;
+    model->inputs_sum = 0;
+    model->total_sums = 0;
+    model->sample_start_tick = tick;
+
+    /* The first sample only sets the reference of the measurements and the initial history of the inputs. */
+    if (!model->is_started)
+    {
+        model->reference = measurement_avg;
+        model->previous_measurement = 0;
+        for (uint8_t i=0; i<THERMAL_MODEL_DEAD_TIME_CANDIDATES; i++)
+        {
+            model->inputs[i] = normalized_input;
+        }
+        model->is_started = 1;
+        return;
+    }
+
+    /* Shift the new input into the history of the inputs. */
+    for (uint8_t i=THERMAL_MODEL_DEAD_TIME_CANDIDATES-1; i>0; i--)
+    {
+        model->inputs[i] = model->inputs[i-1];
+    }
+    model->inputs[0] = normalized_input;
+
+    /* Update the RLS estimator of each candidate dead time with the input that was applied that many samples ago. */
+    normalized_measurement = (((int64_t) measurement_avg - model->reference) << THERMAL_MODEL_Q32_SHIFT) / model->config.measurement_scale;
+    regressors[0] = -model->previous_measurement;
+    regressors[2] = THERMAL_MODEL_ONE;
+    for (uint8_t i=0; i<THERMAL_MODEL_DEAD_TIME_CANDIDATES; i++)
+    {
+        regressors[1] = model->inputs[i];
+        update_thermal_model_rls(model, &model->rls[i], regressors, normalized_measurement - model->previous_measurement);
+    }
+    model->previous_measurement = normalized_measurement;
+    if (model->samples < UINT32_MAX)
+    {
+        model->samples++;
+    }
+}
+
+Thermal_Model_Status get_thermal_model_estimate(const thermal_model_t *model, thermal_model_estimate_t *estimate)
+{
+    /** <b>Local variable best:</b> RLS estimator whose candidate dead time has the lowest filtered power of its a priori prediction error. */
+    uint8_t best = 0;
+    /** <b>Local variable alpha:</b> Estimated \f$\alpha\f$ parameter of the best RLS estimator in Q32.32 Fixed-Point format. */
+    int64_t alpha;
+    /** <b>Local variable ratio:</b> Ratio between two of the estimated parameters in Q32.32 Fixed-Point format. */
+    int64_t ratio;
+    /** <b>Local variable value:</b> Result of converting a ratio into measurement units, before limiting it into 32 bits. */
+    int64_t value;
+
+    estimate->samples = model->samples;
+    if (model->samples < model->config.min_samples)
+    {
+        return THERMAL_MODEL_EC_NO_DATA;
+    }
+    for (uint8_t i=1; i<THERMAL_MODEL_DEAD_TIME_CANDIDATES; i++)
+    {
+        if (model->rls[i].error_power < model->rls[best].error_power)
+        {
+            best = i;
+        }
+    }
+
+    /* The process is only stable if alpha is between zero and one, where its time constant must also fit in 32 bits. */
+    // NOTE: A time constant of sample_period/alpha milliseconds is lower than 2^31 only if alpha, in Q32.32 Fixed-Point format, is greater than twice the sample period.
+    alpha = model->rls[best].parameters[0];
+    if ((alpha <= ((int64_t) model->config.sample_period << 1)) || (alpha >= THERMAL_MODEL_ONE))
+    {
+        return THERMAL_MODEL_EC_NO_DATA;
+    }
+    estimate->time_constant = (uint32_t) (divide_q32((int64_t) model->config.sample_period << THERMAL_MODEL_Q32_SHIFT, alpha) >> THERMAL_MODEL_Q32_SHIFT) - model->config.sample_period/2;
+    estimate->dead_time = best * model->config.sample_period;
+
+    /* Convert the normalized steady-state gain b/alpha into measurement units per input unit in Q16 Fixed-Point format. */
+    ratio = limit_ratio(divide_q32(model->rls[best].parameters[1], alpha));
+    value = ((ratio >> (THERMAL_MODEL_Q32_SHIFT-PID_CONTROLLER_Q16_SHIFT)) * model->config.measurement_scale) / model->config.input_scale;
+    estimate->gain = (int32_t) ((value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : value));
+
+    /* Convert the normalized equilibrium c/alpha into measurement units relative to zero. */
+    ratio = limit_ratio(divide_q32(model->rls[best].parameters[2], alpha));
+    value = model->reference + (((ratio >> PID_CONTROLLER_Q16_SHIFT) * model->config.measurement_scale) >> (THERMAL_MODEL_Q32_SHIFT-PID_CONTROLLER_Q16_SHIFT));
+    estimate->equilibrium = (int32_t) ((value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : value));
+
+    return THERMAL_MODEL_EC_OK;
+}
+
+Thermal_Model_Status calculate_thermal_model_pid_gains(const thermal_model_estimate_t *estimate, uint32_t closed_loop_time_constant, int32_t *kp, int32_t *ki)
+{
+    /** <b>Local variable tau_plus_theta:</b> Sum of the desired closed-loop time constant and of the dead time, in milliseconds. */
+    int64_t tau_plus_theta = (int64_t) closed_loop_time_constant + estimate->dead_time;
+    /** <b>Local variable integral_time:</b> Integral time of the PI Controller, in milliseconds. */
+    int64_t integral_time = (estimate->time_constant < 4*tau_plus_theta) ? estimate->time_constant : 4*tau_plus_theta;
+    /** <b>Local variable ratio:</b> Ratio of the time constant of the model to the sum of the desired closed-loop time constant and of the dead time, in Q16 Fixed-Point format. */
+    int64_t ratio;
+    /** <b>Local variable new_kp:</b> Proportional gain in Q16 Fixed-Point format. */
+    int64_t new_kp;
+    /** <b>Local variable new_ki:</b> Integral gain in Q16 Fixed-Point format. */
+    int64_t new_ki;
+
+    if ((estimate->gain <= 0) || (tau_plus_theta == 0) || (integral_time == 0))
+    {
+        return THERMAL_MODEL_EC_ERR;
+    }
+    ratio = ((int64_t) estimate->time_constant << PID_CONTROLLER_Q16_SHIFT) / tau_plus_theta;
+    if (ratio > INT32_MAX)
+    {
+        return THERMAL_MODEL_EC_ERR;
+    }
+
+    /* Calculate the SIMC gains, where the integral time is given in milliseconds. */
+    new_kp = (ratio << PID_CONTROLLER_Q16_SHIFT) / estimate->gain;
+    new_ki = (new_kp*1000) / integral_time;
+    if ((new_kp > INT32_MAX) || (new_ki > INT32_MAX))
+    {
+        return THERMAL_MODEL_EC_ERR;
+    }
+    *kp = (int32_t) new_kp;
+    *ki = (int32_t) new_ki;
+
+    return THERMAL_MODEL_EC_OK;
+}
+
+Thermal_Model_Status init_thermal_model(thermal_model_t *model, const thermal_model_config_t *config)
+{
+    /* Validate the given configuration. */
+    if ((config->sample_period==0) || (config->forgetting_factor==0) || (config->measurement_scale==0) || (config->input_scale==0))
+    {
+        return THERMAL_MODEL_EC_ERR;
+    }
+
+    model->config = *config;
+    model->inverse_forgetting_factor = divide_q32(THERMAL_MODEL_ONE, (int64_t) config->forgetting_factor << (THERMAL_MODEL_Q32_SHIFT-16));
+    for (uint8_t i=0; i<THERMAL_MODEL_DEAD_TIME_CANDIDATES; i++)
+    {
+        reset_thermal_model_rls(&model->rls[i]);
+        model->inputs[i] = 0;
+    }
+    model->previous_measurement = 0;
+    model->reference = 0;
+    model->measurements_sum = 0;
+    model->inputs_sum = 0;
+    model->total_sums = 0;
+    model->sample_start_tick = 0;
+    model->samples = 0;
+    model->is_started = 0;
+
+    return THERMAL_MODEL_EC_OK;
+}
+
+static int64_t multiply_q32(int64_t a, int64_t b)
+{
+    /** <b>Local variable is_negative:</b> Flag that indicates whether the product is negative or not. */
+    uint8_t is_negative = ((a < 0) != (b < 0)) ? 1 : 0;
+    /** <b>Local variable magnitude_a:</b> Magnitude of the \p a param. */
+    uint64_t magnitude_a = (a < 0) ? -((uint64_t) a) : (uint64_t) a;
+    /** <b>Local variable magnitude_b:</b> Magnitude of the \p b param. */
+    uint64_t magnitude_b = (b < 0) ? -((uint64_t) b) : (uint64_t) b;
+    /** <b>Local variable a_high:</b> Integer part of the magnitude of the \p a param. */
+    uint64_t a_high = magnitude_a >> 32;
+    /** <b>Local variable a_low:</b> Fractional part of the magnitude of the \p a param. */
+    uint64_t a_low = magnitude_a & 0xFFFFFFFFU;
+    /** <b>Local variable b_high:</b> Integer part of the magnitude of the \p b param. */
+    uint64_t b_high = magnitude_b >> 32;
+    /** <b>Local variable b_low:</b> Fractional part of the magnitude of the \p b param. */
+    uint64_t b_low = magnitude_b & 0xFFFFFFFFU;
+    /** <b>Local variable product:</b> Magnitude of the product, made out of the four 32-bit partial products. */
+    uint64_t product = ((a_high*b_high) << 32) + a_high*b_low + a_low*b_high + ((a_low*b_low) >> 32);
+
+    return is_negative ? -((int64_t) product) : (int64_t) product;
+}
+
+static int64_t divide_q32(int64_t a, int64_t b)
+{
+    /** <b>Local variable is_negative:</b> Flag that indicates whether the quotient is negative or not. */
+    uint8_t is_negative = ((a < 0) != (b < 0)) ? 1 : 0;
+    /** <b>Local variable magnitude_a:</b> Magnitude of the \p a param. */
+    uint64_t magnitude_a = (a < 0) ? -((uint64_t) a) : (uint64_t) a;
+    /** <b>Local variable magnitude_b:</b> Magnitude of the \p b param. */
+    uint64_t magnitude_b = (b < 0) ? -((uint64_t) b) : (uint64_t) b;
+    /** <b>Local variable quotient:</b> Magnitude of the quotient, whose fractional bits are obtained one at a time. */
+    uint64_t quotient = magnitude_a / magnitude_b;
+    /** <b>Local variable remainder:</b> Remainder of the long division. */
+    uint64_t remainder = magnitude_a % magnitude_b;
+
+    if ((quotient >> 31) != 0)
+    {
+        return is_negative ? -INT64_MAX : INT64_MAX;
+    }
+    for (uint8_t i=0; i<THERMAL_MODEL_Q32_SHIFT; i++)
+    {
+        quotient <<= 1;
+        remainder <<= 1;
+        if (remainder >= magnitude_b)
+        {
+            remainder -= magnitude_b;
+            quotient |= 1;
+        }
+    }
+
+    return is_negative ? -((int64_t) quotient) : (int64_t) quotient;
+}
+
+static int64_t limit_ratio(int64_t ratio)
+{
+    if (ratio > THERMAL_MODEL_MAX_RATIO)
+    {
+        return THERMAL_MODEL_MAX_RATIO;
+    }
+    if (ratio < -THERMAL_MODEL_MAX_RATIO)
+    {
+        return -THERMAL_MODEL_MAX_RATIO;
+    }
+    return ratio;
+}
+
+static void reset_thermal_model_rls(thermal_model_rls_t *rls)
+{
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        rls->parameters[i] = 0;
+        for (uint8_t j=0; j<THERMAL_MODEL_TOTAL_PARAMETERS; j++)
+        {
+            rls->covariance[i][j] = (i == j) ? THERMAL_MODEL_INITIAL_COVARIANCE : 0;
+        }
+    }
+    rls->error_power = 0;
+}
+
+static void update_thermal_model_rls(const thermal_model_t *model, thermal_model_rls_t *rls, const int64_t *regressors, int64_t target)
+{
+    /** <b>Local variable covariance_regressors:</b> Product of the covariance matrix and the regressors (i.e., \f$P \varphi\f$ ). */
+    int64_t covariance_regressors[THERMAL_MODEL_TOTAL_PARAMETERS];
+    /** <b>Local variable gains:</b> Gains of the RLS estimator (i.e., \f$\frac{P \varphi}{\lambda + \varphi^T P \varphi}\f$ ). */
+    int64_t gains[THERMAL_MODEL_TOTAL_PARAMETERS];
+    /** <b>Local variable denominator:</b> Forgetting factor plus the variance of the prediction (i.e., \f$\lambda + \varphi^T P \varphi\f$ ). */
+    int64_t denominator = (int64_t) model->config.forgetting_factor << (THERMAL_MODEL_Q32_SHIFT-16);
+    /** <b>Local variable error:</b> A priori prediction error of the sample. */
+    int64_t error = target;
+    /** <b>Local variable is_forgetting:</b> Flag that indicates whether the covariance matrix is inflated by the forgetting factor or not. */
+    uint8_t is_forgetting = 1;
+
+    /* Calculate the gains and the a priori prediction error with the current parameters. */
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        covariance_regressors[i] = 0;
+        for (uint8_t j=0; j<THERMAL_MODEL_TOTAL_PARAMETERS; j++)
+        {
+            covariance_regressors[i] += multiply_q32(rls->covariance[i][j], regressors[j]);
+        }
+    }
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        denominator += multiply_q32(regressors[i], covariance_regressors[i]);
+        error -= multiply_q32(regressors[i], rls->parameters[i]);
+    }
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        gains[i] = divide_q32(covariance_regressors[i], denominator);
+    }
+    error = (error > THERMAL_MODEL_MAX_ERROR) ? THERMAL_MODEL_MAX_ERROR : ((error < -THERMAL_MODEL_MAX_ERROR) ? -THERMAL_MODEL_MAX_ERROR : error);
+    rls->error_power += (multiply_q32(error, error) - rls->error_power) >> THERMAL_MODEL_ERROR_FILTER_SHIFT;
+
+    /* Correct the parameters and shrink the covariance matrix (i.e., P - (P phi)(P phi)^T / denominator), which is symmetric and, therefore, only its upper triangle is calculated. */
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        rls->parameters[i] += multiply_q32(gains[i], error);
+        for (uint8_t j=i; j<THERMAL_MODEL_TOTAL_PARAMETERS; j++)
+        {
+            rls->covariance[i][j] -= multiply_q32(gains[i], covariance_regressors[j]);
+        }
+    }
+
+    /* Start over with no confidence if the rounding errors have made the covariance matrix lose its positive diagonal, or stop forgetting while its diagonal is already at its initial value. */
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        if (rls->covariance[i][i] <= 0)
+        {
+            for (uint8_t j=0; j<THERMAL_MODEL_TOTAL_PARAMETERS; j++)
+            {
+                for (uint8_t k=0; k<THERMAL_MODEL_TOTAL_PARAMETERS; k++)
+                {
+                    rls->covariance[j][k] = (j == k) ? THERMAL_MODEL_INITIAL_COVARIANCE : 0;
+                }
+            }
+            return;
+        }
+        if (rls->covariance[i][i] >= THERMAL_MODEL_INITIAL_COVARIANCE)
+        {
+            is_forgetting = 0;
+        }
+    }
+    for (uint8_t i=0; i<THERMAL_MODEL_TOTAL_PARAMETERS; i++)
+    {
+        for (uint8_t j=i; j<THERMAL_MODEL_TOTAL_PARAMETERS; j++)
+        {
+            if (is_forgetting)
+            {
+                rls->covariance[i][j] = multiply_q32(rls->covariance[i][j], model->inverse_forgetting_factor);
+            }
+            rls->covariance[j][i] = rls->covariance[i][j];
+        }
+    }
+}
+
+/** @} */
@@ -0,0 +1,82 @@
+/** @addtogroup time_proportional_output
+ * @{
+ */
+
+#include "time_proportional_output.h"
+
+uint8_t run_time_proportional_output(time_proportional_output_t *tpo, uint32_t tick)
+{
+    /** <b>Local variable elapsed_time:</b> Time, in milliseconds, that has elapsed since the current window started. */
+    uint32_t elapsed_time = tick - tpo->window_start_tick;
+    /** <b>Local variable should_be_on:</b> Flag that indicates whether the actuator should be On at this point of the current window. */
+    uint8_t should_be_on;
+
+    /* Start a new window once the current one has elapsed, with the On time given by the latest Duty Cycle. */
+    if (elapsed_time >= tpo->config.window)
+    {
+        tpo->window_start_tick += (elapsed_time/tpo->config.window) * tpo->config.window;
+        elapsed_time = tick - tpo->window_start_tick;
+        tpo->on_time = ((uint32_t) tpo->duty_cycle * tpo->config.window) / TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE;
+
+        /* Skip any On or Off time that would be shorter than the allowed ones. */
+        if (tpo->on_time < tpo->config.min_on_time)
+        {
+            tpo->on_time = 0;
+        }
+        else if ((tpo->config.window - tpo->on_time) < tpo->config.min_off_time)
+        {
+            tpo->on_time = tpo->config.window;
+        }
+    }
+    should_be_on = (elapsed_time < tpo->on_time) ? 1 : 0;
+
+    /* Change the state of the actuator only once it has been kept in its current state for at least its minimum time. */
+    if (should_be_on != tpo->is_on)
+    {
+        if ((tick - tpo->last_switch_tick) >= (tpo->is_on ? tpo->config.min_on_time : tpo->config.min_off_time))
+        {
+            tpo->is_on = should_be_on;
+            tpo->last_switch_tick = tick;
+        }
+    }
+
+    return tpo->is_on;
+}
+
+void set_time_proportional_output_duty_cycle(time_proportional_output_t *tpo, int32_t duty_cycle)
+{
+    if (duty_cycle < 0)
+    {
+        duty_cycle = 0;
+    }
+    else if (duty_cycle > TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE)
+    {
+        duty_cycle = TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE;
+    }
+    tpo->duty_cycle = (uint16_t) duty_cycle;
+}
+
+void reset_time_proportional_output(time_proportional_output_t *tpo, uint32_t tick)
+{
+    tpo->duty_cycle = 0;
+    tpo->on_time = 0;
+    tpo->window_start_tick = tick;
+    tpo->last_switch_tick = tick;
+    tpo->is_on = 0;
+}
+
+Time_Proportional_Output_Status init_time_proportional_output(time_proportional_output_t *tpo, const time_proportional_output_config_t *config, uint32_t tick)
+{
+    /* Validate the given configuration. */
+    if ((config->window==0) || (config->min_on_time>=config->window) || (config->min_off_time>=config->window))
+    {
+        return TIME_PROPORTIONAL_OUTPUT_EC_ERR;
+    }
+
+    tpo->config = *config;
+    reset_time_proportional_output(tpo, tick);
+
+    return TIME_PROPORTIONAL_OUTPUT_EC_OK;
+}
+
+/** @} */
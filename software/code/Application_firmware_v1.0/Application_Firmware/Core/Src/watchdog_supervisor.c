@@ -0,0 +1,225 @@
+/** @addtogroup watchdog_supervisor
+ * @{
+ */
+
+#include "watchdog_supervisor.h"
+
+#define IWDG_KEY_RELOAD                     (0xAAAAU)       /**< @brief Key that reloads the counter of the IWDG. */
+#define IWDG_KEY_ENABLE                     (0xCCCCU)       /**< @brief Key that starts the IWDG. */
+#define IWDG_KEY_WRITE_ACCESS               (0x5555U)       /**< @brief Key that enables the write access to the Prescaler and Reload registers of the IWDG. */
+#define IWDG_PRESCALER_DIV64                (4U)            /**< @brief Value of the Prescaler register of the IWDG that divides the LSI by 64. */
+#define IWDG_MAX_RELOAD                     (0x0FFFU)       /**< @brief Highest value of the 12-bit Reload register of the IWDG. */
+#define IWDG_COUNTER_FREQUENCY              (WATCHDOG_SUPERVISOR_LSI_FREQUENCY/64)   /**< @brief Typical frequency, in Hertz, at which the counter of the IWDG is decremented. */
+#define RETAINED_DATA_MAGIC                 (0x57445356U)   /**< @brief Value with which the retained data of the @ref watchdog_supervisor is marked as valid. */
+
+/**@brief	Data of the @ref watchdog_supervisor that is retained across any reset other than a Power-On one.
+ */
+typedef struct
+{
+    uint32_t magic;                     //!< @ref RETAINED_DATA_MAGIC if this data is valid.
+    uint32_t total_resets;              //!< Number of resets since our MCU/MPU was powered On.
+    uint32_t watchdog_resets;           //!< Number of those resets that were made by the IWDG.
+    uint8_t late_task;                  //!< Index of the task that is currently late, or @ref WATCHDOG_SUPERVISOR_NO_TASK if none.
+    uint8_t last_checked_in_task;       //!< Index of the task that lastly checked in, or @ref WATCHDOG_SUPERVISOR_NO_TASK if none.
+    uint16_t reserved;                  //!< Padding that keeps the next field aligned.
+    uint32_t inverted_magic;            //!< Bitwise complement of the @ref RETAINED_DATA_MAGIC if this data is valid.
+} watchdog_supervisor_retained_t;
+
+static watchdog_supervisor_retained_t retained_data __attribute__((section(".noinit")));    /**< @brief Data of the @ref watchdog_supervisor that is kept in the retained RAM section, which is neither initialized nor zeroed by the startup code. */
+static watchdog_supervisor_reset_info_t reset_info;                                         /**< @brief Information about the latest reset of our MCU/MPU. */
+static uint8_t total_supervised_tasks = 0;                                                  /**< @brief Number of tasks that are supervised by the @ref watchdog_supervisor . */
+static uint32_t check_in_windows[TASK_SCHEDULER_MAX_TASKS];                                 /**< @brief Longest time, in milliseconds, that may elapse between two consecutive check-ins of each task. */
+static uint32_t last_check_in_ticks[TASK_SCHEDULER_MAX_TASKS];                              /**< @brief HAL Tick at which each task lastly checked in. */
+static uint32_t checked_in_tasks = 0;                                                       /**< @brief Bitmask of the tasks that have checked in since the IWDG was lastly reloaded. */
+static uint32_t all_tasks_mask = 0;                                                         /**< @brief Bitmask with one bit set for each of the supervised tasks. */
+
+/**@brief   Gets the cause of the latest reset of our MCU/MPU from its reset flags and then clears those flags.
+ *
+ * @return  The cause of the latest reset.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static Reset_Cause read_and_clear_reset_cause(void);
+
+void watchdog_supervisor_check_in(uint8_t task)
+{
+    if (task >= total_supervised_tasks)
+    {
+        return;
+    }
+
+    last_check_in_ticks[task] = HAL_GetTick();
+    checked_in_tasks |= (1UL << task);
+    retained_data.last_checked_in_task = task;
+}
+
+Watchdog_Supervisor_Status run_watchdog_supervisor(void)
+{
+    /** <b>Local variable current_tick:</b> Current HAL Tick in our MCU/MPU. */
+    uint32_t current_tick = HAL_GetTick();
+
+    if (total_supervised_tasks == 0)
+    {
+        return WATCHDOG_SUPERVISOR_EC_ERR;
+    }
+
+    /* Withhold the reload of the IWDG while any task is late, and remember it in case the IWDG ends up resetting our MCU/MPU. */
+    for (uint8_t i=0; i<total_supervised_tasks; i++)
+    {
+        if ((current_tick - last_check_in_ticks[i]) > check_in_windows[i])
+        {
+            retained_data.late_task = i;
+            return WATCHDOG_SUPERVISOR_EC_ERR;
+        }
+    }
+    retained_data.late_task = WATCHDOG_SUPERVISOR_NO_TASK;
+
+    /* Reload the IWDG only once all the tasks have checked in since its previous reload. */
+    if (checked_in_tasks == all_tasks_mask)
+    {
+        IWDG->KR = IWDG_KEY_RELOAD;
+        checked_in_tasks = 0;
+    }
+
+    return WATCHDOG_SUPERVISOR_EC_OK;
+}
+
+Watchdog_Supervisor_Status refresh_watchdog_supervisor(void)
+{
+    /** <b>Local variable current_tick:</b> Current HAL Tick in our MCU/MPU. */
+    uint32_t current_tick = HAL_GetTick();
+
+    if (total_supervised_tasks == 0)
+    {
+        return WATCHDOG_SUPERVISOR_EC_ERR;
+    }
+
+    /* Never hide a task that is already late, so that the IWDG still resets our MCU/MPU because of it. */
+    for (uint8_t i=0; i<total_supervised_tasks; i++)
+    {
+        if ((current_tick - last_check_in_ticks[i]) > check_in_windows[i])
+        {
+            return WATCHDOG_SUPERVISOR_EC_ERR;
+        }
+    }
+    IWDG->KR = IWDG_KEY_RELOAD;
+
+    return WATCHDOG_SUPERVISOR_EC_OK;
+}
+
+void get_watchdog_supervisor_reset_info(watchdog_supervisor_reset_info_t *info)
+{
+    *info = reset_info;
+}
+
+Watchdog_Supervisor_Status init_watchdog_supervisor(const task_scheduler_task_t *tasks, uint8_t total_tasks, uint32_t timeout)
+{
+    /** <b>Local variable current_tick:</b> Current HAL Tick in our MCU/MPU. */
+    uint32_t current_tick = HAL_GetTick();
+    /** <b>Local variable reload:</b> Value of the Reload register of the IWDG that stands for the requested timeout. */
+    uint32_t reload = (timeout*IWDG_COUNTER_FREQUENCY) / 1000;
+
+    /* Validate the given parameters, including that the IWDG timeout is longer than the check-in window of every task. */
+    if ((tasks==NULL) || (total_tasks==0) || (total_tasks>TASK_SCHEDULER_MAX_TASKS) || (timeout>WATCHDOG_SUPERVISOR_MAX_TIMEOUT) || (reload==0))
+    {
+        return WATCHDOG_SUPERVISOR_EC_ERR;
+    }
+    for (uint8_t i=0; i<total_tasks; i++)
+    {
+        if ((tasks[i].period + tasks[i].deadline) >= timeout)
+        {
+            return WATCHDOG_SUPERVISOR_EC_ERR;
+        }
+    }
+
+    /* Record the cause of the latest reset, whose counters are only kept across the resets that are not Power-On ones. */
+    reset_info.cause = read_and_clear_reset_cause();
+    if ((reset_info.cause==RESET_CAUSE_POWER_ON) || (retained_data.magic!=RETAINED_DATA_MAGIC) || (retained_data.inverted_magic!=~RETAINED_DATA_MAGIC))
+    {
+        retained_data.total_resets = 0;
+        retained_data.watchdog_resets = 0;
+        retained_data.late_task = WATCHDOG_SUPERVISOR_NO_TASK;
+        retained_data.last_checked_in_task = WATCHDOG_SUPERVISOR_NO_TASK;
+    }
+    retained_data.total_resets++;
+    if (reset_info.cause == RESET_CAUSE_INDEPENDENT_WATCHDOG)
+    {
+        retained_data.watchdog_resets++;
+    }
+    reset_info.late_task = retained_data.late_task;
+    reset_info.last_checked_in_task = retained_data.last_checked_in_task;
+    reset_info.total_resets = retained_data.total_resets;
+    reset_info.watchdog_resets = retained_data.watchdog_resets;
+    retained_data.late_task = WATCHDOG_SUPERVISOR_NO_TASK;
+    retained_data.last_checked_in_task = WATCHDOG_SUPERVISOR_NO_TASK;
+    retained_data.reserved = 0;
+    retained_data.magic = RETAINED_DATA_MAGIC;
+    retained_data.inverted_magic = ~RETAINED_DATA_MAGIC;
+
+    /* Consider that all the given tasks have just checked in. */
+    for (uint8_t i=0; i<total_tasks; i++)
+    {
+        check_in_windows[i] = tasks[i].period + tasks[i].deadline;
+        last_check_in_ticks[i] = current_tick;
+    }
+    all_tasks_mask = (1UL << total_tasks) - 1;
+    checked_in_tasks = 0;
+    total_supervised_tasks = total_tasks;
+
+    /* Freeze the IWDG while the Core is halted by a debugger, and then start it with the requested timeout. */
+    DBGMCU->CR |= DBGMCU_CR_DBG_IWDG_STOP;
+    IWDG->KR = IWDG_KEY_ENABLE;
+    IWDG->KR = IWDG_KEY_WRITE_ACCESS;
+    IWDG->PR = IWDG_PRESCALER_DIV64;
+    IWDG->RLR = (reload > IWDG_MAX_RELOAD) ? IWDG_MAX_RELOAD : reload;
+    while (IWDG->SR != 0)
+    {
+        // Wait for the Prescaler and Reload registers to be updated in the LSI clock domain, which takes a few LSI cycles.
+    }
+    IWDG->KR = IWDG_KEY_RELOAD;
+
+    return WATCHDOG_SUPERVISOR_EC_OK;
+}
+
+static Reset_Cause read_and_clear_reset_cause(void)
+{
+    /** <b>Local variable csr:</b> Value of the Control/Status register of the RCC, which holds the reset flags. */
+    uint32_t csr = RCC->CSR;
+    /** <b>Local variable cause:</b> Cause of the latest reset. */
+    Reset_Cause cause;
+
+    if (csr & RCC_CSR_LPWRRSTF)
+    {
+        cause = RESET_CAUSE_LOW_POWER;
+    }
+    else if (csr & RCC_CSR_WWDGRSTF)
+    {
+        cause = RESET_CAUSE_WINDOW_WATCHDOG;
+    }
+    else if (csr & RCC_CSR_IWDGRSTF)
+    {
+        cause = RESET_CAUSE_INDEPENDENT_WATCHDOG;
+    }
+    else if (csr & RCC_CSR_SFTRSTF)
+    {
+        cause = RESET_CAUSE_SOFTWARE;
+    }
+    else if (csr & RCC_CSR_PORRSTF)
+    {
+        cause = RESET_CAUSE_POWER_ON;
+    }
+    else if (csr & RCC_CSR_PINRSTF)
+    {
+        cause = RESET_CAUSE_PIN;
+    }
+    else
+    {
+        cause = RESET_CAUSE_UNKNOWN;
+    }
+    RCC->CSR |= RCC_CSR_RMVF;
+
+    return cause;
+}
+
+/** @} */
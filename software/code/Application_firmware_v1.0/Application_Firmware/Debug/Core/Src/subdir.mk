@@ -1,57 +0,0 @@
-################################################################################
-# Automatically-generated file. Do not edit!
-# Toolchain: GNU Tools for STM32 (11.3.rel1)
-################################################################################
-
-# Add inputs and outputs from these tool invocations to the build variables 
-C_SRCS += \
-../Core/Src/5641as_display_driver.c \
-../Core/Src/app_side_etx_ota.c \
-../Core/Src/crc32_mpeg2.c \
-../Core/Src/firmware_update_config.c \
-../Core/Src/hm10_ble_driver.c \
-../Core/Src/main.c \
-../Core/Src/stm32f1xx_hal_msp.c \
-../Core/Src/stm32f1xx_it.c \
-../Core/Src/syscalls.c \
-../Core/Src/sysmem.c \
-../Core/Src/system_stm32f1xx.c 
-
-OBJS += \
-./Core/Src/5641as_display_driver.o \
-./Core/Src/app_side_etx_ota.o \
-./Core/Src/crc32_mpeg2.o \
-./Core/Src/firmware_update_config.o \
-./Core/Src/hm10_ble_driver.o \
-./Core/Src/main.o \
-./Core/Src/stm32f1xx_hal_msp.o \
-./Core/Src/stm32f1xx_it.o \
-./Core/Src/syscalls.o \
-./Core/Src/sysmem.o \
-./Core/Src/system_stm32f1xx.o 
-
-C_DEPS += \
-./Core/Src/5641as_display_driver.d \
-./Core/Src/app_side_etx_ota.d \
-./Core/Src/crc32_mpeg2.d \
-./Core/Src/firmware_update_config.d \
-./Core/Src/hm10_ble_driver.d \
-./Core/Src/main.d \
-./Core/Src/stm32f1xx_hal_msp.d \
-./Core/Src/stm32f1xx_it.d \
-./Core/Src/syscalls.d \
-./Core/Src/sysmem.d \
-./Core/Src/system_stm32f1xx.d 
-
-
-# Each subdirectory must supply rules for building sources it contributes
-Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
-	arm-none-eabi-gcc "$<" -mcpu=cortex-m3 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F103xB -c -I../Core/Inc -I../Drivers/STM32F1xx_HAL_Driver/Inc -I../Drivers/STM32F1xx_HAL_Driver/Inc/Legacy -I../Drivers/CMSIS/Device/ST/STM32F1xx/Include -I../Drivers/CMSIS/Include -O3 -ffunction-sections -fdata-sections -Wall -fstack-usage -fcyclomatic-complexity -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfloat-abi=soft -mthumb -o "$@"
-
-clean: clean-Core-2f-Src
-
-clean-Core-2f-Src:
-	-$(RM) ./Core/Src/5641as_display_driver.cyclo ./Core/Src/5641as_display_driver.d ./Core/Src/5641as_display_driver.o ./Core/Src/5641as_display_driver.su ./Core/Src/app_side_etx_ota.cyclo ./Core/Src/app_side_etx_ota.d ./Core/Src/app_side_etx_ota.o ./Core/Src/app_side_etx_ota.su ./Core/Src/crc32_mpeg2.cyclo ./Core/Src/crc32_mpeg2.d ./Core/Src/crc32_mpeg2.o ./Core/Src/crc32_mpeg2.su ./Core/Src/firmware_update_config.cyclo ./Core/Src/firmware_update_config.d ./Core/Src/firmware_update_config.o ./Core/Src/firmware_update_config.su ./Core/Src/hm10_ble_driver.cyclo ./Core/Src/hm10_ble_driver.d ./Core/Src/hm10_ble_driver.o ./Core/Src/hm10_ble_driver.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f1xx_hal_msp.cyclo ./Core/Src/stm32f1xx_hal_msp.d ./Core/Src/stm32f1xx_hal_msp.o ./Core/Src/stm32f1xx_hal_msp.su ./Core/Src/stm32f1xx_it.cyclo ./Core/Src/stm32f1xx_it.d ./Core/Src/stm32f1xx_it.o ./Core/Src/stm32f1xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f1xx.cyclo ./Core/Src/system_stm32f1xx.d ./Core/Src/system_stm32f1xx.o ./Core/Src/system_stm32f1xx.su
-
-.PHONY: clean-Core-2f-Src
-
@@ -0,0 +1,342 @@
+/** @addtogroup hal_stubs
+ * @{
+ */
+
+#include "hal_stubs.h"
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <stdlib.h> // Library from which "exit()" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <sys/mman.h> // Library from which "mmap()" is located at.
+#include "etx_ota_config.h" // Custom Library used for configuring the ETX OTA protocol.
+
+#define HOST_REGISTERS_PAGE_SIZE        (0x1000U)   /**< @brief Size in bytes of the region that is mapped for the registers of each peripheral, which is one page of the host. */
+
+static uint32_t host_hal_tick = 0;          /**< @brief Value that is returned by the @ref HAL_GetTick function. */
+static uint8_t *host_flash = NULL;          /**< @brief Pointer to the simulated Flash Memory, which is mapped at \c FLASH_START_ADDR . */
+static uint32_t host_flash_erased_pages = 0; /**< @brief Number of pages that have been erased via @ref HAL_FLASHEx_Erase . */
+static uint32_t host_flash_program_limit = HOST_FLASH_NO_PROGRAM_LIMIT; /**< @brief Number of times that @ref HAL_FLASH_Program will still succeed. */
+static struct
+{
+    GPIO_TypeDef *GPIOx;                    //!< Type Definition of the GPIO peripheral port of the GPIO Pin.
+    uint16_t GPIO_Pin;                      //!< Pin number of the GPIO Pin.
+    GPIO_PinState PinState;                 //!< Current state of the GPIO Pin.
+} host_gpio_pins[HOST_GPIO_MAX_PINS];       /**< @brief Simulated state of the GPIO Pins that have been either set or written. */
+static uint32_t host_gpio_total_pins = 0;   /**< @brief Number of GPIO Pins in @ref host_gpio_pins . */
+static uint16_t *host_adc_dma_buffer = NULL; /**< @brief Buffer that was lastly given to @ref HAL_ADC_Start_DMA . */
+static uint32_t host_adc_dma_length = 0;    /**< @brief Number of Half-Words of @ref host_adc_dma_buffer . */
+static uint8_t host_uart_tx_data[HOST_UART_TX_MAX_SIZE]; /**< @brief Copy of the bytes that were lastly given to @ref HAL_UART_Transmit_IT . */
+static uint16_t host_uart_tx_size = 0;      /**< @brief Number of bytes in @ref host_uart_tx_data . */
+static uint32_t host_uart_transmissions = 0; /**< @brief Number of transmissions that have been started via @ref HAL_UART_Transmit_IT . */
+
+/**@brief	Gets the pointer to a part of the simulated Flash Memory.
+ *
+ * @param address   Address of our MCU/MPU's Flash Memory at which that part starts.
+ * @param size      Size in bytes of that part.
+ *
+ * @return  The pointer to that part, or \c NULL if it is not fully inside of the simulated Flash Memory.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static uint8_t *get_host_flash_pointer(uint32_t address, uint32_t size);
+
+/**@brief	Maps a RAM region of one page at the very same address of a desired page of our MCU/MPU.
+ *
+ * @note    This function terminates the host test if that address cannot be mapped.
+ *
+ * @param address   Address of our MCU/MPU, which must be aligned to the size of the pages of the host.
+ * @param size      Size in bytes of the region.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+static void map_host_region(uint32_t address, uint32_t size);
+
+void set_host_hal_tick(uint32_t tick)
+{
+    host_hal_tick = tick;
+}
+
+void set_host_gpio_pin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    for (uint32_t i=0; i<host_gpio_total_pins; i++)
+    {
+        if ((host_gpio_pins[i].GPIOx == GPIOx) && (host_gpio_pins[i].GPIO_Pin == GPIO_Pin))
+        {
+            host_gpio_pins[i].PinState = PinState;
+            return;
+        }
+    }
+    if (host_gpio_total_pins == HOST_GPIO_MAX_PINS)
+    {
+        printf("No more than %u GPIO Pins can be simulated.\n", HOST_GPIO_MAX_PINS);
+        exit(1);
+    }
+    host_gpio_pins[host_gpio_total_pins].GPIOx = GPIOx;
+    host_gpio_pins[host_gpio_total_pins].GPIO_Pin = GPIO_Pin;
+    host_gpio_pins[host_gpio_total_pins].PinState = PinState;
+    host_gpio_total_pins++;
+}
+
+uint16_t *get_host_adc_dma_buffer(uint32_t *length)
+{
+    *length = host_adc_dma_length;
+    return host_adc_dma_buffer;
+}
+
+const uint8_t *get_host_uart_tx_data(uint16_t *size)
+{
+    *size = host_uart_tx_size;
+    return host_uart_tx_data;
+}
+
+uint32_t get_host_uart_transmissions(void)
+{
+    return host_uart_transmissions;
+}
+
+void complete_host_uart_transmission(UART_HandleTypeDef *huart)
+{
+    if (huart->gState == HAL_UART_STATE_BUSY_TX)
+    {
+        huart->gState = HAL_UART_STATE_READY;
+        HAL_UART_TxCpltCallback(huart);
+    }
+}
+
+void init_host_flash(void)
+{
+    if (host_flash == NULL)
+    {
+        host_flash = mmap((void *) (uintptr_t) FLASH_START_ADDR, HOST_FLASH_SIZE_IN_BYTES, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if ((host_flash == MAP_FAILED) || (host_flash != (uint8_t *) (uintptr_t) FLASH_START_ADDR))
+        {
+            printf("The simulated Flash Memory could not be mapped at 0x%08X.\n", FLASH_START_ADDR);
+            exit(1);
+        }
+    }
+    memset(host_flash, 0xFF, HOST_FLASH_SIZE_IN_BYTES);
+    host_flash_erased_pages = 0;
+    host_flash_program_limit = HOST_FLASH_NO_PROGRAM_LIMIT;
+}
+
+uint32_t get_host_flash_erased_pages(void)
+{
+    return host_flash_erased_pages;
+}
+
+void set_host_flash_program_limit(uint32_t programs)
+{
+    host_flash_program_limit = programs;
+}
+
+void init_host_peripheral_registers(void)
+{
+    /** <b>Local variable is_mapped:</b> Whether the simulated registers have already been mapped or not. */
+    static uint8_t is_mapped = 0;
+
+    if (!is_mapped)
+    {
+        map_host_region(IWDG_BASE, HOST_REGISTERS_PAGE_SIZE);
+        map_host_region(RCC_BASE, HOST_REGISTERS_PAGE_SIZE);
+        map_host_region(DBGMCU_BASE, HOST_REGISTERS_PAGE_SIZE);
+        is_mapped = 1;
+    }
+    memset(IWDG, 0, sizeof(IWDG_TypeDef));
+    memset(RCC, 0, sizeof(RCC_TypeDef));
+    memset(DBGMCU, 0, sizeof(DBGMCU_TypeDef));
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return host_hal_tick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    host_hal_tick += Delay;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+    /** <b>Local variable size:</b> Number of bytes that are programmed. */
+    uint32_t size;
+    /** <b>Local variable p_flash:</b> Pointer to the simulated Flash Memory bytes that are programmed. */
+    uint8_t *p_flash;
+
+    switch (TypeProgram)
+    {
+        case FLASH_TYPEPROGRAM_HALFWORD:
+            size = 2;
+            break;
+        case FLASH_TYPEPROGRAM_WORD:
+            size = 4;
+            break;
+        case FLASH_TYPEPROGRAM_DOUBLEWORD:
+            size = 8;
+            break;
+        default:
+            return HAL_ERROR;
+    }
+    p_flash = get_host_flash_pointer(Address, size);
+    if ((p_flash == NULL) || ((Address % 2) != 0) || (host_flash_program_limit == 0))
+    {
+        return HAL_ERROR;
+    }
+    if (host_flash_program_limit != HOST_FLASH_NO_PROGRAM_LIMIT)
+    {
+        host_flash_program_limit--;
+    }
+
+    /* As in the STM32F1 series, each half-word can only be programmed once after it has been erased. */
+    for (uint32_t i=0; i<size; i+=2)
+    {
+        if ((p_flash[i] != 0xFF) || (p_flash[i+1] != 0xFF))
+        {
+            return HAL_ERROR;
+        }
+    }
+    memcpy(p_flash, &Data, size);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError)
+{
+    /** <b>Local variable p_flash:</b> Pointer to the simulated Flash Memory pages that are erased. */
+    uint8_t *p_flash;
+
+    if (pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES)
+    {
+        return HAL_ERROR;
+    }
+    p_flash = get_host_flash_pointer(pEraseInit->PageAddress, pEraseInit->NbPages*FLASH_PAGE_SIZE_IN_BYTES);
+    if ((p_flash == NULL) || (((pEraseInit->PageAddress - FLASH_START_ADDR) % FLASH_PAGE_SIZE_IN_BYTES) != 0))
+    {
+        *PageError = pEraseInit->PageAddress;
+        return HAL_ERROR;
+    }
+    memset(p_flash, 0xFF, pEraseInit->NbPages*FLASH_PAGE_SIZE_IN_BYTES);
+    host_flash_erased_pages += pEraseInit->NbPages;
+    *PageError = 0xFFFFFFFFU;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef* hadc)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData, uint32_t Length)
+{
+    host_adc_dma_buffer = (uint16_t *) pData;
+    host_adc_dma_length = Length;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* hadc)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+    if (huart->gState != HAL_UART_STATE_READY)
+    {
+        return HAL_BUSY;
+    }
+    if ((pData == NULL) || (Size == 0) || (Size > HOST_UART_TX_MAX_SIZE))
+    {
+        return HAL_ERROR;
+    }
+    memcpy(host_uart_tx_data, pData, Size);
+    host_uart_tx_size = Size;
+    host_uart_transmissions++;
+    huart->gState = HAL_UART_STATE_BUSY_TX;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
+{
+    huart->gState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+/**@brief	Default UART Transmission Complete Callback, which is replaced by the one of the tested module, if any, as
+ *          with the weak callbacks of the HAL.
+ */
+__weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    for (uint32_t i=0; i<host_gpio_total_pins; i++)
+    {
+        if ((host_gpio_pins[i].GPIOx == GPIOx) && (host_gpio_pins[i].GPIO_Pin == GPIO_Pin))
+        {
+            return host_gpio_pins[i].PinState;
+        }
+    }
+
+    return GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    set_host_gpio_pin(GPIOx, GPIO_Pin, PinState);
+}
+
+static uint8_t *get_host_flash_pointer(uint32_t address, uint32_t size)
+{
+    if ((host_flash == NULL) || (address < FLASH_START_ADDR) || (size > HOST_FLASH_SIZE_IN_BYTES) ||
+        ((address - FLASH_START_ADDR) > (HOST_FLASH_SIZE_IN_BYTES - size)))
+    {
+        return NULL;
+    }
+
+    return &host_flash[address - FLASH_START_ADDR];
+}
+
+static void map_host_region(uint32_t address, uint32_t size)
+{
+    /** <b>Local pointer p_region:</b> Pointer to the mapped region. */
+    void *p_region = mmap((void *) (uintptr_t) address, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if ((p_region == MAP_FAILED) || (p_region != (void *) (uintptr_t) address))
+    {
+        printf("The simulated registers could not be mapped at 0x%08X.\n", address);
+        exit(1);
+    }
+}
+
+/** @} */
@@ -0,0 +1,147 @@
+/**@file
+ * @brief	Host HAL Stubs Header file.
+ *
+ * @defgroup hal_stubs Host HAL Stubs module
+ * @{
+ *
+ * @brief   This module provides host implementations of the HAL functions that are called by the modules of the
+ *          Application Firmware that are tested on a host computer, so that those modules can be compiled and run
+ *          as they are.
+ *
+ * @details The HAL Tick is a plain variable that each host test sets via @ref set_host_hal_tick . The Flash Memory
+ *          of our MCU/MPU is simulated by a RAM region that is mapped at the very same address (see
+ *          @ref init_host_flash ), so that the modules that read their records directly from the Flash Memory work
+ *          unchanged. As in the STM32F1 series, programming a half-word that has not been erased fails. The UART
+ *          transmissions in non-blocking mode are kept busy until the host test completes them via
+ *          @ref complete_host_uart_transmission , as the UART Interrupts would. The registers of the IWDG, the RCC
+ *          and the DBGMCU, which some modules access directly, are simulated the same way as the Flash Memory (see
+ *          @ref init_host_peripheral_registers ).
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef HAL_STUBS_H_
+#define HAL_STUBS_H_
+
+#include "stm32f1xx_hal.h" // This is the HAL Driver Library for the STM32F1 series devices.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define HOST_FLASH_SIZE_IN_BYTES    (128U*1024U)    /**< @brief Size in bytes of the simulated Flash Memory, which covers all the pages of our MCU/MPU. */
+#define HOST_GPIO_MAX_PINS          (16U)           /**< @brief Maximum number of GPIO Pins whose state can be simulated at the same time. */
+#define HOST_UART_TX_MAX_SIZE       (256U)          /**< @brief Maximum number of bytes that can be sent via @ref HAL_UART_Transmit_IT at once. */
+#define HOST_FLASH_NO_PROGRAM_LIMIT (0xFFFFFFFFU)   /**< @brief Value of @ref set_host_flash_program_limit with which the programming operations always succeed. */
+
+/**@brief   Sets the value that the @ref HAL_GetTick function will return from now on.
+ *
+ * @param tick  Desired HAL Tick in milliseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void set_host_hal_tick(uint32_t tick);
+
+/**@brief   Sets the state that the @ref HAL_GPIO_ReadPin function will return from now on for a certain GPIO Pin, as
+ *          if its input had changed. The GPIO Pins that have never been set, nor written via @ref HAL_GPIO_WritePin ,
+ *          are read as \c GPIO_PIN_RESET .
+ *
+ * @note    This function terminates the host test if more than @ref HOST_GPIO_MAX_PINS GPIO Pins are simulated.
+ *
+ * @param[in] GPIOx     Type Definition of the GPIO peripheral port of the desired GPIO Pin.
+ * @param GPIO_Pin      Pin number of the desired GPIO Pin.
+ * @param PinState      Desired state of the GPIO Pin.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void set_host_gpio_pin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+/**@brief   Gets the buffer into which the ADC conversions were lastly requested to be written via
+ *          @ref HAL_ADC_Start_DMA , so that a host test can write the conversions that the DMA would.
+ *
+ * @param[out] length   Pointer into which the number of Half-Words of that buffer will be written.
+ *
+ * @return  The pointer to that buffer, or \c NULL if @ref HAL_ADC_Start_DMA has not been called yet.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint16_t *get_host_adc_dma_buffer(uint32_t *length);
+
+/**@brief   Gets the bytes that were lastly requested to be sent via @ref HAL_UART_Transmit_IT .
+ *
+ * @param[out] size     Pointer into which the number of those bytes will be written.
+ *
+ * @return  The pointer to a copy of those bytes.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+const uint8_t *get_host_uart_tx_data(uint16_t *size);
+
+/**@brief   Gets the number of transmissions that have been started via @ref HAL_UART_Transmit_IT .
+ *
+ * @return  The number of started transmissions.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_host_uart_transmissions(void);
+
+/**@brief   Completes the transmission that is being sent by a UART, if any, and then calls the
+ *          @ref HAL_UART_TxCpltCallback function as the UART Interrupts would.
+ *
+ * @param[in,out] huart Pointer to the UART Handle Structure of the UART.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void complete_host_uart_transmission(UART_HandleTypeDef *huart);
+
+/**@brief   Maps the simulated Flash Memory at the address of the Flash Memory of our MCU/MPU (i.e.,
+ *          \c FLASH_START_ADDR ) and erases all of it.
+ *
+ * @note    This function terminates the host test if that address cannot be mapped.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void init_host_flash(void);
+
+/**@brief   Gets the number of Flash Memory pages that have been erased via @ref HAL_FLASHEx_Erase since the
+ *          simulated Flash Memory was initialized.
+ *
+ * @return  The number of erased pages.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+uint32_t get_host_flash_erased_pages(void);
+
+/**@brief   Sets the number of times that the @ref HAL_FLASH_Program function will still succeed from now on, after
+ *          which it will fail as if our MCU/MPU had been reset in the middle of a write or as if the Flash Memory had
+ *          worn out, until either this function or @ref init_host_flash is called again.
+ *
+ * @param programs  Number of programming operations that will succeed, or \c HOST_FLASH_NO_PROGRAM_LIMIT so that they
+ *                  always succeed, which is the case after @ref init_host_flash is called.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void set_host_flash_program_limit(uint32_t programs);
+
+/**@brief   Maps the simulated registers of the IWDG, the RCC and the DBGMCU at their addresses in our MCU/MPU (i.e.,
+ *          \c IWDG_BASE , \c RCC_BASE and \c DBGMCU_BASE ) and clears all of them.
+ *
+ * @note    The registers keep the last value that was written into them, even the write-only ones (e.g., the Key
+ *          register of the IWDG), so that a host test can check what was written.
+ * @note    This function terminates the host test if those addresses cannot be mapped.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date    October 16, 2026.
+ */
+void init_host_peripheral_registers(void);
+
+#endif /* HAL_STUBS_H_ */
+
+/** @} */
@@ -0,0 +1,67 @@
+/**@file
+ * @brief	Host Test Assertions Header file.
+ *
+ * @defgroup host_test Host Test Assertions module
+ * @{
+ *
+ * @brief   This module provides the assertion macros with which the host tests of the Application Firmware check
+ *          their expectations, so that each host test can be built as a plain executable with no framework.
+ *
+ * @details Each failed assertion prints the file, line and condition that failed and increments
+ *          @ref host_test_failures , so that the test goes on and reports all of its failures at once. The
+ *          \c main() function of each host test then returns @ref HOST_TEST_RESULT , which is zero only if no
+ *          assertion has failed.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+static unsigned int host_test_failures = 0; /**< @brief Number of assertions that have failed so far in the host test. */
+
+/**@brief   Checks that a condition holds, or otherwise reports it as a failure of the host test.
+ *
+ * @param condition Condition that is expected to be true.
+ */
+#define HOST_TEST_CHECK(condition)                                                                      \
+    do                                                                                                  \
+    {                                                                                                   \
+        if (!(condition))                                                                               \
+        {                                                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                        \
+            host_test_failures++;                                                                       \
+        }                                                                                               \
+    } while (0)
+
+/**@brief   Checks that two integers are equal, or otherwise reports both of them as a failure of the host test.
+ *
+ * @param actual    Integer obtained from the code under test.
+ * @param expected  Integer that was expected.
+ */
+#define HOST_TEST_CHECK_EQUAL(actual, expected)                                                         \
+    do                                                                                                  \
+    {                                                                                                   \
+        long long host_test_actual = (long long) (actual);                                              \
+        long long host_test_expected = (long long) (expected);                                          \
+        if (host_test_actual != host_test_expected)                                                     \
+        {                                                                                               \
+            printf("%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #actual, #expected, \
+                   host_test_actual, host_test_expected);                                               \
+            host_test_failures++;                                                                       \
+        }                                                                                               \
+    } while (0)
+
+/**@brief   Prints the summary of a host test and evaluates into the exit code of its \c main() function.
+ */
+#define HOST_TEST_RESULT                                                                                \
+    (printf("%s: %s (%u failed checks)\n", __FILE__, (host_test_failures == 0) ? "PASSED" : "FAILED",  \
+            host_test_failures), (host_test_failures == 0) ? 0 : 1)
+
+#endif /* HOST_TEST_H_ */
+
+/** @} */
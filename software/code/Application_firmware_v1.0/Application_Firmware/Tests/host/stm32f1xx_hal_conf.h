@@ -0,0 +1,23 @@
+/**@file
+ * @brief	Host HAL Configuration Header file.
+ *
+ * @details This file is found before the HAL configuration file of the Application Firmware by the host tests (see
+ *          the \c -I. flag of their Makefile), since the @c stm32f1xx_hal.h header includes it by its name. It keeps
+ *          that very same configuration and then replaces the CMSIS intrinsics that the tested modules call, which
+ *          are ARM instructions, with their host equivalents. The host tests are single-threaded, so the interrupts
+ *          are never really masked and the Memory Barriers only need to keep the compiler from reordering.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#ifndef HOST_STM32F1XX_HAL_CONF_H_
+#define HOST_STM32F1XX_HAL_CONF_H_
+
+#include "../../Core/Inc/stm32f1xx_hal_conf.h" // HAL configuration file of the Application Firmware.
+
+#define __disable_irq()     __sync_synchronize()    /**< @brief Host replacement of the CMSIS intrinsic that masks the interrupts. */
+#define __enable_irq()      __sync_synchronize()    /**< @brief Host replacement of the CMSIS intrinsic that unmasks the interrupts. */
+#define __DMB()             __sync_synchronize()    /**< @brief Host replacement of the CMSIS Data Memory Barrier intrinsic. */
+
+#endif /* HOST_STM32F1XX_HAL_CONF_H_ */
@@ -0,0 +1,141 @@
+/**@file
+ * @brief	Host test of the @ref fault_manager .
+ *
+ * @details This test reports the conditions of some of the faults of the MTKATR001 System, with their definitions in
+ *          the @ref main module, and checks that the non-latched faults are cleared only after their clear time,
+ *          that they are latched once they come back more times than their retries unless they have stayed cleared
+ *          long enough, that the latched faults are never cleared, that the lost capabilities and the latest active
+ *          fault follow the active faults and that the history records every event.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "fault_manager.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the Fault Manager of the MTKATR001 System.
+
+#define CAPABILITY_HEATING          (1U << 0)   /**< @brief Capability of the MTKATR001 System to throw Heat inside it. */
+#define CAPABILITY_COOLING          (1U << 1)   /**< @brief Capability of the MTKATR001 System to throw Cold Air inside it. */
+#define SENSOR_FAULT_MAX_RETRIES    (3)         /**< @brief Number of times that a fault of the Temperature Sensors may come back, as in the @ref main module. */
+#define SENSOR_FAULT_CLEAR_TIME     (5000)      /**< @brief Clear time in milliseconds of the faults of the Temperature Sensors, as in the @ref main module. */
+#define REPORT_PERIOD               (100)       /**< @brief Period in milliseconds at which the conditions are reported, as the one of the Sensing Task. */
+#define HOT_WATER_SHORTCIRCUIT      (9U)        /**< @brief Exception Code of the latched short-circuit fault of the Hot Water Temperature Sensor. */
+#define COLD_WATER_SENSOR_FAULT     (11U)       /**< @brief Exception Code of the fault of the Cold Water Temperature Sensor. */
+#define HOT_WATER_SENSOR_FAULT      (12U)       /**< @brief Exception Code of the fault of the Hot Water Temperature Sensor. */
+#define AMBIENT_SENSOR_FAULT        (13U)       /**< @brief Exception Code of the fault of the Internal Ambient Temperature Sensor. */
+
+/**@brief	Some of the faults of the MTKATR001 System, defined as in the @ref main module.
+ */
+static const fault_def_t faults[] = {
+    {.code = HOT_WATER_SHORTCIRCUIT, .is_latched = 1, .lost_capabilities = CAPABILITY_HEATING},
+    {.code = COLD_WATER_SENSOR_FAULT, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = SENSOR_FAULT_CLEAR_TIME, .lost_capabilities = CAPABILITY_COOLING},
+    {.code = HOT_WATER_SENSOR_FAULT, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = SENSOR_FAULT_CLEAR_TIME, .lost_capabilities = CAPABILITY_HEATING},
+    {.code = AMBIENT_SENSOR_FAULT, .is_latched = 0, .max_retries = SENSOR_FAULT_MAX_RETRIES, .clear_time = SENSOR_FAULT_CLEAR_TIME, .lost_capabilities = CAPABILITY_HEATING | CAPABILITY_COOLING}
+};
+static const uint8_t total_faults = sizeof(faults)/sizeof(faults[0]); /**< @brief Number of faults in @ref faults . */
+
+/**@brief	Reports the condition of a fault each @ref REPORT_PERIOD milliseconds during some time.
+ *
+ * @return  The time in milliseconds after which the fault stopped being active, or zero if it stayed active.
+ */
+static uint32_t report_condition(uint8_t code, uint8_t is_present, uint32_t *tick, uint32_t duration)
+{
+    uint32_t cleared_after = 0;
+
+    for (uint32_t elapsed=REPORT_PERIOD; elapsed<=duration; elapsed+=REPORT_PERIOD)
+    {
+        *tick += REPORT_PERIOD;
+        HOST_TEST_CHECK_EQUAL(set_fault_condition(code, is_present, *tick), FAULT_MANAGER_EC_OK);
+        if ((cleared_after == 0) && !is_fault_active(code))
+        {
+            cleared_after = elapsed;
+        }
+    }
+
+    return cleared_after;
+}
+
+int main(void)
+{
+    fault_def_t invalid_faults[2] = {faults[1], faults[1]};
+    fault_history_entry_t entry = {0};
+    uint32_t tick = 0;
+
+    /* Invalid definitions are rejected. */
+    HOST_TEST_CHECK_EQUAL(init_fault_manager(faults, 0), FAULT_MANAGER_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_fault_manager(invalid_faults, 2), FAULT_MANAGER_EC_ERR);
+    invalid_faults[1].code = 0;
+    HOST_TEST_CHECK_EQUAL(init_fault_manager(invalid_faults, 2), FAULT_MANAGER_EC_ERR);
+
+    /* No fault is active at first and unknown faults are rejected. */
+    HOST_TEST_CHECK_EQUAL(init_fault_manager(faults, total_faults), FAULT_MANAGER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_latest_active_fault(), 0);
+    HOST_TEST_CHECK_EQUAL(get_fault_manager_lost_capabilities(), 0);
+    HOST_TEST_CHECK_EQUAL(set_fault_condition(16, 1, tick), FAULT_MANAGER_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(0, &entry), FAULT_MANAGER_EC_NO_DATA);
+
+    /* A non-latched fault only takes its capabilities away and is cleared once its condition has been absent for its clear time. */
+    report_condition(COLD_WATER_SENSOR_FAULT, 1, &tick, 1000);
+    HOST_TEST_CHECK_EQUAL(is_fault_active(COLD_WATER_SENSOR_FAULT), 1);
+    HOST_TEST_CHECK_EQUAL(get_fault_manager_lost_capabilities(), CAPABILITY_COOLING);
+    HOST_TEST_CHECK_EQUAL(report_condition(COLD_WATER_SENSOR_FAULT, 0, &tick, 2*SENSOR_FAULT_CLEAR_TIME), SENSOR_FAULT_CLEAR_TIME);
+    HOST_TEST_CHECK_EQUAL(get_fault_manager_lost_capabilities(), 0);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(0, &entry), FAULT_MANAGER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(entry.code, COLD_WATER_SENSOR_FAULT);
+    HOST_TEST_CHECK_EQUAL(entry.event, FAULT_EVENT_CLEARED);
+
+    /* An intermittent condition keeps the fault active, since its clear time restarts each time that it is present. */
+    report_condition(HOT_WATER_SENSOR_FAULT, 1, &tick, REPORT_PERIOD);
+    for (int i=0; i<5; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(report_condition(HOT_WATER_SENSOR_FAULT, 0, &tick, SENSOR_FAULT_CLEAR_TIME - REPORT_PERIOD), 0);
+        report_condition(HOT_WATER_SENSOR_FAULT, 1, &tick, REPORT_PERIOD);
+    }
+    HOST_TEST_CHECK(report_condition(HOT_WATER_SENSOR_FAULT, 0, &tick, 2*SENSOR_FAULT_CLEAR_TIME) > 0);
+
+    /* The latest raised fault is the one shown and the lost capabilities add up. */
+    report_condition(COLD_WATER_SENSOR_FAULT, 1, &tick, REPORT_PERIOD);
+    report_condition(HOT_WATER_SHORTCIRCUIT, 1, &tick, REPORT_PERIOD);
+    HOST_TEST_CHECK_EQUAL(get_latest_active_fault(), HOT_WATER_SHORTCIRCUIT);
+    HOST_TEST_CHECK_EQUAL(get_fault_manager_lost_capabilities(), CAPABILITY_HEATING | CAPABILITY_COOLING);
+
+    /* A latched fault is never cleared, while the others still are. */
+    HOST_TEST_CHECK(report_condition(COLD_WATER_SENSOR_FAULT, 0, &tick, 2*SENSOR_FAULT_CLEAR_TIME) > 0);
+    HOST_TEST_CHECK_EQUAL(report_condition(HOT_WATER_SHORTCIRCUIT, 0, &tick, 10*SENSOR_FAULT_CLEAR_TIME), 0);
+    HOST_TEST_CHECK_EQUAL(get_latest_active_fault(), HOT_WATER_SHORTCIRCUIT);
+    HOST_TEST_CHECK_EQUAL(get_fault_manager_lost_capabilities(), CAPABILITY_HEATING);
+
+    /* A non-latched fault that has recovered as many times as allowed is latched the next time that it comes back. */
+    for (int i=0; i<=SENSOR_FAULT_MAX_RETRIES; i++)
+    {
+        report_condition(AMBIENT_SENSOR_FAULT, 1, &tick, REPORT_PERIOD);
+        HOST_TEST_CHECK(report_condition(AMBIENT_SENSOR_FAULT, 0, &tick, 2*SENSOR_FAULT_CLEAR_TIME) > 0);
+    }
+    report_condition(AMBIENT_SENSOR_FAULT, 1, &tick, REPORT_PERIOD);
+    HOST_TEST_CHECK_EQUAL(report_condition(AMBIENT_SENSOR_FAULT, 0, &tick, 10*SENSOR_FAULT_CLEAR_TIME), 0);
+    HOST_TEST_CHECK_EQUAL(get_fault_manager_lost_capabilities(), CAPABILITY_HEATING | CAPABILITY_COOLING);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(0, &entry), FAULT_MANAGER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(entry.code, AMBIENT_SENSOR_FAULT);
+    HOST_TEST_CHECK_EQUAL(entry.event, FAULT_EVENT_LATCHED);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(1, &entry), FAULT_MANAGER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(entry.event, FAULT_EVENT_RAISED);
+
+    /* A fault that stays cleared long enough is forgiven its previous retries. */
+    for (int i=0; i<(3*SENSOR_FAULT_MAX_RETRIES); i++)
+    {
+        report_condition(COLD_WATER_SENSOR_FAULT, 1, &tick, REPORT_PERIOD);
+        HOST_TEST_CHECK(report_condition(COLD_WATER_SENSOR_FAULT, 0, &tick, 2*SENSOR_FAULT_CLEAR_TIME) > 0);
+        tick += FAULT_MANAGER_RETRY_RESET_TIME;
+    }
+
+    /* The history holds the latest events, oldest ones overwritten, and counts all of them. */
+    printf("%u fault events recorded.\n", get_fault_history_total_events());
+    HOST_TEST_CHECK(get_fault_history_total_events() > FAULT_MANAGER_HISTORY_SIZE);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(FAULT_MANAGER_HISTORY_SIZE - 1, &entry), FAULT_MANAGER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(FAULT_MANAGER_HISTORY_SIZE, &entry), FAULT_MANAGER_EC_NO_DATA);
+    HOST_TEST_CHECK_EQUAL(get_fault_history_entry(0, &entry), FAULT_MANAGER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(entry.code, COLD_WATER_SENSOR_FAULT);
+    HOST_TEST_CHECK_EQUAL(entry.event, FAULT_EVENT_CLEARED);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,122 @@
+/**@file
+ * @brief	Host test of the @ref pid_autotune .
+ *
+ * @details This test runs the @ref pid_autotune against a simulated First-Order-Plus-Dead-Time plant of the enclosure
+ *          and checks that the measured Ultimate Gain and Ultimate Period are close to the ones of the exact limit
+ *          cycle that the relay causes on that plant, that the resulting gains follow the Ziegler–Nichols rules and stabilize the plant, and that the
+ *          timeout and the invalid configurations are handled.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <math.h> // Library from which "exp()", "log()" and "fabs()" are located at.
+#include <stdlib.h> // Library from which "abs()" is located at.
+#include "pid_autotune.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Relay-Feedback PID Auto-Tuner.
+
+#define SAMPLE_PERIOD           (500)       /**< @brief Period in milliseconds at which the Auto-Tuner is run, as the one of the Control Task. */
+#define PLANT_GAIN              (0.15)      /**< @brief Steady-state gain of the simulated plant, in centi-degrees Celsius per centi-percent of output. */
+#define PLANT_TIME_CONSTANT     (300.0)     /**< @brief Time constant in seconds of the simulated plant. */
+#define PLANT_DEAD_TIME         (30)        /**< @brief Dead time in seconds of the simulated plant. */
+#define SETPOINT                (2500)      /**< @brief Setpoint in centi-degrees Celsius around which the plant is made to oscillate. */
+#define MAX_RELATIVE_ERROR      (0.05)      /**< @brief Largest relative error allowed between the measured and the expected ultimate values. */
+
+/**@brief	Simulated First-Order-Plus-Dead-Time plant, whose output is relative to its operating point.
+ */
+typedef struct
+{
+    double temperature;                                         //!< Current Temperature of the plant.
+    int32_t delayed_inputs[PLANT_DEAD_TIME*1000/SAMPLE_PERIOD]; //!< Inputs that have not reached the plant yet.
+    uint32_t delayed_index;                                     //!< Index of the oldest input in @ref delayed_inputs .
+} plant_t;
+
+/**@brief	Advances the simulated plant by one period with a new input and gets its new Temperature.
+ */
+static int32_t run_plant(plant_t *plant, int32_t input)
+{
+    int32_t delayed_input = plant->delayed_inputs[plant->delayed_index];
+    plant->delayed_inputs[plant->delayed_index] = input;
+    plant->delayed_index = (plant->delayed_index + 1) % (sizeof(plant->delayed_inputs)/sizeof(plant->delayed_inputs[0]));
+    plant->temperature += ((SETPOINT + PLANT_GAIN*delayed_input - plant->temperature) * (SAMPLE_PERIOD/1000.0)) / PLANT_TIME_CONSTANT;
+    return (int32_t) plant->temperature;
+}
+
+int main(void)
+{
+    pid_autotune_t autotune;
+    pid_autotune_result_t result = {0};
+    pid_autotune_config_t config = {.setpoint = SETPOINT, .relay_amplitude = 3000, .hysteresis = 10, .cycles = 4, .timeout = 4*3600000};
+    plant_t plant = {.temperature = SETPOINT};
+    uint32_t tick = 0;
+    int32_t measurement = SETPOINT;
+
+    /* Exact limit cycle of the plant under the relay, whose peak is reached one dead time after the switch at the
+       hysteresis and whose half period adds the time to fall from that peak to the opposite side of the band. */
+    double steady_state = PLANT_GAIN*config.relay_amplitude;
+    double peak = steady_state + (config.hysteresis - steady_state)*exp(-PLANT_DEAD_TIME/PLANT_TIME_CONSTANT);
+    double expected_ku = (4.0*config.relay_amplitude) / (M_PI*peak);
+    double expected_pu = 2000*(PLANT_DEAD_TIME + PLANT_TIME_CONSTANT*log((peak + steady_state)/(steady_state - config.hysteresis)));
+
+    /* Invalid configurations are rejected. */
+    pid_autotune_config_t invalid_config = config;
+    invalid_config.relay_amplitude = 0;
+    HOST_TEST_CHECK_EQUAL(start_pid_autotune(&autotune, &invalid_config, measurement, tick), PID_AUTOTUNE_EC_ERR);
+    invalid_config = config;
+    invalid_config.cycles = PID_AUTOTUNE_MAX_CYCLES + 1;
+    HOST_TEST_CHECK_EQUAL(start_pid_autotune(&autotune, &invalid_config, measurement, tick), PID_AUTOTUNE_EC_ERR);
+    invalid_config = config;
+    invalid_config.hysteresis = -1;
+    HOST_TEST_CHECK_EQUAL(start_pid_autotune(&autotune, &invalid_config, measurement, tick), PID_AUTOTUNE_EC_ERR);
+
+    /* The relay oscillation gives the ultimate values of the plant. */
+    HOST_TEST_CHECK_EQUAL(start_pid_autotune(&autotune, &config, measurement, tick), PID_AUTOTUNE_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_pid_autotune_result(&autotune, &result), PID_AUTOTUNE_EC_ERR);
+    while (get_pid_autotune_state(&autotune) == PID_AUTOTUNE_RUNNING)
+    {
+        int32_t output = run_pid_autotune(&autotune, measurement, tick);
+        if (get_pid_autotune_state(&autotune) == PID_AUTOTUNE_RUNNING)
+        {
+            HOST_TEST_CHECK((output == config.relay_amplitude) || (output == -config.relay_amplitude));
+        }
+        measurement = run_plant(&plant, output);
+        tick += SAMPLE_PERIOD;
+    }
+    HOST_TEST_CHECK_EQUAL(get_pid_autotune_state(&autotune), PID_AUTOTUNE_DONE);
+    HOST_TEST_CHECK_EQUAL(get_pid_autotune_result(&autotune, &result), PID_AUTOTUNE_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_pid_autotune(&autotune, measurement, tick), 0);
+    double ku = result.ku / 65536.0;
+    printf("Ku = %.2f (expected %.2f), Pu = %u ms (expected %.0f ms), found after %u s.\n", ku, expected_ku, result.pu, expected_pu, tick/1000);
+    HOST_TEST_CHECK(fabs(ku - expected_ku) <= (MAX_RELATIVE_ERROR*expected_ku));
+    HOST_TEST_CHECK(fabs(result.pu - expected_pu) <= (MAX_RELATIVE_ERROR*expected_pu));
+
+    /* The gains follow the classic Ziegler-Nichols rules. */
+    HOST_TEST_CHECK(fabs(result.kp - 0.6*result.ku) <= 1);
+    HOST_TEST_CHECK(fabs(result.ki - 2000.0*result.kp/result.pu) <= 1);
+    HOST_TEST_CHECK(fabs(result.kd - result.kp*(result.pu/1000.0)/8) <= 1);
+
+    /* Those gains stabilize the plant at a new setpoint. */
+    pid_controller_t pid;
+    pid_controller_config_t pid_config = {.kp = result.kp, .ki = result.ki, .kd = result.kd, .sample_period = SAMPLE_PERIOD, .output_min = -10000, .output_max = 10000};
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &pid_config), PID_CONTROLLER_EC_OK);
+    for (uint32_t i=0; i<(4*3600000/SAMPLE_PERIOD); i++)
+    {
+        measurement = run_plant(&plant, run_pid_controller(&pid, SETPOINT + 200, measurement));
+    }
+    printf("Temperature after 4 hours with the tuned gains: %d (setpoint of %d).\n", measurement, SETPOINT + 200);
+    HOST_TEST_CHECK(abs(measurement - (SETPOINT + 200)) <= 2);
+
+    /* A plant that never crosses the setpoint makes the Auto-Tuner fail after its timeout. */
+    config.timeout = 60000;
+    HOST_TEST_CHECK_EQUAL(start_pid_autotune(&autotune, &config, SETPOINT - 1000, 0), PID_AUTOTUNE_EC_OK);
+    for (tick=0; tick<=config.timeout; tick+=SAMPLE_PERIOD)
+    {
+        run_pid_autotune(&autotune, SETPOINT - 1000, tick);
+    }
+    HOST_TEST_CHECK_EQUAL(get_pid_autotune_state(&autotune), PID_AUTOTUNE_FAILED);
+    HOST_TEST_CHECK_EQUAL(run_pid_autotune(&autotune, SETPOINT - 1000, tick), 0);
+    stop_pid_autotune(&autotune);
+    HOST_TEST_CHECK_EQUAL(get_pid_autotune_state(&autotune), PID_AUTOTUNE_IDLE);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,106 @@
+/**@file
+ * @brief	Host test of the @ref pid_controller .
+ *
+ * @details This test closes the loop of the @ref pid_controller , with the default gains and output limits of the
+ *          Internal Ambient Temperature PID Controller, around a simulated first-order plant of the enclosure. It
+ *          checks that the Temperature converges to a reachable setpoint, that a long saturation against an
+ *          unreachable setpoint does not wind the controller up, that a setpoint step does not kick the Derivative term
+ *          and that invalid configurations are rejected.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "pid_controller.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Fixed-Point PID Controller.
+
+#define SAMPLE_PERIOD           (500)       /**< @brief Period in milliseconds of the controller, as the one of the Control Task. */
+#define DEFAULT_KP              (20L << PID_CONTROLLER_Q16_SHIFT)   /**< @brief Default Proportional gain of the Internal Ambient Temperature PID Controller. */
+#define DEFAULT_KI              ((1L << PID_CONTROLLER_Q16_SHIFT)/10)   /**< @brief Default Integral gain of the Internal Ambient Temperature PID Controller. */
+#define OUTPUT_LIMIT            (3000)      /**< @brief Output limit in centi-percent, as the default Fan Duty Cycles of 30 percent. */
+#define OUTSIDE_TEMPERATURE     (2000.0)    /**< @brief Temperature in centi-degrees Celsius to which the simulated enclosure settles with no output. */
+#define PLANT_GAIN              (0.15)      /**< @brief Steady-state gain of the simulated enclosure, in centi-degrees Celsius per centi-percent of output. */
+#define PLANT_TIME_CONSTANT     (300.0)     /**< @brief Time constant in seconds of the simulated enclosure. */
+#define REACHABLE_SETPOINT      (2300)      /**< @brief Setpoint in centi-degrees Celsius that the output limits can reach. */
+#define UNREACHABLE_SETPOINT    (3000)      /**< @brief Setpoint in centi-degrees Celsius that the output limits cannot reach. */
+
+/**@brief	Runs the controller and the simulated enclosure for a number of periods.
+ *
+ * @return  The lowest Temperature of the enclosure during those periods.
+ */
+static double run_closed_loop(pid_controller_t *pid, double *temperature, int32_t setpoint, uint32_t periods)
+{
+    double lowest_temperature = *temperature;
+
+    for (uint32_t i=0; i<periods; i++)
+    {
+        int32_t output = run_pid_controller(pid, setpoint, (int32_t) *temperature);
+        HOST_TEST_CHECK((output >= -OUTPUT_LIMIT) && (output <= OUTPUT_LIMIT));
+        HOST_TEST_CHECK((pid->integral >= ((int64_t) -OUTPUT_LIMIT << PID_CONTROLLER_Q16_SHIFT)) &&
+                        (pid->integral <= ((int64_t) OUTPUT_LIMIT << PID_CONTROLLER_Q16_SHIFT)));
+        *temperature += ((OUTSIDE_TEMPERATURE + PLANT_GAIN*output - *temperature) * (SAMPLE_PERIOD/1000.0)) / PLANT_TIME_CONSTANT;
+        if (*temperature < lowest_temperature)
+        {
+            lowest_temperature = *temperature;
+        }
+    }
+
+    return lowest_temperature;
+}
+
+int main(void)
+{
+    pid_controller_t pid;
+    pid_controller_config_t config = {
+        .kp = DEFAULT_KP,
+        .ki = DEFAULT_KI,
+        .kd = 0,
+        .sample_period = SAMPLE_PERIOD,
+        .output_min = -OUTPUT_LIMIT,
+        .output_max = OUTPUT_LIMIT
+    };
+    double temperature = OUTSIDE_TEMPERATURE;
+    const uint32_t periods_per_hour = 3600000/SAMPLE_PERIOD;
+
+    /* Invalid configurations are rejected. */
+    pid_controller_config_t invalid_config = config;
+    invalid_config.ki = -1;
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &invalid_config), PID_CONTROLLER_EC_ERR);
+    invalid_config = config;
+    invalid_config.sample_period = 0;
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &invalid_config), PID_CONTROLLER_EC_ERR);
+    invalid_config = config;
+    invalid_config.output_min = OUTPUT_LIMIT + 1;
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &invalid_config), PID_CONTROLLER_EC_ERR);
+
+    /* The Temperature converges to a reachable setpoint. */
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &config), PID_CONTROLLER_EC_OK);
+    run_closed_loop(&pid, &temperature, REACHABLE_SETPOINT, 2*periods_per_hour);
+    printf("Temperature after 2 hours: %.1f centi-degrees Celsius (setpoint of %d).\n", temperature, REACHABLE_SETPOINT);
+    HOST_TEST_CHECK((temperature >= (REACHABLE_SETPOINT - 5)) && (temperature <= (REACHABLE_SETPOINT + 5)));
+
+    /* An hour of saturation against an unreachable setpoint does not wind the controller up. */
+    run_closed_loop(&pid, &temperature, UNREACHABLE_SETPOINT, periods_per_hour);
+    HOST_TEST_CHECK_EQUAL(pid.output, OUTPUT_LIMIT);
+    run_closed_loop(&pid, &temperature, REACHABLE_SETPOINT, 1);
+    HOST_TEST_CHECK(pid.output < OUTPUT_LIMIT);
+    double lowest_temperature = run_closed_loop(&pid, &temperature, REACHABLE_SETPOINT, 2*periods_per_hour);
+    printf("Undershoot after leaving saturation: %.1f centi-degrees Celsius.\n", REACHABLE_SETPOINT - lowest_temperature);
+    HOST_TEST_CHECK(lowest_temperature >= (REACHABLE_SETPOINT - 50));
+    HOST_TEST_CHECK((temperature >= (REACHABLE_SETPOINT - 5)) && (temperature <= (REACHABLE_SETPOINT + 5)));
+
+    /* A setpoint step only moves the Proportional term, since the Derivative term is taken from the measurement. */
+    config.ki = 0;
+    config.kd = 60L << PID_CONTROLLER_Q16_SHIFT;
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &config), PID_CONTROLLER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_pid_controller(&pid, 2000, 2000), 0);
+    HOST_TEST_CHECK_EQUAL(run_pid_controller(&pid, 2050, 2000), (DEFAULT_KP*50) >> PID_CONTROLLER_Q16_SHIFT);
+
+    /* Narrower output limits clamp the Integral term and reject being inverted. */
+    HOST_TEST_CHECK_EQUAL(set_pid_controller_output_limits(&pid, 100, -100), PID_CONTROLLER_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(set_pid_controller_output_limits(&pid, -100, 100), PID_CONTROLLER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_pid_controller(&pid, 3000, 2000), 100);
+    HOST_TEST_CHECK_EQUAL(set_pid_controller_gains(&pid, -1, 0, 0), PID_CONTROLLER_EC_ERR);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,203 @@
+/**@file
+ * @brief	Host test of the @ref preheat_scheduler .
+ *
+ * @details This test first gives the @ref preheat_scheduler , with the configuration of the @ref main module, steady
+ *          ramps of the Hot Water and Internal Ambient Temperatures and checks that it only requests the Hot Water on
+ *          demand until it has learned their rates, that it discards the windows that it did not follow all along and
+ *          that, once learned, it requests the Hot Water to be heated only once it would not be ready in time
+ *          otherwise. It then simulates a whole day of an enclosure that loses heat towards its surroundings and of
+ *          its Hot Water tank, with the Hot Air and Water Heater logic of the @ref main module, once with the Water
+ *          Heater always allowed and once with it scheduled from a freshly started @ref preheat_scheduler , and checks
+ *          that the scheduled Water Heater is On for at least ten percent less time without making the Hot Air wait
+ *          longer for the Hot Water nor leaving the Internal Ambient Temperature below its setpoint for longer.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "preheat_scheduler.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a predictive scheduler of the heating of a buffer that a heating loop needs to be ready.
+
+#define CONTROL_PERIOD              (500)       /**< @brief Period in milliseconds at which the @ref preheat_scheduler is run, as the one of the Control Task. */
+#define WINDOW_TIME                 (60000)     /**< @brief Window time in milliseconds of the @ref preheat_scheduler , as in the @ref main module. */
+#define LEAD_MARGIN                 (120000)    /**< @brief Lead margin in milliseconds of the @ref preheat_scheduler , as in the @ref main module. */
+#define MIN_SAMPLES                 (3)         /**< @brief Number of windows from which each rate is learned before it is used, as in the @ref main module. */
+#define AMBIENT_SETPOINT            (2500)      /**< @brief Desired Internal Ambient Temperature in centi-degrees Celsius, as in the @ref main module. */
+#define AMBIENT_HYSTERESIS          (50)        /**< @brief Amount of centi-degrees Celsius above the @ref AMBIENT_SETPOINT at which the simulated Hot Air request stops. */
+#define HOT_WATER_SETPOINT          (5000)      /**< @brief Desired Hot Water Temperature in centi-degrees Celsius, as in the @ref main module. */
+#define HOT_WATER_MIN               (4000)      /**< @brief Hot Water Minimum Temperature in centi-degrees Celsius, as in the @ref main module. */
+#define HOT_WATER_READY             (HOT_WATER_MIN + 50)    /**< @brief Hot Water Temperature, in centi-degrees Celsius, at which the Hot Air stops waiting for it, as in the @ref main module. */
+#define SURROUNDINGS_TEMPERATURE    (1800.0)    /**< @brief Temperature, in centi-degrees Celsius, of the surroundings of the simulated enclosure. */
+#define AMBIENT_TIME_CONSTANT       (4*3600.0)  /**< @brief Time constant in seconds at which the simulated enclosure loses heat towards its surroundings. */
+#define HOT_AIR_RATE                (30.0)      /**< @brief Rate, in centi-degrees Celsius per minute, at which the Hot Air warms up the simulated enclosure. */
+#define HEATER_RATE                 (40.0)      /**< @brief Rate, in centi-degrees Celsius per minute, at which the Water Heating Resistor warms up the simulated Hot Water. */
+#define HOT_AIR_DRAIN_RATE          (80.0)      /**< @brief Rate, in centi-degrees Celsius per minute, at which the Hot Air cools down the simulated Hot Water. */
+#define WATER_TIME_CONSTANT         (2*3600.0)  /**< @brief Time constant in seconds at which the simulated Hot Water loses heat towards the enclosure. */
+#define SIMULATION_TIME             (24*3600000U) /**< @brief Time in milliseconds of each simulated day. */
+
+/**@brief	Result of a simulated day.
+ */
+typedef struct
+{
+    uint32_t heater_on_time;        //!< Time in milliseconds during which the Water Heating Resistor was On.
+    uint32_t waiting_time;          //!< Time in milliseconds during which the Hot Air was requested but waited for the Hot Water.
+    uint32_t below_setpoint_time;   //!< Time in milliseconds during which the Internal Ambient Temperature was more than 0.5 degrees Celsius below its setpoint.
+} day_result_t;
+
+/**@brief	Gives a steady ramp of temperatures to a Scheduler during some time.
+ *
+ * @return  The last request of the Scheduler.
+ */
+static uint8_t run_ramp(preheat_scheduler_t *scheduler, preheat_scheduler_inputs_t *inputs, int32_t buffer_rate, int32_t process_rate, uint32_t *tick, uint32_t duration)
+{
+    uint8_t is_heating_requested = 1;
+
+    for (uint32_t elapsed=0; elapsed<duration; elapsed+=CONTROL_PERIOD)
+    {
+        *tick += CONTROL_PERIOD;
+        if ((*tick % 60000) == 0)
+        {
+            inputs->buffer_temperature += buffer_rate;
+            inputs->process_temperature -= process_rate;
+        }
+        is_heating_requested = run_preheat_scheduler(scheduler, inputs, *tick);
+    }
+
+    return is_heating_requested;
+}
+
+/**@brief	Simulates a whole day of the enclosure and of its Hot Water tank.
+ *
+ * @param[in,out] scheduler Pointer to the Scheduler of the Hot Water, or \c NULL to always allow the Water Heater.
+ */
+static day_result_t simulate_day(preheat_scheduler_t *scheduler)
+{
+    day_result_t result = {0};
+    double ambient = AMBIENT_SETPOINT;
+    double water = SURROUNDINGS_TEMPERATURE;
+    uint8_t is_hot_air_requested = 0;
+    uint8_t is_hot_air_on = 0;
+    uint8_t is_heater_on = 0;
+    uint8_t is_waiting = 0;
+    double dt = CONTROL_PERIOD/60000.0;
+
+    for (uint32_t tick=0; tick<SIMULATION_TIME; tick+=CONTROL_PERIOD)
+    {
+        /* Hot Air is requested below the setpoint, and it waits for the Hot Water as in the Hot Air state machine. */
+        if (ambient < AMBIENT_SETPOINT)
+        {
+            is_hot_air_requested = 1;
+        }
+        else if (ambient >= (AMBIENT_SETPOINT + AMBIENT_HYSTERESIS))
+        {
+            is_hot_air_requested = 0;
+        }
+        if (!is_hot_air_requested)
+        {
+            is_waiting = 0;
+        }
+        else if (is_waiting)
+        {
+            is_waiting = (water >= HOT_WATER_READY) ? 0 : 1;
+        }
+        else
+        {
+            is_waiting = (water < HOT_WATER_MIN) ? 1 : 0;
+        }
+        is_hot_air_on = is_hot_air_requested && !is_waiting;
+
+        /* The Water Heater regulates the Hot Water only while it is needed, as in the Control Task. */
+        preheat_scheduler_inputs_t inputs = {
+            .buffer_temperature = (int32_t) water,
+            .buffer_ready_temperature = HOT_WATER_READY,
+            .process_temperature = (int32_t) ambient,
+            .process_heat_temperature = AMBIENT_SETPOINT,
+            .is_heater_on = is_heater_on,
+            .is_air_on = is_hot_air_on
+        };
+        uint8_t is_needed = (scheduler == NULL) ? 1 : run_preheat_scheduler(scheduler, &inputs, tick);
+        is_heater_on = (is_hot_air_requested || is_needed) && (water < HOT_WATER_SETPOINT);
+
+        /* Advance the enclosure and the Hot Water tank. */
+        ambient += (SURROUNDINGS_TEMPERATURE - ambient)*(CONTROL_PERIOD/1000.0)/AMBIENT_TIME_CONSTANT + (is_hot_air_on ? HOT_AIR_RATE*dt : 0);
+        water += (ambient - water)*(CONTROL_PERIOD/1000.0)/WATER_TIME_CONSTANT + (is_heater_on ? HEATER_RATE*dt : 0) - (is_hot_air_on ? HOT_AIR_DRAIN_RATE*dt : 0);
+
+        result.heater_on_time += is_heater_on ? CONTROL_PERIOD : 0;
+        result.waiting_time += is_waiting ? CONTROL_PERIOD : 0;
+        result.below_setpoint_time += (ambient < (AMBIENT_SETPOINT - 50)) ? CONTROL_PERIOD : 0;
+    }
+
+    return result;
+}
+
+int main(void)
+{
+    preheat_scheduler_config_t config = {.window = WINDOW_TIME, .filter_shift = 3, .min_samples = MIN_SAMPLES, .lead_margin = LEAD_MARGIN};
+    preheat_scheduler_t scheduler;
+    preheat_scheduler_rates_t rates;
+    preheat_scheduler_inputs_t inputs = {.buffer_temperature = 3000, .buffer_ready_temperature = HOT_WATER_READY, .process_temperature = 2800, .process_heat_temperature = AMBIENT_SETPOINT, .is_heater_on = 1, .is_air_on = 0};
+    uint32_t tick = 0;
+    int32_t process_temperature;
+
+    /* Invalid configurations are rejected. */
+    preheat_scheduler_config_t invalid_config = config;
+    invalid_config.window = 0;
+    HOST_TEST_CHECK_EQUAL(init_preheat_scheduler(&scheduler, &invalid_config), PREHEAT_SCHEDULER_EC_ERR);
+    invalid_config = config;
+    invalid_config.filter_shift = PREHEAT_SCHEDULER_MAX_FILTER_SHIFT + 1;
+    HOST_TEST_CHECK_EQUAL(init_preheat_scheduler(&scheduler, &invalid_config), PREHEAT_SCHEDULER_EC_ERR);
+
+    /* Until both rates have been learned, the Hot Water is only heated once the Internal Ambient Temperature already needs it. */
+    HOST_TEST_CHECK_EQUAL(init_preheat_scheduler(&scheduler, &config), PREHEAT_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_ramp(&scheduler, &inputs, 40, 3, &tick, (MIN_SAMPLES - 1)*WINDOW_TIME + CONTROL_PERIOD), 0);
+    HOST_TEST_CHECK_EQUAL(get_preheat_scheduler_rates(&scheduler, &rates), PREHEAT_SCHEDULER_EC_NO_DATA);
+    process_temperature = inputs.process_temperature;
+    inputs.process_temperature = AMBIENT_SETPOINT;
+    HOST_TEST_CHECK_EQUAL(run_preheat_scheduler(&scheduler, &inputs, tick), 1);
+    inputs.process_temperature = process_temperature;
+
+    /* A window that was not followed all along is discarded. */
+    tick += 2*WINDOW_TIME;
+    inputs.buffer_temperature += 1000;
+    run_ramp(&scheduler, &inputs, 40, 3, &tick, WINDOW_TIME);
+    HOST_TEST_CHECK_EQUAL(get_preheat_scheduler_rates(&scheduler, &rates), PREHEAT_SCHEDULER_EC_NO_DATA);
+
+    /* Steady ramps give their rates. */
+    run_ramp(&scheduler, &inputs, 40, 3, &tick, WINDOW_TIME);
+    HOST_TEST_CHECK_EQUAL(get_preheat_scheduler_rates(&scheduler, &rates), PREHEAT_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(rates.heating_rate, 40);
+    HOST_TEST_CHECK_EQUAL(rates.heat_loss_rate, 3);
+
+    /* The windows with the Heater Off or with air do not change the rates. */
+    inputs.is_heater_on = 0;
+    inputs.is_air_on = 1;
+    run_ramp(&scheduler, &inputs, -20, -30, &tick, 5*WINDOW_TIME);
+    HOST_TEST_CHECK_EQUAL(get_preheat_scheduler_rates(&scheduler, &rates), PREHEAT_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(rates.heating_rate, 40);
+    HOST_TEST_CHECK_EQUAL(rates.heat_loss_rate, 3);
+
+    /* The Hot Water is only heated once it would not be ready in time otherwise, where 10 minutes of heating are needed. */
+    inputs.buffer_temperature = HOT_WATER_READY - 10*40;
+    inputs.process_temperature = AMBIENT_SETPOINT + 3*(10 + LEAD_MARGIN/60000) + 3;
+    HOST_TEST_CHECK_EQUAL(run_preheat_scheduler(&scheduler, &inputs, tick), 0);
+    inputs.process_temperature -= 3;
+    HOST_TEST_CHECK_EQUAL(run_preheat_scheduler(&scheduler, &inputs, tick), 1);
+    inputs.buffer_temperature = HOT_WATER_READY;
+    HOST_TEST_CHECK_EQUAL(run_preheat_scheduler(&scheduler, &inputs, tick), 0);
+    inputs.process_temperature = AMBIENT_SETPOINT;
+    HOST_TEST_CHECK_EQUAL(run_preheat_scheduler(&scheduler, &inputs, tick), 1);
+
+    /* Over a whole day, the scheduled Water Heater is On for less time, without any more waiting for the Hot Water nor time below the setpoint. */
+    day_result_t always_on = simulate_day(NULL);
+    HOST_TEST_CHECK_EQUAL(init_preheat_scheduler(&scheduler, &config), PREHEAT_SCHEDULER_EC_OK);
+    day_result_t scheduled = simulate_day(&scheduler);
+    HOST_TEST_CHECK_EQUAL(get_preheat_scheduler_rates(&scheduler, &rates), PREHEAT_SCHEDULER_EC_OK);
+    printf("Learned a heating rate of %d and a heat-loss rate of %d centi-degrees Celsius per minute.\n", rates.heating_rate, rates.heat_loss_rate);
+    printf("Always allowed: Water Heater On for %u min, Hot Air waiting for %u min, %u min below the setpoint.\n", always_on.heater_on_time/60000, always_on.waiting_time/60000, always_on.below_setpoint_time/60000);
+    printf("Scheduled: Water Heater On for %u min, Hot Air waiting for %u min, %u min below the setpoint.\n", scheduled.heater_on_time/60000, scheduled.waiting_time/60000, scheduled.below_setpoint_time/60000);
+    HOST_TEST_CHECK(scheduled.heater_on_time < (always_on.heater_on_time - always_on.heater_on_time/10));
+    HOST_TEST_CHECK(scheduled.waiting_time <= always_on.waiting_time);
+    HOST_TEST_CHECK(scheduled.below_setpoint_time <= always_on.below_setpoint_time);
+
+    return HOST_TEST_RESULT;
+}
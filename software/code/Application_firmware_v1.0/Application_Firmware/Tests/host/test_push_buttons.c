@@ -0,0 +1,152 @@
+/**@file
+ * @brief	Host test of the @ref push_buttons .
+ *
+ * @details This test bounces the Push Buttons of the MTKATR001 System, with the debounce and long-press times of the
+ *          @ref main module, both for the ones that are reported via their EXTI line and for the one that is sampled
+ *          by the debouncer. It checks that each press and each release generates a single event once the bouncing
+ *          has stopped for the debounce time, that a single long-press event is generated per press and that the
+ *          events are discarded, and counted, once the ring buffer is full.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated Flash Memory.
+#include "push_buttons.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Debounced Push Buttons driver.
+
+#define DEBOUNCE_TIME       (15)    /**< @brief Time in milliseconds during which a Push Button must stay quiet, as the one of the @ref main module. */
+#define LONG_PRESS_TIME     (3000)  /**< @brief Time in milliseconds during which a Push Button must be held to be long-pressed, as the one of the @ref main module. */
+#define TOTAL_BUTTONS       (4)     /**< @brief Number of Push Buttons of the MTKATR001 System. */
+#define SAMPLED_BUTTON      (3)     /**< @brief Index of the Push Button that is sampled by the debouncer instead of using an EXTI line. */
+
+/**@brief	Push Buttons of the MTKATR001 System, with the very same GPIO Pins as in the @ref main module.
+ */
+static const push_button_def_t buttons[TOTAL_BUTTONS] = {
+    {.GPIO_Port = GPIOA, .GPIO_Pin = GPIO_PIN_11, .pressed_state = GPIO_PIN_SET, .is_exti = 1},
+    {.GPIO_Port = GPIOA, .GPIO_Pin = GPIO_PIN_12, .pressed_state = GPIO_PIN_SET, .is_exti = 1},
+    {.GPIO_Port = GPIOA, .GPIO_Pin = GPIO_PIN_15, .pressed_state = GPIO_PIN_SET, .is_exti = 1},
+    {.GPIO_Port = GPIOC, .GPIO_Pin = GPIO_PIN_15, .pressed_state = GPIO_PIN_SET, .is_exti = 0}
+};
+
+/**@brief	Changes the GPIO Pin of a Push Button and, if it uses an EXTI line, reports its edge as its EXTI Interrupt would.
+ */
+static void set_button_pin(uint8_t button, GPIO_PinState state)
+{
+    set_host_gpio_pin(buttons[button].GPIO_Port, buttons[button].GPIO_Pin, state);
+    if (buttons[button].is_exti)
+    {
+        push_buttons_exti_handler(buttons[button].GPIO_Pin);
+    }
+}
+
+/**@brief	Bounces the GPIO Pin of a Push Button for some milliseconds, with the debouncer running each millisecond,
+ *          until it settles at a certain state.
+ */
+static void bounce_button(uint8_t button, GPIO_PinState settled_state)
+{
+    static const uint8_t bounce_times[] = {1, 2, 1, 3, 1, 1, 2, 4};
+
+    for (uint32_t i=0; i<sizeof(bounce_times); i++)
+    {
+        set_button_pin(button, ((i % 2) == 0) ? settled_state : !settled_state);
+        for (uint8_t ms=0; ms<bounce_times[i]; ms++)
+        {
+            run_push_buttons_debouncer();
+        }
+    }
+    set_button_pin(button, settled_state);
+}
+
+/**@brief	Runs the debouncer each millisecond until an event is generated or until a timeout.
+ *
+ * @return  The number of milliseconds until the event was generated, or zero if there was no event.
+ */
+static uint32_t wait_for_event(push_button_event_t *event, uint32_t timeout)
+{
+    for (uint32_t ms=1; ms<=timeout; ms++)
+    {
+        run_push_buttons_debouncer();
+        if (get_push_button_event(event) == PUSH_BUTTONS_EC_OK)
+        {
+            return ms;
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    push_button_event_t event = {0};
+    uint32_t delay;
+
+    /* Invalid parameters are rejected. */
+    HOST_TEST_CHECK_EQUAL(init_push_buttons_module(buttons, 0, DEBOUNCE_TIME, LONG_PRESS_TIME), PUSH_BUTTONS_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_push_buttons_module(buttons, TOTAL_BUTTONS, UINT8_MAX + 1, LONG_PRESS_TIME), PUSH_BUTTONS_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_push_buttons_module(buttons, TOTAL_BUTTONS, DEBOUNCE_TIME, 0), PUSH_BUTTONS_EC_ERR);
+
+    /* Released Push Buttons generate no events. */
+    HOST_TEST_CHECK_EQUAL(init_push_buttons_module(buttons, TOTAL_BUTTONS, DEBOUNCE_TIME, LONG_PRESS_TIME), PUSH_BUTTONS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(wait_for_event(&event, 100), 0);
+
+    /* Each bouncing press and release generates a single event, once the bouncing has stopped for the debounce time. */
+    for (uint8_t button=0; button<TOTAL_BUTTONS; button++)
+    {
+        bounce_button(button, GPIO_PIN_SET);
+        delay = wait_for_event(&event, 10*DEBOUNCE_TIME);
+        printf("Button %u press reported %u ms after its bouncing stopped.\n", button, delay);
+        HOST_TEST_CHECK((delay >= DEBOUNCE_TIME) && (delay <= (DEBOUNCE_TIME + 1)));
+        HOST_TEST_CHECK_EQUAL(event.button, button);
+        HOST_TEST_CHECK_EQUAL(event.type, PUSH_BUTTON_EVENT_PRESS);
+        HOST_TEST_CHECK_EQUAL(is_push_button_pressed(button), 1);
+        HOST_TEST_CHECK_EQUAL(wait_for_event(&event, 100), 0);
+
+        bounce_button(button, GPIO_PIN_RESET);
+        delay = wait_for_event(&event, 10*DEBOUNCE_TIME);
+        HOST_TEST_CHECK((delay >= DEBOUNCE_TIME) && (delay <= (DEBOUNCE_TIME + 1)));
+        HOST_TEST_CHECK_EQUAL(event.button, button);
+        HOST_TEST_CHECK_EQUAL(event.type, PUSH_BUTTON_EVENT_RELEASE);
+        HOST_TEST_CHECK_EQUAL(is_push_button_pressed(button), 0);
+        HOST_TEST_CHECK_EQUAL(wait_for_event(&event, 100), 0);
+    }
+
+    /* A glitch shorter than the debounce time generates no events. */
+    set_button_pin(0, GPIO_PIN_SET);
+    run_push_buttons_debouncer();
+    set_button_pin(0, GPIO_PIN_RESET);
+    HOST_TEST_CHECK_EQUAL(wait_for_event(&event, 100), 0);
+
+    /* A held Push Button generates a single long-press event. */
+    set_button_pin(SAMPLED_BUTTON, GPIO_PIN_SET);
+    HOST_TEST_CHECK(wait_for_event(&event, 10*DEBOUNCE_TIME) > 0);
+    HOST_TEST_CHECK_EQUAL(event.type, PUSH_BUTTON_EVENT_PRESS);
+    delay = wait_for_event(&event, 2*LONG_PRESS_TIME);
+    HOST_TEST_CHECK((delay >= (LONG_PRESS_TIME - 1)) && (delay <= LONG_PRESS_TIME));
+    HOST_TEST_CHECK_EQUAL(event.button, SAMPLED_BUTTON);
+    HOST_TEST_CHECK_EQUAL(event.type, PUSH_BUTTON_EVENT_LONG_PRESS);
+    HOST_TEST_CHECK_EQUAL(wait_for_event(&event, 2*LONG_PRESS_TIME), 0);
+    set_button_pin(SAMPLED_BUTTON, GPIO_PIN_RESET);
+    HOST_TEST_CHECK(wait_for_event(&event, 10*DEBOUNCE_TIME) > 0);
+    HOST_TEST_CHECK_EQUAL(event.type, PUSH_BUTTON_EVENT_RELEASE);
+
+    /* Once the ring buffer is full, the newer events are discarded and counted. */
+    HOST_TEST_CHECK_EQUAL(get_push_buttons_dropped_events(), 0);
+    for (uint32_t i=0; i<PUSH_BUTTONS_EVENT_QUEUE_SIZE; i++)
+    {
+        set_button_pin(1, ((i % 2) == 0) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+        for (uint8_t ms=0; ms<=DEBOUNCE_TIME; ms++)
+        {
+            run_push_buttons_debouncer();
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(get_push_buttons_dropped_events(), 1);
+    for (uint32_t i=0; i<(PUSH_BUTTONS_EVENT_QUEUE_SIZE - 1); i++)
+    {
+        HOST_TEST_CHECK_EQUAL(get_push_button_event(&event), PUSH_BUTTONS_EC_OK);
+        HOST_TEST_CHECK_EQUAL(event.type, ((i % 2) == 0) ? PUSH_BUTTON_EVENT_PRESS : PUSH_BUTTON_EVENT_RELEASE);
+    }
+    HOST_TEST_CHECK_EQUAL(get_push_button_event(&event), PUSH_BUTTONS_EC_NO_DATA);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,200 @@
+/**@file
+ * @brief	Host test of the @ref sensor_calibration .
+ *
+ * @details This test sets calibration tables into a simulated Flash Memory and checks them against the exact
+ *          piecewise-linear interpolation. It checks that each Temperature is calibrated with the segment that
+ *          contains it, or extrapolated with the first or last segment outside of the table, that the Q16 slopes
+ *          of the segments round to within one centi-degree Celsius, that one breakpoint applies an offset and no
+ *          breakpoints leave the Temperature unchanged, and that invalid tables are rejected. It then re-initializes
+ *          the @ref sensor_calibration , as if our MCU/MPU had been reset, and checks that the most recent valid
+ *          record of its two pages is loaded, even across the wrap-around of the sequence numbers, and that a
+ *          corrupted record falls back to the one of the other page. Finally, it checks that a table whose record
+ *          could not be written is not applied.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <stdlib.h> // Library from which "llabs()" is located at.
+#include <string.h> // Library from which "memcpy()" and "memcmp()" are located at.
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated Flash Memory.
+#include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
+#include "sensor_calibration.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the per-channel calibration of the Temperature Sensors.
+
+#define PAGE_1_START_ADDR   (SENSOR_CALIBRATION_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR)   /**< @brief Flash Memory address of the first page of the @ref sensor_calibration . */
+#define RECORD_SIZE         (2*sizeof(uint32_t) + TEMP_SENSORS_TOTAL_CHANNELS*sizeof(sensor_calibration_table_t))  /**< @brief Size in bytes of each record of the @ref sensor_calibration , which starts with its 32-bit CRC and its sequence number. */
+#define MIN_TEMPERATURE     (-2000) /**< @brief Lowest Temperature, in centi-degrees Celsius, that is calibrated by this test. */
+#define MAX_TEMPERATURE     (16000) /**< @brief Highest Temperature, in centi-degrees Celsius, that is calibrated by this test. */
+
+/**@brief	Gets the Temperature that a calibration table stands for with the exact piecewise-linear interpolation,
+ *          rounded to the nearest centi-degree Celsius.
+ */
+static int32_t calibrate_exactly(const sensor_calibration_table_t *table, int32_t measured)
+{
+    uint8_t segment = 0;
+    int64_t numerator;
+    int64_t denominator;
+
+    if (table->total_points == 0)
+    {
+        return measured;
+    }
+    if (table->total_points == 1)
+    {
+        return measured + table->points[0].actual - table->points[0].measured;
+    }
+    while ((segment < (table->total_points - 2)) && (measured >= table->points[segment+1].measured))
+    {
+        segment++;
+    }
+    numerator = ((int64_t) (measured - table->points[segment].measured))*(table->points[segment+1].actual - table->points[segment].actual);
+    denominator = table->points[segment+1].measured - table->points[segment].measured;
+    numerator = (numerator >= 0) ? (numerator + denominator/2) : (numerator - denominator/2);
+
+    return table->points[segment].actual + (int32_t) (numerator/denominator);
+}
+
+/**@brief	Checks every Temperature of the test range of a channel against the exact interpolation of its table.
+ *
+ * @return  The largest error, in centi-degrees Celsius, of the calibrated Temperatures.
+ */
+static int64_t check_channel(Temp_Sensor_Channel channel, const sensor_calibration_table_t *table)
+{
+    int64_t max_error = 0;
+
+    for (int32_t measured=MIN_TEMPERATURE; measured<=MAX_TEMPERATURE; measured++)
+    {
+        int64_t error = llabs((int64_t) apply_sensor_calibration(channel, measured) - calibrate_exactly(table, measured));
+        if (error > max_error)
+        {
+            max_error = error;
+        }
+    }
+    HOST_TEST_CHECK(max_error <= 1);
+    for (uint8_t i=0; i<table->total_points; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(apply_sensor_calibration(channel, table->points[i].measured), table->points[i].actual);
+    }
+
+    return max_error;
+}
+
+/**@brief	Gets the pointer to the record of a desired page of the @ref sensor_calibration in the simulated Flash
+ *          Memory.
+ */
+static uint8_t *get_page_record(uint8_t page)
+{
+    return (uint8_t *) (uintptr_t) (PAGE_1_START_ADDR + page*FLASH_PAGE_SIZE_IN_BYTES);
+}
+
+/**@brief	Overwrites the sequence number of the record of a desired page and recalculates its 32-bit CRC.
+ */
+static void set_page_sequence(uint8_t page, uint32_t sequence)
+{
+    uint8_t *p_record = get_page_record(page);
+    uint32_t crc32;
+
+    memcpy(&p_record[sizeof(uint32_t)], &sequence, sizeof(sequence));
+    crc32 = crc32_mpeg2(&p_record[sizeof(uint32_t)], RECORD_SIZE - sizeof(uint32_t));
+    memcpy(p_record, &crc32, sizeof(crc32));
+}
+
+int main(void)
+{
+    /* Non-uniform segments with rising and falling slopes, fractional Q16 slopes and negative actual Temperatures. */
+    sensor_calibration_table_t ambient_table = {.total_points = 4, .points = {{500, -120}, {2000, 1950}, {2300, 2299}, {9000, 8700}}};
+    sensor_calibration_table_t hot_water_table = {.total_points = 3, .points = {{1000, 1000}, {1003, 1001}, {7000, 7321}}};
+    sensor_calibration_table_t cold_water_table = {.total_points = 1, .points = {{2500, 2460}}};
+    sensor_calibration_table_t empty_table = {0};
+    sensor_calibration_table_t invalid_table = ambient_table;
+    sensor_calibration_table_t read_table;
+    int64_t max_error = 0;
+    int64_t error;
+
+    /* A blank Flash Memory leaves every channel uncalibrated. */
+    init_host_flash();
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_NO_DATA);
+    for (uint8_t channel=0; channel<TEMP_SENSORS_TOTAL_CHANNELS; channel++)
+    {
+        check_channel((Temp_Sensor_Channel) channel, &empty_table);
+    }
+
+    /* Invalid tables are rejected and change nothing. */
+    invalid_table.points[2].measured = invalid_table.points[1].measured;
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(INTERNAL_AMBIENT_TEMP_SENSOR, &invalid_table), SENSOR_CALIBRATION_EC_ERR);
+    invalid_table = ambient_table;
+    invalid_table.total_points = SENSOR_CALIBRATION_MAX_POINTS + 1;
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(INTERNAL_AMBIENT_TEMP_SENSOR, &invalid_table), SENSOR_CALIBRATION_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(TEMP_SENSORS_TOTAL_CHANNELS, &ambient_table), SENSOR_CALIBRATION_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(get_host_flash_erased_pages(), 0);
+    check_channel(INTERNAL_AMBIENT_TEMP_SENSOR, &empty_table);
+
+    /* Each Temperature is calibrated with the segment that contains it, or with the first or last one outside of the table. */
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(INTERNAL_AMBIENT_TEMP_SENSOR, &ambient_table), SENSOR_CALIBRATION_EC_OK);
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(HOT_WATER_TEMP_SENSOR, &hot_water_table), SENSOR_CALIBRATION_EC_OK);
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(COLD_WATER_TEMP_SENSOR, &cold_water_table), SENSOR_CALIBRATION_EC_OK);
+    error = check_channel(INTERNAL_AMBIENT_TEMP_SENSOR, &ambient_table);
+    max_error = (error > max_error) ? error : max_error;
+    error = check_channel(HOT_WATER_TEMP_SENSOR, &hot_water_table);
+    max_error = (error > max_error) ? error : max_error;
+    check_channel(COLD_WATER_TEMP_SENSOR, &cold_water_table);
+    HOST_TEST_CHECK_EQUAL(apply_sensor_calibration(INTERNAL_AMBIENT_TEMP_SENSOR, 0), -810);
+    HOST_TEST_CHECK_EQUAL(apply_sensor_calibration(INTERNAL_AMBIENT_TEMP_SENSOR, 12000), 11566);
+    HOST_TEST_CHECK_EQUAL(apply_sensor_calibration(COLD_WATER_TEMP_SENSOR, 0), -40);
+    printf("Largest error of the Q16 interpolation: %lld centi-degrees Celsius.\n", (long long) max_error);
+
+    /* The tables are read back as they were set. */
+    HOST_TEST_CHECK_EQUAL(get_sensor_calibration(HOT_WATER_TEMP_SENSOR, &read_table), SENSOR_CALIBRATION_EC_OK);
+    HOST_TEST_CHECK(memcmp(&read_table, &hot_water_table, sizeof(read_table)) == 0);
+    HOST_TEST_CHECK_EQUAL(get_sensor_calibration(TEMP_SENSORS_TOTAL_CHANNELS, &read_table), SENSOR_CALIBRATION_EC_ERR);
+
+    /* Each record is written into the other page, and the most recent one is loaded after a reset. */
+    HOST_TEST_CHECK_EQUAL(get_host_flash_erased_pages(), 3);
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(INTERNAL_AMBIENT_TEMP_SENSOR, &ambient_table);
+    check_channel(HOT_WATER_TEMP_SENSOR, &hot_water_table);
+    check_channel(COLD_WATER_TEMP_SENSOR, &cold_water_table);
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(COLD_WATER_TEMP_SENSOR, &empty_table), SENSOR_CALIBRATION_EC_OK);
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &empty_table);
+    check_channel(INTERNAL_AMBIENT_TEMP_SENSOR, &ambient_table);
+
+    /* A corrupted record falls back to the record of the other page, which holds the previous tables. */
+    get_page_record(1)[RECORD_SIZE - 1] ^= 0x01;
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &cold_water_table);
+    check_channel(HOT_WATER_TEMP_SENSOR, &hot_water_table);
+    get_page_record(1)[RECORD_SIZE - 1] ^= 0x01;
+
+    /* The most recent record is still found once the sequence numbers wrap around. */
+    set_page_sequence(0, 0xFFFFFFFFU);
+    set_page_sequence(1, 0);
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &empty_table);
+    set_page_sequence(0, 1);
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &cold_water_table);
+
+    /* A table whose record could not be written is not applied, neither before nor after a reset. */
+    set_host_flash_program_limit(RECORD_SIZE/(2*sizeof(uint32_t)));
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(COLD_WATER_TEMP_SENSOR, &empty_table), SENSOR_CALIBRATION_EC_ERR);
+    set_host_flash_program_limit(HOST_FLASH_NO_PROGRAM_LIMIT);
+    check_channel(COLD_WATER_TEMP_SENSOR, &cold_water_table);
+    HOST_TEST_CHECK_EQUAL(get_sensor_calibration(COLD_WATER_TEMP_SENSOR, &read_table), SENSOR_CALIBRATION_EC_OK);
+    HOST_TEST_CHECK(memcmp(&read_table, &cold_water_table, sizeof(read_table)) == 0);
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &cold_water_table);
+    HOST_TEST_CHECK_EQUAL(set_sensor_calibration(COLD_WATER_TEMP_SENSOR, &empty_table), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &empty_table);
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_OK);
+    check_channel(COLD_WATER_TEMP_SENSOR, &empty_table);
+
+    /* No valid record leaves every channel uncalibrated. */
+    get_page_record(0)[RECORD_SIZE - 1] ^= 0x01;
+    get_page_record(1)[RECORD_SIZE - 1] ^= 0x01;
+    HOST_TEST_CHECK_EQUAL(init_sensor_calibration_module(), SENSOR_CALIBRATION_EC_NO_DATA);
+    check_channel(INTERNAL_AMBIENT_TEMP_SENSOR, &empty_table);
+
+    return HOST_TEST_RESULT;
+}
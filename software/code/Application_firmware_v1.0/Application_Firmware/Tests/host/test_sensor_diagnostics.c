@@ -0,0 +1,122 @@
+/**@file
+ * @brief	Host test of the @ref sensor_diagnostics .
+ *
+ * @details This test gives the readings of a simulated Hot Water Temperature Sensor to the @ref sensor_diagnostics ,
+ *          with the configuration and at the Sensing Task period of the @ref main module, and checks that a live
+ *          sensor and a physically possible ramp are always valid, that the Range and Stuck checks fail the sensor
+ *          right away, that the Rate and Cross checks only make it suspect until it settles or until its fail time
+ *          and that a failed sensor recovers through the suspect state.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "sensor_diagnostics.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the Sensor Plausibility Diagnostics.
+
+#define SENSING_PERIOD      (50)        /**< @brief Period in milliseconds at which the readings are given, as the one of the Sensing Task. */
+#define MAX_RATE            (500)       /**< @brief Fastest change, in centi-degrees Celsius per second, of the Water Temperatures, as in the @ref main module. */
+#define STUCK_TIME          (600000)    /**< @brief Stuck time in milliseconds of the Temperature Sensors, as in the @ref main module. */
+#define SETTLE_TIME         (2000)      /**< @brief Settle time in milliseconds of the Temperature Sensors, as in the @ref main module. */
+#define FAIL_TIME           (10000)     /**< @brief Suspect fail time in milliseconds of the Temperature Sensors, as in the @ref main module. */
+#define TEMPERATURE         (4500)      /**< @brief Temperature, in centi-degrees Celsius, around which the simulated sensor reads. */
+
+/**@brief	Gives the readings of a live sensor, with one LSB of noise around a Temperature, during some time.
+ *
+ * @return  The time in milliseconds after which the sensor became valid, or zero if it never did. The \p worst param
+ *          gets the worst validity during that time.
+ */
+static uint32_t run_live_sensor(sensor_diagnostics_t *diagnostics, int32_t temperature, uint8_t is_inconsistent, uint32_t *tick, uint32_t duration, Sensor_Validity *worst)
+{
+    uint32_t valid_after = 0;
+
+    *worst = SENSOR_VALID;
+    for (uint32_t elapsed=SENSING_PERIOD; elapsed<=duration; elapsed+=SENSING_PERIOD)
+    {
+        *tick += SENSING_PERIOD;
+        Sensor_Validity validity = run_sensor_diagnostics(diagnostics, temperature + ((*tick/SENSING_PERIOD) % 2), is_inconsistent, *tick);
+        *worst = (validity > *worst) ? validity : *worst;
+        if ((valid_after == 0) && (validity == SENSOR_VALID))
+        {
+            valid_after = elapsed;
+        }
+    }
+
+    return valid_after;
+}
+
+int main(void)
+{
+    sensor_diagnostics_t diagnostics;
+    sensor_diagnostics_config_t config = {.min_value = 0, .max_value = 15000, .max_rate = MAX_RATE, .stuck_time = STUCK_TIME, .settle_time = SETTLE_TIME, .fail_time = FAIL_TIME};
+    Sensor_Validity worst;
+    uint32_t tick = 0;
+
+    /* Invalid configurations are rejected. */
+    sensor_diagnostics_config_t invalid_config = config;
+    invalid_config.max_value = invalid_config.min_value;
+    HOST_TEST_CHECK_EQUAL(init_sensor_diagnostics(&diagnostics, &invalid_config), SENSOR_DIAGNOSTICS_EC_ERR);
+    invalid_config = config;
+    invalid_config.fail_time = SETTLE_TIME;
+    HOST_TEST_CHECK_EQUAL(init_sensor_diagnostics(&diagnostics, &invalid_config), SENSOR_DIAGNOSTICS_EC_ERR);
+
+    /* A live sensor is always valid. */
+    HOST_TEST_CHECK_EQUAL(init_sensor_diagnostics(&diagnostics, &config), SENSOR_DIAGNOSTICS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_sensor_diagnostics_validity(&diagnostics), SENSOR_VALID);
+    run_live_sensor(&diagnostics, TEMPERATURE, 0, &tick, 2*STUCK_TIME, &worst);
+    HOST_TEST_CHECK_EQUAL(worst, SENSOR_VALID);
+
+    /* A ramp at the fastest physical change is always valid. */
+    for (int32_t temperature=TEMPERATURE; temperature<(TEMPERATURE + 2000); temperature+=(MAX_RATE*SENSING_PERIOD/1000))
+    {
+        tick += SENSING_PERIOD;
+        HOST_TEST_CHECK_EQUAL(run_sensor_diagnostics(&diagnostics, temperature, 0, tick), SENSOR_VALID);
+    }
+
+    /* A reading out of range fails the sensor right away, which then recovers through the suspect state. */
+    tick += SENSING_PERIOD;
+    HOST_TEST_CHECK_EQUAL(run_sensor_diagnostics(&diagnostics, 15001, 0, tick), SENSOR_FAILED);
+    HOST_TEST_CHECK_EQUAL(get_sensor_diagnostics_failed_checks(&diagnostics), SENSOR_DIAGNOSTICS_RANGE_CHECK | SENSOR_DIAGNOSTICS_RATE_CHECK);
+    tick += 1000;
+    HOST_TEST_CHECK_EQUAL(run_sensor_diagnostics(&diagnostics, TEMPERATURE, 0, tick), SENSOR_SUSPECT);
+    HOST_TEST_CHECK_EQUAL(run_live_sensor(&diagnostics, TEMPERATURE, 0, &tick, 2*SETTLE_TIME, &worst), SETTLE_TIME);
+    HOST_TEST_CHECK_EQUAL(worst, SENSOR_SUSPECT);
+
+    /* A single jump faster than physically possible only makes the sensor suspect until it settles. */
+    tick += SENSING_PERIOD;
+    HOST_TEST_CHECK_EQUAL(run_sensor_diagnostics(&diagnostics, TEMPERATURE + 500, 0, tick), SENSOR_SUSPECT);
+    HOST_TEST_CHECK_EQUAL(get_sensor_diagnostics_failed_checks(&diagnostics), SENSOR_DIAGNOSTICS_RATE_CHECK);
+    HOST_TEST_CHECK_EQUAL(run_live_sensor(&diagnostics, TEMPERATURE + 500, 0, &tick, 2*SETTLE_TIME, &worst), SETTLE_TIME);
+    HOST_TEST_CHECK_EQUAL(worst, SENSOR_SUSPECT);
+
+    /* An inconsistent reading is suspect during the fail time and then fails. */
+    HOST_TEST_CHECK_EQUAL(run_live_sensor(&diagnostics, TEMPERATURE, 1, &tick, FAIL_TIME, &worst), 0);
+    HOST_TEST_CHECK_EQUAL(worst, SENSOR_SUSPECT);
+    HOST_TEST_CHECK_EQUAL(get_sensor_diagnostics_failed_checks(&diagnostics), SENSOR_DIAGNOSTICS_CROSS_CHECK);
+    run_live_sensor(&diagnostics, TEMPERATURE, 1, &tick, SENSING_PERIOD, &worst);
+    HOST_TEST_CHECK_EQUAL(worst, SENSOR_FAILED);
+    HOST_TEST_CHECK_EQUAL(run_live_sensor(&diagnostics, TEMPERATURE, 0, &tick, 2*SETTLE_TIME, &worst), SETTLE_TIME);
+
+    /* A reading that does not change at all fails the Stuck check after the stuck time, and not before. */
+    tick += SENSING_PERIOD;
+    run_sensor_diagnostics(&diagnostics, TEMPERATURE + 2, 0, tick);
+    tick += SENSING_PERIOD;
+    HOST_TEST_CHECK_EQUAL(run_sensor_diagnostics(&diagnostics, TEMPERATURE, 0, tick), SENSOR_VALID);
+    for (uint32_t elapsed=SENSING_PERIOD; elapsed<=STUCK_TIME; elapsed+=SENSING_PERIOD)
+    {
+        tick += SENSING_PERIOD;
+        Sensor_Validity validity = run_sensor_diagnostics(&diagnostics, TEMPERATURE, 0, tick);
+        if (elapsed < STUCK_TIME)
+        {
+            HOST_TEST_CHECK_EQUAL(validity, SENSOR_VALID);
+        }
+        else
+        {
+            HOST_TEST_CHECK_EQUAL(validity, SENSOR_FAILED);
+            HOST_TEST_CHECK_EQUAL(get_sensor_diagnostics_failed_checks(&diagnostics), SENSOR_DIAGNOSTICS_STUCK_CHECK);
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(run_live_sensor(&diagnostics, TEMPERATURE + 1, 0, &tick, 2*SETTLE_TIME, &worst), SETTLE_TIME);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,85 @@
+/**@file
+ * @brief	Host test of the @ref sensor_filter .
+ *
+ * @details This test checks that the Median filter rejects isolated spikes, that the IIR Low-Pass filter follows a
+ *          step with the time constant of its configured cut-off frequency and that invalid configurations are
+ *          rejected, with the configuration of the Internal Ambient Temperature Sensor.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <math.h> // Library from which "M_PI" is located at.
+#include "sensor_filter.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Median plus IIR Sensor Filter.
+
+#define SAMPLE_RATE         (100)   /**< @brief Rate in Hertz at which the samples are given to the filter. */
+#define CUTOFF_FREQUENCY    (250)   /**< @brief Cut-off frequency in millihertz of the filter. */
+#define STEP_LOW            (5000)  /**< @brief Sample value before the step. */
+#define STEP_HIGH           (6000)  /**< @brief Sample value after the step. */
+#define SPIKE               (16000) /**< @brief Sample value of the spikes. */
+
+int main(void)
+{
+    sensor_filter_t filter;
+    sensor_filter_config_t config = {.median_window = 5, .cutoff_frequency = CUTOFF_FREQUENCY, .sample_rate = SAMPLE_RATE};
+    double time_constant = SAMPLE_RATE / (2*M_PI*CUTOFF_FREQUENCY/1000.0);
+    uint32_t samples_to_63_percent = 0;
+    uint16_t output = 0;
+
+    /* Invalid configurations are rejected. */
+    sensor_filter_config_t invalid_config = config;
+    invalid_config.median_window = 4;
+    HOST_TEST_CHECK_EQUAL(init_sensor_filter(&filter, &invalid_config), SENSOR_FILTER_EC_ERR);
+    invalid_config.median_window = SENSOR_FILTER_MAX_MEDIAN_WINDOW + 2;
+    HOST_TEST_CHECK_EQUAL(init_sensor_filter(&filter, &invalid_config), SENSOR_FILTER_EC_ERR);
+    invalid_config = config;
+    invalid_config.sample_rate = 0;
+    HOST_TEST_CHECK_EQUAL(init_sensor_filter(&filter, &invalid_config), SENSOR_FILTER_EC_ERR);
+
+    /* The first sample primes the filter, so the output does not start from zero. */
+    HOST_TEST_CHECK_EQUAL(init_sensor_filter(&filter, &config), SENSOR_FILTER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, STEP_LOW), STEP_LOW);
+    for (int i=0; i<SAMPLE_RATE; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, STEP_LOW), STEP_LOW);
+    }
+
+    /* Isolated spikes, and even two consecutive ones with a window of 5 samples, are fully rejected. */
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, SPIKE), STEP_LOW);
+    for (int i=0; i<SAMPLE_RATE; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, STEP_LOW), STEP_LOW);
+    }
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, SPIKE), STEP_LOW);
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, SPIKE), STEP_LOW);
+    for (int i=0; i<SAMPLE_RATE; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, STEP_LOW), STEP_LOW);
+    }
+
+    /* A step reaches 63 % of its height after one time constant, plus the delay of the Median filter. */
+    for (uint32_t i=1; i<=20*time_constant; i++)
+    {
+        output = run_sensor_filter(&filter, STEP_HIGH);
+        HOST_TEST_CHECK(output <= STEP_HIGH);
+        if ((samples_to_63_percent == 0) && (output >= (STEP_LOW + 0.632*(STEP_HIGH - STEP_LOW))))
+        {
+            samples_to_63_percent = i;
+        }
+    }
+    printf("Step reached 63 %% after %u samples (time constant of %.1f samples).\n", samples_to_63_percent, time_constant);
+    HOST_TEST_CHECK(samples_to_63_percent >= time_constant);
+    HOST_TEST_CHECK(samples_to_63_percent <= (time_constant + config.median_window));
+    HOST_TEST_CHECK(output >= (STEP_HIGH - 1));
+
+    /* A window of 1 sample and a cut-off of 0 pass the samples through untouched. */
+    config.median_window = 1;
+    config.cutoff_frequency = 0;
+    HOST_TEST_CHECK_EQUAL(init_sensor_filter(&filter, &config), SENSOR_FILTER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, STEP_LOW), STEP_LOW);
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, SPIKE), SPIKE);
+    HOST_TEST_CHECK_EQUAL(run_sensor_filter(&filter, STEP_HIGH), STEP_HIGH);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,148 @@
+/**@file
+ * @brief	Host test of the @ref system_params .
+ *
+ * @details This test writes the MTKATR001 System Parameters hundreds of times into a simulated Flash Memory,
+ *          re-initializing the @ref system_params in between as if our MCU/MPU had been reset, and checks that the
+ *          latest parameters always survive the page wrap-arounds and that identical parameters are not written again.
+ *          It also interrupts writes after each of their words, as if our MCU/MPU had been reset in the middle of them,
+ *          and checks that the previous parameters are kept and that the next writes skip the torn Data Blocks, even
+ *          across the page wrap-arounds. Finally, it checks that a corrupted latest Data Block makes the module fall
+ *          back to the previous one, even in the other page, and that it is left without data only when every Data
+ *          Block is corrupted.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <string.h>	// Library from which "memset()" and "memcmp()" are located at.
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated Flash Memory.
+#include "etx_ota_config.h" // Custom Library used for configuring the ETX OTA protocol.
+#include "system_params.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the storage of the MTKATR001 System Parameters.
+
+#define TOTAL_WRITES        (500)   /**< @brief Number of different parameters that are written. */
+#define WRITES_PER_RESET    (7)     /**< @brief Number of writes after which the module is re-initialized, as if our MCU/MPU had been reset. */
+#define TORN_WRITES         (100)   /**< @brief Number of writes that are interrupted in the middle of them. */
+#define BLOCK_WORDS         (SYSTEM_PARAMS_BLOCK_SIZE/sizeof(uint32_t))  /**< @brief Number of words that are programmed for each Data Block. */
+#define PAGE_1_START_ADDR   (SYSTEM_PARAMS_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR)  /**< @brief Flash Memory address of the first System Parameters page. */
+
+/**@brief	Fills some System Parameters whose fields depend on a number.
+ */
+static void fill_system_params(system_params_data_t *p_data, int32_t number)
+{
+    memset(p_data, 0xFF, sizeof(system_params_data_t));
+    p_data->pid_kp = number;
+    p_data->pid_ki = 2*number;
+    p_data->pid_kd = 3*number;
+    p_data->desired_internal_ambient_temperature = (int8_t) (number % 100);
+    p_data->desired_hot_fan_duty_cycle = (uint8_t) (number % 101);
+}
+
+int main(void)
+{
+    system_params_data_t written;
+    system_params_data_t read;
+    system_params_data_t torn;
+    uint32_t erased_pages;
+
+    /* A blank Flash Memory has no data. */
+    init_host_flash();
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_NO_DATA);
+    memset(&written, 0xFF, sizeof(written));
+    HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+
+    /* The latest parameters survive every write, reset and page wrap-around. */
+    for (int32_t i=1; i<=TOTAL_WRITES; i++)
+    {
+        fill_system_params(&written, i);
+        HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+        if ((i % WRITES_PER_RESET) == 0)
+        {
+            HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+        }
+        HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+        HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+    }
+    erased_pages = get_host_flash_erased_pages();
+    printf("%d writes erased %u Flash Memory pages.\n", TOTAL_WRITES, erased_pages);
+    HOST_TEST_CHECK(erased_pages >= (2*(TOTAL_WRITES/SYSTEM_PARAMS_BLOCKS_PER_PAGE - 1)));
+
+    /* Identical parameters are not written again. */
+    HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_host_flash_erased_pages(), erased_pages);
+    HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+
+    /* A write that is interrupted after any of its words keeps the previous parameters, and the next writes skip the torn Data Block, even across the page wrap-arounds. */
+    for (int32_t i=1; i<=TORN_WRITES; i++)
+    {
+        fill_system_params(&torn, -i);
+        set_host_flash_program_limit((uint32_t) (i % BLOCK_WORDS));
+        HOST_TEST_CHECK(write_system_params(&torn) != SYSTEM_PARAMS_EC_OK);
+        set_host_flash_program_limit(HOST_FLASH_NO_PROGRAM_LIMIT);
+        HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+        HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+        if ((i % 2) == 0)
+        {
+            HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+            HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+            HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+        }
+        fill_system_params(&written, TOTAL_WRITES + i);
+        HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+        HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+        HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+        HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+    }
+
+    /* A corrupted latest Data Block makes the module fall back to the previous one. */
+    init_host_flash();
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    for (int32_t i=1; i<=3; i++)
+    {
+        fill_system_params(&written, i);
+        HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+    }
+    ((uint8_t *) (uintptr_t) (PAGE_1_START_ADDR + 2*SYSTEM_PARAMS_BLOCK_SIZE))[sizeof(uint32_t)] ^= 0x01;
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+    fill_system_params(&written, 2);
+    HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+
+    /* The fall back goes into the other page when the first Data Block of the latest page is torn. */
+    init_host_flash();
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    for (int32_t i=1; i<=SYSTEM_PARAMS_BLOCKS_PER_PAGE; i++)
+    {
+        fill_system_params(&written, i);
+        HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+    }
+    fill_system_params(&torn, 0);
+    set_host_flash_program_limit(BLOCK_WORDS/2);
+    HOST_TEST_CHECK(write_system_params(&torn) != SYSTEM_PARAMS_EC_OK);
+    set_host_flash_program_limit(HOST_FLASH_NO_PROGRAM_LIMIT);
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+    fill_system_params(&written, SYSTEM_PARAMS_BLOCKS_PER_PAGE + 1);
+    HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK(memcmp(&read, &written, sizeof(read)) == 0);
+
+    /* The module is left without data only when every Data Block is corrupted. */
+    init_host_flash();
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    for (int32_t i=1; i<=3; i++)
+    {
+        fill_system_params(&written, i);
+        HOST_TEST_CHECK_EQUAL(write_system_params(&written), SYSTEM_PARAMS_EC_OK);
+        ((uint8_t *) (uintptr_t) (PAGE_1_START_ADDR + (i - 1)*SYSTEM_PARAMS_BLOCK_SIZE))[sizeof(uint32_t)] ^= 0x01;
+    }
+    HOST_TEST_CHECK_EQUAL(init_system_params_module(), SYSTEM_PARAMS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(read_system_params(&read), SYSTEM_PARAMS_EC_NO_DATA);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,139 @@
+/**@file
+ * @brief	Host test of the @ref task_scheduler .
+ *
+ * @details This test runs two tasks on the @ref task_scheduler while it moves the HAL Tick as the executions of those
+ *          tasks would. It checks that the first task given has the highest priority, that a task that is executed
+ *          late keeps its releases from drifting, that a task that overruns by more than one whole period skips and
+ *          counts the releases that it missed, that a task that finishes after its deadline is counted as such, and
+ *          that all of this keeps working across the overflow of the HAL Tick.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions, such as the one of the HAL Tick.
+#include "task_scheduler.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Cooperative Task Scheduler.
+
+#define FAST_TASK_PERIOD        (50)            /**< @brief Period in milliseconds of the fast task. */
+#define FAST_TASK_DEADLINE      (20)            /**< @brief Deadline in milliseconds of the fast task. */
+#define SLOW_TASK_PERIOD        (500)           /**< @brief Period in milliseconds of the slow task. */
+#define SLOW_TASK_DEADLINE      (100)           /**< @brief Deadline in milliseconds of the slow task. */
+#define WRAP_START_TICK         (0xFFFFFF00U)   /**< @brief HAL Tick at which the tasks are released before the HAL Tick overflows. */
+
+static uint32_t executions[2];              /**< @brief Number of times that each task has been executed. */
+static uint32_t execution_time = 0;         /**< @brief Time in milliseconds that the next executed task takes, after which this is reset to zero. */
+
+/**@brief	Records the execution of a task and moves the HAL Tick by the time that it takes.
+ */
+static void execute(uint8_t task)
+{
+    executions[task]++;
+    set_host_hal_tick(HAL_GetTick() + execution_time);
+    execution_time = 0;
+}
+
+/**@brief	Body of the fast task.
+ */
+static void fast_task(void)
+{
+    execute(0);
+}
+
+/**@brief	Body of the slow task.
+ */
+static void slow_task(void)
+{
+    execute(1);
+}
+
+int main(void)
+{
+    task_scheduler_task_t tasks[2] = {
+        {.callback = fast_task, .period = FAST_TASK_PERIOD, .deadline = FAST_TASK_DEADLINE},
+        {.callback = slow_task, .period = SLOW_TASK_PERIOD, .deadline = SLOW_TASK_DEADLINE}
+    };
+    task_scheduler_task_t invalid_task = tasks[0];
+
+    /* The scheduler runs nothing before it is initialized and rejects invalid tasks. */
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_task_scheduler_module(NULL, 1), TASK_SCHEDULER_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_task_scheduler_module(tasks, 0), TASK_SCHEDULER_EC_ERR);
+    invalid_task.deadline = invalid_task.period + 1;
+    HOST_TEST_CHECK_EQUAL(init_task_scheduler_module(&invalid_task, 1), TASK_SCHEDULER_EC_ERR);
+    invalid_task.deadline = 0;
+    HOST_TEST_CHECK_EQUAL(init_task_scheduler_module(&invalid_task, 1), TASK_SCHEDULER_EC_ERR);
+
+    /* Both tasks are released at once and the first one given is executed first. */
+    set_host_hal_tick(1000);
+    HOST_TEST_CHECK_EQUAL(init_task_scheduler_module(tasks, 2), TASK_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(executions[0], 1);
+    HOST_TEST_CHECK_EQUAL(executions[1], 0);
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(executions[1], 1);
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_IDLE);
+
+    /* A task that is executed late, but within its deadline, keeps its next release one period after its previous one. */
+    set_host_hal_tick(1000 + FAST_TASK_PERIOD + 7);
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(tasks[0].next_release_tick, 1000 + 2*FAST_TASK_PERIOD);
+    HOST_TEST_CHECK_EQUAL(tasks[0].deadline_misses, 0);
+    HOST_TEST_CHECK_EQUAL(tasks[0].skipped_releases, 0);
+
+    /* A task that starts after its deadline misses it, even if its execution is short. */
+    set_host_hal_tick(1000 + 2*FAST_TASK_PERIOD + FAST_TASK_DEADLINE + 1);
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(tasks[0].deadline_misses, 1);
+    HOST_TEST_CHECK_EQUAL(tasks[0].next_release_tick, 1000 + 3*FAST_TASK_PERIOD);
+
+    /* A task that overruns by more than one whole period misses its deadline and skips the releases that it missed. */
+    set_host_hal_tick(1000 + 3*FAST_TASK_PERIOD);
+    execution_time = 2*FAST_TASK_PERIOD + 30;
+    HOST_TEST_CHECK_EQUAL(run_task_scheduler(), TASK_SCHEDULER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(tasks[0].max_execution_time, 2*FAST_TASK_PERIOD + 30);
+    HOST_TEST_CHECK_EQUAL(tasks[0].deadline_misses, 2);
+    HOST_TEST_CHECK_EQUAL(tasks[0].skipped_releases, 2);
+    HOST_TEST_CHECK_EQUAL(tasks[0].next_release_tick, 1000 + 6*FAST_TASK_PERIOD);
+
+    /* The following releases of both tasks keep their phase and meet their deadlines. */
+    for (uint32_t tick=HAL_GetTick(); tick<=(1000 + SLOW_TASK_PERIOD); tick++)
+    {
+        set_host_hal_tick(tick);
+        while (run_task_scheduler() == TASK_SCHEDULER_EC_OK)
+        {
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(executions[0], 9);
+    HOST_TEST_CHECK_EQUAL(executions[1], 2);
+    HOST_TEST_CHECK_EQUAL(tasks[0].next_release_tick, 1000 + SLOW_TASK_PERIOD + FAST_TASK_PERIOD);
+    HOST_TEST_CHECK_EQUAL(tasks[1].next_release_tick, 1000 + 2*SLOW_TASK_PERIOD);
+    HOST_TEST_CHECK_EQUAL(tasks[0].deadline_misses, 2);
+    HOST_TEST_CHECK_EQUAL(tasks[0].skipped_releases, 2);
+    HOST_TEST_CHECK_EQUAL(tasks[1].deadline_misses, 0);
+    HOST_TEST_CHECK_EQUAL(tasks[1].skipped_releases, 0);
+
+    /* The releases neither stall nor burst while the HAL Tick overflows. */
+    set_host_hal_tick(WRAP_START_TICK);
+    HOST_TEST_CHECK_EQUAL(init_task_scheduler_module(tasks, 2), TASK_SCHEDULER_EC_OK);
+    executions[0] = 0;
+    executions[1] = 0;
+    for (uint32_t tick=WRAP_START_TICK; tick!=(WRAP_START_TICK + 4*SLOW_TASK_PERIOD); tick++)
+    {
+        set_host_hal_tick(tick);
+        while (run_task_scheduler() == TASK_SCHEDULER_EC_OK)
+        {
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(executions[0], 4*SLOW_TASK_PERIOD/FAST_TASK_PERIOD);
+    HOST_TEST_CHECK_EQUAL(executions[1], 4);
+    HOST_TEST_CHECK_EQUAL(tasks[0].next_release_tick, WRAP_START_TICK + 4*SLOW_TASK_PERIOD);
+    HOST_TEST_CHECK_EQUAL(tasks[1].next_release_tick, WRAP_START_TICK + 4*SLOW_TASK_PERIOD);
+    for (uint8_t i=0; i<2; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(tasks[i].deadline_misses, 0);
+        HOST_TEST_CHECK_EQUAL(tasks[i].skipped_releases, 0);
+    }
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,186 @@
+/**@file
+ * @brief	Host test of the @ref telemetry_archive .
+ *
+ * @details This test archives thousands of records of the @ref telemetry_log into a simulated Flash Memory,
+ *          mounting the @ref telemetry_archive again in between as if our MCU/MPU had been reset, and checks that
+ *          every mount resumes right after the last archived record, that the archive keeps the latest records once
+ *          its ring of pages wraps around while erasing each page once per turn, that corrupted records and pages are
+ *          skipped, that a record that could not be written is archived into the next slot and that a reset while
+ *          erasing the page that follows the latest one loses no archived record but the ones of that page.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <string.h>	// Library from which "memset()" is located at.
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated Flash Memory.
+#include "telemetry_archive.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the Flash Memory Telemetry Archive.
+
+#define RING_RECORDS        (TELEMETRY_ARCHIVE_TOTAL_PAGES*TELEMETRY_ARCHIVE_RECORDS_PER_PAGE)  /**< @brief Number of record slots in the whole ring of pages of the @ref telemetry_archive . */
+#define RESET_PERIOD        (5)     /**< @brief Number of batches after which the module is mounted again, as if our MCU/MPU had been reset. */
+#define READER_ROOM         (30)    /**< @brief Number of records that the simulated reader can take in each read. */
+#define HEADER_SIZE         (8U)    /**< @brief Size in bytes of the header at the start of each page. */
+#define SLOT_SIZE           (sizeof(telemetry_record_t) + 4U)   /**< @brief Size in bytes of each slot of a page, which is a record followed by its 32-bit CRC. */
+#define PAGE_1_START_ADDR   (TELEMETRY_ARCHIVE_START_PAGE*FLASH_PAGE_SIZE_IN_BYTES + FLASH_START_ADDR)  /**< @brief Flash Memory address of the first page of the @ref telemetry_archive . */
+
+static uint32_t next_timestamp = 0; /**< @brief Timestamp of the next record written into the @ref telemetry_log , which is increased by one for each record so that each record can be recognized once it is read back. */
+
+/**@brief	Gets the pointer to the first byte of a page of the @ref telemetry_archive in the simulated Flash Memory.
+ */
+static uint8_t *get_page_bytes(uint32_t page)
+{
+    return (uint8_t *) (uintptr_t) (PAGE_1_START_ADDR + page*FLASH_PAGE_SIZE_IN_BYTES);
+}
+
+/**@brief	Mounts the @ref telemetry_log and the @ref telemetry_archive again, as after a reset of our MCU/MPU.
+ */
+static void reset_archive(void)
+{
+    init_telemetry_log();
+    init_telemetry_archive_module();
+}
+
+/**@brief	Writes some records into the @ref telemetry_log and feeds them into the @ref telemetry_archive .
+ *
+ * @return  The status of the last feed.
+ */
+static Telemetry_Archive_Status archive_records(uint32_t count)
+{
+    for (uint32_t i=0; i<count; i++)
+    {
+        telemetry_record_t record = {.timestamp = next_timestamp, .hot_water_temperature = (int16_t) next_timestamp, .active_faults = (uint16_t) (next_timestamp >> 16)};
+        write_telemetry_record(&record);
+        next_timestamp++;
+    }
+
+    return feed_telemetry_archive();
+}
+
+/**@brief	Reads all the records of the @ref telemetry_archive from a sequence number and checks that their
+ *          timestamps increase, that they were not corrupted and that the reading ends at the next record.
+ *
+ * @return  The number of records that were read. The \p first_timestamp and \p last_timestamp params get the
+ *          timestamps of the first and last records that were read.
+ */
+static uint32_t read_all_records(uint32_t sequence, uint32_t *first_timestamp, uint32_t *last_timestamp)
+{
+    telemetry_record_t records[READER_ROOM];
+    uint32_t total = 0;
+    uint16_t count;
+
+    while ((count = read_telemetry_archive_records(&sequence, records, READER_ROOM)) > 0)
+    {
+        HOST_TEST_CHECK(count <= READER_ROOM);
+        for (uint16_t i=0; i<count; i++)
+        {
+            HOST_TEST_CHECK_EQUAL(records[i].hot_water_temperature, (int16_t) records[i].timestamp);
+            HOST_TEST_CHECK_EQUAL(records[i].active_faults, (uint16_t) (records[i].timestamp >> 16));
+            if (total > 0)
+            {
+                HOST_TEST_CHECK(records[i].timestamp > *last_timestamp);
+            }
+            else
+            {
+                *first_timestamp = records[i].timestamp;
+            }
+            *last_timestamp = records[i].timestamp;
+            total++;
+        }
+    }
+    HOST_TEST_CHECK((total == 0) || (sequence == get_telemetry_archive_next_sequence()));
+
+    return total;
+}
+
+int main(void)
+{
+    uint32_t first_timestamp = 0;
+    uint32_t last_timestamp = 0;
+    uint32_t sequence;
+    uint32_t next_sequence;
+    static const uint32_t interrupted_pages[] = {TELEMETRY_ARCHIVE_TOTAL_PAGES, 4}; // Number of pages filled in the last turn of the ring before the reset, where the first one leaves the first page being erased.
+
+    /* A blank Flash Memory has no records, and nothing is archived until a whole batch is available. */
+    init_host_flash();
+    init_telemetry_log();
+    HOST_TEST_CHECK_EQUAL(init_telemetry_archive_module(), TELEMETRY_ARCHIVE_EC_NO_DATA);
+    HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), 0);
+    HOST_TEST_CHECK_EQUAL(read_all_records(0, &first_timestamp, &last_timestamp), 0);
+    HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS - 1), TELEMETRY_ARCHIVE_EC_NO_DATA);
+    HOST_TEST_CHECK_EQUAL(get_host_flash_erased_pages(), 0);
+
+    /* Each mount resumes right after the last archived record, and the records that are behind by more than one batch are caught up with. */
+    HOST_TEST_CHECK_EQUAL(archive_records(2*TELEMETRY_ARCHIVE_BATCH_RECORDS + 1), TELEMETRY_ARCHIVE_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), 3*TELEMETRY_ARCHIVE_BATCH_RECORDS);
+    for (uint32_t batch=1; get_telemetry_archive_next_sequence()<(3*RING_RECORDS); batch++)
+    {
+        HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS), TELEMETRY_ARCHIVE_EC_OK);
+        if ((batch % RESET_PERIOD) == 0)
+        {
+            next_sequence = get_telemetry_archive_next_sequence();
+            reset_archive();
+            HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), next_sequence);
+        }
+    }
+
+    /* Once the ring has wrapped around, the archive holds the latest records, from the first slot of its oldest page, and each page has been erased once per turn. */
+    next_sequence = get_telemetry_archive_next_sequence();
+    printf("%u archived records erased %u Flash Memory pages.\n", next_sequence, get_host_flash_erased_pages());
+    HOST_TEST_CHECK_EQUAL(get_host_flash_erased_pages(), (next_sequence + TELEMETRY_ARCHIVE_RECORDS_PER_PAGE - 1)/TELEMETRY_ARCHIVE_RECORDS_PER_PAGE);
+    HOST_TEST_CHECK_EQUAL(read_all_records(0, &first_timestamp, &last_timestamp), RING_RECORDS);
+    HOST_TEST_CHECK_EQUAL(last_timestamp, next_timestamp - 1);
+    HOST_TEST_CHECK_EQUAL(last_timestamp - first_timestamp, RING_RECORDS - 1);
+    HOST_TEST_CHECK_EQUAL(read_all_records(next_sequence - 5, &first_timestamp, &last_timestamp), 5);
+    HOST_TEST_CHECK_EQUAL(read_all_records(next_sequence + 5, &first_timestamp, &last_timestamp), 0);
+
+    /* A record whose CRC does not match is skipped. */
+    get_page_bytes(0)[HEADER_SIZE + 3*SLOT_SIZE] ^= 0x01;
+    HOST_TEST_CHECK_EQUAL(read_all_records(0, &first_timestamp, &last_timestamp), RING_RECORDS - 1);
+
+    /* A record that could not be written is archived into the next slot, without losing any record. */
+    init_host_flash();
+    reset_archive();
+    next_timestamp = 0;
+    HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS), TELEMETRY_ARCHIVE_EC_OK);
+    get_page_bytes(0)[HEADER_SIZE + (TELEMETRY_ARCHIVE_BATCH_RECORDS + 2)*SLOT_SIZE + 4] = 0x00;
+    HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS), TELEMETRY_ARCHIVE_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), TELEMETRY_ARCHIVE_BATCH_RECORDS + 3);
+    HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS), TELEMETRY_ARCHIVE_EC_OK);
+    HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS), TELEMETRY_ARCHIVE_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), 3*TELEMETRY_ARCHIVE_BATCH_RECORDS + 3);
+    reset_archive();
+    HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), 3*TELEMETRY_ARCHIVE_BATCH_RECORDS + 3);
+    HOST_TEST_CHECK_EQUAL(read_all_records(0, &first_timestamp, &last_timestamp), 3*TELEMETRY_ARCHIVE_BATCH_RECORDS + 2);
+    HOST_TEST_CHECK_EQUAL(first_timestamp, 0);
+    HOST_TEST_CHECK_EQUAL(last_timestamp, 3*TELEMETRY_ARCHIVE_BATCH_RECORDS + 1);
+
+    /* A reset while erasing the page that follows the latest one, whether that is the first page or not, only loses the oldest records. */
+    for (uint32_t i=0; i<(sizeof(interrupted_pages)/sizeof(interrupted_pages[0])); i++)
+    {
+        uint32_t full_pages = interrupted_pages[i];
+
+        init_host_flash();
+        reset_archive();
+        while (get_telemetry_archive_next_sequence() < (RING_RECORDS + full_pages*TELEMETRY_ARCHIVE_RECORDS_PER_PAGE))
+        {
+            archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS);
+        }
+        next_sequence = get_telemetry_archive_next_sequence();
+        HOST_TEST_CHECK_EQUAL(next_sequence, RING_RECORDS + full_pages*TELEMETRY_ARCHIVE_RECORDS_PER_PAGE);
+        memset(get_page_bytes(full_pages % TELEMETRY_ARCHIVE_TOTAL_PAGES), 0xFF, FLASH_PAGE_SIZE_IN_BYTES/2);
+        reset_archive();
+        HOST_TEST_CHECK_EQUAL(get_telemetry_archive_next_sequence(), next_sequence);
+        HOST_TEST_CHECK_EQUAL(read_all_records(0, &first_timestamp, &last_timestamp), RING_RECORDS - TELEMETRY_ARCHIVE_RECORDS_PER_PAGE);
+        HOST_TEST_CHECK_EQUAL(last_timestamp, next_timestamp - 1);
+
+        /* The next record erases that page again and is appended into it. */
+        sequence = next_sequence;
+        HOST_TEST_CHECK_EQUAL(archive_records(TELEMETRY_ARCHIVE_BATCH_RECORDS), TELEMETRY_ARCHIVE_EC_OK);
+        reset_archive();
+        HOST_TEST_CHECK_EQUAL(read_all_records(sequence, &first_timestamp, &last_timestamp), TELEMETRY_ARCHIVE_BATCH_RECORDS);
+        HOST_TEST_CHECK_EQUAL(first_timestamp, next_timestamp - TELEMETRY_ARCHIVE_BATCH_RECORDS);
+    }
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,101 @@
+/**@file
+ * @brief	Host test of the @ref telemetry_log .
+ *
+ * @details This test writes records into the @ref telemetry_log , as the Sensing Task would, and reads them back as
+ *          the Telemetry readers would. It checks that the records are read in order from any sequence number, that
+ *          the reads are limited by the room of the reader, that nothing is read past the newest record and that a
+ *          reader that fell behind by more than @ref TELEMETRY_LOG_CAPACITY records resumes from the oldest record
+ *          that is still held.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "telemetry_log.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the RAM Telemetry Log.
+
+#define READER_ROOM     (50)    /**< @brief Number of records that the simulated reader can take in each read. */
+
+/**@brief	Writes the records with the next sequence numbers into the @ref telemetry_log , where each record holds its
+ *          own sequence number as its timestamp so that it can be recognized once it is read back.
+ */
+static void write_records(uint32_t *next_sequence, uint32_t count)
+{
+    for (uint32_t i=0; i<count; i++)
+    {
+        telemetry_record_t record = {.timestamp = *next_sequence, .hot_water_temperature = (int16_t) *next_sequence};
+        write_telemetry_record(&record);
+        (*next_sequence)++;
+    }
+}
+
+/**@brief	Reads all the available records from a sequence number and checks that they follow each other.
+ *
+ * @return  The number of records that were read.
+ */
+static uint32_t read_all_records(uint32_t *sequence)
+{
+    telemetry_record_t records[READER_ROOM];
+    uint32_t total = 0;
+    uint16_t count;
+
+    while ((count = read_telemetry_records(sequence, records, READER_ROOM)) > 0)
+    {
+        HOST_TEST_CHECK(count <= READER_ROOM);
+        for (uint16_t i=0; i<count; i++)
+        {
+            HOST_TEST_CHECK_EQUAL(records[i].timestamp, *sequence + i);
+            HOST_TEST_CHECK_EQUAL(records[i].hot_water_temperature, (int16_t) (*sequence + i));
+        }
+        *sequence += count;
+        total += count;
+    }
+
+    return total;
+}
+
+int main(void)
+{
+    telemetry_record_t records[READER_ROOM];
+    uint32_t next_sequence = 0;
+    uint32_t sequence = 0;
+
+    /* An empty log has nothing to read. */
+    init_telemetry_log();
+    HOST_TEST_CHECK_EQUAL(get_telemetry_log_total_records(), 0);
+    HOST_TEST_CHECK_EQUAL(read_telemetry_records(&sequence, records, READER_ROOM), 0);
+    HOST_TEST_CHECK_EQUAL(sequence, 0);
+
+    /* The records are read in order, limited by the room of the reader, and nothing is read past the newest one. */
+    write_records(&next_sequence, 70);
+    HOST_TEST_CHECK_EQUAL(get_telemetry_log_total_records(), 70);
+    HOST_TEST_CHECK_EQUAL(read_telemetry_records(&sequence, records, READER_ROOM), READER_ROOM);
+    HOST_TEST_CHECK_EQUAL(sequence, 0);
+    sequence = 60;
+    HOST_TEST_CHECK_EQUAL(read_telemetry_records(&sequence, records, READER_ROOM), 10);
+    HOST_TEST_CHECK_EQUAL(records[0].timestamp, 60);
+    sequence = 0;
+    HOST_TEST_CHECK_EQUAL(read_all_records(&sequence), 70);
+    HOST_TEST_CHECK_EQUAL(sequence, 70);
+    sequence = 71;
+    HOST_TEST_CHECK_EQUAL(read_telemetry_records(&sequence, records, READER_ROOM), 0);
+    HOST_TEST_CHECK_EQUAL(sequence, 71);
+
+    /* A reader that keeps up reads every record across the wraparound of the ring buffer. */
+    sequence = 70;
+    for (int i=0; i<10; i++)
+    {
+        write_records(&next_sequence, TELEMETRY_LOG_CAPACITY - 1);
+        HOST_TEST_CHECK_EQUAL(read_all_records(&sequence), TELEMETRY_LOG_CAPACITY - 1);
+    }
+    HOST_TEST_CHECK_EQUAL(sequence, next_sequence);
+
+    /* A reader that fell behind resumes from the oldest record that is still held. */
+    write_records(&next_sequence, 3*TELEMETRY_LOG_CAPACITY + 5);
+    HOST_TEST_CHECK_EQUAL(read_telemetry_records(&sequence, records, READER_ROOM), READER_ROOM);
+    HOST_TEST_CHECK_EQUAL(sequence, next_sequence - TELEMETRY_LOG_CAPACITY);
+    HOST_TEST_CHECK_EQUAL(records[0].timestamp, next_sequence - TELEMETRY_LOG_CAPACITY);
+    HOST_TEST_CHECK_EQUAL(read_all_records(&sequence), TELEMETRY_LOG_CAPACITY);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,218 @@
+/**@file
+ * @brief	Host test of the @ref telemetry_stream .
+ *
+ * @details This test runs the @ref telemetry_stream each 100 milliseconds, as the Comms Task would, with samples that
+ *          depend on the HAL Tick at which they are taken, and decodes every frame that is sent through the stubbed
+ *          UART as the host would. It checks that each frame follows the General Data Format of the ETX OTA Packets
+ *          with a valid 32-bit CRC, that its samples are the ones that were due at each sample period, that a full
+ *          frame takes 40 bytes, that a change that does not fit in 8 bits or a missed period closes the frame early,
+ *          that only the latest frame waits for a busy UART and that pausing the stream aborts its transmission.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <string.h>	// Library from which "memcpy()" is located at.
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated Flash Memory.
+#include "crc32_mpeg2.h" // This custom library provides a function to calculate the CRC32/MPEG-2 algorithm.
+#include "telemetry_stream.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the Telemetry Stream.
+
+#define RUN_PERIOD          (100)   /**< @brief Period in milliseconds at which the @ref telemetry_stream is run, as the one of the Comms Task. */
+#define FULL_FRAME_SIZE     (40)    /**< @brief Length in bytes of a frame with @ref TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME samples. */
+
+/**@brief	Frame of the @ref telemetry_stream as decoded by the host.
+ */
+typedef struct
+{
+    uint8_t sequence;                                                           //!< Frame sequence number.
+    uint8_t total_samples;                                                      //!< Number of samples.
+    uint16_t period;                                                            //!< Sample period in milliseconds.
+    uint32_t first_tick;                                                        //!< HAL Tick of the first sample.
+    telemetry_stream_sample_t samples[TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME];  //!< Decoded samples.
+    uint16_t size;                                                              //!< Length in bytes of the whole frame.
+} decoded_frame_t;
+
+static int16_t hot_water_offset = 0;    /**< @brief Offset, in centi-degrees Celsius, added to the Hot Water Temperature of the samples, so that a test can make it jump. */
+
+/**@brief	Gets the sample of the MTKATR001 System at a certain HAL Tick, whose changes from one sample period to the
+ *          next fit in 8 bits.
+ */
+static telemetry_stream_sample_t get_sample(uint32_t tick)
+{
+    uint32_t n = tick/RUN_PERIOD;
+
+    return (telemetry_stream_sample_t) {
+        .cold_water_temperature = (int16_t) (800 + 3*(n % 20)),
+        .hot_water_temperature = (int16_t) (4500 + (((n % 300) < 150) ? (n % 300) : (300 - (n % 300))) + hot_water_offset),
+        .internal_ambient_temperature = (int16_t) (2300 - 10*(n % 7)),
+        .actuators = (uint8_t) (n % 4)
+    };
+}
+
+/**@brief	Decodes the frame that was lastly sent through the UART, checking its General Data Format and its CRC.
+ */
+static void decode_frame(decoded_frame_t *frame)
+{
+    const uint8_t *data = get_host_uart_tx_data(&frame->size);
+    uint16_t data_length;
+    uint32_t crc;
+    uint16_t offset;
+
+    HOST_TEST_CHECK_EQUAL(data[0], 0xAA);
+    HOST_TEST_CHECK_EQUAL(data[1], TELEMETRY_STREAM_PACKET_TYPE);
+    memcpy(&data_length, &data[2], sizeof(uint16_t));
+    HOST_TEST_CHECK_EQUAL(frame->size, data_length + 9);
+    memcpy(&crc, &data[4+data_length], sizeof(uint32_t));
+    HOST_TEST_CHECK_EQUAL(crc, crc32_mpeg2((uint8_t *) &data[4], data_length));
+    HOST_TEST_CHECK_EQUAL(data[8+data_length], 0xBB);
+
+    frame->sequence = data[4];
+    frame->total_samples = data[5];
+    memcpy(&frame->period, &data[6], sizeof(uint16_t));
+    memcpy(&frame->first_tick, &data[8], sizeof(uint32_t));
+    HOST_TEST_CHECK((frame->total_samples > 0) && (frame->total_samples <= TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME));
+    HOST_TEST_CHECK_EQUAL(data_length, 8 + 7 + 4*(frame->total_samples - 1));
+    memcpy(&frame->samples[0].cold_water_temperature, &data[12], sizeof(int16_t));
+    memcpy(&frame->samples[0].hot_water_temperature, &data[14], sizeof(int16_t));
+    memcpy(&frame->samples[0].internal_ambient_temperature, &data[16], sizeof(int16_t));
+    frame->samples[0].actuators = data[18];
+    offset = 19;
+    for (uint8_t i=1; (i<frame->total_samples) && (i<TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME); i++)
+    {
+        frame->samples[i].cold_water_temperature = frame->samples[i-1].cold_water_temperature + (int8_t) data[offset];
+        frame->samples[i].hot_water_temperature = frame->samples[i-1].hot_water_temperature + (int8_t) data[offset+1];
+        frame->samples[i].internal_ambient_temperature = frame->samples[i-1].internal_ambient_temperature + (int8_t) data[offset+2];
+        frame->samples[i].actuators = data[offset+3];
+        offset += 4;
+    }
+}
+
+/**@brief	Checks that the samples of a decoded frame are the ones that were due at each of its sample periods.
+ */
+static void check_frame_samples(const decoded_frame_t *frame, uint16_t period)
+{
+    HOST_TEST_CHECK_EQUAL(frame->period, period);
+    for (uint8_t i=0; i<frame->total_samples; i++)
+    {
+        telemetry_stream_sample_t expected = get_sample(frame->first_tick + i*period);
+        HOST_TEST_CHECK_EQUAL(frame->samples[i].cold_water_temperature, expected.cold_water_temperature);
+        HOST_TEST_CHECK_EQUAL(frame->samples[i].hot_water_temperature, expected.hot_water_temperature);
+        HOST_TEST_CHECK_EQUAL(frame->samples[i].internal_ambient_temperature, expected.internal_ambient_temperature);
+        HOST_TEST_CHECK_EQUAL(frame->samples[i].actuators, expected.actuators);
+    }
+}
+
+/**@brief	Runs the @ref telemetry_stream each @ref RUN_PERIOD milliseconds until a frame is sent or until a timeout.
+ *
+ * @return  1 if a frame was sent, in which case it is decoded into the \p frame param, or 0 otherwise.
+ */
+static uint8_t run_until_frame(uint32_t *tick, uint32_t timeout, decoded_frame_t *frame)
+{
+    uint32_t transmissions = get_host_uart_transmissions();
+
+    for (uint32_t elapsed=0; elapsed<timeout; elapsed+=RUN_PERIOD)
+    {
+        *tick += RUN_PERIOD;
+        telemetry_stream_sample_t sample = get_sample(*tick);
+        run_telemetry_stream(&sample, *tick);
+        if (get_host_uart_transmissions() != transmissions)
+        {
+            decode_frame(frame);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    UART_HandleTypeDef huart = {.gState = HAL_UART_STATE_READY};
+    decoded_frame_t frame;
+    uint32_t tick = 10000;
+    uint8_t sequence;
+
+    /* Invalid parameters are rejected. */
+    HOST_TEST_CHECK_EQUAL(init_telemetry_stream(NULL, TELEMETRY_STREAM_DEFAULT_PERIOD), TELEMETRY_STREAM_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_telemetry_stream(&huart, TELEMETRY_STREAM_MIN_PERIOD - 1), TELEMETRY_STREAM_EC_ERR);
+
+    /* A full frame takes 40 bytes and holds the samples that were due at each sample period, from the first run onwards. */
+    HOST_TEST_CHECK_EQUAL(init_telemetry_stream(&huart, TELEMETRY_STREAM_DEFAULT_PERIOD), TELEMETRY_STREAM_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 1);
+    HOST_TEST_CHECK_EQUAL(frame.size, FULL_FRAME_SIZE);
+    HOST_TEST_CHECK_EQUAL(frame.total_samples, TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    HOST_TEST_CHECK_EQUAL(frame.first_tick, 10000 + RUN_PERIOD);
+    HOST_TEST_CHECK_EQUAL(tick, frame.first_tick + (TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME - 1)*TELEMETRY_STREAM_DEFAULT_PERIOD);
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+    sequence = frame.sequence;
+
+    /* While the UART is busy, only the latest frame waits for it, so the host sees the dropped frame as a gap in the frame sequence numbers. */
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 2*TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 0);
+    complete_host_uart_transmission(&huart);
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, RUN_PERIOD, &frame), 1);
+    HOST_TEST_CHECK_EQUAL(frame.sequence, (uint8_t) (sequence + 2));
+    HOST_TEST_CHECK_EQUAL(frame.total_samples, TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+    complete_host_uart_transmission(&huart);
+
+    /* Frames keep following each other back to back while the UART is free. */
+    for (int i=0; i<20; i++)
+    {
+        sequence = frame.sequence;
+        HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 1);
+        HOST_TEST_CHECK_EQUAL(frame.sequence, (uint8_t) (sequence + 1));
+        HOST_TEST_CHECK_EQUAL(frame.size, FULL_FRAME_SIZE);
+        check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+        complete_host_uart_transmission(&huart);
+    }
+
+    /* A change that does not fit in 8 bits closes the frame, and the next frame starts with the whole sample. */
+    run_until_frame(&tick, 2*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame);
+    hot_water_offset = 200;
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 1);
+    HOST_TEST_CHECK(frame.total_samples < TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    hot_water_offset = 0;
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+    complete_host_uart_transmission(&huart);
+    hot_water_offset = 200;
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 1);
+    HOST_TEST_CHECK_EQUAL(frame.total_samples, TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+    complete_host_uart_transmission(&huart);
+
+    /* A missed sample period closes the frame, so that the samples of every frame are one period apart. */
+    run_until_frame(&tick, 2*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame);
+    tick += 3*TELEMETRY_STREAM_DEFAULT_PERIOD;
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, RUN_PERIOD, &frame), 1);
+    HOST_TEST_CHECK(frame.total_samples < TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+    complete_host_uart_transmission(&huart);
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 1);
+    HOST_TEST_CHECK_EQUAL(tick, frame.first_tick + (TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME - 1)*TELEMETRY_STREAM_DEFAULT_PERIOD);
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+
+    /* Pausing the stream aborts the frame that is being sent and leaves the UART free until it is resumed. */
+    pause_telemetry_stream();
+    HOST_TEST_CHECK_EQUAL(huart.gState, HAL_UART_STATE_READY);
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 0);
+    resume_telemetry_stream();
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*TELEMETRY_STREAM_DEFAULT_PERIOD, &frame), 1);
+    HOST_TEST_CHECK_EQUAL(frame.total_samples, TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    HOST_TEST_CHECK_EQUAL(tick, frame.first_tick + (TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME - 1)*TELEMETRY_STREAM_DEFAULT_PERIOD);
+    check_frame_samples(&frame, TELEMETRY_STREAM_DEFAULT_PERIOD);
+    complete_host_uart_transmission(&huart);
+
+    /* A new sample period starts a new frame, and a zero one stops the stream. */
+    HOST_TEST_CHECK_EQUAL(set_telemetry_stream_period(TELEMETRY_STREAM_MIN_PERIOD - 1), TELEMETRY_STREAM_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(set_telemetry_stream_period(1000), TELEMETRY_STREAM_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_telemetry_stream_period(), 1000);
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*1000, &frame), 1);
+    HOST_TEST_CHECK_EQUAL(frame.total_samples, TELEMETRY_STREAM_MAX_SAMPLES_PER_FRAME);
+    check_frame_samples(&frame, 1000);
+    complete_host_uart_transmission(&huart);
+    HOST_TEST_CHECK_EQUAL(set_telemetry_stream_period(0), TELEMETRY_STREAM_EC_OK);
+    HOST_TEST_CHECK_EQUAL(run_until_frame(&tick, 10*1000, &frame), 0);
+
+    return HOST_TEST_RESULT;
+}
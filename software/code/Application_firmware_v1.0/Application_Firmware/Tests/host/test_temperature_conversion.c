@@ -0,0 +1,148 @@
+/**@file
+ * @brief	Host test of the Fixed-Point conversion, comparison and display of the Temperatures.
+ *
+ * @details This test checks the @ref convert_temp_sensor_adc_value_to_centi_celsius and the
+ *          @ref convert_number_to_5641as_ASCII functions, together with the comparisons of their centi-degrees Celsius
+ *          against whole-degree setpoints that the @ref main module makes, against the Floating-Point formula and
+ *          display conversion that they replaced, for every decimated ADC value and every whole-degree setpoint.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <math.h> // Library from which "fabs()" is located at.
+#include <stdlib.h> // Library from which "abs()" is located at.
+#include "temperature_sensors.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the ADC acquisition layer of the LM35 Temperature Sensors.
+#include "5641as_display_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the 5641AS 7-segment Display Device.
+
+#define MAX_CONVERSION_ERROR                (0.6)   /**< @brief Largest error, in centi-degrees Celsius, that the Fixed-Point conversion may have with respect to the Floating-Point formula. */
+#define FLOAT_MCU_POWER_SUPPLY_VOLTAGE      (3.3)   /**< @brief Power Supply Voltage with which the Floating-Point formula converted the ADC values. */
+#define FLOAT_LM35_VOLTAGE_TO_CELSIUS       (100.0) /**< @brief Constant of the LM35 Temperature Sensor with which the Floating-Point formula converted the ADC values. */
+#define AMBIENT_BAND                        (50)    /**< @brief Half-width, in centi-degrees Celsius, of the band around the Desired Internal Ambient Temperature that the @ref main module compares against. */
+#define NULL_CODE                           (0)     /**< @brief Code of the 5641AS 7-segment Display for an empty character. */
+#define MINUS_CODE                          (45)    /**< @brief Code of the 5641AS 7-segment Display for the minus sign. */
+#define DIGIT_CODE(digit)                   (48 + (digit))  /**< @brief Code of the 5641AS 7-segment Display for a digit. */
+#define DIGIT_DP_CODE(digit)                (256 + (digit)) /**< @brief Code of the 5641AS 7-segment Display for a digit followed by its Dp LED. */
+
+/**@brief	Converts a decimated ADC value into degrees Celsius with the Floating-Point formula that the
+ *          @ref convert_temp_sensor_adc_value_to_centi_celsius function replaced.
+ */
+static float convert_adc_value_to_float_celsius(uint16_t adc_value)
+{
+    float temperature = adc_value;
+    return (temperature*FLOAT_LM35_VOLTAGE_TO_CELSIUS*FLOAT_MCU_POWER_SUPPLY_VOLTAGE) / ((float) TEMP_SENSORS_ADC_MAX_VALUE);
+}
+
+/**@brief	Converts a number into the codes of the 5641AS 7-segment Display with the Floating-Point conversion that
+ *          the @ref convert_number_to_5641as_ASCII function replaced.
+ */
+static int convert_float_to_display_codes(float src, uint16_t *dst)
+{
+    if ((src>=100) || (src<=-10))
+    {
+        return -1;
+    }
+
+    if (src > 0)
+    {
+        uint8_t first_character = src/10;
+        uint8_t second_character = src - (first_character*10);
+        uint8_t third_character = (src - (first_character*10) - (second_character)) * 10;
+        dst[0] = (first_character == 0) ? NULL_CODE : DIGIT_CODE(first_character);
+        dst[1] = DIGIT_DP_CODE(second_character);
+        dst[2] = DIGIT_CODE(third_character);
+    }
+    else if (src == 0)
+    {
+        dst[0] = NULL_CODE;
+        dst[1] = DIGIT_DP_CODE(0);
+        dst[2] = DIGIT_CODE(0);
+    }
+    else
+    {
+        uint8_t second_character = (-1)*src;
+        uint8_t third_character = ((src*-1) - second_character) * 10;
+        dst[0] = MINUS_CODE;
+        dst[1] = DIGIT_DP_CODE(second_character);
+        dst[2] = DIGIT_CODE(third_character);
+    }
+
+    return 0;
+}
+
+/**@brief	Decodes the codes of the 5641AS 7-segment Display back into the number of tenths that they show.
+ */
+static int32_t decode_display_codes(const uint16_t *dst)
+{
+    int32_t tens = ((dst[0] == NULL_CODE) || (dst[0] == MINUS_CODE)) ? 0 : (dst[0] - DIGIT_CODE(0));
+    int32_t tenths = tens*100 + (dst[1] - DIGIT_DP_CODE(0))*10 + (dst[2] - DIGIT_CODE(0));
+    return (dst[0] == MINUS_CODE) ? -tenths : tenths;
+}
+
+int main(void)
+{
+    double max_error = 0;
+    uint16_t fixed_codes[DISPLAY_5641AS_CHARACTERS_SIZE];
+    uint16_t float_codes[DISPLAY_5641AS_CHARACTERS_SIZE];
+
+    for (uint32_t adc_value=0; adc_value<=TEMP_SENSORS_ADC_MAX_VALUE; adc_value++)
+    {
+        int32_t temperature = convert_temp_sensor_adc_value_to_centi_celsius(adc_value);
+        float float_temperature = convert_adc_value_to_float_celsius(adc_value);
+        double exact_temperature = (adc_value*100.0*FLOAT_LM35_VOLTAGE_TO_CELSIUS*FLOAT_MCU_POWER_SUPPLY_VOLTAGE) / TEMP_SENSORS_ADC_MAX_VALUE;
+
+        /* The conversion stays within its error bound, both against the exact and the Floating-Point formula. */
+        double error = fabs(temperature - float_temperature*100.0);
+        if (error > max_error)
+        {
+            max_error = error;
+        }
+        HOST_TEST_CHECK(error <= MAX_CONVERSION_ERROR);
+        HOST_TEST_CHECK(fabs(temperature - exact_temperature) <= MAX_CONVERSION_ERROR);
+
+        /* Each comparison against a whole-degree setpoint agrees with the Floating-Point one, except within the error bound. */
+        for (int32_t setpoint=0; setpoint<100; setpoint++)
+        {
+            double distance = fabs(float_temperature*100.0 - setpoint*100.0);
+            if ((temperature >= setpoint*100) != (float_temperature >= (float) setpoint))
+            {
+                HOST_TEST_CHECK(distance <= MAX_CONVERSION_ERROR);
+            }
+            distance = fabs(float_temperature*100.0 - (setpoint*100.0 - AMBIENT_BAND));
+            if ((temperature >= (setpoint*100 - AMBIENT_BAND)) != (float_temperature >= (((float) setpoint) - 0.5)))
+            {
+                HOST_TEST_CHECK(distance <= MAX_CONVERSION_ERROR);
+            }
+        }
+
+        /* The display truncates the centi-degrees to tenths and differs from the Floating-Point one by one tenth at most. */
+        if (temperature < 10000)
+        {
+            HOST_TEST_CHECK_EQUAL(convert_number_to_5641as_ASCII(temperature, fixed_codes), Display_5641AS_EC_OK);
+            HOST_TEST_CHECK_EQUAL(convert_float_to_display_codes(float_temperature, float_codes), 0);
+            HOST_TEST_CHECK_EQUAL(decode_display_codes(fixed_codes), temperature/10);
+            HOST_TEST_CHECK(abs(decode_display_codes(fixed_codes) - decode_display_codes(float_codes)) <= 1);
+        }
+    }
+    printf("Largest conversion error: %.3f centi-degrees Celsius.\n", max_error);
+
+    /* The display of every whole number matches the Floating-Point one exactly. */
+    for (int32_t number=-9; number<100; number++)
+    {
+        HOST_TEST_CHECK_EQUAL(convert_number_to_5641as_ASCII(number*100, fixed_codes), Display_5641AS_EC_OK);
+        HOST_TEST_CHECK_EQUAL(convert_float_to_display_codes((float) number, float_codes), 0);
+        for (int i=0; i<3; i++)
+        {
+            HOST_TEST_CHECK_EQUAL(fixed_codes[i], float_codes[i]);
+        }
+    }
+
+    /* The numbers that do not fit in the display are rejected. */
+    HOST_TEST_CHECK_EQUAL(convert_number_to_5641as_ASCII(10000, fixed_codes), Display_5641AS_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(convert_number_to_5641as_ASCII(-1000, fixed_codes), Display_5641AS_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(convert_number_to_5641as_ASCII(9999, fixed_codes), Display_5641AS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(decode_display_codes(fixed_codes), 999);
+
+    return HOST_TEST_RESULT;
+}
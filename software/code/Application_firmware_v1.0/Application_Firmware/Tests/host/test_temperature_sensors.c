@@ -0,0 +1,135 @@
+/**@file
+ * @brief	Host test of the @ref temp_sensors .
+ *
+ * @details This test writes into the Circular DMA buffer of the @ref temp_sensors the Scans that the ADC would convert
+ *          for known Temperatures at several ADC supply voltages (VDDA), with the noise of a few LSBs that makes the
+ *          Oversampling work, and then calls the DMA callbacks as the DMA Interrupts would. It checks that the
+ *          published Temperatures do not depend on the VDDA thanks to the VREFINT compensation, that the measured VDDA
+ *          is published, that Scans with an invalid VREFINT conversion are used uncompensated and that an ADC error
+ *          is reported until the conversions are restarted.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <math.h> // Library from which "lround()" and "fabs()" are located at.
+#include <stdlib.h> // Library from which "abs()" is located at.
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated Flash Memory.
+#include "temperature_sensors.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the ADC acquisition layer of the LM35 Temperature Sensors.
+
+#define MAX_COMPENSATED_ERROR   (10)    /**< @brief Largest error, in centi-degrees Celsius, allowed for the published Temperatures at any valid VDDA. */
+#define MAX_VDDA_ERROR          (5)     /**< @brief Largest error, in millivolts, allowed for the published VDDA. */
+#define NOISE_LSBS              (2)     /**< @brief Amplitude, in LSBs of the 12-bit ADC, of the noise added to each conversion. */
+
+/**@brief	Temperatures, in centi-degrees Celsius, of the Cold Water, Hot Water and Internal Ambient Temperature Sensors.
+ */
+static const int32_t temperatures[TEMP_SENSORS_TOTAL_CHANNELS] = {812, 5037, 2496};
+
+/**@brief	Converts a voltage into the raw 12-bit ADC value that it stands for at a certain VDDA, plus some noise.
+ */
+static uint16_t convert_millivolts_to_raw_adc_value(double millivolts, double vdda_millivolts, int32_t noise)
+{
+    long value = lround(millivolts*4095.0/vdda_millivolts) + noise;
+    return (uint16_t) ((value < 0) ? 0 : ((value > 4095) ? 4095 : value));
+}
+
+/**@brief	Writes one block of Scans into the Circular DMA buffer, as the ADC would at a certain VDDA, and calls the
+ *          DMA callback of that block.
+ */
+static void convert_block(ADC_HandleTypeDef *hadc, uint8_t is_second_block, double vdda_millivolts, uint8_t is_vrefint_valid)
+{
+    uint32_t length;
+    uint16_t *buffer = get_host_adc_dma_buffer(&length);
+    uint16_t *block = &buffer[is_second_block ? (length/2) : 0];
+
+    HOST_TEST_CHECK_EQUAL(length, 2*TEMP_SENSORS_OVERSAMPLING_RATIO*TEMP_SENSORS_ADC_TOTAL_CHANNELS);
+    for (uint32_t scan=0; scan<TEMP_SENSORS_OVERSAMPLING_RATIO; scan++)
+    {
+        int32_t noise = ((int32_t) ((scan*7) % (2*NOISE_LSBS + 1))) - NOISE_LSBS;
+        for (uint32_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+        {
+            block[scan*TEMP_SENSORS_ADC_TOTAL_CHANNELS + i] = convert_millivolts_to_raw_adc_value(temperatures[i]/((double) TEMP_SENSORS_LM35_CENTI_CELSIUS_PER_MILLIVOLT), vdda_millivolts, noise);
+        }
+        block[scan*TEMP_SENSORS_ADC_TOTAL_CHANNELS + TEMP_SENSORS_TOTAL_CHANNELS] = is_vrefint_valid ? convert_millivolts_to_raw_adc_value(TEMP_SENSORS_VREFINT_MILLIVOLTS, vdda_millivolts, 0) : 0;
+    }
+    if (is_second_block)
+    {
+        HAL_ADC_ConvCpltCallback(hadc);
+    }
+    else
+    {
+        HAL_ADC_ConvHalfCpltCallback(hadc);
+    }
+}
+
+int main(void)
+{
+    ADC_HandleTypeDef hadc = {.Instance = ADC1};
+    ADC_HandleTypeDef other_hadc = {.Instance = ADC2};
+    TIM_HandleTypeDef htim = {0};
+    sensor_filter_config_t filter_configs[TEMP_SENSORS_TOTAL_CHANNELS];
+    temp_sensors_sample_t sample;
+    static const double vdda_values[] = {2700, 3000, 3300, 3500};
+    uint32_t expected_sequence = 0;
+
+    /* The filters pass the decimated samples through, so that each block can be checked on its own. */
+    for (uint32_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+    {
+        filter_configs[i] = (sensor_filter_config_t) {.median_window = 1, .cutoff_frequency = 0, .sample_rate = TEMP_SENSORS_SAMPLE_RATE};
+    }
+    HOST_TEST_CHECK_EQUAL(get_temp_sensors_status(), TEMP_SENSORS_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_temp_sensors_module(&hadc, &htim, TIM_CHANNEL_1, filter_configs), TEMP_SENSORS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_temp_sensors_status(), TEMP_SENSORS_EC_OK);
+
+    /* The published Temperatures and VDDA match the actual ones at any valid VDDA, from either block of Scans. */
+    for (uint32_t v=0; v<(sizeof(vdda_values)/sizeof(vdda_values[0])); v++)
+    {
+        for (uint8_t is_second_block=0; is_second_block<=1; is_second_block++)
+        {
+            set_host_hal_tick(1000*v + 10*is_second_block);
+            convert_block(&hadc, is_second_block, vdda_values[v], 1);
+            get_temp_sensors_sample(&sample);
+            HOST_TEST_CHECK_EQUAL(sample.sequence, ++expected_sequence);
+            HOST_TEST_CHECK_EQUAL(sample.timestamp, 1000*v + 10*is_second_block);
+            HOST_TEST_CHECK(fabs(sample.vdda_millivolts - vdda_values[v]) <= MAX_VDDA_ERROR);
+            for (uint32_t i=0; i<TEMP_SENSORS_TOTAL_CHANNELS; i++)
+            {
+                int32_t temperature = convert_temp_sensor_adc_value_to_centi_celsius(sample.adc_values[i]);
+                HOST_TEST_CHECK_EQUAL(get_temp_sensor_adc_value(i), sample.adc_values[i]);
+                HOST_TEST_CHECK(abs(temperature - temperatures[i]) <= MAX_COMPENSATED_ERROR);
+                if (is_second_block)
+                {
+                    printf("VDDA of %.0f mV (published %u mV): sensor %u reads %d for %d centi-degrees Celsius.\n", vdda_values[v], sample.vdda_millivolts, i, temperature, temperatures[i]);
+                }
+            }
+        }
+    }
+
+    /* Scans with an invalid VREFINT conversion are used uncompensated, so they are only right at the nominal VDDA. */
+    convert_block(&hadc, 0, TEMP_SENSORS_NOMINAL_VDDA_MILLIVOLTS, 0);
+    get_temp_sensors_sample(&sample);
+    HOST_TEST_CHECK_EQUAL(sample.vdda_millivolts, 0);
+    HOST_TEST_CHECK(abs(convert_temp_sensor_adc_value_to_centi_celsius(sample.adc_values[HOT_WATER_TEMP_SENSOR]) - temperatures[HOT_WATER_TEMP_SENSOR]) <= MAX_COMPENSATED_ERROR);
+    convert_block(&hadc, 1, 3000, 0);
+    get_temp_sensors_sample(&sample);
+    HOST_TEST_CHECK(abs(convert_temp_sensor_adc_value_to_centi_celsius(sample.adc_values[HOT_WATER_TEMP_SENSOR]) - temperatures[HOT_WATER_TEMP_SENSOR]*3300/3000) <= MAX_COMPENSATED_ERROR);
+
+    /* The callbacks of other ADCs are ignored. */
+    expected_sequence = sample.sequence;
+    HAL_ADC_ConvCpltCallback(&other_hadc);
+    HAL_ADC_ErrorCallback(&other_hadc);
+    get_temp_sensors_sample(&sample);
+    HOST_TEST_CHECK_EQUAL(sample.sequence, expected_sequence);
+    HOST_TEST_CHECK_EQUAL(get_temp_sensors_status(), TEMP_SENSORS_EC_OK);
+
+    /* An ADC error is reported until the conversions are restarted, and a self-calibration keeps them running. */
+    HAL_ADC_ErrorCallback(&hadc);
+    HOST_TEST_CHECK_EQUAL(get_temp_sensors_status(), TEMP_SENSORS_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(restart_temp_sensors_module(), TEMP_SENSORS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_temp_sensors_status(), TEMP_SENSORS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(calibrate_temp_sensors_adc(), TEMP_SENSORS_EC_OK);
+    HOST_TEST_CHECK_EQUAL(get_temp_sensors_status(), TEMP_SENSORS_EC_OK);
+
+    return HOST_TEST_RESULT;
+}
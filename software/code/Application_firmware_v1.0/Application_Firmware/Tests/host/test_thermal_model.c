@@ -0,0 +1,133 @@
+/**@file
+ * @brief	Host test of the @ref thermal_model .
+ *
+ * @details This test feeds the @ref thermal_model , with the configuration and at the Control Task period of the
+ *          @ref main module, with the noisy Internal Ambient Temperature of simulated First-Order-Plus-Dead-Time
+ *          enclosures whose Fans are switched between heating, cooling and off at pseudo-random times. It checks that,
+ *          for time constants from 10 to 40 minutes and dead times from 0 to 60 seconds, the identified gain and time
+ *          constant converge to the ones of each enclosure within ten percent, the dead time within one sample and
+ *          the equilibrium temperature within a few tenths of a degree, and that the resulting SIMC gains are close to
+ *          the ones of the actual enclosure.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include <math.h> // Library from which "exp()" and "fabs()" are located at.
+#include <stdlib.h> // Library from which "abs()" is located at.
+#include "thermal_model.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as an online RLS identifier of a First-Order-Plus-Dead-Time model of a thermal process.
+
+#define CONTROL_PERIOD          (500)       /**< @brief Period in milliseconds at which the @ref thermal_model is run, as the one of the Control Task. */
+#define SAMPLE_PERIOD           (10000)     /**< @brief Sample period in milliseconds of the @ref thermal_model , as in the @ref main module. */
+#define PLANT_GAIN              (0.15)      /**< @brief Steady-state gain of the simulated enclosures, in centi-degrees Celsius per centi-percent of Fan Duty Cycle. */
+#define PLANT_EQUILIBRIUM       (2000.0)    /**< @brief Internal Ambient Temperature, in centi-degrees Celsius, at which the simulated enclosures settle with the Fans off. */
+#define FAN_OUTPUT              (6000)      /**< @brief Output, in centi-percent of Fan Duty Cycle, that is applied to the Hot or Cold Fan while exciting the enclosure. */
+#define NOISE_CENTI_CELSIUS     (3)         /**< @brief Amplitude, in centi-degrees Celsius, of the noise of the filtered Internal Ambient Temperature. */
+#define IDENTIFICATION_TIME     (8*3600000U) /**< @brief Time in milliseconds during which each enclosure is identified. */
+#define MAX_RELATIVE_ERROR      (0.10)      /**< @brief Largest relative error allowed for the identified gain and time constant. */
+#define MAX_GAINS_ERROR         (0.20)      /**< @brief Largest relative error allowed for the SIMC gains of the identified model, which also depend on its dead time and thus on the sample period. */
+#define MAX_EQUILIBRIUM_ERROR   (30)        /**< @brief Largest error, in centi-degrees Celsius, allowed for the identified equilibrium temperature. */
+
+/**@brief	Simulated First-Order-Plus-Dead-Time enclosure.
+ */
+typedef struct
+{
+    double time_constant;           //!< Time constant in seconds.
+    uint32_t dead_time;             //!< Dead time in seconds.
+    double temperature;             //!< Current Internal Ambient Temperature in centi-degrees Celsius.
+    int32_t delayed_inputs[128];    //!< Inputs that have not reached the enclosure yet, one per Control Task period.
+    uint32_t delayed_index;         //!< Index of the oldest input in @ref delayed_inputs .
+} plant_t;
+
+static uint32_t random_state = 12345;   /**< @brief State of the pseudo-random generator of the test, so that every run is the same. */
+
+/**@brief	Gets the next pseudo-random number of the test.
+ */
+static uint32_t get_random(void)
+{
+    random_state = random_state*1103515245U + 12345U;
+    return (random_state >> 16) & 0x7FFF;
+}
+
+/**@brief	Advances a simulated enclosure by one Control Task period with a new input and gets its new noisy
+ *          Internal Ambient Temperature.
+ */
+static int32_t run_plant(plant_t *plant, int32_t input)
+{
+    uint32_t delay = plant->dead_time*1000/CONTROL_PERIOD;
+    int32_t delayed_input;
+
+    plant->delayed_inputs[(plant->delayed_index + delay) % 128] = input;
+    delayed_input = plant->delayed_inputs[plant->delayed_index];
+    plant->delayed_index = (plant->delayed_index + 1) % 128;
+    plant->temperature += (PLANT_EQUILIBRIUM + PLANT_GAIN*delayed_input - plant->temperature) * (1.0 - exp(-(CONTROL_PERIOD/1000.0)/plant->time_constant));
+
+    return (int32_t) lround(plant->temperature) + (int32_t) (get_random() % (2*NOISE_CENTI_CELSIUS + 1)) - NOISE_CENTI_CELSIUS;
+}
+
+int main(void)
+{
+    thermal_model_config_t config = {.sample_period = SAMPLE_PERIOD, .forgetting_factor = 65208, .min_samples = 180, .measurement_scale = 100, .input_scale = 10000};
+    static const double time_constants[] = {600, 1200, 1800, 2400};
+    static const uint32_t dead_times[] = {0, 20, 45, 60};
+    thermal_model_t model;
+    thermal_model_estimate_t estimate = {0};
+    int32_t kp;
+    int32_t ki;
+
+    /* Invalid configurations are rejected. */
+    thermal_model_config_t invalid_config = config;
+    invalid_config.sample_period = 0;
+    HOST_TEST_CHECK_EQUAL(init_thermal_model(&model, &invalid_config), THERMAL_MODEL_EC_ERR);
+    invalid_config = config;
+    invalid_config.input_scale = 0;
+    HOST_TEST_CHECK_EQUAL(init_thermal_model(&model, &invalid_config), THERMAL_MODEL_EC_ERR);
+
+    for (uint32_t i=0; i<(sizeof(time_constants)/sizeof(time_constants[0])); i++)
+    {
+        plant_t plant = {.time_constant = time_constants[i], .dead_time = dead_times[i], .temperature = PLANT_EQUILIBRIUM};
+        int32_t input = 0;
+        uint32_t next_switch_tick = 0;
+        double expected_kp;
+        double expected_ki;
+
+        /* The model has no data until its minimum number of samples has been taken. */
+        HOST_TEST_CHECK_EQUAL(init_thermal_model(&model, &config), THERMAL_MODEL_EC_OK);
+        for (uint32_t tick=0; tick<IDENTIFICATION_TIME; tick+=CONTROL_PERIOD)
+        {
+            if (tick >= next_switch_tick)
+            {
+                input = ((int32_t) (get_random() % 3) - 1)*FAN_OUTPUT;
+                next_switch_tick = tick + (2 + get_random() % 14)*60000;
+            }
+            run_thermal_model(&model, run_plant(&plant, input), input, tick);
+            if (tick == ((config.min_samples - 1)*SAMPLE_PERIOD))
+            {
+                HOST_TEST_CHECK_EQUAL(get_thermal_model_estimate(&model, &estimate), THERMAL_MODEL_EC_NO_DATA);
+            }
+        }
+
+        /* The identified model matches the enclosure. */
+        HOST_TEST_CHECK_EQUAL(get_thermal_model_estimate(&model, &estimate), THERMAL_MODEL_EC_OK);
+        printf("Tau of %.0f s and dead time of %u s: K = %.4f, tau = %.0f s, dead time = %u s and equilibrium of %d, from %u samples.\n",
+               time_constants[i], dead_times[i], estimate.gain/65536.0, estimate.time_constant/1000.0, estimate.dead_time/1000, estimate.equilibrium, estimate.samples);
+        HOST_TEST_CHECK(fabs(estimate.gain/65536.0 - PLANT_GAIN) <= (MAX_RELATIVE_ERROR*PLANT_GAIN));
+        HOST_TEST_CHECK(fabs(estimate.time_constant/1000.0 - time_constants[i]) <= (MAX_RELATIVE_ERROR*time_constants[i]));
+        HOST_TEST_CHECK(abs((int32_t) estimate.dead_time - (int32_t) (dead_times[i]*1000)) <= SAMPLE_PERIOD);
+        HOST_TEST_CHECK(abs(estimate.equilibrium - (int32_t) PLANT_EQUILIBRIUM) <= MAX_EQUILIBRIUM_ERROR);
+
+        /* The SIMC gains of the model are close to the ones of the enclosure, with a closed-loop time constant of five minutes. */
+        HOST_TEST_CHECK_EQUAL(calculate_thermal_model_pid_gains(&estimate, 300000, &kp, &ki), THERMAL_MODEL_EC_OK);
+        expected_kp = time_constants[i]/(PLANT_GAIN*(300 + dead_times[i]));
+        expected_ki = expected_kp/fmin(time_constants[i], 4*(300 + dead_times[i]));
+        HOST_TEST_CHECK(fabs(kp/65536.0 - expected_kp) <= (MAX_GAINS_ERROR*expected_kp));
+        HOST_TEST_CHECK(fabs(ki/65536.0 - expected_ki) <= (MAX_GAINS_ERROR*expected_ki));
+    }
+
+    /* Models whose gain is not positive give no gains. */
+    estimate.gain = 0;
+    HOST_TEST_CHECK_EQUAL(calculate_thermal_model_pid_gains(&estimate, 60000, &kp, &ki), THERMAL_MODEL_EC_ERR);
+
+    return HOST_TEST_RESULT;
+}
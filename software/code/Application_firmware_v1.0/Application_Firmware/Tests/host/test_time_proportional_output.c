@@ -0,0 +1,130 @@
+/**@file
+ * @brief	Host test of the @ref time_proportional_output .
+ *
+ * @details This test checks that the @ref time_proportional_output latches the Duty Cycle at the start of each window
+ *          and skips the On and Off times shorter than the allowed ones, and then closes the loop of the Hot Water
+ *          Temperature PID Controller, with the gains, window and minimum times of the @ref main module, around a
+ *          simulated water tank whose Water Heating Resistor lags behind its relay. It checks that the water is held
+ *          close to its setpoint and that the relay is never kept in a state for less than its minimum times.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "pid_controller.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Fixed-Point PID Controller.
+#include "time_proportional_output.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a Time-Proportional Output.
+
+#define CONTROL_PERIOD              (500)   /**< @brief Period in milliseconds at which the output is run, as the one of the Control Task. */
+#define WINDOW_TIME                 (10000) /**< @brief Length in milliseconds of each window, as the one of the Water Heating Resistor. */
+#define MIN_SWITCH_TIME             (1000)  /**< @brief Shortest On and Off times in milliseconds, as the ones of the Water Heating Resistor. */
+#define HOT_WATER_PID_KP            (10L << PID_CONTROLLER_Q16_SHIFT)       /**< @brief Proportional gain of the Hot Water Temperature PID Controller. */
+#define HOT_WATER_PID_KI            ((1L << PID_CONTROLLER_Q16_SHIFT)/50)   /**< @brief Integral gain of the Hot Water Temperature PID Controller. */
+#define SETPOINT                    (5000)  /**< @brief Hot Water Temperature setpoint, in centi-degrees Celsius, as the default one. */
+#define OUTSIDE_TEMPERATURE         (2000.0)    /**< @brief Temperature, in centi-degrees Celsius, to which the simulated water settles with the heater Off. */
+#define HEATER_RISE                 (8000.0)    /**< @brief Temperature rise, in centi-degrees Celsius, at which the simulated water settles with the heater always On. */
+#define TANK_TIME_CONSTANT          (1800.0)    /**< @brief Time constant in seconds of the simulated water tank. */
+#define HEATER_TIME_CONSTANT        (20.0)      /**< @brief Time constant in seconds with which the simulated heater follows its relay. */
+#define MAX_REGULATION_ERROR        (10)    /**< @brief Largest error, in centi-degrees Celsius, allowed around the setpoint once settled. */
+
+int main(void)
+{
+    time_proportional_output_t tpo;
+    time_proportional_output_config_t config = {.window = WINDOW_TIME, .min_on_time = MIN_SWITCH_TIME, .min_off_time = MIN_SWITCH_TIME};
+    uint32_t tick = 0;
+    uint32_t on_periods = 0;
+
+    /* Invalid configurations are rejected. */
+    time_proportional_output_config_t invalid_config = config;
+    invalid_config.window = 0;
+    HOST_TEST_CHECK_EQUAL(init_time_proportional_output(&tpo, &invalid_config, tick), TIME_PROPORTIONAL_OUTPUT_EC_ERR);
+    invalid_config = config;
+    invalid_config.min_off_time = WINDOW_TIME;
+    HOST_TEST_CHECK_EQUAL(init_time_proportional_output(&tpo, &invalid_config, tick), TIME_PROPORTIONAL_OUTPUT_EC_ERR);
+
+    /* The output starts Off and a Duty Cycle only applies from the next window on. */
+    HOST_TEST_CHECK_EQUAL(init_time_proportional_output(&tpo, &config, tick), TIME_PROPORTIONAL_OUTPUT_EC_OK);
+    set_time_proportional_output_duty_cycle(&tpo, 3000);
+    for (; tick<WINDOW_TIME; tick+=CONTROL_PERIOD)
+    {
+        HOST_TEST_CHECK_EQUAL(run_time_proportional_output(&tpo, tick), 0);
+    }
+
+    /* A window is On during its Duty Cycle, even if the Duty Cycle is changed in the middle of it. */
+    for (; tick<2*WINDOW_TIME; tick+=CONTROL_PERIOD)
+    {
+        on_periods += run_time_proportional_output(&tpo, tick);
+        set_time_proportional_output_duty_cycle(&tpo, 7000);
+    }
+    HOST_TEST_CHECK_EQUAL(on_periods*CONTROL_PERIOD, 3*WINDOW_TIME/10);
+
+    /* The next window applies the latest Duty Cycle. */
+    for (on_periods=0; tick<3*WINDOW_TIME; tick+=CONTROL_PERIOD)
+    {
+        on_periods += run_time_proportional_output(&tpo, tick);
+    }
+    HOST_TEST_CHECK_EQUAL(on_periods*CONTROL_PERIOD, 7*WINDOW_TIME/10);
+
+    /* Too short On times are skipped and too short Off times keep the actuator On during the whole window. */
+    set_time_proportional_output_duty_cycle(&tpo, 500);
+    for (on_periods=0; tick<4*WINDOW_TIME; tick+=CONTROL_PERIOD)
+    {
+        on_periods += run_time_proportional_output(&tpo, tick);
+    }
+    HOST_TEST_CHECK_EQUAL(on_periods, 0);
+    set_time_proportional_output_duty_cycle(&tpo, 9500);
+    run_time_proportional_output(&tpo, tick);
+    for (tick+=CONTROL_PERIOD, on_periods=0; tick<6*WINDOW_TIME; tick+=CONTROL_PERIOD)
+    {
+        on_periods += run_time_proportional_output(&tpo, tick);
+    }
+    HOST_TEST_CHECK_EQUAL(on_periods*CONTROL_PERIOD, 2*WINDOW_TIME - CONTROL_PERIOD);
+
+    /* Duty Cycles outside of their range are limited to it and a reset turns the actuator Off at once. */
+    set_time_proportional_output_duty_cycle(&tpo, -100);
+    HOST_TEST_CHECK_EQUAL(tpo.duty_cycle, 0);
+    set_time_proportional_output_duty_cycle(&tpo, TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE + 1);
+    HOST_TEST_CHECK_EQUAL(tpo.duty_cycle, TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE);
+    reset_time_proportional_output(&tpo, tick);
+    HOST_TEST_CHECK_EQUAL(run_time_proportional_output(&tpo, tick), 0);
+
+    /* The Hot Water Temperature PID Controller holds the simulated water at its setpoint through the relay. */
+    pid_controller_t pid;
+    pid_controller_config_t pid_config = {.kp = HOT_WATER_PID_KP, .ki = HOT_WATER_PID_KI, .kd = 0, .sample_period = CONTROL_PERIOD, .output_min = 0, .output_max = TIME_PROPORTIONAL_OUTPUT_MAX_DUTY_CYCLE};
+    double water_temperature = OUTSIDE_TEMPERATURE;
+    double heater_power = 0;
+    double lowest_temperature = 1e9;
+    double highest_temperature = -1e9;
+    uint32_t shortest_run = UINT32_MAX;
+    uint32_t run_start_tick = 0;
+    uint8_t is_on = 0;
+    HOST_TEST_CHECK_EQUAL(init_pid_controller(&pid, &pid_config), PID_CONTROLLER_EC_OK);
+    HOST_TEST_CHECK_EQUAL(init_time_proportional_output(&tpo, &config, 0), TIME_PROPORTIONAL_OUTPUT_EC_OK);
+    for (tick=0; tick<(6*3600000); tick+=CONTROL_PERIOD)
+    {
+        set_time_proportional_output_duty_cycle(&tpo, run_pid_controller(&pid, SETPOINT, (int32_t) water_temperature));
+        uint8_t should_be_on = run_time_proportional_output(&tpo, tick);
+        if (should_be_on != is_on)
+        {
+            if ((tick > 0) && ((tick - run_start_tick) < shortest_run))
+            {
+                shortest_run = tick - run_start_tick;
+            }
+            is_on = should_be_on;
+            run_start_tick = tick;
+        }
+        heater_power += ((is_on - heater_power) * (CONTROL_PERIOD/1000.0)) / HEATER_TIME_CONSTANT;
+        water_temperature += ((OUTSIDE_TEMPERATURE + HEATER_RISE*heater_power - water_temperature) * (CONTROL_PERIOD/1000.0)) / TANK_TIME_CONSTANT;
+        if (tick >= (4*3600000))
+        {
+            lowest_temperature = (water_temperature < lowest_temperature) ? water_temperature : lowest_temperature;
+            highest_temperature = (water_temperature > highest_temperature) ? water_temperature : highest_temperature;
+        }
+    }
+    printf("Hot Water held between %.1f and %.1f centi-degrees Celsius (setpoint of %d), shortest relay run of %u ms.\n", lowest_temperature, highest_temperature, SETPOINT, shortest_run);
+    HOST_TEST_CHECK(lowest_temperature >= (SETPOINT - MAX_REGULATION_ERROR));
+    HOST_TEST_CHECK(highest_temperature <= (SETPOINT + MAX_REGULATION_ERROR));
+    HOST_TEST_CHECK(shortest_run >= MIN_SWITCH_TIME);
+
+    return HOST_TEST_RESULT;
+}
@@ -0,0 +1,160 @@
+/**@file
+ * @brief	Host test of the @ref watchdog_supervisor .
+ *
+ * @details This test supervises two tasks, with the periods and deadlines of the Sensing and Control Tasks of the
+ *          @ref main module, on simulated IWDG and RCC registers. It checks that the IWDG is reloaded only once every
+ *          task has checked in since the previous reload, that a task is late only once more than its period plus its
+ *          deadline has elapsed since its previous check-in, that the reload is withheld while any task is late, and
+ *          that after a reset the cause of that reset, the task that was late and the task that lastly checked in are
+ *          reported and the reset counters are only cleared by a Power-On reset. It also checks that a refresh reloads
+ *          the IWDG right away unless some task is late.
+ *
+ * @author 	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 16, 2026.
+ */
+
+#include "host_test.h"
+#include "hal_stubs.h" // This host library contains the stubs of the HAL functions and the simulated registers of the IWDG and the RCC.
+#include "watchdog_supervisor.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as a supervisor of the tasks of the Cooperative Task Scheduler via the Independent Watchdog.
+
+#define SENSING_TASK            (0)         /**< @brief Index of the simulated Sensing Task. */
+#define CONTROL_TASK            (1)         /**< @brief Index of the simulated Control Task. */
+#define CONTROL_TASK_WINDOW     (500 + 100) /**< @brief Check-in window, in milliseconds, of the simulated Control Task. */
+#define WATCHDOG_TIMEOUT        (3000)      /**< @brief IWDG timeout in milliseconds, as in the @ref main module. */
+#define IWDG_KEY_RELOAD         (0xAAAAU)   /**< @brief Key that reloads the counter of the IWDG. */
+
+/**@brief	Dummy body of the supervised tasks, which are never run by this test.
+ */
+static void dummy_task(void)
+{
+}
+
+/**@brief	Gets whether the IWDG has been reloaded since this function was lastly called.
+ */
+static uint8_t is_iwdg_reloaded(void)
+{
+    uint8_t is_reloaded = (IWDG->KR == IWDG_KEY_RELOAD);
+
+    IWDG->KR = 0;
+    return is_reloaded;
+}
+
+/**@brief	Initializes the @ref watchdog_supervisor as if our MCU/MPU had just been reset with the given reset flags.
+ */
+static void reset_and_init(const task_scheduler_task_t *tasks, uint32_t reset_flags, watchdog_supervisor_reset_info_t *info)
+{
+    RCC->CSR = reset_flags;
+    HOST_TEST_CHECK_EQUAL(init_watchdog_supervisor(tasks, 2, WATCHDOG_TIMEOUT), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(RCC->CSR & RCC_CSR_RMVF);
+    HOST_TEST_CHECK(is_iwdg_reloaded());
+    get_watchdog_supervisor_reset_info(info);
+}
+
+int main(void)
+{
+    task_scheduler_task_t tasks[2] = {
+        {.callback = dummy_task, .period = 50, .deadline = 20},
+        {.callback = dummy_task, .period = 500, .deadline = 100}
+    };
+    watchdog_supervisor_reset_info_t info;
+    uint32_t tick = 1000;
+
+    init_host_peripheral_registers();
+    set_host_hal_tick(tick);
+
+    /* The supervisor does nothing before it is initialized and rejects invalid parameters. */
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(refresh_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_watchdog_supervisor(NULL, 2, WATCHDOG_TIMEOUT), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_watchdog_supervisor(tasks, 0, WATCHDOG_TIMEOUT), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_watchdog_supervisor(tasks, 2, WATCHDOG_SUPERVISOR_MAX_TIMEOUT + 1), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(init_watchdog_supervisor(tasks, 2, CONTROL_TASK_WINDOW), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK_EQUAL(IWDG->KR, 0);
+
+    /* A Power-On reset is reported as such and the IWDG is started with the requested timeout. */
+    reset_and_init(tasks, RCC_CSR_PORRSTF | RCC_CSR_PINRSTF, &info);
+    HOST_TEST_CHECK_EQUAL(info.cause, RESET_CAUSE_POWER_ON);
+    HOST_TEST_CHECK_EQUAL(info.late_task, WATCHDOG_SUPERVISOR_NO_TASK);
+    HOST_TEST_CHECK_EQUAL(info.last_checked_in_task, WATCHDOG_SUPERVISOR_NO_TASK);
+    HOST_TEST_CHECK_EQUAL(info.total_resets, 1);
+    HOST_TEST_CHECK_EQUAL(info.watchdog_resets, 0);
+    HOST_TEST_CHECK_EQUAL(IWDG->PR, 4);
+    HOST_TEST_CHECK_EQUAL(IWDG->RLR, WATCHDOG_TIMEOUT*(WATCHDOG_SUPERVISOR_LSI_FREQUENCY/64)/1000);
+    HOST_TEST_CHECK(DBGMCU->CR & DBGMCU_CR_DBG_IWDG_STOP);
+
+    /* The IWDG is reloaded only once every task has checked in since its previous reload. */
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(!is_iwdg_reloaded());
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(!is_iwdg_reloaded());
+    watchdog_supervisor_check_in(CONTROL_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(is_iwdg_reloaded());
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(!is_iwdg_reloaded());
+
+    /* A task that stops checking in is tolerated until its window elapses, after which the reload is withheld even if every other task keeps checking in. */
+    for (uint32_t elapsed=50; elapsed<=CONTROL_TASK_WINDOW; elapsed+=50)
+    {
+        set_host_hal_tick(tick + elapsed);
+        watchdog_supervisor_check_in(SENSING_TASK);
+        HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    }
+    set_host_hal_tick(tick + CONTROL_TASK_WINDOW + 1);
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK(!is_iwdg_reloaded());
+
+    /* A late task that checks in again within the IWDG timeout lets the IWDG be reloaded again. */
+    tick += CONTROL_TASK_WINDOW + 50;
+    set_host_hal_tick(tick);
+    watchdog_supervisor_check_in(CONTROL_TASK);
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(is_iwdg_reloaded());
+
+    /* A refresh reloads the IWDG without waiting for the check-ins, but never while a task is late. */
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(refresh_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(is_iwdg_reloaded());
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(!is_iwdg_reloaded());
+    set_host_hal_tick(tick + CONTROL_TASK_WINDOW + 1);
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(refresh_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_ERR);
+    HOST_TEST_CHECK(!is_iwdg_reloaded());
+    watchdog_supervisor_check_in(CONTROL_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_OK);
+    HOST_TEST_CHECK(is_iwdg_reloaded());
+    tick += CONTROL_TASK_WINDOW + 1;
+
+    /* After the IWDG resets our MCU/MPU, the task that was late and the one that lastly checked in are reported. */
+    set_host_hal_tick(tick + CONTROL_TASK_WINDOW + 1);
+    watchdog_supervisor_check_in(SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(run_watchdog_supervisor(), WATCHDOG_SUPERVISOR_EC_ERR);
+    reset_and_init(tasks, RCC_CSR_IWDGRSTF | RCC_CSR_PINRSTF, &info);
+    HOST_TEST_CHECK_EQUAL(info.cause, RESET_CAUSE_INDEPENDENT_WATCHDOG);
+    HOST_TEST_CHECK_EQUAL(info.late_task, CONTROL_TASK);
+    HOST_TEST_CHECK_EQUAL(info.last_checked_in_task, SENSING_TASK);
+    HOST_TEST_CHECK_EQUAL(info.total_resets, 2);
+    HOST_TEST_CHECK_EQUAL(info.watchdog_resets, 1);
+
+    /* A software reset keeps the reset counters and reports no late task. */
+    watchdog_supervisor_check_in(CONTROL_TASK);
+    reset_and_init(tasks, RCC_CSR_SFTRSTF | RCC_CSR_PINRSTF, &info);
+    HOST_TEST_CHECK_EQUAL(info.cause, RESET_CAUSE_SOFTWARE);
+    HOST_TEST_CHECK_EQUAL(info.late_task, WATCHDOG_SUPERVISOR_NO_TASK);
+    HOST_TEST_CHECK_EQUAL(info.last_checked_in_task, CONTROL_TASK);
+    HOST_TEST_CHECK_EQUAL(info.total_resets, 3);
+    HOST_TEST_CHECK_EQUAL(info.watchdog_resets, 1);
+
+    /* A Power-On reset clears the reset counters. */
+    reset_and_init(tasks, RCC_CSR_PORRSTF | RCC_CSR_PINRSTF, &info);
+    HOST_TEST_CHECK_EQUAL(info.cause, RESET_CAUSE_POWER_ON);
+    HOST_TEST_CHECK_EQUAL(info.total_resets, 1);
+    HOST_TEST_CHECK_EQUAL(info.watchdog_resets, 0);
+
+    return HOST_TEST_RESULT;
+}
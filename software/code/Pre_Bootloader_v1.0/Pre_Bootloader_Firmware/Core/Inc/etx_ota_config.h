@@ -70,7 +70,7 @@
 #endif
 
 #ifndef ETX_APP_FLASH_PAGES_SIZE
-#define ETX_APP_FLASH_PAGES_SIZE 			(88U)   			/**< @brief Designated Flash Memory pages for the Application Firmware of our MCU/MPU. */
+#define ETX_APP_FLASH_PAGES_SIZE 			(62U)   			/**< @brief Designated Flash Memory pages for the Application Firmware of our MCU/MPU. @note The 26 Flash Memory pages that follow them (i.e., from 0x08017800 up to 0x0801DFFF) are used by the Telemetry Archive and the Temperature Sensors Calibration modules of the Application Firmware, so they must not be erased whenever a new Application Firmware Image is installed. */
 #endif
 
 /** @} */ //default_etx_ota_firmware_update_settings